@@ -0,0 +1,154 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/utils.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+using optionx::utils::AsyncLogLevel;
+
+constexpr std::size_t kTicks = 4096;
+
+struct Tick {
+    std::string symbol;
+    double bid = 0.0;
+    double ask = 0.0;
+    std::int64_t time_ms = 0;
+};
+
+struct Bar {
+    double open = 0.0;
+    double high = 0.0;
+    double low = 0.0;
+    double close = 0.0;
+    std::uint64_t volume = 0;
+};
+
+enum class LogMode {
+    OFF,
+    SYNC,
+    ASYNC,
+    LEVEL_DISABLED
+};
+
+/// Stand-in for a LOGIT file/console sink: appends under a mutex.
+class MemorySink {
+public:
+    void write(const std::string& line) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_buffer += line;
+        m_buffer.push_back('\n');
+        if (m_buffer.size() > (1u << 20)) m_buffer.clear();
+        ++m_lines;
+    }
+
+    std::uint64_t lines() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_lines;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::string m_buffer;
+    std::uint64_t m_lines = 0;
+};
+
+const std::vector<Tick>& ticks() {
+    static const auto s_ticks = []() {
+        const char* symbols[] = {"EURUSD", "GBPUSD", "USDJPY", "BTCUSDT"};
+        std::vector<Tick> out(kTicks);
+        double price = 1.08;
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            price += (i % 7 == 0 ? -0.00003 : 0.00001);
+            out[i] = {symbols[i % 4], price, price + 0.00002, 1718000000000 + static_cast<std::int64_t>(i)};
+        }
+        return out;
+    }();
+    return s_ticks;
+}
+
+void on_tick(const Tick& tick, Bar& bar, LogMode mode, MemorySink& sink) {
+    if (bar.volume == 0) bar.open = tick.bid;
+    bar.high = std::max(bar.high, tick.bid);
+    bar.low = bar.volume == 0 ? tick.bid : std::min(bar.low, tick.bid);
+    bar.close = tick.bid;
+    ++bar.volume;
+    switch (mode) {
+        case LogMode::OFF:
+            break;
+        case LogMode::SYNC:
+            sink.write(optionx::utils::format(
+                "tick %s bid=%.5f ask=%.5f time=%lld volume=%llu",
+                tick.symbol.c_str(), tick.bid, tick.ask,
+                static_cast<long long>(tick.time_ms),
+                static_cast<unsigned long long>(bar.volume)));
+            break;
+        case LogMode::ASYNC:
+        case LogMode::LEVEL_DISABLED:
+            OPTIONX_ASYNC_LOG_DEBUG("tick %s bid=%.5f ask=%.5f time=%lld volume=%llu",
+                tick.symbol, tick.bid, tick.ask, tick.time_ms, bar.volume);
+            break;
+    }
+}
+
+/// Bar update on every tick with the given logging mode; the async worker is
+/// stopped after the timed loop, so the counters include every record.
+void run_tick_path(BenchmarkState& state, LogMode mode) {
+    auto& logger = optionx::utils::AsyncLogger::instance();
+    const auto& data = ticks();
+    MemorySink sink;
+    logger.set_handler([&sink](AsyncLogLevel, std::int64_t, const std::string& message) {
+        sink.write(message);
+    });
+    if (mode == LogMode::ASYNC || mode == LogMode::LEVEL_DISABLED) {
+        optionx::utils::AsyncLogConfig config;
+        config.ring_capacity = 1u << 16;
+        config.min_level = mode == LogMode::ASYNC ? AsyncLogLevel::DEBUG : AsyncLogLevel::INFO;
+        logger.start(config);
+    }
+    const auto dropped_before = logger.dropped();
+
+    Bar bar;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        on_tick(data[i++ % kTicks], bar, mode, sink);
+    }
+
+    logger.stop();
+    logger.set_level(optionx::utils::AsyncLogConfig().min_level);
+    logger.set_handler(nullptr);
+    const auto logged = sink.lines();
+    const auto dropped = logger.dropped() - dropped_before;
+    if (bar.volume != state.iterations()) state.fail("tick path skipped ticks");
+    if (mode == LogMode::SYNC || mode == LogMode::ASYNC) {
+        if (logged + dropped != state.iterations()) state.fail("log records were lost");
+    } else if (logged != 0) {
+        state.fail("disabled logging produced records");
+    }
+    state.set_items_processed(state.iterations());
+    state.set_counter("dropped", static_cast<double>(dropped));
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK(async_log_tick_off, "async_log/tick_path/off") {
+    run_tick_path(state, LogMode::OFF);
+}
+
+OPTIONX_BENCHMARK(async_log_tick_sync, "async_log/tick_path/sync_format") {
+    run_tick_path(state, LogMode::SYNC);
+}
+
+OPTIONX_BENCHMARK(async_log_tick_async, "async_log/tick_path/async") {
+    run_tick_path(state, LogMode::ASYNC);
+}
+
+OPTIONX_BENCHMARK(async_log_tick_level_disabled, "async_log/tick_path/level_disabled") {
+    run_tick_path(state, LogMode::LEVEL_DISABLED);
+}
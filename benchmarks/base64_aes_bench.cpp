@@ -0,0 +1,204 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/utils.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+using optionx::utils::Base64;
+
+/// Typical session blobs: short tokens, cookie sets and serialized auth JSON.
+std::string make_blob(std::size_t size) {
+    std::string blob(size, '\0');
+    std::uint32_t state = 0x12345678u;
+    for (auto& ch : blob) {
+        state = state * 1664525u + 1013904223u;
+        ch = static_cast<char>(state >> 24);
+    }
+    return blob;
+}
+
+/// Previous scalar codec: per-character appends without reservation.
+std::string reference_encode(const std::string& input) {
+    static const char alphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string output;
+    for (std::size_t i = 0; i < input.size(); i += 3) {
+        std::uint32_t buffer = 0;
+        const std::size_t remaining = std::min<std::size_t>(3, input.size() - i);
+        for (std::size_t j = 0; j < remaining; ++j) {
+            buffer |= static_cast<std::uint8_t>(input[i + j]) << (16 - j * 8);
+        }
+        for (std::size_t j = 0; j < 4; ++j) {
+            output += j < remaining + 1 ? alphabet[(buffer >> (18 - j * 6)) & 0x3F] : '=';
+        }
+    }
+    return output;
+}
+
+std::string reference_decode(const std::string& input) {
+    std::string output;
+    std::uint32_t buffer = 0;
+    std::size_t bits = 0;
+    for (char c : input) {
+        if (c == '=') break;
+        int value = -1;
+        if (c >= 'A' && c <= 'Z') value = c - 'A';
+        else if (c >= 'a' && c <= 'z') value = c - 'a' + 26;
+        else if (c >= '0' && c <= '9') value = c - '0' + 52;
+        else if (c == '+') value = 62;
+        else if (c == '/') value = 63;
+        if (value < 0) throw std::invalid_argument("Invalid Base64 input.");
+        buffer = (buffer << 6) | static_cast<std::uint32_t>(value);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            output += static_cast<char>((buffer >> bits) & 0xFF);
+        }
+    }
+    return output;
+}
+
+bool check_codec(BenchmarkState& state, const std::string& blob) {
+    const auto encoded = Base64::encode(blob);
+    if (encoded != reference_encode(blob) || Base64::decode(encoded) != blob) {
+        state.fail("Base64 codec disagrees with the scalar reference");
+        return false;
+    }
+    return true;
+}
+
+void run_reference_encode(BenchmarkState& state, std::size_t size) {
+    const auto blob = make_blob(size);
+    std::size_t sink = 0;
+    for (auto _ : state) {
+        sink += reference_encode(blob).size();
+    }
+    optionx::benchmarks::do_not_optimize(sink);
+    state.set_items_processed(state.iterations() * size);
+}
+
+void run_encode(BenchmarkState& state, std::size_t size) {
+    const auto blob = make_blob(size);
+    if (!check_codec(state, blob)) return;
+    std::string text;
+    for (auto _ : state) {
+        Base64::encode_to(blob.data(), blob.size(), text);
+        optionx::benchmarks::do_not_optimize(text);
+    }
+    state.set_items_processed(state.iterations() * size);
+    state.set_counter("simd_level", static_cast<double>(optionx::utils::base64_detail::simd_level()));
+}
+
+void run_reference_decode(BenchmarkState& state, std::size_t size) {
+    const auto encoded = Base64::encode(make_blob(size));
+    std::size_t sink = 0;
+    for (auto _ : state) {
+        sink += reference_decode(encoded).size();
+    }
+    optionx::benchmarks::do_not_optimize(sink);
+    state.set_items_processed(state.iterations() * size);
+}
+
+void run_decode(BenchmarkState& state, std::size_t size) {
+    const auto blob = make_blob(size);
+    if (!check_codec(state, blob)) return;
+    const auto encoded = Base64::encode(blob);
+    std::string bytes;
+    for (auto _ : state) {
+        Base64::decode_to(encoded.data(), encoded.size(), bytes);
+        optionx::benchmarks::do_not_optimize(bytes);
+    }
+    state.set_items_processed(state.iterations() * size);
+}
+
+optionx::crypto::AESCrypt& aes() {
+    static optionx::crypto::AESCrypt s_aes(optionx::crypto::AesMode::CBC_256);
+    static const bool s_keyed = s_aes.set_key(s_aes.generate_key());
+    (void)s_keyed;
+    return s_aes;
+}
+
+/// Session blob round trip: encrypt, Base64 encode, decode, decrypt.
+void run_aes_allocating(BenchmarkState& state, std::size_t size) {
+    auto& crypt = aes();
+    const auto blob = make_blob(size);
+    std::string decrypted;
+    for (auto _ : state) {
+        decrypted = crypt.decrypt(Base64::decode(Base64::encode(crypt.encrypt(blob))));
+    }
+    if (decrypted != blob) state.fail("AES round trip changed the blob");
+    state.set_items_processed(state.iterations() * size);
+}
+
+void run_aes_reuse(BenchmarkState& state, std::size_t size) {
+    auto& crypt = aes();
+    const auto blob = make_blob(size);
+    std::string encrypted;
+    std::string text;
+    std::string decoded;
+    std::string decrypted;
+    for (auto _ : state) {
+        crypt.encrypt_into(blob, encrypted);
+        Base64::encode_to(encrypted.data(), encrypted.size(), text);
+        Base64::decode_to(text.data(), text.size(), decoded);
+        crypt.decrypt_into(decoded, decrypted);
+    }
+    if (decrypted != blob) state.fail("AES round trip changed the blob");
+    state.set_items_processed(state.iterations() * size);
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK(base64_reference_encode_48, "base64/reference_encode/bytes:48") {
+    run_reference_encode(state, 48);
+}
+
+OPTIONX_BENCHMARK(base64_encode_48, "base64/encode/bytes:48") {
+    run_encode(state, 48);
+}
+
+OPTIONX_BENCHMARK(base64_reference_encode_4096, "base64/reference_encode/bytes:4096") {
+    run_reference_encode(state, 4096);
+}
+
+OPTIONX_BENCHMARK(base64_encode_4096, "base64/encode/bytes:4096") {
+    run_encode(state, 4096);
+}
+
+OPTIONX_BENCHMARK(base64_reference_decode_48, "base64/reference_decode/bytes:48") {
+    run_reference_decode(state, 48);
+}
+
+OPTIONX_BENCHMARK(base64_decode_48, "base64/decode/bytes:48") {
+    run_decode(state, 48);
+}
+
+OPTIONX_BENCHMARK(base64_reference_decode_4096, "base64/reference_decode/bytes:4096") {
+    run_reference_decode(state, 4096);
+}
+
+OPTIONX_BENCHMARK(base64_decode_4096, "base64/decode/bytes:4096") {
+    run_decode(state, 4096);
+}
+
+OPTIONX_BENCHMARK(aes_roundtrip_allocating_256, "aes_base64/roundtrip_allocating/bytes:256") {
+    run_aes_allocating(state, 256);
+}
+
+OPTIONX_BENCHMARK(aes_roundtrip_reuse_256, "aes_base64/roundtrip_reuse/bytes:256") {
+    run_aes_reuse(state, 256);
+}
+
+OPTIONX_BENCHMARK(aes_roundtrip_allocating_4096, "aes_base64/roundtrip_allocating/bytes:4096") {
+    run_aes_allocating(state, 4096);
+}
+
+OPTIONX_BENCHMARK(aes_roundtrip_reuse_4096, "aes_base64/roundtrip_reuse/bytes:4096") {
+    run_aes_reuse(state, 4096);
+}
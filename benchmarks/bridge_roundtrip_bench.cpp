@@ -0,0 +1,178 @@
+#include "common/BenchmarkHarness.hpp"
+#include "common/StandIns.hpp"
+
+#include <optionx_cpp/bridges.hpp>
+
+#include <client_http.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+namespace proto = optionx::bridges::protocol_v1;
+using HttpClient = SimpleWeb::Client<SimpleWeb::HTTP>;
+
+proto::BridgeProtocolServerConfig bench_config() {
+    proto::BridgeProtocolServerConfig config;
+    config.bridge_id = 3;
+    config.address = "127.0.0.1";
+    config.http_port = 0;
+    config.websocket_port = 0;
+    config.enable_websocket = false;
+    config.secret = "bench-secret";
+    config.request_body_limit = 8192;
+    config.dedupe_cache_size = 64;
+    return config;
+}
+
+nlohmann::json trade_open(const std::string& id, const std::string& idempotency_key) {
+    return nlohmann::json{
+        {"jsonrpc", "2.0"},
+        {"id", id},
+        {"method", "trade.open"},
+        {"params", {
+            {"context", {
+                {"idempotency_key", idempotency_key},
+                {"valid_until_ms", time_shield::timestamp_ms() + 600000}
+            }},
+            {"routing", {
+                {"selector", {
+                    {"kind", "account"},
+                    {"account_id", "99"}
+                }}
+            }},
+            {"identity", {
+                {"unique_hash", "bench"},
+                {"signal_name", "bench"}
+            }},
+            {"trade", {
+                {"symbol", "EURUSD"},
+                {"order_type", "BUY"},
+                {"option_type", "SPRINT"},
+                {"amount", {
+                    {"value", "1.00"},
+                    {"currency", "USD"}
+                }},
+                {"expiry", {
+                    {"kind", "duration"},
+                    {"duration_ms", 60000}
+                }}
+            }}
+        }}
+    };
+}
+
+/// Runs a protocol v1 HTTP bridge on a loopback port with an in-process signal sink.
+class LoopbackBridge {
+public:
+    std::atomic<std::uint64_t> signals{0};
+
+    LoopbackBridge()
+        : m_config(bench_config()) {
+        m_bridge.configure(std::make_unique<proto::BridgeProtocolServerConfig>(m_config));
+        m_bridge.on_signal_id() = [this]() {
+            return static_cast<optionx::SignalId>(m_next_signal_id.fetch_add(1));
+        };
+        m_bridge.on_trade_signal() = [this](std::unique_ptr<optionx::TradeSignal>) {
+            signals.fetch_add(1);
+        };
+        auto account = std::make_shared<optionx::benchmarks::BenchAccountInfo>();
+        account->user_id = 99;
+        m_bridge.update_account_info(optionx::AccountInfoUpdate(
+            account,
+            optionx::AccountUpdateStatus::BALANCE_UPDATED,
+            123));
+        m_bridge.run();
+        for (int i = 0; i < 500 && m_bridge.bound_http_port() == 0; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        if (m_bridge.bound_http_port() != 0) {
+            m_client = std::make_unique<HttpClient>(
+                m_config.address + ":" + std::to_string(m_bridge.bound_http_port()));
+            m_headers.emplace("Content-Type", "application/json");
+            m_headers.emplace("X-OptionX-Secret", m_config.secret);
+        }
+    }
+
+    ~LoopbackBridge() {
+        m_client.reset();
+        m_bridge.shutdown();
+    }
+
+    bool ready() const noexcept {
+        return static_cast<bool>(m_client);
+    }
+
+    /// Posts one command and parses the JSON-RPC response.
+    nlohmann::json post(const nlohmann::json& request) {
+        const auto response = m_client->request("POST", m_config.command_path, request.dump(-1), m_headers);
+        return nlohmann::json::parse(response->content.string());
+    }
+
+private:
+    proto::BridgeProtocolServerConfig m_config;
+    proto::BridgeProtocolServerBridge m_bridge;
+    std::atomic<std::int64_t> m_next_signal_id{1};
+    std::unique_ptr<HttpClient> m_client;
+    SimpleWeb::CaseInsensitiveMultimap m_headers;
+};
+
+} // namespace
+
+OPTIONX_BENCHMARK_MAX(bridge_http_hello, "bridge_protocol_v1/http_roundtrip/protocol.hello", 50000) {
+    LoopbackBridge bridge;
+    if (!bridge.ready()) {
+        state.fail("bridge did not bind a loopback port");
+        return;
+    }
+    const nlohmann::json hello{
+        {"jsonrpc", "2.0"},
+        {"id", "hello"},
+        {"method", "protocol.hello"},
+        {"params", nlohmann::json::object()}
+    };
+
+    std::uint64_t ok = 0;
+    for (auto _ : state) {
+        const auto response = bridge.post(hello);
+        ok += response.contains("result") ? 1 : 0;
+    }
+    if (ok != state.iterations()) state.fail("protocol.hello returned an error");
+    state.set_items_processed(ok);
+}
+
+OPTIONX_BENCHMARK_MAX(bridge_http_trade_open, "bridge_protocol_v1/http_roundtrip/trade.open", 50000) {
+    LoopbackBridge bridge;
+    if (!bridge.ready()) {
+        state.fail("bridge did not bind a loopback port");
+        return;
+    }
+
+    // Requests are prepared up front so the loop measures transport, parsing,
+    // validation, dedupe and dispatch rather than JSON construction.
+    std::vector<nlohmann::json> requests;
+    requests.reserve(static_cast<std::size_t>(state.iterations()));
+    for (std::uint64_t i = 0; i < state.iterations(); ++i) {
+        const auto key = std::to_string(i);
+        requests.push_back(trade_open("trade-" + key, "bench-idem-" + key));
+    }
+
+    std::uint64_t accepted = 0;
+    std::size_t next = 0;
+    for (auto _ : state) {
+        const auto response = bridge.post(requests[next++]);
+        const auto* result = response.contains("result") ? &response.at("result") : nullptr;
+        accepted += result && result->value("status", std::string()) == "accepted" ? 1 : 0;
+    }
+    if (accepted != state.iterations() || bridge.signals.load() != accepted) {
+        state.fail("trade.open was not accepted for every request");
+    }
+    state.set_items_processed(accepted);
+}
@@ -0,0 +1,429 @@
+#pragma once
+#ifndef OPTIONX_BENCHMARKS_COMMON_BENCHMARK_HARNESS_HPP_INCLUDED
+#define OPTIONX_BENCHMARKS_COMMON_BENCHMARK_HARNESS_HPP_INCLUDED
+
+/// \file BenchmarkHarness.hpp
+/// \brief Minimal microbenchmark harness used by the `optionx_benchmarks` target.
+///
+/// Benchmarks register themselves with OPTIONX_BENCHMARK and iterate over
+/// BenchmarkState. The runner calibrates the iteration count until one run
+/// takes at least the configured minimum time, repeats the run and reports
+/// the median. Results are printed as a table on stderr and as JSON on
+/// stdout or into a file, so CI can diff them between revisions.
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace optionx::benchmarks {
+
+    /// \brief Prevents the compiler from discarding a computed value.
+    /// \param value Value that must be treated as observed.
+    template<class T>
+    inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r"(&value) : "memory");
+#else
+        static const void* volatile sink = nullptr;
+        sink = static_cast<const void*>(&value);
+        (void)sink;
+#endif
+    }
+
+    /// \class BenchmarkState
+    /// \brief Iteration driver and timer passed to every benchmark body.
+    ///
+    /// The body must iterate with `for (auto _ : state)`; the timer runs from
+    /// the first iteration until the loop ends. Setup that must stay outside
+    /// the measurement can be wrapped in pause_timing()/resume_timing().
+    class BenchmarkState {
+    public:
+        using clock_t = std::chrono::steady_clock;
+
+        /// \brief Creates a state for a fixed number of iterations.
+        /// \param iterations Number of loop iterations to run.
+        explicit BenchmarkState(std::uint64_t iterations)
+            : m_iterations(iterations) {}
+
+        /// \brief Loop variable type; non-trivial so `for (auto _ : state)` does not warn.
+        struct Value {
+            Value() noexcept {}
+            ~Value() {}
+        };
+
+        class iterator {
+        public:
+            iterator(BenchmarkState* state, std::uint64_t remaining)
+                : m_state(state), m_remaining(remaining) {}
+
+            Value operator*() const noexcept { return Value(); }
+
+            iterator& operator++() noexcept {
+                --m_remaining;
+                return *this;
+            }
+
+            bool operator!=(const iterator&) {
+                if (m_remaining != 0) return true;
+                m_state->stop();
+                return false;
+            }
+
+        private:
+            BenchmarkState* m_state;
+            std::uint64_t   m_remaining;
+        };
+
+        iterator begin() {
+            m_elapsed = clock_t::duration::zero();
+            m_running = true;
+            m_started = clock_t::now();
+            return iterator(this, m_iterations);
+        }
+
+        iterator end() {
+            return iterator(this, 0);
+        }
+
+        /// \brief Returns the number of iterations of this run.
+        std::uint64_t iterations() const noexcept {
+            return m_iterations;
+        }
+
+        /// \brief Stops the timer until resume_timing() is called.
+        void pause_timing() {
+            if (!m_running) return;
+            m_elapsed += clock_t::now() - m_started;
+            m_running = false;
+        }
+
+        /// \brief Restarts the timer after pause_timing().
+        void resume_timing() {
+            if (m_running) return;
+            m_started = clock_t::now();
+            m_running = true;
+        }
+
+        /// \brief Sets the number of processed items for throughput reporting.
+        /// \param items Total items handled by all iterations of this run.
+        void set_items_processed(std::uint64_t items) noexcept {
+            m_items = items;
+        }
+
+        /// \brief Records a scenario-specific value reported next to the timings.
+        /// \param name Counter name.
+        /// \param value Counter value of the last run.
+        void set_counter(const std::string& name, double value) {
+            m_counters[name] = value;
+        }
+
+        /// \brief Marks the run as failed; the runner reports the message and a non-zero exit code.
+        /// \param message Failure description.
+        void fail(std::string message) {
+            if (m_error.empty()) m_error = std::move(message);
+        }
+
+        /// \brief Returns measured time in nanoseconds.
+        double elapsed_ns() const noexcept {
+            return std::chrono::duration<double, std::nano>(m_elapsed).count();
+        }
+
+        std::uint64_t items_processed() const noexcept { return m_items; }
+        const std::map<std::string, double>& counters() const noexcept { return m_counters; }
+        const std::string& error() const noexcept { return m_error; }
+
+    private:
+        std::uint64_t m_iterations = 0;
+        std::uint64_t m_items = 0;
+        clock_t::time_point m_started{};
+        clock_t::duration m_elapsed = clock_t::duration::zero();
+        bool m_running = false;
+        std::map<std::string, double> m_counters;
+        std::string m_error;
+
+        void stop() {
+            pause_timing();
+        }
+    };
+
+    /// \brief Benchmark body signature.
+    using benchmark_fn_t = std::function<void(BenchmarkState&)>;
+
+    /// \struct BenchmarkEntry
+    /// \brief Registered benchmark.
+    struct BenchmarkEntry {
+        std::string    name;           ///< Unique name, `<scenario>/<case>`.
+        benchmark_fn_t fn;             ///< Benchmark body.
+        std::uint64_t  max_iterations; ///< Upper bound for calibration; 0 means unlimited.
+    };
+
+    /// \brief Returns the process-wide benchmark registry.
+    inline std::vector<BenchmarkEntry>& registry() {
+        static std::vector<BenchmarkEntry> entries;
+        return entries;
+    }
+
+    /// \struct BenchmarkRegistrar
+    /// \brief Adds a benchmark to the registry during static initialization.
+    struct BenchmarkRegistrar {
+        BenchmarkRegistrar(std::string name, benchmark_fn_t fn, std::uint64_t max_iterations = 0) {
+            registry().push_back(BenchmarkEntry{std::move(name), std::move(fn), max_iterations});
+        }
+    };
+
+    /// \struct BenchmarkOptions
+    /// \brief Command-line options of the benchmark runner.
+    struct BenchmarkOptions {
+        std::string   filter;            ///< Substring a benchmark name must contain.
+        std::string   json_path;         ///< JSON output file; empty writes JSON to stdout.
+        double        min_time_ms = 200; ///< Minimum duration of a calibrated run.
+        std::uint32_t repetitions = 3;   ///< Measured runs per benchmark; the median is reported.
+        bool          list_only = false; ///< Print registered names and exit.
+    };
+
+    /// \struct BenchmarkResult
+    /// \brief Aggregated result of one benchmark.
+    struct BenchmarkResult {
+        std::string   name;
+        std::uint64_t iterations = 0;
+        double        ns_per_op = 0.0;
+        double        min_ns_per_op = 0.0;
+        double        max_ns_per_op = 0.0;
+        double        items_per_sec = 0.0;
+        std::map<std::string, double> counters;
+        std::string   error;
+    };
+
+    /// \brief Parses runner options.
+    /// \param argc Argument count.
+    /// \param argv Argument values.
+    /// \param options Parsed options.
+    /// \return False when an argument is unknown or malformed.
+    inline bool parse_options(int argc, char** argv, BenchmarkOptions& options) {
+        const auto value_of = [](const std::string& arg, const char* key, std::string& out) {
+            const std::string prefix = std::string(key) + "=";
+            if (arg.compare(0, prefix.size(), prefix) != 0) return false;
+            out = arg.substr(prefix.size());
+            return true;
+        };
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            std::string value;
+            if (value_of(arg, "--filter", value)) {
+                options.filter = value;
+            } else if (value_of(arg, "--json", value)) {
+                options.json_path = value;
+            } else if (value_of(arg, "--min-time-ms", value)) {
+                options.min_time_ms = std::atof(value.c_str());
+                if (options.min_time_ms <= 0.0) return false;
+            } else if (value_of(arg, "--repetitions", value)) {
+                const long reps = std::atol(value.c_str());
+                if (reps <= 0) return false;
+                options.repetitions = static_cast<std::uint32_t>(reps);
+            } else if (arg == "--list") {
+                options.list_only = true;
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// \brief Runs one benchmark: calibrates the iteration count, then measures repeated runs.
+    /// \param entry Benchmark to run.
+    /// \param options Runner options.
+    /// \return Median result of the measured runs.
+    inline BenchmarkResult run_benchmark(const BenchmarkEntry& entry, const BenchmarkOptions& options) {
+        BenchmarkResult result;
+        result.name = entry.name;
+
+        const double min_time_ns = options.min_time_ms * 1e6;
+        std::uint64_t iterations = 1;
+        for (;;) {
+            BenchmarkState state(iterations);
+            entry.fn(state);
+            if (!state.error().empty()) {
+                result.error = state.error();
+                return result;
+            }
+            const bool at_limit = entry.max_iterations != 0 && iterations >= entry.max_iterations;
+            if (state.elapsed_ns() >= min_time_ns || at_limit) break;
+
+            // Grow towards the target time, at most tenfold per step.
+            const double per_iter = std::max(state.elapsed_ns() / static_cast<double>(iterations), 1.0);
+            const double wanted = min_time_ns * 1.2 / per_iter;
+            const double capped = std::min(wanted, static_cast<double>(iterations) * 10.0);
+            iterations = std::max<std::uint64_t>(iterations + 1, static_cast<std::uint64_t>(capped));
+            if (entry.max_iterations != 0) iterations = std::min(iterations, entry.max_iterations);
+        }
+
+        struct Run {
+            double ns_per_op;
+            double items_per_sec;
+            std::map<std::string, double> counters;
+        };
+        std::vector<Run> runs;
+        runs.reserve(options.repetitions);
+        for (std::uint32_t rep = 0; rep < options.repetitions; ++rep) {
+            BenchmarkState state(iterations);
+            entry.fn(state);
+            if (!state.error().empty()) {
+                result.error = state.error();
+                return result;
+            }
+            const double ns = state.elapsed_ns();
+            runs.push_back(Run{
+                ns / static_cast<double>(iterations),
+                ns > 0.0 ? static_cast<double>(state.items_processed()) * 1e9 / ns : 0.0,
+                state.counters()});
+        }
+
+        std::sort(runs.begin(), runs.end(), [](const Run& a, const Run& b) {
+            return a.ns_per_op < b.ns_per_op;
+        });
+        const auto& median = runs[runs.size() / 2];
+        result.iterations = iterations;
+        result.ns_per_op = median.ns_per_op;
+        result.min_ns_per_op = runs.front().ns_per_op;
+        result.max_ns_per_op = runs.back().ns_per_op;
+        result.items_per_sec = median.items_per_sec;
+        result.counters = median.counters;
+        return result;
+    }
+
+    /// \brief Converts results to the machine-readable report.
+    /// \param results Benchmark results.
+    /// \param options Options the results were produced with.
+    /// \return JSON document with a context header and one entry per benchmark.
+    inline nlohmann::json to_json(const std::vector<BenchmarkResult>& results, const BenchmarkOptions& options) {
+        nlohmann::json context{
+            {"timestamp_ms", std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count()},
+            {"hardware_concurrency", std::thread::hardware_concurrency()},
+            {"min_time_ms", options.min_time_ms},
+            {"repetitions", options.repetitions},
+#if defined(NDEBUG)
+            {"build_type", "release"},
+#else
+            {"build_type", "debug"},
+#endif
+#if defined(__clang__)
+            {"compiler", std::string("clang ") + __clang_version__},
+#elif defined(__GNUC__)
+            {"compiler", std::string("gcc ") + __VERSION__},
+#elif defined(_MSC_VER)
+            {"compiler", "msvc " + std::to_string(_MSC_VER)},
+#else
+            {"compiler", "unknown"},
+#endif
+        };
+
+        nlohmann::json items = nlohmann::json::array();
+        for (const auto& result : results) {
+            nlohmann::json item{
+                {"name", result.name},
+                {"iterations", result.iterations},
+                {"ns_per_op", result.ns_per_op},
+                {"min_ns_per_op", result.min_ns_per_op},
+                {"max_ns_per_op", result.max_ns_per_op},
+                {"items_per_sec", result.items_per_sec},
+                {"counters", result.counters},
+            };
+            if (!result.error.empty()) item["error"] = result.error;
+            items.push_back(std::move(item));
+        }
+        return nlohmann::json{{"context", std::move(context)}, {"benchmarks", std::move(items)}};
+    }
+
+    /// \brief Runs all registered benchmarks that match the options.
+    /// \param argc Argument count.
+    /// \param argv Argument values.
+    /// \return Process exit code: 0 on success, 1 on failed benchmarks, 2 on bad arguments.
+    inline int run_main(int argc, char** argv) {
+        BenchmarkOptions options;
+        if (!parse_options(argc, argv, options)) {
+            std::cerr
+                << "usage: " << (argc > 0 ? argv[0] : "optionx_benchmarks")
+                << " [--filter=substr] [--json=path] [--min-time-ms=N] [--repetitions=N] [--list]\n";
+            return 2;
+        }
+
+        auto entries = registry();
+        std::sort(entries.begin(), entries.end(), [](const BenchmarkEntry& a, const BenchmarkEntry& b) {
+            return a.name < b.name;
+        });
+
+        std::vector<BenchmarkResult> results;
+        bool failed = false;
+        for (const auto& entry : entries) {
+            if (!options.filter.empty() && entry.name.find(options.filter) == std::string::npos) continue;
+            if (options.list_only) {
+                std::cout << entry.name << '\n';
+                continue;
+            }
+            auto result = run_benchmark(entry, options);
+            if (!result.error.empty()) {
+                failed = true;
+                std::cerr << std::left << std::setw(48) << result.name << " FAILED: " << result.error << '\n';
+            } else {
+                std::cerr
+                    << std::left << std::setw(48) << result.name
+                    << std::right << std::setw(14) << std::fixed << std::setprecision(1) << result.ns_per_op << " ns/op"
+                    << std::setw(16) << std::setprecision(0) << result.items_per_sec << " items/s"
+                    << std::setw(12) << result.iterations << " it\n";
+            }
+            results.push_back(std::move(result));
+        }
+        if (options.list_only) return 0;
+
+        const auto report = to_json(results, options).dump(2);
+        if (options.json_path.empty()) {
+            std::cout << report << std::endl;
+        } else {
+            std::ofstream out(options.json_path, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                std::cerr << "cannot write " << options.json_path << '\n';
+                return 1;
+            }
+            out << report << '\n';
+        }
+        return failed ? 1 : 0;
+    }
+
+} // namespace optionx::benchmarks
+
+#define OPTIONX_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define OPTIONX_BENCHMARK_CONCAT(a, b) OPTIONX_BENCHMARK_CONCAT_IMPL(a, b)
+
+/// \brief Defines and registers a benchmark body.
+/// \param id C identifier of the body function.
+/// \param name Reported benchmark name, `<scenario>/<case>`.
+#define OPTIONX_BENCHMARK(id, name) \
+    static void id(::optionx::benchmarks::BenchmarkState& state); \
+    static const ::optionx::benchmarks::BenchmarkRegistrar \
+        OPTIONX_BENCHMARK_CONCAT(id, _registrar)(name, &id); \
+    static void id(::optionx::benchmarks::BenchmarkState& state)
+
+/// \brief Same as OPTIONX_BENCHMARK, but caps calibration for slow end-to-end scenarios.
+/// \param id C identifier of the body function.
+/// \param name Reported benchmark name.
+/// \param max_iterations Upper bound for the calibrated iteration count.
+#define OPTIONX_BENCHMARK_MAX(id, name, max_iterations) \
+    static void id(::optionx::benchmarks::BenchmarkState& state); \
+    static const ::optionx::benchmarks::BenchmarkRegistrar \
+        OPTIONX_BENCHMARK_CONCAT(id, _registrar)(name, &id, max_iterations); \
+    static void id(::optionx::benchmarks::BenchmarkState& state)
+
+#endif // OPTIONX_BENCHMARKS_COMMON_BENCHMARK_HARNESS_HPP_INCLUDED
@@ -0,0 +1,133 @@
+#pragma once
+#ifndef OPTIONX_BENCHMARKS_COMMON_STAND_INS_HPP_INCLUDED
+#define OPTIONX_BENCHMARKS_COMMON_STAND_INS_HPP_INCLUDED
+
+/// \file StandIns.hpp
+/// \brief In-process stand-ins shared by benchmark scenarios.
+///
+/// Benchmarks never talk to a broker: account data accepts every trade,
+/// records are generated deterministically, and network scenarios bind to
+/// loopback ports chosen by the OS.
+
+#include <optionx_cpp/data.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace optionx::benchmarks {
+
+    /// \class BenchAccountInfo
+    /// \brief Permissive account data: connected, unlimited trades, no order interval.
+    class BenchAccountInfo final : public BaseAccountInfoData {
+    public:
+        std::int64_t user_id = 1;               ///< Reported user id.
+        double       balance = 1.0e9;           ///< Balance large enough for any benchmark.
+        double       payout = 0.8;              ///< Reported payout ratio.
+        CurrencyType currency = CurrencyType::USD;
+        AccountType  account_type = AccountType::DEMO;
+
+        const PlatformType platform_type() const override {
+            return PlatformType::SIMULATOR;
+        }
+
+        std::unique_ptr<BaseAccountInfoData> clone_unique() const override {
+            return std::make_unique<BenchAccountInfo>(*this);
+        }
+
+        std::shared_ptr<BaseAccountInfoData> clone_shared() const override {
+            return std::make_shared<BenchAccountInfo>(*this);
+        }
+
+    protected:
+        bool get_info_bool(const AccountInfoRequest&) const override {
+            return true;
+        }
+
+        std::int64_t get_info_int64(const AccountInfoRequest& request) const override {
+            switch (request.type) {
+            case AccountInfoType::USER_ID: return user_id;
+            case AccountInfoType::CONNECTION_STATUS: return 1;
+            case AccountInfoType::BALANCE: return static_cast<std::int64_t>(balance);
+            case AccountInfoType::PLATFORM_TYPE: return static_cast<std::int64_t>(platform_type());
+            case AccountInfoType::ACCOUNT_TYPE: return static_cast<std::int64_t>(account_type);
+            case AccountInfoType::CURRENCY: return static_cast<std::int64_t>(currency);
+            case AccountInfoType::MAX_TRADES: return (std::numeric_limits<std::int32_t>::max)();
+            case AccountInfoType::PAYOUT: return static_cast<std::int64_t>(payout * 100.0);
+            case AccountInfoType::ORDER_QUEUE_TIMEOUT: return 10;
+            case AccountInfoType::RESPONSE_TIMEOUT: return 10;
+            case AccountInfoType::ORDER_INTERVAL_MS: return 0;
+            default: break;
+            }
+            return 0;
+        }
+
+        double get_info_f64(const AccountInfoRequest& request) const override {
+            switch (request.type) {
+            case AccountInfoType::BALANCE: return balance;
+            case AccountInfoType::PAYOUT: return payout;
+            default: break;
+            }
+            return 0.0;
+        }
+
+        std::string get_info_str(const AccountInfoRequest& request) const override {
+            return request.type == AccountInfoType::USER_ID ? std::to_string(user_id) : std::string();
+        }
+
+        AccountType get_info_account_type(const AccountInfoRequest&) const override {
+            return account_type;
+        }
+
+        CurrencyType get_info_currency(const AccountInfoRequest&) const override {
+            return currency;
+        }
+    }; // BenchAccountInfo
+
+    /// \brief Generates a deterministic closed-trade history.
+    /// \param count Number of records.
+    /// \param symbols Number of distinct symbols.
+    /// \param signals Number of distinct signal names.
+    /// \return Records ordered by open date, one every 97 seconds.
+    inline std::vector<TradeRecord> make_trade_records(
+            std::size_t count,
+            std::size_t symbols = 20,
+            std::size_t signals = 10) {
+        std::vector<TradeRecord> records;
+        records.reserve(count);
+        const std::int64_t start_ms = 1700006400000; // 2023-11-15 00:00:00 UTC
+        for (std::size_t i = 0; i < count; ++i) {
+            TradeRecord record;
+            record.unique_id = static_cast<std::int64_t>(i + 1);
+            record.unique_hash = "bench-" + std::to_string(i + 1);
+            record.trade_id = static_cast<std::uint32_t>(i + 1);
+            record.account_id = 7001 + static_cast<std::int64_t>(i % 2);
+            record.option_id = static_cast<std::int64_t>(100000 + i);
+            record.platform_type = PlatformType::INTRADE_BAR;
+            record.account_type = i % 2 == 0 ? AccountType::DEMO : AccountType::REAL;
+            record.currency = i % 3 == 0 ? CurrencyType::RUB : CurrencyType::USD;
+            record.symbol = "SYM" + std::to_string(i % symbols);
+            record.signal_name = "signal-" + std::to_string(i % signals);
+            record.option_type = OptionType::SPRINT;
+            record.order_type = i % 2 == 0 ? OrderType::BUY : OrderType::SELL;
+            record.amount = 10.0 + static_cast<double>(i % 5);
+            record.payout = 0.8;
+            const bool win = (i * 7) % 11 < 6;
+            record.trade_state = record.live_state = win ? TradeState::WIN : TradeState::LOSS;
+            record.profit = win ? record.amount * record.payout : -record.amount;
+            record.ping = static_cast<std::int64_t>(i % 120);
+            record.place_date = start_ms + static_cast<std::int64_t>(i) * 97000;
+            record.send_date = record.place_date;
+            record.open_date = record.place_date;
+            record.close_date = record.open_date + 60000 * static_cast<std::int64_t>(1 + i % 5);
+            record.duration = static_cast<std::uint32_t>(60 * (1 + i % 5));
+            records.push_back(std::move(record));
+        }
+        return records;
+    }
+
+} // namespace optionx::benchmarks
+
+#endif // OPTIONX_BENCHMARKS_COMMON_STAND_INS_HPP_INCLUDED
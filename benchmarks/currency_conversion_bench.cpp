@@ -0,0 +1,95 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/data.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using optionx::CurrencyType;
+using optionx::benchmarks::BenchmarkState;
+
+/// Previous implementation: ordered-map lookup for the direct pair, then for
+/// the inverse pair, with no cross rates.
+class ReferenceMatrix {
+public:
+    std::map<std::pair<CurrencyType, CurrencyType>, double> rates;
+
+    double convert(double value, CurrencyType from, CurrencyType to) const {
+        if (from == to || from == CurrencyType::UNKNOWN || to == CurrencyType::UNKNOWN) {
+            return value;
+        }
+        const auto direct = rates.find({from, to});
+        if (direct != rates.end()) return value * direct->second;
+        const auto inverse = rates.find({to, from});
+        if (inverse != rates.end() && inverse->second != 0.0) return value / inverse->second;
+        return value;
+    }
+};
+
+/// Mostly account currencies converted to the USD reporting currency, as
+/// TradeStatsCalculator does for every record.
+struct ConversionFixture {
+    ReferenceMatrix reference;
+    optionx::TradeCurrencyConversionMatrix matrix;
+    std::vector<CurrencyType> sources;
+
+    ConversionFixture() : sources(1024) {
+        const std::pair<CurrencyType, double> quotes[] = {
+            {CurrencyType::EUR, 1.08}, {CurrencyType::GBP, 1.27}, {CurrencyType::BTC, 64000.0},
+            {CurrencyType::ETH, 3400.0}, {CurrencyType::USDT, 1.0}, {CurrencyType::USDC, 1.0},
+            {CurrencyType::RUB, 0.011}, {CurrencyType::UAH, 0.024}, {CurrencyType::KZT, 0.0021}
+        };
+        matrix.set_base_currency(CurrencyType::USD);
+        for (const auto& [currency, rate] : quotes) {
+            reference.rates[{currency, CurrencyType::USD}] = rate;
+            matrix.set_rate(currency, CurrencyType::USD, rate);
+        }
+        for (std::size_t i = 0; i < sources.size(); ++i) {
+            sources[i] = i % 3 == 0 ? CurrencyType::USD : quotes[i % 9].first;
+        }
+    }
+};
+
+const ConversionFixture& fixture() {
+    static const ConversionFixture s_fixture;
+    return s_fixture;
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK(currency_conversion_reference, "currency_conversion/to_usd/reference_map") {
+    const auto& data = fixture();
+    double total = 0.0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        total += data.reference.convert(1.0 + static_cast<double>(i & 7), data.sources[i & 1023], CurrencyType::USD);
+        ++i;
+    }
+    optionx::benchmarks::do_not_optimize(total);
+    state.set_items_processed(state.iterations());
+}
+
+OPTIONX_BENCHMARK(currency_conversion_table, "currency_conversion/to_usd/dense_table") {
+    const auto& data = fixture();
+    for (const auto from : data.sources) {
+        const double expected = data.reference.convert(100.0, from, CurrencyType::USD);
+        if (std::fabs(data.matrix.convert_to_base(100.0, from) - expected) > 1e-9) {
+            state.fail("dense table disagrees with the map reference");
+            return;
+        }
+    }
+
+    double total = 0.0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        total += data.matrix.convert_to_base(1.0 + static_cast<double>(i & 7), data.sources[i & 1023]);
+        ++i;
+    }
+    optionx::benchmarks::do_not_optimize(total);
+    state.set_items_processed(state.iterations());
+}
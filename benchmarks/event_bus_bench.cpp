@@ -0,0 +1,86 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/utils.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <typeindex>
+#include <vector>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+
+class BenchEvent final : public optionx::utils::Event {
+public:
+    std::uint64_t value = 0;
+
+    explicit BenchEvent(std::uint64_t v = 0) : value(v) {}
+
+    std::type_index type() const override {
+        return typeid(BenchEvent);
+    }
+
+    const char* name() const override {
+        return "BenchEvent";
+    }
+};
+
+class CountingMediator final : public optionx::utils::EventMediator {
+public:
+    std::uint64_t sum = 0;
+
+    explicit CountingMediator(optionx::utils::EventBus& bus)
+        : optionx::utils::EventMediator(bus) {
+        subscribe<BenchEvent>([this](const BenchEvent& event) {
+            sum += event.value;
+        });
+    }
+
+    void on_event(const optionx::utils::Event* const) override {}
+};
+
+void run_notify(BenchmarkState& state, std::size_t subscribers) {
+    optionx::utils::EventBus bus;
+    std::vector<std::unique_ptr<CountingMediator>> mediators;
+    for (std::size_t i = 0; i < subscribers; ++i) {
+        mediators.push_back(std::make_unique<CountingMediator>(bus));
+    }
+
+    BenchEvent event(1);
+    for (auto _ : state) {
+        bus.notify(event);
+    }
+
+    std::uint64_t delivered = 0;
+    for (const auto& mediator : mediators) delivered += mediator->sum;
+    if (delivered != state.iterations() * subscribers) state.fail("lost notifications");
+    state.set_items_processed(delivered);
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK(event_bus_notify_1, "event_bus/notify/subscribers:1") {
+    run_notify(state, 1);
+}
+
+OPTIONX_BENCHMARK(event_bus_notify_8, "event_bus/notify/subscribers:8") {
+    run_notify(state, 8);
+}
+
+// Queued path: each iteration posts a batch of 64 events and drains it.
+OPTIONX_BENCHMARK(event_bus_notify_async, "event_bus/notify_async+process/batch:64") {
+    constexpr std::size_t kBatch = 64;
+    optionx::utils::EventBus bus;
+    CountingMediator mediator(bus);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < kBatch; ++i) {
+            bus.notify_async(std::make_unique<BenchEvent>(1));
+        }
+        bus.process();
+    }
+
+    if (mediator.sum != state.iterations() * kBatch) state.fail("lost queued events");
+    state.set_items_processed(mediator.sum);
+}
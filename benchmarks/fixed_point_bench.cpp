@@ -0,0 +1,151 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/utils.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+
+constexpr std::size_t kPrices = 65536;
+constexpr std::size_t kDigits = 5;
+
+using Price5 = optionx::utils::Price<kDigits>;
+
+/// Random-walk quote stream rendered as text, plus both parsed forms.
+struct PriceFixture {
+    std::vector<std::string> texts;
+    std::vector<double> doubles;
+    std::vector<Price5> prices;
+
+    PriceFixture() {
+        texts.reserve(kPrices);
+        std::int64_t raw = 108412;
+        std::uint32_t state = 0x2545F491u;
+        for (std::size_t i = 0; i < kPrices; ++i) {
+            state = state * 1664525u + 1013904223u;
+            raw += static_cast<std::int64_t>(state % 7u) - 3;
+            texts.push_back(optionx::utils::Decimal64::from_raw(raw, kDigits).to_string());
+        }
+        doubles.resize(kPrices);
+        prices.resize(kPrices);
+        for (std::size_t i = 0; i < kPrices; ++i) {
+            doubles[i] = reference_parse(texts[i]);
+            Price5::try_parse(texts[i], prices[i]);
+        }
+    }
+
+    /// Previous path: parse through double, then renormalize by digits.
+    static double reference_parse(const std::string& text) {
+        return optionx::utils::normalize_double(std::strtod(text.c_str(), nullptr), kDigits);
+    }
+};
+
+const PriceFixture& fixture() {
+    static const PriceFixture s_fixture;
+    return s_fixture;
+}
+
+bool reference_compare(double a, double b) {
+    return optionx::utils::normalize_double(a, kDigits) == optionx::utils::normalize_double(b, kDigits);
+}
+
+std::size_t count_changes_reference(const PriceFixture& data) {
+    std::size_t changes = 0;
+    for (std::size_t i = 1; i < kPrices; ++i) {
+        changes += reference_compare(data.doubles[i - 1], data.doubles[i]) ? 0 : 1;
+    }
+    return changes;
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK(fixed_point_parse_reference, "fixed_point/parse/strtod_normalize") {
+    const auto& data = fixture();
+    double total = 0.0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        total += PriceFixture::reference_parse(data.texts[i++ % kPrices]);
+    }
+    optionx::benchmarks::do_not_optimize(total);
+    state.set_items_processed(state.iterations());
+}
+
+OPTIONX_BENCHMARK(fixed_point_parse_price, "fixed_point/parse/price5") {
+    const auto& data = fixture();
+    for (std::size_t i = 0; i < kPrices; ++i) {
+        if (!(Price5::from_double(data.doubles[i]) == data.prices[i])) {
+            state.fail("Price parsing disagrees with the double path");
+            return;
+        }
+    }
+
+    Price5 price;
+    std::size_t parsed = 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        parsed += Price5::try_parse(data.texts[i++ % kPrices], price) ? 1 : 0;
+    }
+    optionx::benchmarks::do_not_optimize(price);
+    if (parsed != state.iterations()) state.fail("Price parsing rejected a quote");
+    state.set_items_processed(state.iterations());
+}
+
+OPTIONX_BENCHMARK(fixed_point_compare_reference, "fixed_point/compare/normalize_double") {
+    const auto& data = fixture();
+    std::size_t changes = 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto index = 1 + i++ % (kPrices - 1);
+        changes += reference_compare(data.doubles[index - 1], data.doubles[index]) ? 0 : 1;
+    }
+    optionx::benchmarks::do_not_optimize(changes);
+    state.set_items_processed(state.iterations());
+}
+
+OPTIONX_BENCHMARK(fixed_point_compare_with_precision, "fixed_point/compare/compare_with_precision") {
+    const auto& data = fixture();
+    std::size_t expected = 0;
+    for (std::size_t i = 1; i < kPrices; ++i) {
+        expected += optionx::utils::compare_with_precision(data.doubles[i - 1], data.doubles[i], kDigits) ? 0 : 1;
+    }
+    if (expected != count_changes_reference(data)) {
+        state.fail("compare_with_precision disagrees with the reference");
+        return;
+    }
+
+    std::size_t changes = 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto index = 1 + i++ % (kPrices - 1);
+        changes += optionx::utils::compare_with_precision(data.doubles[index - 1], data.doubles[index], kDigits) ? 0 : 1;
+    }
+    optionx::benchmarks::do_not_optimize(changes);
+    state.set_items_processed(state.iterations());
+}
+
+OPTIONX_BENCHMARK(fixed_point_compare_price, "fixed_point/compare/price5") {
+    const auto& data = fixture();
+    std::size_t expected = 0;
+    for (std::size_t i = 1; i < kPrices; ++i) {
+        expected += data.prices[i - 1] == data.prices[i] ? 0 : 1;
+    }
+    if (expected != count_changes_reference(data)) {
+        state.fail("Price comparison disagrees with the reference");
+        return;
+    }
+
+    std::size_t changes = 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto index = 1 + i++ % (kPrices - 1);
+        changes += data.prices[index - 1] == data.prices[index] ? 0 : 1;
+    }
+    optionx::benchmarks::do_not_optimize(changes);
+    state.set_items_processed(state.iterations());
+    state.set_counter("bytes_per_price", static_cast<double>(sizeof(Price5)));
+}
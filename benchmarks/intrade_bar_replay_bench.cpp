@@ -0,0 +1,109 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <intrade_bar_api/IntradeBarMockBroker.hpp>
+
+#include <optionx_cpp/platforms.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+using namespace optionx;
+using namespace optionx::platforms::intrade_bar;
+using optionx::platforms::IntradeBarPlatform;
+using namespace optionx::tests::intrade_bar_mock;
+
+/// Replays the recorded BTCUSDT stream as fast as possible and times how long
+/// IntradeBarPlatform takes to deliver each tick through on_tick_data().
+void run_btc_replay(BenchmarkState& state, double speed) {
+    MockBrokerConfig config;
+    config.replay.speed = speed;
+    config.replay.repeat = 0;
+    IntradeBarMockBroker broker(make_default_recording(1000, 1), config);
+    if (!broker.start()) {
+        state.fail("mock broker did not start");
+        return;
+    }
+
+    IntradeBarPlatform platform;
+    platform.run(false);
+    std::mutex mutex;
+    std::uint64_t delivered = 0;
+    utils::metrics::Histogram wire_ms;
+    utils::metrics::Histogram dispatch_ms;
+    platform.on_tick_data() =
+        [&](std::unique_ptr<market_data::TickDataBatch> batch) {
+            if (!batch) return;
+            const auto now_ms = static_cast<std::uint64_t>(time_shield::timestamp_ms());
+            for (const auto& tick : batch->items) {
+                if (tick.received_ms >= tick.time_ms) wire_ms.record(tick.received_ms - tick.time_ms);
+                if (now_ms >= tick.received_ms) dispatch_ms.record(now_ms - tick.received_ms);
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            delivered += batch->items.size();
+        };
+
+    auto auth = std::make_unique<AuthData>();
+    auth->set_user_token("1", "bench-token");
+    auth->host = broker.host();
+    platform.configure_auth(std::move(auth));
+    platform.subscribe_ticks(
+        market_data::TickSubscriptionRequest("BTCUSDT", market_data::MarketDataTransport::WEBSOCKET),
+        [](market_data::MarketDataSubscriptionResult) {});
+
+    auto read_delivered = [&]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return delivered;
+    };
+
+    // Wait for the stream to be live before timing.
+    const auto warmup_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (read_delivered() == 0 && std::chrono::steady_clock::now() < warmup_deadline) {
+        platform.process();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (read_delivered() == 0) {
+        state.fail("no ticks from mock broker");
+        platform.shutdown();
+        return;
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+    const auto start = read_delivered();
+    std::uint64_t target = start;
+    for (auto _ : state) {
+        ++target;
+        while (read_delivered() < target) {
+            platform.process();
+            if (std::chrono::steady_clock::now() > deadline) {
+                state.fail("tick replay stalled");
+                break;
+            }
+        }
+    }
+
+    state.set_items_processed(read_delivered() - start);
+    const auto wire = wire_ms.snapshot();
+    const auto dispatch = dispatch_ms.snapshot();
+    state.set_counter("wire_p50_ms", static_cast<double>(wire.value_at(0.5)));
+    state.set_counter("wire_p99_ms", static_cast<double>(wire.value_at(0.99)));
+    state.set_counter("dispatch_p50_ms", static_cast<double>(dispatch.value_at(0.5)));
+    state.set_counter("dispatch_p99_ms", static_cast<double>(dispatch.value_at(0.99)));
+    state.set_counter("frames_sent", static_cast<double>(broker.stats().ws_frames_sent));
+    platform.shutdown();
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK_MAX(intrade_bar_replay_btc_max, "intrade_bar/ws_replay/btcusdt/speed:max", 20000) {
+    run_btc_replay(state, 0.0);
+}
+
+OPTIONX_BENCHMARK_MAX(intrade_bar_replay_btc_realtime, "intrade_bar/ws_replay/btcusdt/speed:1", 2000) {
+    run_btc_replay(state, 1.0);
+}
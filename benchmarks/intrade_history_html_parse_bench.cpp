@@ -0,0 +1,192 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/platforms.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+namespace intrade_bar = optionx::platforms::intrade_bar;
+
+constexpr std::size_t kRowsPerPage = 4000;
+
+/// Rows follow the markup recorded from the authenticated trade_close table
+/// and trade_load_more2.php fragments.
+std::string make_close_table_row(std::size_t index) {
+    static const char* symbols[] = {"BTC/USDT", "EUR/USD", "GBP/JPY", "AUD/CAD"};
+    static const char* months[] = {"Jan", "Mar", "Jun", "Oct"};
+    const int day = static_cast<int>(1 + index % 28);
+    const int minute = static_cast<int>(index % 55);
+    const auto two_digits = [](int value) {
+        return (value < 10 ? "0" : "") + std::to_string(value);
+    };
+
+    std::string open_date;
+    std::string close_date;
+    if (index % 2 == 0) {
+        open_date = "09:" + two_digits(minute) + ":34, " + std::to_string(day) + ".06.26";
+        close_date = "09:" + two_digits(minute + 5) + ":34, " + std::to_string(day) + ".06.26";
+    } else {
+        const std::string month = months[index % 4];
+        open_date = "19:" + two_digits(minute) + ":42, " + std::to_string(day) + " " + month + " 26";
+        close_date = "19:" + two_digits(minute + 3) + ":42, " + std::to_string(day) + " " + month + " 26";
+    }
+    const bool rub = index % 3 == 0;
+    const std::string currency = rub ? "&#8381;" : "$";
+    const std::string result = index % 5 == 0 ? "0" : (index % 7 == 0 ? "100" : "1,79");
+
+    std::ostringstream row;
+    row << "<tr class=\"trade_list_type trade_list_type_1\" >\n"
+        << "<th class=\"center\"><div class=\""
+        << (index % 2 == 0 ? "trading-table__up-td" : "trading-table__down-td")
+        << "\"></div></th>\n"
+        << "<th>\n" << (224100000 + index) << "\n<br>\n"
+        << open_date << "\n<BR/>\n" << close_date << "\n</th>\n"
+        << "<th>\n" << symbols[index % 4] << "\n<br>\n"
+        << "64708.01\n<br />\n64735.64\n</th>\n"
+        << "<th>\n<br>\n" << (rub ? "100" : "1") << "&nbsp;" << currency
+        << "\n<br>\n" << result << "&nbsp;" << currency << "\n</th>\n"
+        << "</tr>\n";
+    return row.str();
+}
+
+std::string make_history_page() {
+    std::string html =
+        "<div id=\"trade_close_block\" class=\"hide\"><table class=\"\">"
+        "<tbody class=\"table_tbody\" id=\"trade_close\">\n";
+    for (std::size_t i = 0; i < kRowsPerPage; ++i) {
+        html += make_close_table_row(i);
+    }
+    html +=
+        "</tbody></table><div class=\"text-center\">"
+        "<a class=\"trading-tables__btn btn btn--gray trade_btn_load_more\" "
+        "id=\"trade_btn_load_more\" data-last=\"224099999\">load more</a></div></div>";
+    return html;
+}
+
+/// Previous cell pipeline: regex_replace for line breaks, a tag strip with
+/// copying entity replacement and regex date/amount scanners.
+std::vector<std::string> reference_cell_lines(std::string cell_html) {
+    static const std::regex br_regex(R"(<\s*br\s*/?\s*>)", std::regex_constants::icase);
+    cell_html = std::regex_replace(cell_html, br_regex, "\n");
+
+    std::string text;
+    bool in_tag = false;
+    for (char ch : cell_html) {
+        if (ch == '<') { in_tag = true; continue; }
+        if (ch == '>') { in_tag = false; continue; }
+        if (!in_tag) text.push_back(ch);
+    }
+    const std::pair<std::string, std::string> entities[] = {
+        {"&nbsp;", " "}, {"&#160;", " "}, {"&amp;", "&"},
+        {"&#36;", "$"}, {"&#8381;", "\xE2\x82\xBD"}
+    };
+    for (const auto& entity : entities) {
+        std::size_t pos = 0;
+        while ((pos = text.find(entity.first, pos)) != std::string::npos) {
+            text.replace(pos, entity.first.size(), entity.second);
+            pos += entity.second.size();
+        }
+    }
+
+    std::vector<std::string> lines;
+    std::istringstream stream(text);
+    std::string line;
+    while (std::getline(stream, line)) {
+        line = optionx::utils::trim_copy(line);
+        if (!line.empty()) lines.push_back(std::move(line));
+    }
+    return lines;
+}
+
+std::size_t reference_parse_page(const std::string& html) {
+    static const std::regex cell_regex(R"(<th[^>]*>([\s\S]*?)</th>)");
+    static const std::regex date_regex(
+        R"(^\s*([0-9]{1,2}):([0-9]{2}):([0-9]{2}),\s*([0-9]{1,2})(?:\.([0-9]{1,2})\.|\s+([A-Za-z]{3})\s+)([0-9]{2,4})\s*$)");
+    static const std::regex number_regex(R"([-+]?[0-9]+(?:\.[0-9]+)?)");
+
+    std::size_t parsed = 0;
+    std::size_t pos = 0;
+    for (;;) {
+        const std::size_t row_start = html.find("<tr", pos);
+        if (row_start == std::string::npos) break;
+        const std::size_t row_end = html.find("</tr>", row_start);
+        if (row_end == std::string::npos) break;
+        const std::string row = html.substr(row_start, row_end - row_start);
+        pos = row_end + 5;
+
+        std::vector<std::string> cells;
+        for (std::sregex_iterator it(row.begin(), row.end(), cell_regex), end; it != end; ++it) {
+            cells.push_back((*it)[1].str());
+        }
+        if (cells.size() < 4) continue;
+
+        const auto id_lines = reference_cell_lines(cells[1]);
+        const auto money_lines = reference_cell_lines(cells[3]);
+        if (id_lines.size() < 3 || money_lines.size() < 2) continue;
+
+        std::smatch match;
+        if (!std::regex_match(id_lines[1], match, date_regex) ||
+            !std::regex_match(id_lines[2], match, date_regex)) {
+            continue;
+        }
+        std::string amount = money_lines[0];
+        std::replace(amount.begin(), amount.end(), ',', '.');
+        if (!std::regex_search(amount, match, number_regex)) continue;
+        ++parsed;
+    }
+    return parsed;
+}
+
+const std::string& history_page() {
+    static const std::string s_html = make_history_page();
+    return s_html;
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK_MAX(intrade_history_reference, "intrade_bar/history_html/regex_reference:4000_rows", 50) {
+    const auto& html = history_page();
+    std::size_t rows = 0;
+    for (auto _ : state) {
+        rows = reference_parse_page(html);
+        optionx::benchmarks::do_not_optimize(rows);
+    }
+    if (rows != kRowsPerPage) state.fail("regex reference skipped rows");
+    state.set_items_processed(state.iterations() * kRowsPerPage);
+}
+
+OPTIONX_BENCHMARK_MAX(intrade_history_scanner, "intrade_bar/history_html/scanner:4000_rows", 2000) {
+    const auto& html = history_page();
+    const auto checked = intrade_bar::parse_trade_history_html_page(html, optionx::AccountType::DEMO);
+    if (checked.records.size() != kRowsPerPage || checked.next_last != "224099999") {
+        state.fail("scanner parsed an unexpected page");
+        return;
+    }
+    for (std::size_t i = 0; i < checked.records.size(); ++i) {
+        const auto& record = checked.records[i];
+        if (record.option_id != static_cast<std::int64_t>(224100000 + i) ||
+            record.open_date <= 0 ||
+            record.close_date <= record.open_date ||
+            record.currency != (i % 3 == 0 ? optionx::CurrencyType::RUB : optionx::CurrencyType::USD) ||
+            record.order_type != (i % 2 == 0 ? optionx::OrderType::BUY : optionx::OrderType::SELL)) {
+            state.fail("scanner parsed row " + std::to_string(i) + " incorrectly");
+            return;
+        }
+    }
+
+    std::size_t rows = 0;
+    for (auto _ : state) {
+        const auto page = intrade_bar::parse_trade_history_html_page(html, optionx::AccountType::DEMO);
+        rows += page.records.size();
+    }
+    optionx::benchmarks::do_not_optimize(rows);
+    state.set_items_processed(rows);
+    state.set_counter("page_bytes", static_cast<double>(html.size()));
+}
@@ -0,0 +1,142 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/bridges/legacy_trading.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+namespace legacy_protocol = optionx::bridges::legacy_trading::detail;
+
+constexpr std::size_t kContractCount = 4096;
+
+/// Previous decoder: normalized copy plus linear table scan, and repeated
+/// `at(...).get<std::string>()` copies for every field.
+std::string reference_parse_symbol(const std::string& symbol) {
+    static const std::vector<std::string> symbols = {
+        "EURUSD", "USDJPY", "USDCHF", "USDCAD", "EURJPY", "AUDUSD",
+        "NZDUSD", "EURGBP", "EURCHF", "AUDJPY", "GBPJPY", "EURCAD",
+        "AUDCAD", "CADJPY", "NZDJPY", "AUDNZD", "GBPAUD", "EURAUD",
+        "GBPCHF", "AUDCHF", "GBPNZD", "BTCUSDT"
+    };
+
+    std::string normalized;
+    normalized.reserve(symbol.size());
+    for (const unsigned char ch : symbol) {
+        if (std::isalnum(ch) != 0) {
+            normalized.push_back(static_cast<char>(std::toupper(ch)));
+        }
+    }
+    if (normalized == "BTCUSD" || normalized == "BTCUSDT") {
+        return "BTCUSDT";
+    }
+    const auto it = std::find(symbols.begin(), symbols.end(), normalized);
+    if (it != symbols.end()) {
+        return *it;
+    }
+    throw std::invalid_argument("Invalid symbol in legacy trade request.");
+}
+
+std::unique_ptr<optionx::TradeSignal> reference_parse_contract(
+        const nlohmann::json& contract,
+        double min_payout) {
+    auto signal = std::make_unique<optionx::TradeSignal>();
+    signal->symbol = reference_parse_symbol(contract.at("s").get<std::string>());
+    legacy_protocol::parse_note(contract.value("note", std::string()), *signal);
+    signal->amount = contract.at("a").get<double>();
+    optionx::OrderType order_type = optionx::OrderType::UNKNOWN;
+    if (!optionx::to_enum(contract.at("dir").get<std::string>(), order_type) ||
+        order_type == optionx::OrderType::UNKNOWN) {
+        throw std::invalid_argument("Invalid order direction in legacy trade request.");
+    }
+    signal->order_type = order_type;
+    legacy_protocol::parse_expiry_or_duration(contract, *signal);
+    signal->min_payout = min_payout;
+    return signal;
+}
+
+std::vector<nlohmann::json> make_contracts() {
+    static const std::vector<std::string> symbols = {
+        "eur/usd", "GBPNZD", "btc-usd", "usd_jpy", "AUDCHF", "nzd/jpy"
+    };
+    static const std::vector<std::string> directions = {"buy", "SELL", "put", "call"};
+
+    std::mt19937 rng(20260712);
+    std::uniform_int_distribution<int> amount(1, 100);
+    std::vector<nlohmann::json> out;
+    out.reserve(kContractCount);
+    for (std::size_t i = 0; i < kContractCount; ++i) {
+        nlohmann::json contract = {
+            {"s", symbols[i % symbols.size()]},
+            {"note", "signal-" + std::to_string(i % 17) + "&payload"},
+            {"a", amount(rng)},
+            {"dir", directions[i % directions.size()]}
+        };
+        if (i % 2 == 0) {
+            contract["dur"] = 60 * (1 + i % 5);
+        } else {
+            contract["exp"] = 1900000000 + static_cast<std::int64_t>(i);
+        }
+        out.push_back(std::move(contract));
+    }
+    return out;
+}
+
+const std::vector<nlohmann::json>& contracts() {
+    static const auto s_contracts = make_contracts();
+    return s_contracts;
+}
+
+bool same_signal(const optionx::TradeSignal& a, const optionx::TradeSignal& b) {
+    return a.symbol == b.symbol &&
+           a.signal_name == b.signal_name &&
+           a.user_data == b.user_data &&
+           a.order_type == b.order_type &&
+           a.option_type == b.option_type &&
+           a.duration == b.duration &&
+           a.expiry_time == b.expiry_time &&
+           a.amount == b.amount;
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK(legacy_contract_reference, "legacy_trading/contract_parse/reference") {
+    const auto& data = contracts();
+    std::size_t parsed = 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto signal = reference_parse_contract(data[i++ % kContractCount], 0.8);
+        parsed += signal->symbol.size();
+    }
+    optionx::benchmarks::do_not_optimize(parsed);
+    state.set_items_processed(state.iterations());
+}
+
+OPTIONX_BENCHMARK(legacy_contract_registry, "legacy_trading/contract_parse/registry_decoder") {
+    const auto& data = contracts();
+    for (const auto& contract : data) {
+        const auto expected = reference_parse_contract(contract, 0.8);
+        const auto decoded = legacy_protocol::parse_contract(contract, 0.8);
+        if (!same_signal(*expected, *decoded)) {
+            state.fail("registry decoder disagrees with the reference");
+            return;
+        }
+    }
+
+    std::size_t parsed = 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto signal = legacy_protocol::parse_contract(data[i++ % kContractCount], 0.8);
+        parsed += signal->symbol.size();
+    }
+    optionx::benchmarks::do_not_optimize(parsed);
+    state.set_items_processed(state.iterations());
+}
@@ -0,0 +1,137 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/utils.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <string>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+
+constexpr std::size_t kRows = 8000;
+
+/// Diagnostic dump shaped like a logged trade-history response: mostly HTML
+/// with a few credential fields in headers and query strings.
+std::string make_log_text() {
+    std::string text =
+        "POST /trade_history.php HTTP/1.1\r\n"
+        "Cookie: user_id=42; user_hash=deadbeefcafebabe\r\n"
+        "Authorization: Bearer abcdef0123456789\r\n\r\n";
+    for (std::size_t i = 0; i < kRows; ++i) {
+        text += "<tr class=\"trade_list_type\"><th>";
+        text += std::to_string(224100000 + i);
+        text += "<br>09:15:34, 12.06.26</th><th>EUR/USD<br>1.08412</th>"
+                "<th>100&nbsp;$<br>179&nbsp;$</th></tr>\n";
+        if (i % 1000 == 0) {
+            text += "retry url=/api?user_id=42&token=tok";
+            text += std::to_string(i);
+            text += "&password=hunter2\n";
+        }
+    }
+    return text;
+}
+
+/// Previous implementation: lowercase copy of the whole text, then a find
+/// loop per key that re-lowercases the text after every replacement.
+std::string reference_redact(std::string text) {
+    static constexpr const char* keys[] = {
+        "auth_token", "authorization", "cookie", "cookies", "password", "passwd",
+        "proxy_auth", "session", "token", "user_hash", "x-api-token"
+    };
+    auto to_lower_ascii = [](std::string value) {
+        std::transform(value.begin(), value.end(), value.begin(), [](unsigned char ch) {
+            return static_cast<char>(std::tolower(ch));
+        });
+        return value;
+    };
+    auto is_key_boundary = [](char ch) {
+        return !(std::isalnum(static_cast<unsigned char>(ch)) || ch == '_' || ch == '-');
+    };
+    auto is_value_delimiter = [](char ch) {
+        return ch == '&' || ch == ',' || ch == ';' ||
+               ch == '\r' || ch == '\n' || ch == '\t' || ch == ' ';
+    };
+
+    std::string lower = to_lower_ascii(text);
+    for (const std::string key : keys) {
+        std::size_t pos = 0;
+        while ((pos = lower.find(key, pos)) != std::string::npos) {
+            const bool left_ok = (pos == 0) || is_key_boundary(lower[pos - 1]);
+            const std::size_t key_end = pos + key.size();
+            const bool right_ok = key_end >= lower.size() || is_key_boundary(lower[key_end]);
+            if (!left_ok || !right_ok) {
+                pos = key_end;
+                continue;
+            }
+            std::size_t sep = key_end;
+            while (sep < lower.size() && lower[sep] == ' ') ++sep;
+            if (sep >= lower.size() || (lower[sep] != '=' && lower[sep] != ':')) {
+                pos = key_end;
+                continue;
+            }
+            std::size_t value_begin = sep + 1;
+            while (value_begin < lower.size() && lower[value_begin] == ' ') ++value_begin;
+            if (value_begin >= lower.size()) {
+                pos = value_begin;
+                continue;
+            }
+            const char quote = (lower[value_begin] == '"' || lower[value_begin] == '\'')
+                ? lower[value_begin]
+                : '\0';
+            if (quote != '\0') ++value_begin;
+            std::size_t value_end = value_begin;
+            if (quote != '\0') {
+                while (value_end < lower.size() && lower[value_end] != quote) ++value_end;
+            } else if (key == "cookie" || key == "cookies" || key == "authorization") {
+                while (value_end < lower.size() && lower[value_end] != '\r' && lower[value_end] != '\n') {
+                    ++value_end;
+                }
+            } else {
+                while (value_end < lower.size() && !is_value_delimiter(lower[value_end])) ++value_end;
+            }
+            text.replace(value_begin, value_end - value_begin, "***");
+            lower = to_lower_ascii(text);
+            pos = value_begin + 3;
+        }
+    }
+    return text;
+}
+
+const std::string& log_text() {
+    static const std::string s_text = make_log_text();
+    return s_text;
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK_MAX(log_redaction_reference, "log_redaction/trade_history_dump/per_key_reference", 20) {
+    const auto& text = log_text();
+    std::string output;
+    for (auto _ : state) {
+        output = reference_redact(text);
+    }
+    if (output.find("hunter2") != std::string::npos) state.fail("reference left a password in the text");
+    state.set_items_processed(state.iterations() * text.size());
+}
+
+OPTIONX_BENCHMARK_MAX(log_redaction_compiled, "log_redaction/trade_history_dump/compiled_redactor", 5000) {
+    const auto& text = log_text();
+    const auto& redactor = optionx::utils::LogRedactor::default_instance();
+    std::string output;
+    redactor.redact_to(text, output);
+    if (output != reference_redact(text) ||
+        output.find("hunter2") != std::string::npos ||
+        output.find("deadbeef") != std::string::npos) {
+        state.fail("compiled redactor disagrees with the reference");
+        return;
+    }
+
+    for (auto _ : state) {
+        redactor.redact_to(text, output);
+        optionx::benchmarks::do_not_optimize(output);
+    }
+    state.set_items_processed(state.iterations() * text.size());
+}
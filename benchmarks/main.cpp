@@ -0,0 +1,5 @@
+#include "common/BenchmarkHarness.hpp"
+
+int main(int argc, char** argv) {
+    return optionx::benchmarks::run_main(argc, argv);
+}
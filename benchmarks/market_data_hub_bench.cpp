@@ -0,0 +1,80 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/market_data.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+using namespace optionx;
+using namespace optionx::market_data;
+
+class CountingSubscriber final : public IMarketDataSubscriber {
+public:
+    std::uint64_t ticks = 0;
+
+    void on_tick_data(const TickDataBatch& batch) override {
+        ticks += batch.items.size();
+    }
+
+    void on_bar_data(const BarDataBatch&) override {}
+
+    void on_market_data_status(const MarketDataStatusUpdate&) override {}
+};
+
+std::unique_ptr<TickDataBatch> make_batch(std::size_t ticks, std::uint64_t time_ms) {
+    auto batch = std::make_unique<TickDataBatch>();
+    batch->type = MarketDataType::TICKS;
+    batch->symbol = "EURUSD";
+    batch->price_digits = 5;
+    batch->items.reserve(ticks);
+    for (std::size_t i = 0; i < ticks; ++i) {
+        batch->items.push_back(Tick(0.0, 0.0, 1.08412 + 0.00001 * static_cast<double>(i % 7), 1.0, time_ms + i, 0, 0));
+    }
+    return batch;
+}
+
+void run_publish_ticks(BenchmarkState& state, std::size_t subscribers, std::size_t ticks_per_batch) {
+    MarketDataHub hub;
+    std::vector<std::shared_ptr<CountingSubscriber>> sinks;
+    for (std::size_t i = 0; i < subscribers; ++i) {
+        sinks.push_back(std::make_shared<CountingSubscriber>());
+        hub.add_subscriber(sinks.back());
+    }
+
+    // Batches are built outside the timed region; the hub takes ownership.
+    std::vector<std::unique_ptr<TickDataBatch>> batches;
+    batches.reserve(static_cast<std::size_t>(state.iterations()));
+    for (std::uint64_t i = 0; i < state.iterations(); ++i) {
+        batches.push_back(make_batch(ticks_per_batch, 1783028778000ULL + i * ticks_per_batch));
+    }
+
+    std::size_t next = 0;
+    for (auto _ : state) {
+        hub.publish_ticks(std::move(batches[next++]));
+    }
+
+    std::uint64_t delivered = 0;
+    for (const auto& sink : sinks) delivered += sink->ticks;
+    if (delivered != state.iterations() * subscribers * ticks_per_batch) state.fail("lost tick deliveries");
+    state.set_items_processed(delivered);
+    state.set_counter("subscribers", static_cast<double>(subscribers));
+    state.set_counter("ticks_per_batch", static_cast<double>(ticks_per_batch));
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK_MAX(market_data_publish_1x1, "market_data_hub/publish_ticks/subscribers:1/batch:1", 500000) {
+    run_publish_ticks(state, 1, 1);
+}
+
+OPTIONX_BENCHMARK_MAX(market_data_publish_16x1, "market_data_hub/publish_ticks/subscribers:16/batch:1", 500000) {
+    run_publish_ticks(state, 16, 1);
+}
+
+OPTIONX_BENCHMARK_MAX(market_data_publish_16x32, "market_data_hub/publish_ticks/subscribers:16/batch:32", 50000) {
+    run_publish_ticks(state, 16, 32);
+}
@@ -0,0 +1,78 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/data.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+using namespace optionx;
+
+constexpr std::size_t kSeries = 1000;
+constexpr std::size_t kOutcomes = 4096;
+
+struct OrderFixture {
+    std::vector<std::unique_ptr<TradeSignal>> signals;
+    std::vector<std::uint32_t> order;
+    std::vector<TradeState> outcomes;
+
+    OrderFixture() {
+        MmSeriesConfig config;
+        config.type = MmSystemType::MARTINGALE_SYMBOL;
+        config.amount = 1.0;
+        config.multiplier = 2.2;
+        config.steps = 6;
+        for (std::size_t i = 0; i < kSeries; ++i) {
+            auto signal = std::make_unique<TradeSignal>();
+            signal->signal_name = "strategy-" + std::to_string(i % 50);
+            signal->symbol = "SYM" + std::to_string(i / 50);
+            signal->account_id = 99;
+            signal->set_money_management(std::make_unique<MmSeriesParams>(config));
+            signals.push_back(std::move(signal));
+        }
+        std::mt19937 rng(7);
+        for (std::size_t i = 0; i < kOutcomes; ++i) {
+            order.push_back(static_cast<std::uint32_t>(rng() % kSeries));
+            outcomes.push_back(rng() % 100 < 56 ? TradeState::WIN : TradeState::LOSS);
+        }
+    }
+};
+
+/// MmSeriesEngine with the series key hashed from the signal on every order.
+void run_engine(BenchmarkState& state, bool cache_keys) {
+    OrderFixture fixture;
+    MmSeriesEngine engine;
+    const auto table = engine.add_table(*fixture.signals.front());
+    const auto scope = engine.table(table)->scope();
+    std::vector<std::uint64_t> keys;
+    for (const auto& signal : fixture.signals) keys.push_back(MmSeriesEngine::series_key(*signal, scope));
+
+    double total = 0.0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto index = fixture.order[i % kOutcomes];
+        const auto key = cache_keys ? keys[index] : MmSeriesEngine::series_key(*fixture.signals[index], scope);
+        const auto decision = engine.decide(table, key);
+        total += decision.amount;
+        engine.on_result(table, key, decision.step, fixture.outcomes[i % kOutcomes]);
+        ++i;
+    }
+    optionx::benchmarks::do_not_optimize(total);
+    state.set_items_processed(state.iterations());
+    state.set_counter("active_series", static_cast<double>(engine.active_series()));
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK(mm_series_engine, "mm_series/order/engine") {
+    run_engine(state, false);
+}
+
+OPTIONX_BENCHMARK(mm_series_engine_cached_key, "mm_series/order/engine_cached_key") {
+    run_engine(state, true);
+}
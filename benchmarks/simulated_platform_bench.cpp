@@ -0,0 +1,108 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/platforms.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+using namespace optionx;
+using platforms::SimulatedTradingPlatform;
+using platforms::simulator::ExpiryResolution;
+using platforms::simulator::LatencyDistribution;
+using platforms::simulator::SimulationConfig;
+
+constexpr std::uint64_t kBatch = 64;
+
+/// Zero-latency broker with no trade limit, so the platform loop and the
+/// trade queue are the only costs.
+std::unique_ptr<SimulationConfig> make_config(double rejection_rate) {
+    auto config = std::make_unique<SimulationConfig>();
+    config->seed = 42;
+    config->max_trades = 1000000;
+    config->max_amount = 1000000.0;
+    config->balance = 1.0e9;
+    config->open_latency = LatencyDistribution::fixed(0);
+    config->close_latency = LatencyDistribution::fixed(0);
+    config->rejection_rate = rejection_rate;
+    config->expiry_resolution = ExpiryResolution::SEEDED;
+    config->publish_prices = false;
+    return config;
+}
+
+bool drive_until(SimulatedTradingPlatform& platform, const std::uint64_t& counter, std::uint64_t target) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (counter < target) {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        platform.process();
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+/// Places batches of SPRINT orders and drives the platform loop until every
+/// order of the batch was filled or rejected by the simulated broker.
+void run_batches(BenchmarkState& state, double rejection_rate, TradeState expected) {
+    std::uint64_t answered = 0;
+    std::uint64_t unexpected = 0;
+    SimulatedTradingPlatform platform;
+
+    bool connected = false;
+    platform.configure_auth(make_config(rejection_rate));
+    platform.connect([&connected](ConnectionResult result) {
+        connected = result.success;
+    });
+    platform.run(false);
+    while (!connected) {
+        platform.process();
+        std::this_thread::yield();
+    }
+
+    std::uint64_t placed = 0;
+    for (auto _ : state) {
+        const auto target = answered + kBatch;
+        for (std::uint64_t i = 0; i < kBatch; ++i) {
+            auto request = std::make_unique<TradeRequest>();
+            request->symbol = "EURUSD";
+            request->amount = 1.0;
+            request->option_type = OptionType::SPRINT;
+            request->order_type = placed++ % 2 == 0 ? OrderType::BUY : OrderType::SELL;
+            request->duration = 60;
+            request->add_callback([&answered, &unexpected, expected](
+                    std::unique_ptr<TradeRequest>,
+                    std::unique_ptr<TradeResult> result) {
+                if (result->trade_state != TradeState::OPEN_SUCCESS &&
+                    result->trade_state != TradeState::OPEN_ERROR) return;
+                ++answered;
+                if (result->trade_state != expected) ++unexpected;
+            });
+            if (!platform.place_trade(std::move(request))) {
+                state.fail("place_trade rejected a request");
+                return;
+            }
+        }
+        if (!drive_until(platform, answered, target)) {
+            state.fail("simulated broker did not answer the batch");
+            return;
+        }
+    }
+
+    if (unexpected != 0) state.fail("simulated broker answered with an unexpected state");
+    state.set_items_processed(answered);
+    state.set_counter("sent_orders", static_cast<double>(platform.sent_orders()));
+    platform.shutdown();
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK_MAX(simulated_platform_fill, "simulated_platform/place+fill/batch:64", 200) {
+    run_batches(state, 0.0, TradeState::OPEN_SUCCESS);
+}
+
+OPTIONX_BENCHMARK_MAX(simulated_platform_reject, "simulated_platform/place+reject/batch:64", 200) {
+    run_batches(state, 1.0, TradeState::OPEN_ERROR);
+}
@@ -0,0 +1,116 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/data.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+
+constexpr std::size_t kSymbols = 300;
+constexpr std::size_t kQueries = 1024;
+
+/// Previous implementation: linear scan with exact string comparison.
+std::optional<optionx::SymbolInfo> reference_find(
+        const std::vector<optionx::SymbolInfo>& symbols,
+        const std::string& symbol) {
+    for (const auto& sym_info : symbols) {
+        if (sym_info.symbol == symbol) {
+            return sym_info;
+        }
+    }
+    return std::nullopt;
+}
+
+/// 300 listed symbols and a random lookup stream over them.
+struct SymbolFixture {
+    optionx::SymbolsInfo info;
+    std::vector<std::string> queries;
+
+    SymbolFixture() {
+        info.begin_update();
+        for (std::size_t i = 0; i < kSymbols; ++i) {
+            info.add_symbol("SYM" + std::to_string(i) + "USD", static_cast<int64_t>(i % 6));
+        }
+        info.end_update();
+
+        std::uint32_t state = 0x12345678u;
+        for (std::size_t i = 0; i < kQueries; ++i) {
+            state = state * 1664525u + 1013904223u;
+            queries.push_back(info.symbols()[state % kSymbols].symbol);
+        }
+    }
+};
+
+const SymbolFixture& fixture() {
+    static const SymbolFixture s_fixture;
+    return s_fixture;
+}
+
+bool check_lookups(BenchmarkState& state, const SymbolFixture& data) {
+    for (const auto& query : data.queries) {
+        const auto expected = reference_find(data.info.symbols(), query);
+        const auto found = data.info.find_symbol(query);
+        if (!expected || !found || found->digits != expected->digits) {
+            state.fail("registry lookup disagrees with the linear scan");
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK(symbol_registry_reference, "symbol_registry/find/linear_scan:300") {
+    const auto& data = fixture();
+    std::int64_t digits = 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        digits += reference_find(data.info.symbols(), data.queries[i++ % kQueries])->digits;
+    }
+    optionx::benchmarks::do_not_optimize(digits);
+    state.set_items_processed(state.iterations());
+}
+
+OPTIONX_BENCHMARK(symbol_registry_find_symbol, "symbol_registry/find/find_symbol:300") {
+    const auto& data = fixture();
+    if (!check_lookups(state, data)) return;
+    std::int64_t digits = 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        digits += data.info.find_symbol(data.queries[i++ % kQueries])->digits;
+    }
+    optionx::benchmarks::do_not_optimize(digits);
+    state.set_items_processed(state.iterations());
+}
+
+OPTIONX_BENCHMARK(symbol_registry_snapshot, "symbol_registry/find/held_snapshot:300") {
+    const auto& data = fixture();
+    if (!check_lookups(state, data)) return;
+    const auto registry = data.info.snapshot();
+    std::int64_t digits = 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        digits += registry->find(data.queries[i++ % kQueries])->digits;
+    }
+    optionx::benchmarks::do_not_optimize(digits);
+    state.set_items_processed(state.iterations());
+}
+
+OPTIONX_BENCHMARK_MAX(symbol_registry_bulk_load, "symbol_registry/bulk_load/batched:300", 20000) {
+    const auto& data = fixture();
+    for (auto _ : state) {
+        optionx::SymbolsInfo info;
+        info.begin_update();
+        for (const auto& symbol : data.info.symbols()) {
+            info.add_symbol(symbol.symbol, symbol.digits);
+        }
+        info.end_update();
+        optionx::benchmarks::do_not_optimize(info);
+    }
+    state.set_items_processed(state.iterations() * kSymbols);
+}
@@ -0,0 +1,181 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/storages.hpp>
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+using optionx::storage::TradeMetaStatsCalculator;
+using optionx::storage::TradeRecordFilterMatcher;
+using optionx::storage::TradeStatsCalculator;
+
+constexpr std::size_t kRecords = 20000;
+constexpr std::size_t kSymbols = 20;
+constexpr std::size_t kSignals = 10;
+
+std::vector<optionx::TradeRecord> make_records() {
+    std::vector<optionx::TradeRecord> records;
+    records.reserve(kRecords);
+    const std::int64_t start_ms = 1700006400000; // 2023-11-15 00:00:00 UTC
+    for (std::size_t i = 0; i < kRecords; ++i) {
+        optionx::TradeRecord record;
+        record.unique_id = static_cast<std::int64_t>(i + 1);
+        record.account_id = 7001 + static_cast<std::int64_t>(i % 2);
+        record.platform_type = optionx::PlatformType::INTRADE_BAR;
+        record.account_type = i % 2 == 0 ? optionx::AccountType::DEMO : optionx::AccountType::REAL;
+        record.currency = i % 3 == 0 ? optionx::CurrencyType::RUB : optionx::CurrencyType::USD;
+        record.symbol = "SYM" + std::to_string(i % kSymbols);
+        record.signal_name = "signal-" + std::to_string(i % kSignals);
+        record.option_type = optionx::OptionType::CLASSIC;
+        record.order_type = i % 2 == 0 ? optionx::OrderType::BUY : optionx::OrderType::SELL;
+        record.amount = 10.0 + static_cast<double>(i % 5);
+        record.payout = 0.8;
+        const bool win = (i * 7) % 11 < 6;
+        record.trade_state = win ? optionx::TradeState::WIN : optionx::TradeState::LOSS;
+        record.profit = win ? record.amount * record.payout : -record.amount;
+        record.ping = static_cast<std::int64_t>(i % 120);
+        record.place_date = start_ms + static_cast<std::int64_t>(i) * 97000;
+        record.open_date = record.place_date;
+        record.close_date = record.open_date + 60000 * static_cast<std::int64_t>(1 + i % 5);
+        record.duration = static_cast<std::uint32_t>(60 * (1 + i % 5));
+        records.push_back(std::move(record));
+    }
+    return records;
+}
+
+template<class T>
+void reference_dimension(
+        const std::vector<optionx::TradeRecord>& records,
+        const optionx::TradeStatsConfig& config,
+        const std::set<T>& values,
+        optionx::IncludeExcludeFilter<T> optionx::TradeRecordFilter::*member,
+        std::vector<optionx::TradeStats>& out) {
+    for (const auto& value : values) {
+        auto cfg = config;
+        (cfg.filter.*member).include = {value};
+        out.push_back(std::move(*TradeStatsCalculator::calc(records, cfg)));
+    }
+}
+
+/// Previous algorithm: collect distinct values, then rerun the full
+/// calculator once per value of every dimension.
+optionx::TradeMetaStats reference_meta_calc(
+        const std::vector<optionx::TradeRecord>& records,
+        const optionx::TradeStatsConfig& config) {
+    optionx::TradeMetaStats meta{};
+    std::set<optionx::PlatformType> platforms;
+    std::set<optionx::AccountType> accounts;
+    std::set<optionx::CurrencyType> currencies;
+    std::set<std::string> symbols;
+    std::set<std::string> signals;
+    std::set<std::uint32_t> durations;
+    for (const auto& rec : records) {
+        if (!TradeRecordFilterMatcher::match_filter(rec, config.filter, config.time_zone)) continue;
+        if (!config.include_errors && optionx::is_error_trade_state(rec.trade_state)) continue;
+        if (!config.include_non_terminal && !optionx::is_terminal_trade_state(rec.trade_state)) continue;
+        platforms.insert(rec.platform_type);
+        accounts.insert(rec.account_type);
+        currencies.insert(rec.currency);
+        if (!rec.symbol.empty()) symbols.insert(rec.symbol);
+        if (!rec.signal_name.empty()) signals.insert(rec.signal_name);
+        if (rec.duration > 0) durations.insert(rec.duration);
+    }
+    meta.symbols.assign(symbols.begin(), symbols.end());
+    meta.signals.assign(signals.begin(), signals.end());
+
+    using Filter = optionx::TradeRecordFilter;
+    reference_dimension(records, config, platforms, &Filter::platforms, meta.platform_stats);
+    reference_dimension(records, config, accounts, &Filter::accounts, meta.account_stats);
+    reference_dimension(records, config, currencies, &Filter::currencies, meta.currency_stats);
+    reference_dimension(records, config, symbols, &Filter::symbols, meta.symbol_stats);
+    reference_dimension(records, config, signals, &Filter::signals, meta.signal_stats);
+    reference_dimension(records, config, durations, &Filter::durations, meta.duration_stats);
+
+    std::set<std::uint32_t> hours;
+    for (std::uint32_t h = 0; h < 24; ++h) hours.insert(h);
+    std::set<std::uint32_t> weekdays;
+    for (std::uint32_t wd = 0; wd < 7; ++wd) weekdays.insert(wd);
+    reference_dimension(records, config, hours, &Filter::hours, meta.hour_stats);
+    reference_dimension(records, config, weekdays, &Filter::weekdays, meta.weekday_stats);
+    return meta;
+}
+
+bool same_stats(
+        const std::vector<optionx::TradeStats>& actual,
+        const std::vector<optionx::TradeStats>& expected) {
+    if (actual.size() != expected.size()) return false;
+    for (std::size_t i = 0; i < actual.size(); ++i) {
+        if (actual[i].total.trades != expected[i].total.trades ||
+            actual[i].total.wins != expected[i].total.wins ||
+            actual[i].total_profit != expected[i].total_profit ||
+            actual[i].max_absolute_drawdown != expected[i].max_absolute_drawdown ||
+            actual[i].equity_curve.x_time != expected[i].equity_curve.x_time ||
+            actual[i].series.max_loss_series != expected[i].series.max_loss_series) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool same_meta(const optionx::TradeMetaStats& actual, const optionx::TradeMetaStats& expected) {
+    return actual.symbols == expected.symbols &&
+           actual.signals == expected.signals &&
+           same_stats(actual.platform_stats, expected.platform_stats) &&
+           same_stats(actual.account_stats, expected.account_stats) &&
+           same_stats(actual.currency_stats, expected.currency_stats) &&
+           same_stats(actual.symbol_stats, expected.symbol_stats) &&
+           same_stats(actual.signal_stats, expected.signal_stats) &&
+           same_stats(actual.duration_stats, expected.duration_stats) &&
+           same_stats(actual.hour_stats, expected.hour_stats) &&
+           same_stats(actual.weekday_stats, expected.weekday_stats);
+}
+
+/// Two accounts, RUB and USD records converted to USD.
+struct MetaFixture {
+    std::vector<optionx::TradeRecord> records = make_records();
+    optionx::TradeStatsConfig config;
+
+    MetaFixture() {
+        config.start_balance = 1000.0;
+        config.currency_matrix.set_base_currency(optionx::CurrencyType::USD);
+        config.currency_matrix.set_rate(optionx::CurrencyType::RUB, optionx::CurrencyType::USD, 0.011);
+    }
+};
+
+const MetaFixture& fixture() {
+    static const MetaFixture s_fixture;
+    return s_fixture;
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK_MAX(trade_meta_stats_reference, "trade_meta_stats/calc/per_value_reference:20000", 5) {
+    const auto& data = fixture();
+    for (auto _ : state) {
+        const auto meta = reference_meta_calc(data.records, data.config);
+        optionx::benchmarks::do_not_optimize(meta);
+    }
+    state.set_items_processed(state.iterations() * kRecords);
+}
+
+OPTIONX_BENCHMARK_MAX(trade_meta_stats_single_pass, "trade_meta_stats/calc/single_pass:20000", 200) {
+    const auto& data = fixture();
+    if (!same_meta(TradeMetaStatsCalculator::calc(data.records, data.config),
+                   reference_meta_calc(data.records, data.config))) {
+        state.fail("single-pass meta stats disagree with the per-value reference");
+        return;
+    }
+
+    for (auto _ : state) {
+        const auto meta = TradeMetaStatsCalculator::calc(data.records, data.config);
+        optionx::benchmarks::do_not_optimize(meta);
+    }
+    state.set_items_processed(state.iterations() * kRecords);
+    state.set_counter("symbols", static_cast<double>(kSymbols));
+    state.set_counter("signals", static_cast<double>(kSignals));
+}
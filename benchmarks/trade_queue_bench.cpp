@@ -0,0 +1,96 @@
+#include "common/BenchmarkHarness.hpp"
+#include "common/StandIns.hpp"
+
+#include <optionx_cpp/components.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+using namespace optionx;
+
+class BenchTradeExecution final : public components::BaseTradeExecutionComponent {
+public:
+    using components::BaseTradeExecutionComponent::BaseTradeExecutionComponent;
+
+    PlatformType platform_type() const override {
+        return PlatformType::SIMULATOR;
+    }
+};
+
+/// Broker stand-in: settles every sent trade as WIN inside the request event,
+/// so the queue finalizes it on the same process() call.
+class InstantBroker final : public utils::EventMediator {
+public:
+    explicit InstantBroker(utils::EventBus& bus)
+        : utils::EventMediator(bus) {
+        subscribe<events::TradeRequestEvent>();
+    }
+
+    void on_event(const utils::Event* const event) override {
+        const auto* request_event = dynamic_cast<const events::TradeRequestEvent*>(event);
+        if (!request_event) return;
+        auto& result = request_event->result;
+        result->open_price = 1.08412;
+        result->close_price = 1.08420;
+        result->open_date = result->send_date;
+        result->close_date = result->send_date + 60000;
+        result->profit = result->amount * result->payout;
+        result->trade_state = result->live_state = TradeState::WIN;
+    }
+};
+
+std::unique_ptr<TradeRequest> make_request(std::uint64_t index) {
+    auto request = std::make_unique<TradeRequest>();
+    request->symbol = "EURUSD";
+    request->signal_name = "bench";
+    request->unique_hash = "bench-" + std::to_string(index);
+    request->option_type = OptionType::SPRINT;
+    request->order_type = index % 2 == 0 ? OrderType::BUY : OrderType::SELL;
+    request->amount = 10.0;
+    request->duration = 60;
+    return request;
+}
+
+} // namespace
+
+// One iteration places a batch of trades and drives process() until every
+// trade of the batch reached a terminal state.
+OPTIONX_BENCHMARK(trade_queue_place_and_settle, "trade_queue/place+settle/batch:32") {
+    constexpr std::uint64_t kBatch = 32;
+    utils::EventBus bus;
+    BenchTradeExecution execution(bus, std::make_shared<benchmarks::BenchAccountInfo>());
+    InstantBroker broker(bus);
+
+    std::uint64_t settled = 0;
+    std::uint64_t callbacks = 0;
+    execution.set_trade_result_callback([&](std::unique_ptr<TradeRequest>, std::unique_ptr<TradeResult> result) {
+        ++callbacks;
+        if (result->trade_state == TradeState::WIN) ++settled;
+    });
+
+    std::uint64_t placed = 0;
+    for (auto _ : state) {
+        const auto target = settled + kBatch;
+        for (std::uint64_t i = 0; i < kBatch; ++i) {
+            if (!execution.place_trade(make_request(placed++))) {
+                state.fail("place_trade rejected a request");
+                return;
+            }
+        }
+        for (std::uint64_t guard = 0; settled < target && guard < kBatch * 4; ++guard) {
+            execution.process();
+        }
+        if (settled != target) {
+            state.fail("trades did not settle");
+            return;
+        }
+    }
+
+    execution.shutdown();
+    state.set_items_processed(settled);
+    state.set_counter("callbacks_per_trade", settled ? static_cast<double>(callbacks) / static_cast<double>(settled) : 0.0);
+}
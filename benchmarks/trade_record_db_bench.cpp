@@ -0,0 +1,133 @@
+#include "common/BenchmarkHarness.hpp"
+#include "common/StandIns.hpp"
+
+#include <optionx_cpp/storages.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <system_error>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+using optionx::storage::TradeRecordDB;
+
+constexpr std::size_t kPrefilled = 10000;
+
+/// Owns a throw-away database under the system temp directory.
+class TempTradeRecordDB {
+public:
+    TempTradeRecordDB() {
+        static std::atomic<std::uint64_t> counter{0};
+        const auto stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+        m_path = std::filesystem::temp_directory_path() /
+            ("optionx_bench_trades_" + std::to_string(stamp) + "_" + std::to_string(counter.fetch_add(1)));
+
+        mdbxc::Config config;
+        config.pathname = m_path.string();
+        config.max_dbs = 4;
+        config.no_subdir = false;
+        config.relative_to_exe = false;
+        m_db = std::make_unique<TradeRecordDB>(config);
+    }
+
+    ~TempTradeRecordDB() {
+        m_db.reset();
+        std::error_code ec;
+        std::filesystem::remove_all(m_path, ec);
+    }
+
+    TradeRecordDB& operator*() noexcept { return *m_db; }
+    TradeRecordDB* operator->() noexcept { return m_db.get(); }
+
+private:
+    std::filesystem::path m_path;
+    std::unique_ptr<TradeRecordDB> m_db;
+};
+
+bool prefill(TradeRecordDB& db, const std::vector<optionx::TradeRecord>& records) {
+    for (const auto& record : records) {
+        if (!db.upsert(record).ok()) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK_MAX(trade_record_db_upsert, "trade_record_db/upsert", 20000) {
+    TempTradeRecordDB db;
+    if (!db->is_open()) {
+        state.fail("database did not open");
+        return;
+    }
+    const auto records = optionx::benchmarks::make_trade_records(static_cast<std::size_t>(state.iterations()));
+
+    std::size_t next = 0;
+    for (auto _ : state) {
+        if (!db->upsert(records[next++]).ok()) {
+            state.fail("upsert failed");
+            return;
+        }
+    }
+    state.set_items_processed(state.iterations());
+}
+
+OPTIONX_BENCHMARK(trade_record_db_find_by_uid, "trade_record_db/find_by_uid/records:10000") {
+    TempTradeRecordDB db;
+    const auto records = optionx::benchmarks::make_trade_records(kPrefilled);
+    if (!db->is_open() || !prefill(*db, records)) {
+        state.fail("prefill failed");
+        return;
+    }
+
+    std::uint64_t found = 0;
+    std::uint64_t uid = 0;
+    for (auto _ : state) {
+        const auto result = db->find_by_uid(static_cast<std::int64_t>(uid++ % kPrefilled) + 1);
+        found += result.ok() ? 1 : 0;
+    }
+    if (found != state.iterations()) state.fail("lookup missed a stored record");
+    state.set_items_processed(found);
+}
+
+OPTIONX_BENCHMARK_MAX(trade_record_db_find_all, "trade_record_db/find_records_all/records:10000", 1000) {
+    TempTradeRecordDB db;
+    const auto records = optionx::benchmarks::make_trade_records(kPrefilled);
+    if (!db->is_open() || !prefill(*db, records)) {
+        state.fail("prefill failed");
+        return;
+    }
+
+    std::uint64_t loaded = 0;
+    for (auto _ : state) {
+        const auto result = db->find_records(optionx::TradeRecordQuery::all());
+        loaded += result.records.size();
+    }
+    if (loaded != state.iterations() * kPrefilled) state.fail("query returned an incomplete history");
+    state.set_items_processed(loaded);
+}
+
+OPTIONX_BENCHMARK(trade_record_db_find_range_day, "trade_record_db/find_range_day/records:10000") {
+    TempTradeRecordDB db;
+    const auto records = optionx::benchmarks::make_trade_records(kPrefilled);
+    if (!db->is_open() || !prefill(*db, records)) {
+        state.fail("prefill failed");
+        return;
+    }
+
+    constexpr std::int64_t kDayMs = 86400000;
+    const std::int64_t first = records.front().open_date;
+    const std::int64_t days = (records.back().open_date - first) / kDayMs + 1;
+    std::uint64_t loaded = 0;
+    std::int64_t day = 0;
+    for (auto _ : state) {
+        const std::int64_t start = first + (day++ % days) * kDayMs;
+        const auto result = db->find_range(start, start + kDayMs - 1);
+        loaded += result.records.size();
+    }
+    state.set_items_processed(loaded);
+}
@@ -0,0 +1,59 @@
+#include "common/BenchmarkHarness.hpp"
+#include "common/StandIns.hpp"
+
+#include <optionx_cpp/storages.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+using optionx::storage::TradeMetaStatsCalculator;
+using optionx::storage::TradeStatsCalculator;
+
+constexpr std::size_t kRecords = 20000;
+
+const std::vector<optionx::TradeRecord>& history() {
+    static const auto records = optionx::benchmarks::make_trade_records(kRecords);
+    return records;
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK(trade_stats_calc, "trade_stats/calc/records:20000") {
+    const auto& records = history();
+    const optionx::TradeStatsConfig config;
+
+    std::uint64_t trades = 0;
+    for (auto _ : state) {
+        const auto stats = TradeStatsCalculator::calc(records, config);
+        optionx::benchmarks::do_not_optimize(stats->total_profit);
+        trades += stats->total.trades;
+    }
+    if (trades != state.iterations() * kRecords) state.fail("calculator skipped records");
+    state.set_items_processed(trades);
+}
+
+OPTIONX_BENCHMARK(trade_stats_calc_filtered, "trade_stats/calc_symbol_filter/records:20000") {
+    const auto& records = history();
+    optionx::TradeStatsConfig config;
+    config.filter.symbols.include = {"SYM3"};
+
+    for (auto _ : state) {
+        const auto stats = TradeStatsCalculator::calc(records, config);
+        optionx::benchmarks::do_not_optimize(stats->total_profit);
+    }
+    state.set_items_processed(state.iterations() * kRecords);
+}
+
+OPTIONX_BENCHMARK_MAX(trade_stats_meta_calc, "trade_stats/meta_calc/records:20000", 200) {
+    const auto& records = history();
+    const optionx::TradeStatsConfig config;
+
+    for (auto _ : state) {
+        const auto meta = TradeMetaStatsCalculator::calc(records, config);
+        optionx::benchmarks::do_not_optimize(meta);
+    }
+    state.set_items_processed(state.iterations() * kRecords);
+}
@@ -0,0 +1,106 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/data.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+
+constexpr std::size_t kTimestamps = 65536;
+constexpr auto kZone = time_shield::CET;
+
+/// Trade history spread over a few months, one record every ~63 seconds.
+const std::vector<std::int64_t>& column() {
+    static const auto s_column = []() {
+        std::vector<std::int64_t> out(kTimestamps);
+        std::int64_t ts = time_shield::to_timestamp_ms(2024, 1, 1, 0, 0, 0);
+        std::uint32_t state = 0x9E3779B9u;
+        for (auto& value : out) {
+            state = state * 1664525u + 1013904223u;
+            ts += 1000 + static_cast<std::int64_t>(state % 125000u);
+            value = ts;
+        }
+        return out;
+    }();
+    return s_column;
+}
+
+/// Previous implementation: every conversion asks time-shield for the offset.
+std::int64_t reference_to_local_ms(std::int64_t utc_ms, time_shield::TimeZone zone) {
+    time_shield::tz_t resolved = 0;
+    const auto offset = time_shield::zone_offset_at_utc_ms(
+        static_cast<time_shield::ts_ms_t>(utc_ms), zone, resolved)
+            ? static_cast<std::int64_t>(resolved)
+            : 0;
+    return utc_ms + offset * time_shield::MS_PER_SEC;
+}
+
+const std::vector<std::int64_t>& reference_column() {
+    static const auto s_reference = []() {
+        const auto& utc = column();
+        std::vector<std::int64_t> out(utc.size());
+        for (std::size_t i = 0; i < utc.size(); ++i) {
+            out[i] = reference_to_local_ms(utc[i], kZone);
+        }
+        return out;
+    }();
+    return s_reference;
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK(trade_time_zone_reference, "trade_time_zone/to_local/per_timestamp_resolve") {
+    const auto& utc = column();
+    std::int64_t total = 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        total += reference_to_local_ms(utc[i++ % kTimestamps], kZone);
+    }
+    optionx::benchmarks::do_not_optimize(total);
+    state.set_items_processed(state.iterations());
+}
+
+OPTIONX_BENCHMARK(trade_time_zone_table, "trade_time_zone/to_local/transition_table") {
+    const auto& utc = column();
+    const auto& expected = reference_column();
+    const auto tz = optionx::TradeTimeZone::named(kZone);
+    for (std::size_t i = 0; i < kTimestamps; ++i) {
+        if (tz.to_local_ms(utc[i]) != expected[i]) {
+            state.fail("transition table disagrees with time-shield");
+            return;
+        }
+    }
+
+    std::int64_t total = 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        total += tz.to_local_ms(utc[i++ % kTimestamps]);
+    }
+    optionx::benchmarks::do_not_optimize(total);
+    state.set_items_processed(state.iterations());
+}
+
+OPTIONX_BENCHMARK_MAX(trade_time_zone_batch, "trade_time_zone/to_local/batch_cursor:65536", 2000) {
+    const auto& utc = column();
+    const auto tz = optionx::TradeTimeZone::named(kZone);
+    std::vector<std::int64_t> local(kTimestamps);
+    for (auto _ : state) {
+        tz.to_local_ms(utc.data(), utc.size(), local.data());
+        optionx::benchmarks::do_not_optimize(local);
+    }
+    if (local != reference_column()) state.fail("batch conversion disagrees with time-shield");
+    state.set_items_processed(state.iterations() * kTimestamps);
+}
+
+OPTIONX_BENCHMARK_MAX(trade_time_zone_build, "trade_time_zone/build/named", 2000) {
+    std::size_t built = 0;
+    for (auto _ : state) {
+        const auto tz = optionx::TradeTimeZone::named(kZone);
+        optionx::benchmarks::do_not_optimize(tz);
+        ++built;
+    }
+    optionx::benchmarks::do_not_optimize(built);
+}
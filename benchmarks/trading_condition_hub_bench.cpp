@@ -0,0 +1,180 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/components.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+
+constexpr std::size_t kScopes = 2000;
+constexpr std::size_t kSubscribers = 200;
+constexpr std::size_t kScopesPerSubscriber = 10;
+constexpr std::size_t kUpdates = 65536;
+
+class CountingSubscriber final
+        : public optionx::components::ITradingConditionSubscriber {
+public:
+    void on_trading_condition(const optionx::TradingConditionUpdate& update) override {
+        ++calls;
+        if (update.payout) ++payouts;
+    }
+
+    std::size_t calls = 0;
+    std::size_t payouts = 0;
+};
+
+/// Previous implementation: linear `same_scope` upsert and full fan-out to
+/// every subscriber after pruning the subscriber vector.
+class ReferenceHub {
+public:
+    void add_subscriber(const std::shared_ptr<CountingSubscriber>& subscriber) {
+        m_subscribers.push_back(subscriber);
+    }
+
+    void publish(const optionx::TradingConditionUpdate& update) {
+        const auto it = std::find_if(
+            m_cached.begin(),
+            m_cached.end(),
+            [&update](const optionx::TradingConditionUpdate& cached) {
+                return cached.same_scope(update);
+            });
+        if (it == m_cached.end()) {
+            m_cached.push_back(update);
+        } else {
+            it->merge_patch(update);
+        }
+        m_subscribers.erase(
+            std::remove_if(
+                m_subscribers.begin(),
+                m_subscribers.end(),
+                [](const std::weak_ptr<CountingSubscriber>& item) { return item.expired(); }),
+            m_subscribers.end());
+        std::vector<std::shared_ptr<CountingSubscriber>> locked;
+        locked.reserve(m_subscribers.size());
+        for (const auto& subscriber : m_subscribers) {
+            if (auto item = subscriber.lock()) locked.push_back(std::move(item));
+        }
+        for (const auto& subscriber : locked) {
+            subscriber->on_trading_condition(update);
+        }
+    }
+
+    const std::vector<optionx::TradingConditionUpdate>& cached() const {
+        return m_cached;
+    }
+
+private:
+    std::vector<std::weak_ptr<CountingSubscriber>> m_subscribers;
+    std::vector<optionx::TradingConditionUpdate> m_cached;
+};
+
+optionx::TradingConditionUpdate make_scope(std::size_t index) {
+    optionx::TradingConditionUpdate scope;
+    scope.symbol = "SYM" + std::to_string(index);
+    scope.platform_type = optionx::PlatformType::INTRADE_BAR;
+    scope.account_type = optionx::AccountType::DEMO;
+    scope.currency = optionx::CurrencyType::USD;
+    scope.option_type = optionx::OptionType::SPRINT;
+    return scope;
+}
+
+/// Payout stream over 2000 scopes; most broker ticks repeat the current payout.
+const std::vector<optionx::TradingConditionUpdate>& updates() {
+    static const auto s_updates = []() {
+        std::vector<optionx::TradingConditionUpdate> out;
+        out.reserve(kUpdates);
+        std::uint32_t state = 0x51ED270Bu;
+        for (std::size_t i = 0; i < kUpdates; ++i) {
+            state = state * 1664525u + 1013904223u;
+            auto update = make_scope(state % kScopes);
+            update.payout = 0.70 + 0.01 * static_cast<double>((state >> 16) % 4u == 0 ? (state >> 8) % 10u : 0u);
+            update.market_open = true;
+            out.push_back(std::move(update));
+        }
+        return out;
+    }();
+    return s_updates;
+}
+
+std::vector<std::shared_ptr<CountingSubscriber>> subscribe_all(ReferenceHub& hub) {
+    std::vector<std::shared_ptr<CountingSubscriber>> subscribers;
+    for (std::size_t i = 0; i < kSubscribers; ++i) {
+        subscribers.push_back(std::make_shared<CountingSubscriber>());
+        hub.add_subscriber(subscribers.back());
+    }
+    return subscribers;
+}
+
+/// Every subscriber watches its own 10 scopes.
+std::vector<std::shared_ptr<CountingSubscriber>> subscribe_scoped(optionx::components::TradingConditionHub& hub) {
+    std::vector<std::shared_ptr<CountingSubscriber>> subscribers;
+    for (std::size_t i = 0; i < kSubscribers; ++i) {
+        subscribers.push_back(std::make_shared<CountingSubscriber>());
+        std::vector<optionx::TradingConditionUpdate> scopes;
+        for (std::size_t j = 0; j < kScopesPerSubscriber; ++j) {
+            scopes.push_back(make_scope((i * kScopesPerSubscriber + j) % kScopes));
+        }
+        hub.add_scoped_subscriber(subscribers.back(), scopes);
+    }
+    return subscribers;
+}
+
+std::size_t total_calls(const std::vector<std::shared_ptr<CountingSubscriber>>& subscribers) {
+    std::size_t calls = 0;
+    for (const auto& subscriber : subscribers) calls += subscriber->calls;
+    return calls;
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK(trading_condition_hub_reference, "trading_condition_hub/publish/linear_fan_out") {
+    const auto& data = updates();
+    ReferenceHub hub;
+    const auto subscribers = subscribe_all(hub);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        hub.publish(data[i++ % kUpdates]);
+    }
+    state.set_items_processed(state.iterations());
+    state.set_counter("callbacks_per_publish",
+        static_cast<double>(total_calls(subscribers)) / static_cast<double>(state.iterations()));
+}
+
+OPTIONX_BENCHMARK(trading_condition_hub_indexed, "trading_condition_hub/publish/indexed_scoped_deltas") {
+    const auto& data = updates();
+    {
+        ReferenceHub reference;
+        optionx::components::TradingConditionHub hub(false);
+        for (const auto& update : data) {
+            reference.publish(update);
+            hub.publish(update);
+        }
+        if (hub.cached_updates().size() != reference.cached().size()) {
+            state.fail("indexed hub cached a different number of scopes");
+            return;
+        }
+        for (const auto& cached : reference.cached()) {
+            const auto current = hub.current_condition(cached);
+            if (!current || current->payout != cached.payout) {
+                state.fail("indexed hub disagrees with the linear reference");
+                return;
+            }
+        }
+    }
+
+    optionx::components::TradingConditionHub hub(false);
+    const auto subscribers = subscribe_scoped(hub);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        hub.publish(data[i++ % kUpdates]);
+    }
+    state.set_items_processed(state.iterations());
+    state.set_counter("callbacks_per_publish",
+        static_cast<double>(total_calls(subscribers)) / static_cast<double>(state.iterations()));
+}
@@ -0,0 +1,135 @@
+#include "common/BenchmarkHarness.hpp"
+
+#include <optionx_cpp/bridges/trading_view.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using optionx::benchmarks::BenchmarkState;
+namespace tv_protocol = optionx::bridges::tradingview::detail;
+
+constexpr std::size_t kCustomKeywordsPerSide = 300;
+constexpr std::size_t kAlertCount = 10000;
+
+std::string random_word(std::mt19937& rng, std::size_t min_size, std::size_t max_size) {
+    static const char alphabet[] = "abcdefghijklmnopqrstuvwxyz";
+    std::uniform_int_distribution<std::size_t> size_dist(min_size, max_size);
+    std::uniform_int_distribution<std::size_t> char_dist(0, sizeof(alphabet) - 2);
+    std::string word(size_dist(rng), 'a');
+    for (auto& ch : word) {
+        ch = alphabet[char_dist(rng)];
+    }
+    return word;
+}
+
+std::vector<std::string> make_keywords(std::mt19937& rng, const std::string& prefix) {
+    std::vector<std::string> keywords;
+    keywords.reserve(kCustomKeywordsPerSide);
+    for (std::size_t i = 0; i < kCustomKeywordsPerSide; ++i) {
+        keywords.push_back(prefix + random_word(rng, 3, 9));
+    }
+    return keywords;
+}
+
+/// Synthetic alert corpus: symbol, filler words and, for most alerts, one custom keyword.
+struct AlertCorpus {
+    optionx::bridges::tradingview::TradingViewExtensionBridgeConfig config;
+    std::vector<std::string> alerts;
+
+    AlertCorpus() {
+        std::mt19937 rng(20260711);
+        config.buy_action_keywords = make_keywords(rng, "up");
+        config.sell_action_keywords = make_keywords(rng, "dn");
+
+        static const std::vector<std::string> symbols = {
+            "EURUSD", "GBPUSD", "BTCUSD", "XAUUSD", "USDJPY", "AUDCAD"
+        };
+        std::uniform_int_distribution<std::size_t> pick(0, 99);
+        alerts.reserve(kAlertCount);
+        for (std::size_t i = 0; i < kAlertCount; ++i) {
+            std::string text = symbols[i % symbols.size()];
+            text += " Crossing ";
+            for (int word = 0; word < 12; ++word) {
+                text += random_word(rng, 2, 10);
+                text += ' ';
+            }
+            const auto roll = pick(rng);
+            if (roll < 30) {
+                text += config.buy_action_keywords[roll % config.buy_action_keywords.size()];
+            } else if (roll < 60) {
+                text += config.sell_action_keywords[roll % config.sell_action_keywords.size()];
+            } else if (roll < 65) {
+                text += u8"\u041F\u041E\u041A\u0423\u041F\u0410\u0422\u042C";
+            }
+            text += " 64,143.35";
+            alerts.push_back(std::move(text));
+        }
+    }
+};
+
+const AlertCorpus& corpus() {
+    static const AlertCorpus s_corpus;
+    return s_corpus;
+}
+
+/// Previous path: rebuild the effective keyword lists and scan each keyword.
+std::uint8_t reference_mask(
+        const optionx::bridges::tradingview::TradingViewExtensionBridgeConfig& config,
+        const std::string& text) {
+    const auto buy = tv_protocol::protocol::effective_buy_action_keywords(config);
+    const auto sell = tv_protocol::protocol::effective_sell_action_keywords(config);
+    std::uint8_t mask = 0;
+    if (tv_protocol::protocol::contains_any_action_keyword(text, buy)) {
+        mask |= tv_protocol::TradingViewActionKeywordMatcher::BUY_MASK;
+    }
+    if (tv_protocol::protocol::contains_any_action_keyword(text, sell)) {
+        mask |= tv_protocol::TradingViewActionKeywordMatcher::SELL_MASK;
+    }
+    return mask;
+}
+
+} // namespace
+
+OPTIONX_BENCHMARK_MAX(tradingview_keywords_reference, "tradingview/action_keywords/reference_scan", 20000) {
+    const auto& data = corpus();
+    std::uint64_t matched = 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        matched += reference_mask(data.config, data.alerts[i++ % data.alerts.size()]) != 0;
+    }
+    optionx::benchmarks::do_not_optimize(matched);
+    state.set_items_processed(state.iterations());
+}
+
+OPTIONX_BENCHMARK(tradingview_keywords_compiled, "tradingview/action_keywords/compiled_matcher") {
+    const auto& data = corpus();
+    const auto matcher = tv_protocol::protocol::make_action_keyword_matcher(data.config);
+    for (const auto& text : data.alerts) {
+        if (matcher.match_mask(text) != reference_mask(data.config, text)) {
+            state.fail("compiled matcher disagrees with the reference scan");
+            return;
+        }
+    }
+
+    std::uint64_t matched = 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        matched += matcher.match_mask(data.alerts[i++ % data.alerts.size()]) != 0;
+    }
+    optionx::benchmarks::do_not_optimize(matched);
+    state.set_items_processed(state.iterations());
+    state.set_counter("keywords", static_cast<double>(matcher.keyword_count()));
+}
+
+OPTIONX_BENCHMARK_MAX(tradingview_keywords_build, "tradingview/action_keywords/build_matcher", 2000) {
+    const auto& data = corpus();
+    std::size_t keywords = 0;
+    for (auto _ : state) {
+        keywords += tv_protocol::protocol::make_action_keyword_matcher(data.config).keyword_count();
+    }
+    optionx::benchmarks::do_not_optimize(keywords);
+}
@@ -33,6 +33,7 @@
 
 #include "BaseBridge.hpp"
 #include "detail/BridgeTradeSignalValidation.hpp"
+#include "detail/BridgeDedupeStore.hpp"
 #include "bot_binary/BotBinaryBridgeConfig.hpp"
 #include "bot_binary/detail/BotBinaryProtocol.hpp"
 #include "bot_binary/BotBinaryBridge.hpp"
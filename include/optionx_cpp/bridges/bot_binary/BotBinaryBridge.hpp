@@ -38,8 +38,7 @@ namespace optionx::bridges::bot_binary {
             std::shared_ptr<HttpServer> http_server;
             std::thread http_thread;
             std::thread file_thread;
-            std::deque<std::string> dedupe_order;
-            std::unordered_set<std::string> dedupe_keys;
+            optionx::bridges::detail::BridgeDedupeStore dedupe;
             std::deque<std::string> seen_file_order;
             std::unordered_set<std::string> seen_file_keys;
             std::size_t active_http_requests = 0;
@@ -160,6 +159,7 @@ namespace optionx::bridges::bot_binary {
                 return;
             }
 
+            std::string dedupe_error;
             {
                 std::unique_lock<std::mutex> lock(m_state->mutex);
                 if (m_state->stopping) {
@@ -171,12 +171,20 @@ namespace optionx::bridges::bot_binary {
                 if (m_state->running) {
                     return;
                 }
+                if (!m_state->dedupe.open(
+                        config->dedupe_state_file,
+                        config->dedupe_ttl_seconds * 1000,
+                        config->dedupe_cache_size,
+                        optionx::bridges::detail::BridgeDedupeStore::now_ms(),
+                        dedupe_error)) {
+                    lock.unlock();
+                    notify_status(BridgeStatus::SERVER_START_FAILED, "dedupe", dedupe_error);
+                    return;
+                }
                 m_state->running = true;
                 m_state->stop_requested = false;
                 m_state->pending_callback_shutdown = false;
                 m_state->active_http_requests = 0;
-                m_state->dedupe_order.clear();
-                m_state->dedupe_keys.clear();
                 m_state->seen_file_order.clear();
                 m_state->seen_file_keys.clear();
             }
@@ -496,22 +504,21 @@ namespace optionx::bridges::bot_binary {
 
         static bool remember_key(
                 const std::shared_ptr<RuntimeState>& state,
-                const std::string& key,
-                const std::size_t cache_size) {
+                const std::string& key) {
             if (key.empty()) {
                 return true;
             }
-            std::lock_guard<std::mutex> lock(state->mutex);
-            if (state->dedupe_keys.find(key) != state->dedupe_keys.end()) {
-                return false;
-            }
-            state->dedupe_keys.insert(key);
-            state->dedupe_order.push_back(key);
-            while (state->dedupe_order.size() > cache_size) {
-                state->dedupe_keys.erase(state->dedupe_order.front());
-                state->dedupe_order.pop_front();
+            bool accepted = false;
+            std::string journal_error;
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                accepted = state->dedupe.remember(
+                    key,
+                    optionx::bridges::detail::BridgeDedupeStore::now_ms());
+                journal_error = state->dedupe.take_journal_error();
             }
-            return true;
+            notify_dedupe_journal_error(state, std::move(journal_error));
+            return accepted;
         }
 
         static void forget_key(
@@ -520,14 +527,27 @@ namespace optionx::bridges::bot_binary {
             if (key.empty()) {
                 return;
             }
-            std::lock_guard<std::mutex> lock(state->mutex);
-            state->dedupe_keys.erase(key);
-            state->dedupe_order.erase(
-                std::remove(
-                    state->dedupe_order.begin(),
-                    state->dedupe_order.end(),
-                    key),
-                state->dedupe_order.end());
+            std::string journal_error;
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->dedupe.forget(key);
+                journal_error = state->dedupe.take_journal_error();
+            }
+            notify_dedupe_journal_error(state, std::move(journal_error));
+        }
+
+        /// \brief Reports that dedupe keys are no longer persisted across restarts.
+        static void notify_dedupe_journal_error(
+                const std::shared_ptr<RuntimeState>& state,
+                std::string error) {
+            if (error.empty()) {
+                return;
+            }
+            notify_status_from_state(
+                state,
+                BridgeStatus::CONNECTION_ERROR,
+                "dedupe",
+                error + "; dedupe keys are kept in memory only.");
         }
 
         static bool remember_file_seen(
@@ -605,7 +625,7 @@ namespace optionx::bridges::bot_binary {
                     {"message", ex.what()}
                 };
             }
-            if (!remember_key(state, dedupe_key, config.dedupe_cache_size)) {
+            if (!remember_key(state, dedupe_key)) {
                 notify_signal_report(
                     state,
                     make_signal_report(
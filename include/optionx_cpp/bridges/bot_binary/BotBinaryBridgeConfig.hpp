@@ -26,6 +26,8 @@ namespace optionx::bridges::bot_binary {
                 {"file_signal_dir", file_signal_dir},
                 {"poll_interval_ms", poll_interval_ms},
                 {"dedupe_cache_size", dedupe_cache_size},
+                {"dedupe_ttl_seconds", dedupe_ttl_seconds},
+                {"dedupe_state_file", dedupe_state_file},
                 {"request_query_limit", request_query_limit},
                 {"delete_processed_files", delete_processed_files},
                 {"delete_invalid_files", delete_invalid_files},
@@ -71,6 +73,12 @@ namespace optionx::bridges::bot_binary {
             if (j.contains("dedupe_cache_size")) {
                 dedupe_cache_size = j.at("dedupe_cache_size").get<std::size_t>();
             }
+            if (j.contains("dedupe_ttl_seconds")) {
+                dedupe_ttl_seconds = j.at("dedupe_ttl_seconds").get<std::int64_t>();
+            }
+            if (j.contains("dedupe_state_file")) {
+                dedupe_state_file = j.at("dedupe_state_file").get<std::string>();
+            }
             if (j.contains("request_query_limit")) {
                 request_query_limit = j.at("request_query_limit").get<std::size_t>();
             }
@@ -120,6 +128,9 @@ namespace optionx::bridges::bot_binary {
             if (dedupe_cache_size == 0) {
                 return {false, "BotBinary bridge dedupe_cache_size must be positive."};
             }
+            if (dedupe_ttl_seconds < 0) {
+                return {false, "BotBinary bridge dedupe_ttl_seconds must not be negative."};
+            }
             if (request_query_limit == 0) {
                 return {false, "BotBinary bridge request_query_limit must be positive."};
             }
@@ -182,7 +193,9 @@ namespace optionx::bridges::bot_binary {
         std::string file_signal_dir = default_file_signal_dir(); ///< Directory with BotBinary `.txt` signals.
         std::int64_t poll_interval_ms = 250; ///< File-signal polling interval.
 
-        std::size_t dedupe_cache_size = 1024; ///< Recent transport keys retained to reject duplicates.
+        std::size_t dedupe_cache_size = 1024; ///< Hard cap on retained duplicate-detection keys.
+        std::int64_t dedupe_ttl_seconds = 3600; ///< Duplicate-detection window; 0 keeps keys until the cap evicts them.
+        std::string dedupe_state_file; ///< Optional journal that keeps dedupe keys across restarts.
         std::size_t request_query_limit = 64 * 1024; ///< Maximum accepted HTTP query size.
         bool delete_processed_files = true; ///< Remove accepted file-signal files after dispatch.
         bool delete_invalid_files = false;  ///< Remove invalid file-signal files after reporting.
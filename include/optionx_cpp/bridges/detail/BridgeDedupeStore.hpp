@@ -0,0 +1,437 @@
+#pragma once
+#ifndef OPTIONX_HEADER_BRIDGES_DETAIL_BRIDGE_DEDUPE_STORE_HPP_INCLUDED
+#define OPTIONX_HEADER_BRIDGES_DETAIL_BRIDGE_DEDUPE_STORE_HPP_INCLUDED
+
+/// \file BridgeDedupeStore.hpp
+/// \brief Defines a compact, time-windowed duplicate-signal store shared by bridges.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace optionx::bridges::detail {
+
+    /// \class BridgeDedupeStore
+    /// \brief Remembers recently handled signal keys as 64-bit hashes.
+    /// \details Keys live in an open-addressing table; insertion order is kept
+    ///          in a TTL ring, so expiry pops from the front in O(1). When a
+    ///          state file is configured, every change is appended to a small
+    ///          binary journal that is replayed on `open()` and compacted when
+    ///          stale records dominate. If the journal later fails to write,
+    ///          it is closed, the store keeps working in memory and the error
+    ///          is kept for `take_journal_error()`. The class is not
+    ///          thread-safe; bridges call it under their runtime-state mutex.
+    class BridgeDedupeStore {
+    public:
+        /// \brief Returns the current wall-clock time used for persisted expiry.
+        static std::int64_t now_ms() {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+        }
+
+        /// \brief Hashes a dedupe key into a non-zero 64-bit value.
+        static std::uint64_t hash_key(const std::string& key) noexcept {
+            std::uint64_t hash = 14695981039346656037ULL;
+            for (const char ch : key) {
+                hash ^= static_cast<unsigned char>(ch);
+                hash *= 1099511628211ULL;
+            }
+            hash ^= hash >> 30;
+            hash *= 0xBF58476D1CE4E5B9ULL;
+            hash ^= hash >> 27;
+            hash *= 0x94D049BB133111EBULL;
+            hash ^= hash >> 31;
+            return hash == 0 ? 1 : hash;
+        }
+
+        /// \brief Resets the store and optionally loads a persisted journal.
+        /// \param state_file Journal path; empty keeps the store in memory only.
+        /// \param ttl_ms Retention window; zero keeps keys until `max_entries` evicts them.
+        /// \param max_entries Hard cap on live keys.
+        /// \param now Current Unix time in milliseconds.
+        /// \param error Receives a description when the journal cannot be used.
+        /// \return `false` when the journal cannot be read or opened for append.
+        bool open(
+                const std::filesystem::path& state_file,
+                std::int64_t ttl_ms,
+                std::size_t max_entries,
+                std::int64_t now,
+                std::string& error) {
+            close();
+            m_ttl_ms = ttl_ms > 0 ? ttl_ms : 0;
+            m_max_entries = max_entries > 0 ? max_entries : 1;
+            m_state_file = state_file;
+            if (m_state_file.empty()) {
+                return true;
+            }
+
+            if (!load_journal(now, error) || !rewrite_journal(error)) {
+                close();
+                return false;
+            }
+            return true;
+        }
+
+        /// \brief Drops all keys and closes the journal without deleting it.
+        void close() {
+            m_slots.assign(MIN_CAPACITY, Slot{});
+            m_ring.clear();
+            m_size = 0;
+            m_next_seq = 1;
+            m_journal.close();
+            m_journal_records = 0;
+            m_state_file.clear();
+            m_journal_error.clear();
+        }
+
+        /// \brief Records a key unless it is already live.
+        /// \return `false` when the key is a duplicate inside the retention window.
+        bool remember(const std::string& key, std::int64_t now) {
+            expire(now);
+            const auto hash = hash_key(key);
+            if (find_slot(hash) != NPOS) {
+                return false;
+            }
+
+            const auto expires_at = m_ttl_ms > 0
+                ? now + m_ttl_ms
+                : std::numeric_limits<std::int64_t>::max();
+            const auto seq = m_next_seq++;
+            insert_slot(hash, seq);
+            m_ring.push_back(RingEntry{hash, expires_at, seq});
+            append_record(hash, expires_at);
+
+            while (m_size > m_max_entries && !m_ring.empty()) {
+                pop_front();
+            }
+            compact_ring_if_needed();
+            return true;
+        }
+
+        /// \brief Removes a key so a retry can be accepted again.
+        void forget(const std::string& key) {
+            const auto hash = hash_key(key);
+            const auto index = find_slot(hash);
+            if (index == NPOS) {
+                return;
+            }
+            erase_slot(index);
+            append_record(hash, 0);
+        }
+
+        /// \brief Returns true when the key is live at `now`.
+        bool contains(const std::string& key, std::int64_t now) {
+            expire(now);
+            return find_slot(hash_key(key)) != NPOS;
+        }
+
+        /// \brief Returns the number of live keys.
+        std::size_t size() const noexcept {
+            return m_size;
+        }
+
+        /// \brief Returns true when changes are persisted to a journal.
+        bool persistent() const noexcept {
+            return m_journal.is_open();
+        }
+
+        /// \brief Returns and clears the error that disabled the journal.
+        /// \return Empty string unless the journal failed since the last call.
+        std::string take_journal_error() {
+            std::string error;
+            error.swap(m_journal_error);
+            return error;
+        }
+
+    private:
+        struct Slot {
+            std::uint64_t hash = 0; ///< Zero marks an empty slot.
+            std::uint64_t seq = 0;  ///< Ring entry that owns the slot.
+        };
+
+        struct RingEntry {
+            std::uint64_t hash = 0;
+            std::int64_t expires_at = 0;
+            std::uint64_t seq = 0;
+        };
+
+        static constexpr std::size_t NPOS = static_cast<std::size_t>(-1);
+        static constexpr std::size_t MIN_CAPACITY = 16;
+        static constexpr char JOURNAL_MAGIC[8] = {'O', 'X', 'D', 'E', 'D', 'U', 'P', '1'};
+        static constexpr std::size_t RECORD_SIZE = 16;
+
+        std::vector<Slot> m_slots = std::vector<Slot>(MIN_CAPACITY);
+        std::deque<RingEntry> m_ring;
+        std::size_t m_size = 0;
+        std::uint64_t m_next_seq = 1;
+        std::int64_t m_ttl_ms = 0;
+        std::size_t m_max_entries = 1024;
+
+        std::filesystem::path m_state_file;
+        std::ofstream m_journal;
+        std::size_t m_journal_records = 0;
+        std::string m_journal_error;
+
+        std::size_t mask() const noexcept {
+            return m_slots.size() - 1;
+        }
+
+        std::size_t find_slot(std::uint64_t hash) const noexcept {
+            for (auto index = static_cast<std::size_t>(hash) & mask();;
+                 index = (index + 1) & mask()) {
+                if (m_slots[index].hash == hash) {
+                    return index;
+                }
+                if (m_slots[index].hash == 0) {
+                    return NPOS;
+                }
+            }
+        }
+
+        void insert_slot(std::uint64_t hash, std::uint64_t seq) {
+            if ((m_size + 1) * 2 > m_slots.size()) {
+                rehash(m_slots.size() * 2);
+            }
+            auto index = static_cast<std::size_t>(hash) & mask();
+            while (m_slots[index].hash != 0) {
+                index = (index + 1) & mask();
+            }
+            m_slots[index] = Slot{hash, seq};
+            ++m_size;
+        }
+
+        /// \brief Backward-shift deletion keeps probe chains intact without tombstones.
+        void erase_slot(std::size_t index) {
+            auto hole = index;
+            auto next = (hole + 1) & mask();
+            while (m_slots[next].hash != 0) {
+                const auto home = static_cast<std::size_t>(m_slots[next].hash) & mask();
+                const auto distance_next = (next - home) & mask();
+                const auto distance_hole = (hole - home) & mask();
+                if (distance_hole < distance_next) {
+                    m_slots[hole] = m_slots[next];
+                    hole = next;
+                }
+                next = (next + 1) & mask();
+            }
+            m_slots[hole] = Slot{};
+            --m_size;
+        }
+
+        void rehash(std::size_t capacity) {
+            std::vector<Slot> old;
+            old.swap(m_slots);
+            m_slots.assign(capacity, Slot{});
+            for (const auto& slot : old) {
+                if (slot.hash == 0) {
+                    continue;
+                }
+                auto index = static_cast<std::size_t>(slot.hash) & mask();
+                while (m_slots[index].hash != 0) {
+                    index = (index + 1) & mask();
+                }
+                m_slots[index] = slot;
+            }
+        }
+
+        /// \brief Removes the oldest ring entry if it still owns its slot.
+        void pop_front() {
+            const auto entry = m_ring.front();
+            m_ring.pop_front();
+            const auto index = find_slot(entry.hash);
+            if (index != NPOS && m_slots[index].seq == entry.seq) {
+                erase_slot(index);
+            }
+        }
+
+        void expire(std::int64_t now) {
+            while (!m_ring.empty() && m_ring.front().expires_at <= now) {
+                pop_front();
+            }
+            if (m_size * 8 < m_slots.size() && m_slots.size() > MIN_CAPACITY) {
+                auto capacity = MIN_CAPACITY;
+                while (capacity < m_size * 4) {
+                    capacity *= 2;
+                }
+                rehash(capacity);
+            }
+        }
+
+        /// \brief Drops ring entries orphaned by `forget()`.
+        void compact_ring_if_needed() {
+            if (m_ring.size() <= m_size * 2 + MIN_CAPACITY) {
+                return;
+            }
+            std::deque<RingEntry> live;
+            for (const auto& entry : m_ring) {
+                const auto index = find_slot(entry.hash);
+                if (index != NPOS && m_slots[index].seq == entry.seq) {
+                    live.push_back(entry);
+                }
+            }
+            m_ring.swap(live);
+        }
+
+        static void write_u64(std::ostream& output, std::uint64_t value) {
+            char bytes[8];
+            for (int i = 0; i < 8; ++i) {
+                bytes[i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+            }
+            output.write(bytes, sizeof(bytes));
+        }
+
+        static std::uint64_t read_u64(const char* bytes) {
+            std::uint64_t value = 0;
+            for (int i = 7; i >= 0; --i) {
+                value = (value << 8) | static_cast<unsigned char>(bytes[i]);
+            }
+            return value;
+        }
+
+        void append_record(std::uint64_t hash, std::int64_t expires_at) {
+            if (!m_journal.is_open()) {
+                return;
+            }
+            write_u64(m_journal, hash);
+            write_u64(m_journal, static_cast<std::uint64_t>(expires_at));
+            m_journal.flush();
+            if (!m_journal) {
+                disable_journal("Failed to append dedupe state: " + m_state_file.u8string());
+                return;
+            }
+            ++m_journal_records;
+
+            if (m_journal_records > m_size * 2 + 64) {
+                std::string error;
+                if (!rewrite_journal(error)) {
+                    disable_journal(error);
+                }
+            }
+        }
+
+        /// \brief Falls back to in-memory operation after a journal failure.
+        void disable_journal(std::string error) {
+            m_journal.close();
+            m_journal_error = std::move(error);
+        }
+
+        bool load_journal(std::int64_t now, std::string& error) {
+            std::error_code ec;
+            if (!std::filesystem::exists(m_state_file, ec)) {
+                if (ec) {
+                    error = "Failed to inspect dedupe state: " + ec.message();
+                    return false;
+                }
+                return true;
+            }
+
+            std::ifstream input(m_state_file, std::ios::binary);
+            if (!input) {
+                error = "Failed to open dedupe state: " + m_state_file.u8string();
+                return false;
+            }
+            char magic[sizeof(JOURNAL_MAGIC)] = {};
+            input.read(magic, sizeof(magic));
+            if (input.gcount() == 0) {
+                return true;
+            }
+            if (input.gcount() != static_cast<std::streamsize>(sizeof(magic)) ||
+                !std::equal(magic, magic + sizeof(magic), JOURNAL_MAGIC)) {
+                error = "Dedupe state has an unknown format: " + m_state_file.u8string();
+                return false;
+            }
+
+            // Records are replayed in write order; a truncated tail record
+            // left by a crash is ignored.
+            char record[RECORD_SIZE];
+            while (input.read(record, sizeof(record))) {
+                const auto hash = read_u64(record);
+                const auto expires_at = static_cast<std::int64_t>(read_u64(record + 8));
+                if (hash == 0) {
+                    continue;
+                }
+                const auto index = find_slot(hash);
+                if (expires_at == 0) {
+                    if (index != NPOS) {
+                        erase_slot(index);
+                    }
+                    continue;
+                }
+                if (index != NPOS || expires_at <= now) {
+                    continue;
+                }
+                const auto seq = m_next_seq++;
+                insert_slot(hash, seq);
+                m_ring.push_back(RingEntry{hash, expires_at, seq});
+            }
+
+            std::stable_sort(
+                m_ring.begin(),
+                m_ring.end(),
+                [](const RingEntry& left, const RingEntry& right) {
+                    return left.expires_at < right.expires_at;
+                });
+            expire(now);
+            while (m_size > m_max_entries && !m_ring.empty()) {
+                pop_front();
+            }
+            compact_ring_if_needed();
+            return true;
+        }
+
+        /// \brief Replaces the journal with one record per live key.
+        bool rewrite_journal(std::string& error) {
+            m_journal.close();
+
+            auto temp_file = m_state_file;
+            temp_file += ".tmp";
+            {
+                std::ofstream output(temp_file, std::ios::binary | std::ios::trunc);
+                if (!output) {
+                    error = "Failed to write dedupe state: " + temp_file.u8string();
+                    return false;
+                }
+                output.write(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+                m_journal_records = 0;
+                for (const auto& entry : m_ring) {
+                    const auto index = find_slot(entry.hash);
+                    if (index == NPOS || m_slots[index].seq != entry.seq) {
+                        continue;
+                    }
+                    write_u64(output, entry.hash);
+                    write_u64(output, static_cast<std::uint64_t>(entry.expires_at));
+                    ++m_journal_records;
+                }
+                output.flush();
+                if (!output) {
+                    error = "Failed to write dedupe state: " + temp_file.u8string();
+                    return false;
+                }
+            }
+
+            std::error_code ec;
+            std::filesystem::rename(temp_file, m_state_file, ec);
+            if (ec) {
+                error = "Failed to replace dedupe state: " + ec.message();
+                return false;
+            }
+
+            m_journal.open(m_state_file, std::ios::binary | std::ios::app);
+            if (!m_journal) {
+                error = "Failed to open dedupe state for append: " + m_state_file.u8string();
+                return false;
+            }
+            return true;
+        }
+    };
+
+} // namespace optionx::bridges::detail
+
+#endif // OPTIONX_HEADER_BRIDGES_DETAIL_BRIDGE_DEDUPE_STORE_HPP_INCLUDED
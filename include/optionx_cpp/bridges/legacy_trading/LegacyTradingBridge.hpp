@@ -15,6 +15,11 @@ namespace optionx::bridges::legacy_trading {
     /// receive `update_bet`, account, connection, and ping messages. Incoming
     /// contracts are published as `TradeSignal`; this bridge does not execute
     /// trades by itself.
+    ///
+    /// With `framed_mode` enabled, a client may send `{"framing":1}` or a
+    /// `#`-prefixed batch frame. From then on its outbound updates are
+    /// coalesced and written as one frame per flush tick; clients that never
+    /// opt in keep receiving one JSON message per write.
     class LegacyTradingBridge final : public BaseBridge {
     private:
         struct RuntimeState {
@@ -25,6 +30,9 @@ namespace optionx::bridges::legacy_trading {
             BaseBridge::signal_report_callback_t signal_report_callback;
             BaseBridge::signal_id_allocator_t signal_id_allocator;
             bool running = false;
+            std::mutex flush_mutex;
+            std::map<int, detail::LegacyOutboundBatch> framed_clients;
+            std::size_t max_frame_size = 65536;
 
 #           if defined(_WIN32)
             std::shared_ptr<SimpleNamedPipe::NamedPipeServer> server;
@@ -101,12 +109,16 @@ namespace optionx::bridges::legacy_trading {
             case AccountUpdateStatus::CONNECTED:
             case AccountUpdateStatus::DISCONNECTED:
             case AccountUpdateStatus::FAILED_TO_CONNECT:
-                broadcast(detail::format_connection_update(*info.account_info));
+                broadcast(
+                    detail::format_connection_update(*info.account_info),
+                    OutboundKind::CONNECTION);
                 break;
             case AccountUpdateStatus::BALANCE_UPDATED:
             case AccountUpdateStatus::ACCOUNT_TYPE_CHANGED:
             case AccountUpdateStatus::CURRENCY_CHANGED:
-                broadcast(detail::format_balance_update(*info.account_info));
+                broadcast(
+                    detail::format_balance_update(*info.account_info),
+                    OutboundKind::BALANCE);
                 break;
             default:
                 break;
@@ -155,6 +167,8 @@ namespace optionx::bridges::legacy_trading {
                 m_state->server = server;
                 m_state->running = true;
                 m_state->client_ids.clear();
+                m_state->framed_clients.clear();
+                m_state->max_frame_size = config->buffer_size;
             }
 
             try {
@@ -181,6 +195,23 @@ namespace optionx::bridges::legacy_trading {
                 return;
             }
 
+            if (config->framed_mode &&
+                !m_task_manager.add_periodic_task(
+                    "legacy-trading-bridge-flush",
+                    config->frame_flush_period_ms,
+                    [state = m_state](std::shared_ptr<utils::Task> task) {
+                        if (task->is_shutdown()) return;
+                        flush_framed_clients(state);
+                    })) {
+                server->stop();
+                clear_runtime_server();
+                notify_status(
+                    BridgeStatus::SERVER_START_FAILED,
+                    {},
+                    "Failed to schedule legacy bridge frame flush task.");
+                return;
+            }
+
             m_task_manager.run();
 #           else
             (void)config;
@@ -192,16 +223,19 @@ namespace optionx::bridges::legacy_trading {
         }
 
         /// \brief Stops the bridge and clears connected clients.
-        /// \details Drains the ping task manager and then stops the pipe server
-        ///          if it was running.
+        /// \details Flushes pending framed updates, drains the task manager,
+        ///          and then stops the pipe server if it was running.
         void shutdown() override {
 #           if defined(_WIN32)
+            flush_framed_clients(m_state);
+
             std::shared_ptr<SimpleNamedPipe::NamedPipeServer> server;
             {
                 std::lock_guard<std::mutex> lock(m_state->mutex);
                 server = m_state->server;
                 m_state->server.reset();
                 m_state->client_ids.clear();
+                m_state->framed_clients.clear();
                 m_state->running = false;
             }
 
@@ -307,29 +341,112 @@ namespace optionx::bridges::legacy_trading {
             }
         }
 
-        void broadcast(const std::string& message) {
-            broadcast(m_state, message);
+        /// \brief Outbound message category used when coalescing framed updates.
+        enum class OutboundKind {
+            MESSAGE,    ///< Ordered event such as `update_bet` or `ping`.
+            BALANCE,    ///< Balance snapshot; the latest one wins.
+            CONNECTION  ///< Connection snapshot; the latest one wins.
+        };
+
+        void broadcast(
+                const std::string& message,
+                OutboundKind kind = OutboundKind::MESSAGE) {
+            broadcast(m_state, message, kind);
         }
 
+        /// \brief Sends a message to plain clients and queues it for framed ones.
         static void broadcast(
                 const std::shared_ptr<RuntimeState>& state,
-                const std::string& message) {
+                const std::string& message,
+                OutboundKind kind = OutboundKind::MESSAGE) {
 #           if defined(_WIN32)
             std::shared_ptr<SimpleNamedPipe::NamedPipeServer> server;
             std::vector<int> clients;
             {
                 std::lock_guard<std::mutex> lock(state->mutex);
                 server = state->server;
-                clients.assign(state->client_ids.begin(), state->client_ids.end());
+                if (!server) return;
+                clients.reserve(state->client_ids.size());
+                for (const int client_id : state->client_ids) {
+                    auto it = state->framed_clients.find(client_id);
+                    if (it == state->framed_clients.end()) {
+                        clients.push_back(client_id);
+                        continue;
+                    }
+                    switch (kind) {
+                    case OutboundKind::BALANCE:
+                        it->second.set_balance(message);
+                        break;
+                    case OutboundKind::CONNECTION:
+                        it->second.set_connection(message);
+                        break;
+                    default:
+                        it->second.push(message);
+                        break;
+                    }
+                }
             }
 
-            if (!server) return;
             for (const int client_id : clients) {
                 server->send_to(client_id, message);
             }
 #           else
             (void)state;
             (void)message;
+            (void)kind;
+#           endif
+        }
+
+        /// \brief Writes pending batches, one or more frames per framed client.
+        /// \details `flush_mutex` keeps frames from concurrent flushes in order.
+        static void flush_framed_clients(const std::shared_ptr<RuntimeState>& state) {
+#           if defined(_WIN32)
+            std::lock_guard<std::mutex> flush_lock(state->flush_mutex);
+            std::shared_ptr<SimpleNamedPipe::NamedPipeServer> server;
+            std::vector<std::pair<int, std::vector<std::string>>> pending;
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                server = state->server;
+                if (!server) return;
+                for (auto& item : state->framed_clients) {
+                    if (item.second.empty()) continue;
+                    pending.emplace_back(
+                        item.first,
+                        item.second.take_frames(state->max_frame_size));
+                }
+            }
+
+            for (const auto& item : pending) {
+                for (const auto& frame : item.second) {
+                    server->send_to(item.first, frame);
+                }
+            }
+#           else
+            (void)state;
+#           endif
+        }
+
+        /// \brief Switches a connected client to framed replies.
+        /// \param send_ack Echo the framing hello back to the client.
+        static void enable_framing(
+                const std::shared_ptr<RuntimeState>& state,
+                int client_id,
+                bool send_ack) {
+#           if defined(_WIN32)
+            std::shared_ptr<SimpleNamedPipe::NamedPipeServer> server;
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (state->client_ids.count(client_id) == 0) return;
+                state->framed_clients.emplace(client_id, detail::LegacyOutboundBatch());
+                server = state->server;
+            }
+            if (server && send_ack) {
+                server->send_to(client_id, detail::framing_hello_message());
+            }
+#           else
+            (void)state;
+            (void)client_id;
+            (void)send_ack;
 #           endif
         }
 
@@ -367,6 +484,7 @@ namespace optionx::bridges::legacy_trading {
                     {
                         std::lock_guard<std::mutex> lock(state->mutex);
                         state->client_ids.erase(client_id);
+                        state->framed_clients.erase(client_id);
                     }
                     notify_status(
                         state,
@@ -389,6 +507,7 @@ namespace optionx::bridges::legacy_trading {
             std::lock_guard<std::mutex> lock(m_state->mutex);
             m_state->server.reset();
             m_state->client_ids.clear();
+            m_state->framed_clients.clear();
             m_state->running = false;
         }
 #       endif
@@ -414,12 +533,55 @@ namespace optionx::bridges::legacy_trading {
         void handle_message(int client_id, const std::string& message) {
             auto config = get_config_or_throw();
             const auto conn_id = connection_id(client_id);
+            if (!detail::is_framed_message(message)) {
+                handle_record(config, client_id, conn_id, message);
+                return;
+            }
+
+            std::vector<std::string> records;
+            try {
+                if (!config->framed_mode) {
+                    throw std::invalid_argument("Legacy batch framing is disabled.");
+                }
+                records = detail::parse_frame(message);
+            } catch (const std::exception& ex) {
+                OPTIONX_ASYNC_LOG_ERROR("Parsing legacy bridge frame failed: %s", ex.what());
+                notify_signal_report(
+                    m_state,
+                    make_signal_report(
+                        *config,
+                        BridgeSignalReportStatus::INVALID,
+                        "invalid_frame",
+                        ex.what(),
+                        conn_id,
+                        nlohmann::json(),
+                        nlohmann::json(),
+                        {},
+                        nlohmann::json{{"body_size", message.size()}}));
+                notify_status(
+                    BridgeStatus::CONNECTION_ERROR,
+                    conn_id,
+                    ex.what());
+                return;
+            }
+
+            enable_framing(m_state, client_id, false);
+            for (const auto& record : records) {
+                handle_record(config, client_id, conn_id, record);
+            }
+        }
+
+        void handle_record(
+                const std::shared_ptr<LegacyTradingBridgeConfig>& config,
+                int client_id,
+                const std::string& conn_id,
+                const std::string& message) {
             nlohmann::json payload;
 
             try {
                 payload = nlohmann::json::parse(message);
             } catch (const std::exception& ex) {
-                LOGIT_PRINT_ERROR("Parsing legacy bridge message failed: ", ex.what());
+                OPTIONX_ASYNC_LOG_ERROR("Parsing legacy bridge message failed: %s", ex.what());
                 notify_signal_report(
                     m_state,
                     make_signal_report(
@@ -442,6 +604,10 @@ namespace optionx::bridges::legacy_trading {
             if (payload.contains("pong") || payload.contains("ping")) {
                 return;
             }
+            if (config->framed_mode && payload.contains("framing")) {
+                enable_framing(m_state, client_id, true);
+                return;
+            }
             if (!payload.contains("contract")) {
                 notify_signal_report(
                     m_state,
@@ -459,7 +625,7 @@ namespace optionx::bridges::legacy_trading {
             try {
                 signal = detail::parse_contract(payload.at("contract"), config->min_payout);
             } catch (const std::exception& ex) {
-                LOGIT_PRINT_ERROR("Parsing legacy bridge contract failed: ", ex.what());
+                OPTIONX_ASYNC_LOG_ERROR("Parsing legacy bridge contract failed: %s", ex.what());
                 notify_signal_report(
                     m_state,
                     make_signal_report(
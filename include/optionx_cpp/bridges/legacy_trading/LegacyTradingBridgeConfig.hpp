@@ -20,7 +20,9 @@ namespace optionx::bridges::legacy_trading {
                 {"min_payout", min_payout},
                 {"buffer_size", buffer_size},
                 {"pipe_timeout_ms", pipe_timeout_ms},
-                {"ping_period_ms", ping_period_ms}
+                {"ping_period_ms", ping_period_ms},
+                {"framed_mode", framed_mode},
+                {"frame_flush_period_ms", frame_flush_period_ms}
             };
         }
 
@@ -45,6 +47,12 @@ namespace optionx::bridges::legacy_trading {
             if (j.contains("ping_period_ms")) {
                 ping_period_ms = j.at("ping_period_ms").get<std::int64_t>();
             }
+            if (j.contains("framed_mode")) {
+                framed_mode = j.at("framed_mode").get<bool>();
+            }
+            if (j.contains("frame_flush_period_ms")) {
+                frame_flush_period_ms = j.at("frame_flush_period_ms").get<std::int64_t>();
+            }
         }
 
         /// \brief Validates the bridge configuration.
@@ -68,6 +76,9 @@ namespace optionx::bridges::legacy_trading {
             if (ping_period_ms <= 0) {
                 return {false, "Ping period must be positive."};
             }
+            if (framed_mode && frame_flush_period_ms <= 0) {
+                return {false, "Frame flush period must be positive."};
+            }
             return {true, std::string()};
         }
 
@@ -95,6 +106,8 @@ namespace optionx::bridges::legacy_trading {
         std::size_t buffer_size = 65536;                    ///< Pipe read/write buffer size.
         std::size_t pipe_timeout_ms = 50;                   ///< Pipe wait timeout in milliseconds.
         std::int64_t ping_period_ms = time_shield::MS_PER_15_SEC; ///< Periodic legacy ping interval.
+        bool framed_mode = false;                           ///< Accept batch frames and coalesce replies for clients that opt in.
+        std::int64_t frame_flush_period_ms = 20;            ///< Coalesced write interval for framed clients.
     };
 
 } // namespace optionx::bridges::legacy_trading
@@ -7,32 +7,73 @@
 
 namespace optionx::bridges::legacy_trading::detail {
 
-    inline std::string parse_symbol(const std::string& symbol) {
-        static const std::vector<std::string> symbols = {
-            "EURUSD", "USDJPY", "USDCHF", "USDCAD", "EURJPY", "AUDUSD",
-            "NZDUSD", "EURGBP", "EURCHF", "AUDJPY", "GBPJPY", "EURCAD",
-            "AUDCAD", "CADJPY", "NZDJPY", "AUDNZD", "GBPAUD", "EURAUD",
-            "GBPCHF", "AUDCHF", "GBPNZD", "BTCUSDT"
-        };
+    /// \class LegacySymbolRegistry
+    /// \brief Sorted table of symbols accepted in legacy `contract` messages.
+    /// \details Lookup normalizes into a stack buffer and binary-searches
+    ///          `string_view`s, so resolving a symbol does not allocate.
+    class LegacySymbolRegistry {
+    public:
+        static constexpr std::size_t MAX_SYMBOL_SIZE = 16; ///< Longest normalized symbol accepted.
 
-        std::string normalized;
-        normalized.reserve(symbol.size());
-        for (const unsigned char ch : symbol) {
-            if (std::isalnum(ch) != 0) {
-                normalized.push_back(static_cast<char>(std::toupper(ch)));
-            }
+        /// \brief Returns the canonical symbols in lookup order.
+        static constexpr const std::array<std::string_view, 22>& symbols() noexcept {
+            return SYMBOLS;
         }
 
-        if (normalized == "BTCUSD" || normalized == "BTCUSDT") {
-            return "BTCUSDT";
+        /// \brief Checks that the table is strictly sorted for binary search.
+        static constexpr bool is_sorted_unique() noexcept {
+            for (std::size_t i = 1; i < SYMBOLS.size(); ++i) {
+                if (!(SYMBOLS[i - 1] < SYMBOLS[i])) return false;
+            }
+            return true;
         }
 
-        const auto it = std::find(symbols.begin(), symbols.end(), normalized);
-        if (it != symbols.end()) {
-            return *it;
+        /// \brief Resolves a raw symbol to its canonical name.
+        /// \param symbol Raw symbol; case and non-alphanumeric characters are ignored.
+        /// \return Canonical symbol, or an empty view when the symbol is unknown.
+        static std::string_view find(std::string_view symbol) noexcept {
+            char buffer[MAX_SYMBOL_SIZE];
+            std::size_t size = 0;
+            for (const char ch : symbol) {
+                const auto byte = static_cast<unsigned char>(ch);
+                if (std::isalnum(byte) == 0) continue;
+                if (size == MAX_SYMBOL_SIZE) return {};
+                buffer[size++] = static_cast<char>(std::toupper(byte));
+            }
+
+            std::string_view normalized(buffer, size);
+            if (normalized == "BTCUSD") {
+                normalized = "BTCUSDT";
+            }
+
+            const auto it = std::lower_bound(SYMBOLS.begin(), SYMBOLS.end(), normalized);
+            if (it != SYMBOLS.end() && *it == normalized) {
+                return *it;
+            }
+            return {};
         }
 
-        throw std::invalid_argument("Invalid symbol in legacy trade request.");
+    private:
+        static constexpr std::array<std::string_view, 22> SYMBOLS = {
+            "AUDCAD", "AUDCHF", "AUDJPY", "AUDNZD", "AUDUSD", "BTCUSDT",
+            "CADJPY", "EURAUD", "EURCAD", "EURCHF", "EURGBP", "EURJPY",
+            "EURUSD", "GBPAUD", "GBPCHF", "GBPJPY", "GBPNZD", "NZDJPY",
+            "NZDUSD", "USDCAD", "USDCHF", "USDJPY"
+        };
+    };
+
+    static_assert(
+        LegacySymbolRegistry::is_sorted_unique(),
+        "Legacy symbol table must stay sorted for binary search.");
+
+    /// \brief Resolves a legacy contract symbol.
+    /// \throws std::invalid_argument when the symbol is not supported.
+    inline std::string parse_symbol(std::string_view symbol) {
+        const auto canonical = LegacySymbolRegistry::find(symbol);
+        if (canonical.empty()) {
+            throw std::invalid_argument("Invalid symbol in legacy trade request.");
+        }
+        return std::string(canonical);
     }
 
     inline void parse_note(const std::string& note, TradeSignal& signal) {
@@ -45,9 +86,12 @@ namespace optionx::bridges::legacy_trading::detail {
         signal.user_data = note.substr(pos + 1);
     }
 
-    inline OrderType parse_order_type(const std::string& direction) {
+    /// \brief Parses a legacy direction with the aliases accepted by `to_enum`.
+    /// \throws std::invalid_argument for unknown or `UNKNOWN` directions.
+    inline OrderType parse_order_type(std::string_view direction) {
         OrderType order_type = OrderType::UNKNOWN;
-        if (!to_enum(direction, order_type) || order_type == OrderType::UNKNOWN) {
+        if (!to_enum(std::string(direction), order_type) ||
+            order_type == OrderType::UNKNOWN) {
             throw std::invalid_argument("Invalid order direction in legacy trade request.");
         }
         return order_type;
@@ -61,15 +105,35 @@ namespace optionx::bridges::legacy_trading::detail {
         return static_cast<std::uint32_t>(value);
     }
 
+    /// \brief Returns a pointer to a contract field, or null when it is absent.
+    inline const nlohmann::json* find_contract_field(
+            const nlohmann::json& contract,
+            const char* key) {
+        const auto it = contract.find(key);
+        return it == contract.end() ? nullptr : &*it;
+    }
+
+    /// \brief Returns a required string field without copying it.
+    inline const std::string& contract_string_field(
+            const nlohmann::json& contract,
+            const char* key,
+            const char* error) {
+        const auto* field = find_contract_field(contract, key);
+        if (!field || !field->is_string()) {
+            throw std::invalid_argument(error);
+        }
+        return field->get_ref<const std::string&>();
+    }
+
     inline void parse_expiry_or_duration(
             const nlohmann::json& contract,
             TradeSignal& signal) {
-        if (contract.contains("exp")) {
-            if (!contract.at("exp").is_number()) {
+        if (const auto* expiry = find_contract_field(contract, "exp")) {
+            if (!expiry->is_number()) {
                 throw std::invalid_argument("Invalid expiry time in legacy trade request.");
             }
 
-            const std::int64_t expiry_time = contract.at("exp").get<std::int64_t>();
+            const std::int64_t expiry_time = expiry->get<std::int64_t>();
             signal.option_type = OptionType::CLASSIC;
             if (expiry_time < time_shield::SEC_PER_DAY) {
                 signal.duration = parse_duration_value(expiry_time);
@@ -81,12 +145,12 @@ namespace optionx::bridges::legacy_trading::detail {
             return;
         }
 
-        if (contract.contains("dur")) {
-            if (!contract.at("dur").is_number()) {
+        if (const auto* duration = find_contract_field(contract, "dur")) {
+            if (!duration->is_number()) {
                 throw std::invalid_argument("Invalid duration in legacy trade request.");
             }
 
-            signal.duration = parse_duration_value(contract.at("dur").get<std::int64_t>());
+            signal.duration = parse_duration_value(duration->get<std::int64_t>());
             signal.option_type = OptionType::SPRINT;
             return;
         }
@@ -95,18 +159,38 @@ namespace optionx::bridges::legacy_trading::detail {
     }
 
     /// \brief Parses a legacy `contract` object into a TradeSignal.
+    /// \details Each field is looked up once and read in place; string
+    ///          fields are only copied into the resulting signal.
     /// \param contract Legacy JSON contract payload.
     /// \param min_payout Minimum payout copied into the created signal.
     /// \return Newly allocated trade signal.
-    /// \throws std::exception when required contract fields are invalid.
+    /// \throws std::invalid_argument when required contract fields are invalid.
     inline std::unique_ptr<TradeSignal> parse_contract(
             const nlohmann::json& contract,
             double min_payout) {
+        if (!contract.is_object()) {
+            throw std::invalid_argument("Legacy trade request contract must be an object.");
+        }
+
         auto signal = std::make_unique<TradeSignal>();
-        signal->symbol = parse_symbol(contract.at("s").get<std::string>());
-        parse_note(contract.value("note", std::string()), *signal);
-        signal->amount = contract.at("a").get<double>();
-        signal->order_type = parse_order_type(contract.at("dir").get<std::string>());
+        signal->symbol = parse_symbol(contract_string_field(
+            contract, "s", "Invalid symbol in legacy trade request."));
+
+        if (const auto* note = find_contract_field(contract, "note")) {
+            if (!note->is_string()) {
+                throw std::invalid_argument("Invalid note in legacy trade request.");
+            }
+            parse_note(note->get_ref<const std::string&>(), *signal);
+        }
+
+        const auto* amount = find_contract_field(contract, "a");
+        if (!amount || !amount->is_number()) {
+            throw std::invalid_argument("Invalid amount in legacy trade request.");
+        }
+        signal->amount = amount->get<double>();
+
+        signal->order_type = parse_order_type(contract_string_field(
+            contract, "dir", "Invalid order direction in legacy trade request."));
         parse_expiry_or_duration(contract, *signal);
         signal->min_payout = min_payout;
         return signal;
@@ -205,6 +289,153 @@ namespace optionx::bridges::legacy_trading::detail {
         return message.dump();
     }
 
+    /// \brief First byte of a length-prefixed batch frame.
+    /// \details Single legacy messages are JSON objects that start with `{`,
+    ///          so the marker never collides with existing clients.
+    constexpr char FRAME_MARKER = '#';
+
+    /// \brief Message a client sends to request framed replies and that the
+    ///        bridge echoes back once framing is enabled for the client.
+    inline const char* framing_hello_message() {
+        return "{\"framing\":1}";
+    }
+
+    /// \brief Checks whether a pipe message uses batch framing.
+    /// \param message Raw pipe message.
+    /// \return `true` when the message starts with `FRAME_MARKER`.
+    inline bool is_framed_message(const std::string& message) {
+        return !message.empty() && message.front() == FRAME_MARKER;
+    }
+
+    /// \brief Appends one `<length>:<payload>` record to a batch frame.
+    /// \param frame Frame being built; the marker is written on first use.
+    /// \param payload Serialized JSON message.
+    inline void append_frame_record(std::string& frame, const std::string& payload) {
+        if (frame.empty()) {
+            frame.push_back(FRAME_MARKER);
+        }
+        frame += std::to_string(payload.size());
+        frame.push_back(':');
+        frame += payload;
+    }
+
+    /// \brief Splits a batch frame into its records.
+    /// \param frame Frame in the form `#<length>:<payload><length>:<payload>...`.
+    /// \return Record payloads in wire order.
+    /// \throws std::invalid_argument when a length prefix is malformed or
+    ///         a record overruns the frame.
+    inline std::vector<std::string> parse_frame(const std::string& frame) {
+        if (!is_framed_message(frame)) {
+            throw std::invalid_argument("Legacy frame does not start with the frame marker.");
+        }
+
+        std::vector<std::string> records;
+        std::size_t pos = 1;
+        while (pos < frame.size()) {
+            std::size_t length = 0;
+            std::size_t digits = 0;
+            while (pos < frame.size() &&
+                   std::isdigit(static_cast<unsigned char>(frame[pos])) != 0) {
+                if (++digits > 9) {
+                    throw std::invalid_argument("Legacy frame record length is too long.");
+                }
+                length = length * 10 + static_cast<std::size_t>(frame[pos] - '0');
+                ++pos;
+            }
+            if (digits == 0 || pos >= frame.size() || frame[pos] != ':') {
+                throw std::invalid_argument("Invalid legacy frame record length prefix.");
+            }
+            ++pos;
+            if (length > frame.size() - pos) {
+                throw std::invalid_argument("Legacy frame record overruns the frame.");
+            }
+            records.emplace_back(frame, pos, length);
+            pos += length;
+        }
+        return records;
+    }
+
+    /// \class LegacyOutboundBatch
+    /// \brief Collects outbound updates for one framed client between flushes.
+    /// \details Messages are sent in the order they were queued. Balance and
+    ///          connection messages are snapshots: a newer one drops the
+    ///          pending older one and takes its place at the end of the queue.
+    class LegacyOutboundBatch {
+    public:
+        /// \brief Replaces the pending balance snapshot.
+        void set_balance(std::string message) {
+            replace_snapshot(m_balance_index, std::move(message));
+        }
+
+        /// \brief Replaces the pending connection snapshot.
+        void set_connection(std::string message) {
+            replace_snapshot(m_connection_index, std::move(message));
+        }
+
+        /// \brief Queues an ordered message such as `update_bet` or `ping`.
+        void push(std::string message) {
+            if (message.empty()) return;
+            m_messages.push_back(std::move(message));
+            ++m_pending;
+        }
+
+        /// \brief Returns true when nothing is pending.
+        bool empty() const noexcept {
+            return m_pending == 0;
+        }
+
+        /// \brief Encodes pending messages and clears the batch.
+        /// \param max_frame_size Frame size budget including the frame marker,
+        ///        usually the pipe buffer size. A record larger than the budget
+        ///        is sent in a frame of its own.
+        /// \return Frames to write in order; empty when nothing was pending.
+        std::vector<std::string> take_frames(std::size_t max_frame_size) {
+            std::vector<std::string> frames;
+            std::string frame;
+            for (const auto& payload : m_messages) {
+                if (payload.empty()) continue;
+                const auto record_size =
+                    payload.size() + std::to_string(payload.size()).size() + 1;
+                // An empty frame still costs the marker byte.
+                const auto used = frame.empty() ? std::size_t{1} : frame.size();
+                if (!frame.empty() && used + record_size > max_frame_size) {
+                    frames.push_back(std::move(frame));
+                    frame.clear();
+                }
+                append_frame_record(frame, payload);
+            }
+            if (!frame.empty()) {
+                frames.push_back(std::move(frame));
+            }
+
+            m_messages.clear();
+            m_pending = 0;
+            m_balance_index = NPOS;
+            m_connection_index = NPOS;
+            return frames;
+        }
+
+    private:
+        static constexpr std::size_t NPOS = static_cast<std::size_t>(-1);
+
+        std::vector<std::string> m_messages;  ///< Queue in send order; dropped snapshots are left empty.
+        std::size_t m_pending = 0;
+        std::size_t m_balance_index = NPOS;
+        std::size_t m_connection_index = NPOS;
+
+        void replace_snapshot(std::size_t& index, std::string message) {
+            if (index != NPOS) {
+                m_messages[index].clear();
+                --m_pending;
+                index = NPOS;
+            }
+            if (message.empty()) return;
+            index = m_messages.size();
+            m_messages.push_back(std::move(message));
+            ++m_pending;
+        }
+    };
+
 } // namespace optionx::bridges::legacy_trading::detail
 
 #endif // OPTIONX_HEADER_BRIDGES_LEGACY_TRADING_DETAIL_LEGACY_TRADING_PROTOCOL_HPP_INCLUDED
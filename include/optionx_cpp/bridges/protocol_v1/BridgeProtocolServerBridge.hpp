@@ -1226,9 +1226,17 @@ namespace optionx::bridges::protocol_v1 {
                 *config);
         }
 
+        static detail::CommandMetrics& command_metrics() {
+            static detail::CommandMetrics s_metrics = detail::CommandMetrics::make("protocol_v1_server");
+            return s_metrics;
+        }
+
         nlohmann::json handle_message_body(
                 const BridgeProtocolServerConfig& config,
                 const std::string& body) {
+            auto& metrics = command_metrics();
+            metrics.commands.inc();
+            utils::metrics::ScopedTimer timer(metrics.duration_us);
             if (body.size() > config.request_body_limit) {
                 return detail::jsonrpc_error(
                     nullptr,
@@ -15,6 +15,21 @@ namespace optionx::bridges::protocol_v1::detail {
     inline constexpr int jsonrpc_authorization_failed = -32001;
     inline constexpr int jsonrpc_unsupported_protocol_version = -32010;
 
+    /// \brief Command metrics of one Bridge Protocol v1 transport.
+    struct CommandMetrics {
+        utils::metrics::Counter&   commands;    ///< Handled message bodies.
+        utils::metrics::Histogram& duration_us; ///< Parse, dispatch and reply build time.
+
+        /// \brief Looks up the series labeled with a transport name.
+        static CommandMetrics make(const char* bridge) {
+            auto& registry = utils::metrics::MetricsRegistry::global();
+            return CommandMetrics{
+                registry.counter("optionx_bridge_commands_total", "Bridge Protocol v1 messages handled.", {{"bridge", bridge}}),
+                registry.histogram("optionx_bridge_command_us", "Bridge Protocol v1 message handling time, in microseconds.", {{"bridge", bridge}})
+            };
+        }
+    };
+
     inline nlohmann::json jsonrpc_result(nlohmann::json id, nlohmann::json result) {
         return nlohmann::json{
             {"jsonrpc", "2.0"},
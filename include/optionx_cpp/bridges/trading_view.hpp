@@ -8,6 +8,7 @@
 #include <nlohmann/json.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <chrono>
 #include <cmath>
@@ -28,11 +29,14 @@
 
 #include "BaseBridge.hpp"
 #include <optionx_cpp/utils/unicode_case.hpp>
+#include <optionx_cpp/utils/aho_corasick.hpp>
 
 #include <server_http.hpp>
 
 #include "detail/BridgeTradeSignalValidation.hpp"
+#include "detail/BridgeDedupeStore.hpp"
 #include "trading_view/TradingViewExtensionBridgeConfig.hpp"
+#include "trading_view/detail/TradingViewActionKeywordMatcher.hpp"
 #include "trading_view/detail/TradingViewExtensionProtocol.hpp"
 #include "trading_view/TradingViewExtensionBridge.hpp"
 
@@ -39,8 +39,7 @@ namespace optionx::bridges::tradingview {
             BaseBridge::signal_id_allocator_t signal_id_allocator;
             std::shared_ptr<HttpServer> server;
             std::thread server_thread;
-            std::deque<std::string> dedupe_order;
-            std::unordered_set<std::string> dedupe_keys;
+            optionx::bridges::detail::BridgeDedupeStore dedupe;
             bool running = false;
         };
 
@@ -74,8 +73,12 @@ namespace optionx::bridges::tradingview {
                 return false;
             }
 
+            auto next_parse_context =
+                std::make_shared<const detail::TradingViewParseContext>(*next_config);
+
             std::lock_guard<std::mutex> lock(m_mutex);
             m_config = std::move(next_config);
+            m_parse_context = std::move(next_parse_context);
             return true;
         }
 
@@ -107,7 +110,8 @@ namespace optionx::bridges::tradingview {
 
         /// \brief Starts the local HTTP server.
         void run() override {
-            auto config = get_config_or_throw();
+            std::shared_ptr<const detail::TradingViewParseContext> parse_context;
+            auto config = get_config_or_throw(parse_context);
             if (!get_signal_id_allocator()) {
                 notify_status(
                     BridgeStatus::SERVER_START_FAILED,
@@ -116,24 +120,34 @@ namespace optionx::bridges::tradingview {
                 return;
             }
 
+            std::string dedupe_error;
+            bool dedupe_ready = false;
             {
                 std::lock_guard<std::mutex> lock(m_state->mutex);
                 if (m_state->running) {
                     return;
                 }
+                dedupe_ready = m_state->dedupe.open(
+                    config->dedupe_state_file,
+                    config->dedupe_ttl_seconds * 1000,
+                    config->dedupe_cache_size,
+                    optionx::bridges::detail::BridgeDedupeStore::now_ms(),
+                    dedupe_error);
+            }
+            if (!dedupe_ready) {
+                notify_status(BridgeStatus::SERVER_START_FAILED, "dedupe", dedupe_error);
+                return;
             }
 
             auto server = std::make_shared<HttpServer>();
             server->config.address = config->address;
             server->config.port = config->port;
             server->config.thread_pool_size = 1;
-            configure_routes(server, config);
+            configure_routes(server, config, parse_context);
 
             {
                 std::lock_guard<std::mutex> lock(m_state->mutex);
                 m_state->server = server;
-                m_state->dedupe_order.clear();
-                m_state->dedupe_keys.clear();
                 m_state->running = true;
                 m_state->server_thread = std::thread([state = m_state, server]() {
                     try {
@@ -187,6 +201,16 @@ namespace optionx::bridges::tradingview {
             }
         }
 
+        /// \brief Returns level alert rule lookup counters for the active config.
+        /// \details Counters restart from zero whenever `configure()` accepts a
+        ///          new config, because the rule index is rebuilt with it.
+        TradingViewRuleMatchStats rule_match_stats() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_parse_context
+                ? m_parse_context->level_rules.stats()
+                : TradingViewRuleMatchStats{};
+        }
+
         /// \brief Returns the currently bound HTTP port.
         /// \return Non-zero bound port when the server has started.
         unsigned short bound_port() const noexcept {
@@ -202,12 +226,15 @@ namespace optionx::bridges::tradingview {
         mutable std::mutex m_mutex;
         std::shared_ptr<RuntimeState> m_state;
         std::shared_ptr<TradingViewExtensionBridgeConfig> m_config;
+        std::shared_ptr<const detail::TradingViewParseContext> m_parse_context;
 
-        std::shared_ptr<TradingViewExtensionBridgeConfig> get_config_or_throw() const {
+        std::shared_ptr<TradingViewExtensionBridgeConfig> get_config_or_throw(
+                std::shared_ptr<const detail::TradingViewParseContext>& parse_context) const {
             std::lock_guard<std::mutex> lock(m_mutex);
             if (!m_config) {
                 throw std::invalid_argument("TradingView extension bridge is not configured.");
             }
+            parse_context = m_parse_context;
             return m_config;
         }
 
@@ -433,7 +460,8 @@ namespace optionx::bridges::tradingview {
 
         void configure_routes(
                 const std::shared_ptr<HttpServer>& server,
-                const std::shared_ptr<TradingViewExtensionBridgeConfig>& config) {
+                const std::shared_ptr<TradingViewExtensionBridgeConfig>& config,
+                const std::shared_ptr<const detail::TradingViewParseContext>& parse_context) {
             server->resource[regex_path("/health")]["GET"] =
                 [config](
                     std::shared_ptr<HttpServer::Response> response,
@@ -457,16 +485,17 @@ namespace optionx::bridges::tradingview {
                 };
 
             server->resource[regex_path(config->signal_path)]["POST"] =
-                [state = m_state, config](
+                [state = m_state, config, parse_context](
                     std::shared_ptr<HttpServer::Response> response,
                     std::shared_ptr<HttpServer::Request> request) {
-                    handle_signal_post(state, config, response, request);
+                    handle_signal_post(state, config, *parse_context, response, request);
                 };
         }
 
         static void handle_signal_post(
                 const std::shared_ptr<RuntimeState>& state,
                 const std::shared_ptr<TradingViewExtensionBridgeConfig>& config,
+                const detail::TradingViewParseContext& parse_context,
                 const std::shared_ptr<HttpServer::Response>& response,
                 const std::shared_ptr<HttpServer::Request>& request) {
             const auto body = request->content.string();
@@ -529,7 +558,11 @@ namespace optionx::bridges::tradingview {
             const auto request_secret =
                 request_header_value(request->header, "X-OptionX-Secret");
             auto result =
-                detail::parse_extension_payload(payload, request_secret, *config);
+                detail::parse_extension_payload(
+                    payload,
+                    request_secret,
+                    *config,
+                    parse_context);
             if (!result.authorized) {
                 notify_signal_report(state, make_parse_report(*config, result));
                 write_json(
@@ -550,7 +583,7 @@ namespace optionx::bridges::tradingview {
                 return;
             }
 
-            if (!remember_dedupe_key(state, result.dedupe_key, config->dedupe_cache_size)) {
+            if (!remember_dedupe_key(state, result.dedupe_key)) {
                 notify_signal_report(
                     state,
                     make_signal_report(
@@ -659,22 +692,21 @@ namespace optionx::bridges::tradingview {
 
         static bool remember_dedupe_key(
                 const std::shared_ptr<RuntimeState>& state,
-                const std::string& dedupe_key,
-                std::size_t cache_size) {
+                const std::string& dedupe_key) {
             if (dedupe_key.empty()) {
                 return true;
             }
-            std::lock_guard<std::mutex> lock(state->mutex);
-            if (state->dedupe_keys.find(dedupe_key) != state->dedupe_keys.end()) {
-                return false;
-            }
-            state->dedupe_keys.insert(dedupe_key);
-            state->dedupe_order.push_back(dedupe_key);
-            while (state->dedupe_order.size() > cache_size) {
-                state->dedupe_keys.erase(state->dedupe_order.front());
-                state->dedupe_order.pop_front();
+            bool accepted = false;
+            std::string journal_error;
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                accepted = state->dedupe.remember(
+                    dedupe_key,
+                    optionx::bridges::detail::BridgeDedupeStore::now_ms());
+                journal_error = state->dedupe.take_journal_error();
             }
-            return true;
+            notify_dedupe_journal_error(state, std::move(journal_error));
+            return accepted;
         }
 
         static void forget_dedupe_key(
@@ -683,8 +715,27 @@ namespace optionx::bridges::tradingview {
             if (dedupe_key.empty()) {
                 return;
             }
-            std::lock_guard<std::mutex> lock(state->mutex);
-            state->dedupe_keys.erase(dedupe_key);
+            std::string journal_error;
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->dedupe.forget(dedupe_key);
+                journal_error = state->dedupe.take_journal_error();
+            }
+            notify_dedupe_journal_error(state, std::move(journal_error));
+        }
+
+        /// \brief Reports that dedupe keys are no longer persisted across restarts.
+        static void notify_dedupe_journal_error(
+                const std::shared_ptr<RuntimeState>& state,
+                std::string error) {
+            if (error.empty()) {
+                return;
+            }
+            notify_status(
+                state,
+                BridgeStatus::CONNECTION_ERROR,
+                "dedupe",
+                error + "; dedupe keys are kept in memory only.");
         }
     };
 
@@ -45,6 +45,18 @@ namespace optionx::bridges::tradingview {
         rule.signal_name = j.value("signal_name", std::string());
     }
 
+    /// \struct TradingViewRuleMatchStats
+    /// \brief Snapshot of level alert rule lookup counters for one config revision.
+    struct TradingViewRuleMatchStats {
+        std::uint64_t rule_count = 0;         ///< Rules compiled into the index.
+        std::uint64_t bucket_count = 0;       ///< Distinct symbol/alert ID buckets.
+        std::uint64_t lookups = 0;            ///< Rule lookups performed.
+        std::uint64_t matches = 0;            ///< Lookups that returned a rule.
+        std::uint64_t candidates_checked = 0; ///< Rules evaluated across all lookups.
+        std::uint64_t total_match_ns = 0;     ///< Accumulated lookup latency.
+        std::uint64_t max_match_ns = 0;       ///< Slowest single lookup.
+    };
+
     /// \class TradingViewExtensionBridgeConfig
     /// \brief Configuration for receiving TradingView browser-extension signals over HTTP.
     class TradingViewExtensionBridgeConfig final : public IBridgeConfig {
@@ -63,6 +75,8 @@ namespace optionx::bridges::tradingview {
                 {"min_payout", min_payout},
                 {"symbol_map", symbol_map},
                 {"dedupe_cache_size", dedupe_cache_size},
+                {"dedupe_ttl_seconds", dedupe_ttl_seconds},
+                {"dedupe_state_file", dedupe_state_file},
                 {"request_body_limit", request_body_limit},
                 {"allow_cors", allow_cors},
                 {"allowed_origin", allowed_origin},
@@ -126,6 +140,12 @@ namespace optionx::bridges::tradingview {
             if (j.contains("dedupe_cache_size")) {
                 dedupe_cache_size = j.at("dedupe_cache_size").get<std::size_t>();
             }
+            if (j.contains("dedupe_ttl_seconds")) {
+                dedupe_ttl_seconds = j.at("dedupe_ttl_seconds").get<std::int64_t>();
+            }
+            if (j.contains("dedupe_state_file")) {
+                dedupe_state_file = j.at("dedupe_state_file").get<std::string>();
+            }
             if (j.contains("request_body_limit")) {
                 request_body_limit = j.at("request_body_limit").get<std::size_t>();
             }
@@ -296,6 +316,9 @@ namespace optionx::bridges::tradingview {
             if (dedupe_cache_size == 0) {
                 return {false, "TradingView bridge dedupe_cache_size must be positive."};
             }
+            if (dedupe_ttl_seconds < 0) {
+                return {false, "TradingView bridge dedupe_ttl_seconds must not be negative."};
+            }
             if (request_body_limit == 0) {
                 return {false, "TradingView bridge request_body_limit must be positive."};
             }
@@ -463,7 +486,9 @@ namespace optionx::bridges::tradingview {
         std::string default_level_action = "reject"; ///< Fallback for unmapped level alerts.
         std::vector<TradingViewLevelAlertRule> level_alert_rules; ///< User-defined level alert mappings.
 
-        std::size_t dedupe_cache_size = 1024; ///< Recent event IDs retained to reject duplicates.
+        std::size_t dedupe_cache_size = 1024; ///< Hard cap on retained duplicate-detection keys.
+        std::int64_t dedupe_ttl_seconds = 3600; ///< Duplicate-detection window; 0 keeps keys until the cap evicts them.
+        std::string dedupe_state_file; ///< Optional journal that keeps dedupe keys across restarts.
         std::size_t request_body_limit = 64 * 1024; ///< Maximum accepted request body in bytes.
         bool allow_cors = true; ///< Add permissive local CORS headers for browser-extension clients.
         std::string allowed_origin = "*"; ///< Allowed CORS origin; use chrome-extension://<id> outside dev.
@@ -0,0 +1,202 @@
+#pragma once
+#ifndef OPTIONX_HEADER_BRIDGES_TRADING_VIEW_DETAIL_TRADING_VIEW_ACTION_KEYWORD_MATCHER_HPP_INCLUDED
+#define OPTIONX_HEADER_BRIDGES_TRADING_VIEW_DETAIL_TRADING_VIEW_ACTION_KEYWORD_MATCHER_HPP_INCLUDED
+
+/// \file TradingViewActionKeywordMatcher.hpp
+/// \brief Precompiled buy/sell keyword classifier for free-form TradingView alert text.
+
+namespace optionx::bridges::tradingview::detail {
+
+    /// \class TradingViewActionKeywordMatcher
+    /// \brief Buy/sell keyword classifier on top of utils::AhoCorasickAutomaton.
+    /// \details Keywords are trimmed and folded once when the matcher is built.
+    ///          Classification folds the alert text once and walks it in a
+    ///          single pass. ASCII-only keywords must sit on ASCII word
+    ///          boundaries, non-ASCII keywords match as plain substrings; this
+    ///          mirrors the per-keyword `find` scan the matcher replaces.
+    class TradingViewActionKeywordMatcher {
+    public:
+        static constexpr std::uint8_t BUY_MASK = 0x01;  ///< Text contains a buy keyword.
+        static constexpr std::uint8_t SELL_MASK = 0x02; ///< Text contains a sell keyword.
+
+        /// \brief Constructs an empty matcher that never reports a keyword.
+        TradingViewActionKeywordMatcher() {
+            build();
+        }
+
+        /// \brief Compiles buy and sell keyword lists.
+        /// \param buy_keywords Raw buy keywords; blank entries are ignored.
+        /// \param sell_keywords Raw sell keywords; blank entries are ignored.
+        TradingViewActionKeywordMatcher(
+                const std::vector<std::string>& buy_keywords,
+                const std::vector<std::string>& sell_keywords) {
+            for (const auto& keyword : buy_keywords) {
+                add_keyword(keyword, BUY_MASK);
+            }
+            for (const auto& keyword : sell_keywords) {
+                add_keyword(keyword, SELL_MASK);
+            }
+            build();
+        }
+
+        /// \brief Returns the number of distinct compiled keywords.
+        std::size_t keyword_count() const noexcept {
+            return m_keyword_count;
+        }
+
+        /// \brief Returns true when no keyword was compiled.
+        bool empty() const noexcept {
+            return m_keyword_count == 0;
+        }
+
+        /// \brief Scans raw text and returns the union of matched side masks.
+        /// \param text Alert text; it is case-folded before matching.
+        /// \return Combination of `BUY_MASK` and `SELL_MASK`.
+        std::uint8_t match_mask(const std::string& text) const {
+            if (empty() || text.empty()) {
+                return 0;
+            }
+            return match_folded_mask(utils::unicode_case_fold(text));
+        }
+
+        /// \brief Scans already folded text and returns matched side masks.
+        /// \param folded_text Text produced by `utils::unicode_case_fold`.
+        /// \return Combination of `BUY_MASK` and `SELL_MASK`.
+        std::uint8_t match_folded_mask(const std::string& folded_text) const {
+            std::uint8_t mask = 0;
+            std::uint32_t state = utils::AhoCorasickAutomaton::ROOT;
+            const auto size = folded_text.size();
+            for (std::size_t index = 0; index < size; ++index) {
+                state = m_automaton.next(state, folded_text[index]);
+
+                const auto& node = m_nodes[state];
+                mask |= node.plain_mask;
+                if ((node.bounded_mask & ~mask) != 0) {
+                    mask |= bounded_matches(folded_text, index + 1, state, mask);
+                }
+                if (mask == (BUY_MASK | SELL_MASK)) {
+                    break;
+                }
+            }
+            return mask;
+        }
+
+        /// \brief Classifies text as buy, sell, or unknown.
+        /// \return `BUY`/`SELL` only when exactly one side matched.
+        OrderType classify(const std::string& text) const {
+            const auto mask = match_mask(text);
+            if (mask == BUY_MASK) {
+                return OrderType::BUY;
+            }
+            if (mask == SELL_MASK) {
+                return OrderType::SELL;
+            }
+            return OrderType::UNKNOWN;
+        }
+
+    private:
+        /// \brief Keyword sides attached to an automaton state.
+        struct Node {
+            std::uint8_t own_plain = 0;      ///< Substring keywords ending exactly here.
+            std::uint8_t own_bounded = 0;    ///< Word-bounded keywords ending exactly here.
+            std::uint8_t plain_mask = 0;     ///< Substring masks over the whole suffix chain.
+            std::uint8_t bounded_mask = 0;   ///< Word-bounded masks over the whole suffix chain.
+        };
+
+        /// \brief Keyword added before build().
+        struct PendingKeyword {
+            std::uint32_t state = 0; ///< Terminal automaton state.
+            std::uint8_t side = 0;   ///< `BUY_MASK` or `SELL_MASK`.
+            bool bounded = false;    ///< Keyword must sit on ASCII word boundaries.
+        };
+
+        utils::AhoCorasickAutomaton m_automaton;
+        std::vector<PendingKeyword> m_pending; ///< Keywords waiting for build().
+        std::vector<Node> m_nodes;             ///< Sides indexed by automaton state.
+        std::size_t m_keyword_count = 0;
+
+        static bool is_word_byte(char ch) {
+            const auto value = static_cast<unsigned char>(ch);
+            return value < 0x80 && (std::isalnum(value) != 0 || ch == '_');
+        }
+
+        static std::string trim_keyword(const std::string& value) {
+            const auto first = value.find_first_not_of(" \t\r\n");
+            if (first == std::string::npos) {
+                return {};
+            }
+            const auto last = value.find_last_not_of(" \t\r\n");
+            return value.substr(first, last - first + 1);
+        }
+
+        void add_keyword(const std::string& keyword, std::uint8_t side) {
+            const auto folded = utils::unicode_case_fold(trim_keyword(keyword));
+            if (folded.empty()) {
+                return;
+            }
+
+            const bool ascii = std::none_of(folded.begin(), folded.end(), [](char ch) {
+                return static_cast<unsigned char>(ch) >= 0x80;
+            });
+            m_pending.push_back(PendingKeyword{m_automaton.add_pattern(folded), side, ascii});
+        }
+
+        void build() {
+            m_automaton.build();
+            m_nodes.assign(m_automaton.state_count(), Node{});
+            for (const auto& keyword : m_pending) {
+                auto& node = m_nodes[keyword.state];
+                if (((node.own_plain | node.own_bounded) & keyword.side) == 0) {
+                    ++m_keyword_count;
+                }
+                if (keyword.bounded) {
+                    node.own_bounded |= keyword.side;
+                } else {
+                    node.own_plain |= keyword.side;
+                }
+            }
+            m_pending.clear();
+            m_pending.shrink_to_fit();
+
+            // Breadth-first order guarantees that fail states are complete
+            // before their dependants read them.
+            for (const auto state : m_automaton.breadth_first_order()) {
+                auto& node = m_nodes[state];
+                const auto& fail_node = m_nodes[m_automaton.fail(state)];
+                node.plain_mask = node.own_plain | fail_node.plain_mask;
+                node.bounded_mask = node.own_bounded | fail_node.bounded_mask;
+            }
+        }
+
+        std::uint8_t bounded_matches(
+                const std::string& folded_text,
+                std::size_t end,
+                std::uint32_t state,
+                std::uint8_t known_mask) const {
+            const bool right_ok =
+                end >= folded_text.size() || !is_word_byte(folded_text[end]);
+            if (!right_ok) {
+                return 0;
+            }
+
+            std::uint8_t mask = 0;
+            if (!m_automaton.is_terminal(state)) {
+                state = m_automaton.output_link(state);
+            }
+            while (state != utils::AhoCorasickAutomaton::ROOT) {
+                const auto& node = m_nodes[state];
+                if ((node.own_bounded & ~(known_mask | mask)) != 0) {
+                    const auto begin = end - m_automaton.depth(state);
+                    if (begin == 0 || !is_word_byte(folded_text[begin - 1])) {
+                        mask |= node.own_bounded;
+                    }
+                }
+                state = m_automaton.output_link(state);
+            }
+            return mask;
+        }
+    };
+
+} // namespace optionx::bridges::tradingview::detail
+
+#endif // OPTIONX_HEADER_BRIDGES_TRADING_VIEW_DETAIL_TRADING_VIEW_ACTION_KEYWORD_MATCHER_HPP_INCLUDED
@@ -326,6 +326,16 @@ namespace optionx::bridges::tradingview::detail {
             return keywords;
         }
 
+        /// \brief Compiles the effective buy/sell keywords of a config revision.
+        inline TradingViewActionKeywordMatcher make_action_keyword_matcher(
+                const TradingViewExtensionBridgeConfig& config) {
+            return TradingViewActionKeywordMatcher(
+                effective_buy_action_keywords(config),
+                effective_sell_action_keywords(config));
+        }
+
+        /// \brief Reference per-keyword scan kept for diagnostics and benchmarks.
+        /// \details Hot paths use `TradingViewActionKeywordMatcher` instead.
         inline bool contains_any_action_keyword(
                 const std::string& text,
                 const std::vector<std::string>& keywords) {
@@ -537,9 +547,19 @@ namespace optionx::bridges::tradingview::detail {
         }
 
         inline OrderType order_type_from_action_keywords(
-                const TradingViewExtensionBridgeConfig& config,
+                const TradingViewActionKeywordMatcher& matcher,
                 const NormalizedEvent& event) {
-            std::string text = event.message;
+            if (matcher.empty()) {
+                return OrderType::UNKNOWN;
+            }
+
+            std::string text;
+            text.reserve(
+                event.message.size() +
+                event.signal_name.size() +
+                event.alert_name.size() +
+                event.action.size() + 3);
+            text = event.message;
             if (!event.signal_name.empty()) {
                 text += ' ';
                 text += event.signal_name;
@@ -552,21 +572,15 @@ namespace optionx::bridges::tradingview::detail {
                 text += ' ';
                 text += event.action;
             }
+            return matcher.classify(text);
+        }
 
-            const auto buy_keywords = effective_buy_action_keywords(config);
-            const auto sell_keywords = effective_sell_action_keywords(config);
-            const bool has_buy =
-                contains_any_action_keyword(text, buy_keywords);
-            const bool has_sell =
-                contains_any_action_keyword(text, sell_keywords);
-
-            if (has_buy && !has_sell) {
-                return OrderType::BUY;
-            }
-            if (has_sell && !has_buy) {
-                return OrderType::SELL;
-            }
-            return OrderType::UNKNOWN;
+        inline OrderType order_type_from_action_keywords(
+                const TradingViewExtensionBridgeConfig& config,
+                const NormalizedEvent& event) {
+            return order_type_from_action_keywords(
+                make_action_keyword_matcher(config),
+                event);
         }
 
         inline std::string normalize_condition_type(std::string value) {
@@ -831,6 +845,9 @@ namespace optionx::bridges::tradingview::detail {
             return true;
         }
 
+        /// \brief Linear first-match rule scan.
+        /// \details Request handling uses `LevelRuleIndex`; this stays as the
+        ///          reference behavior the index must reproduce.
         inline const TradingViewLevelAlertRule* find_level_rule(
                 const TradingViewExtensionBridgeConfig& config,
                 const NormalizedEvent& event) {
@@ -842,6 +859,182 @@ namespace optionx::bridges::tradingview::detail {
             return nullptr;
         }
 
+        /// \class LevelRuleIndex
+        /// \brief Level alert rules bucketed by normalized symbol and alert ID.
+        /// \details Rules without a symbol or alert ID land in wildcard buckets.
+        ///          A lookup only evaluates rules from the buckets the event can
+        ///          hit and keeps first-match semantics by returning the lowest
+        ///          config index among the matching candidates.
+        class LevelRuleIndex {
+        public:
+            /// \brief Compiles rules from one config revision.
+            explicit LevelRuleIndex(const TradingViewExtensionBridgeConfig& config)
+                : m_rules(config.level_alert_rules) {
+                m_compiled.reserve(m_rules.size());
+                for (std::size_t index = 0; index < m_rules.size(); ++index) {
+                    const auto& rule = m_rules[index];
+                    CompiledRule compiled;
+                    compiled.symbol_required = !rule.symbol.empty();
+                    compiled.symbol = compiled.symbol_required
+                        ? normalize_symbol_value(rule.symbol)
+                        : std::string();
+                    compiled.condition_type = rule.condition_type.empty()
+                        ? std::string()
+                        : normalize_condition_type(rule.condition_type);
+                    m_compiled.push_back(std::move(compiled));
+
+                    m_buckets[bucket_key(m_compiled.back().symbol, rule.alert_id)]
+                        .push_back(static_cast<std::uint32_t>(index));
+                }
+            }
+
+            LevelRuleIndex(const LevelRuleIndex&) = delete;
+            LevelRuleIndex& operator=(const LevelRuleIndex&) = delete;
+
+            /// \brief Returns the first configured rule matching the event.
+            /// \return Rule owned by the index, or `nullptr`.
+            const TradingViewLevelAlertRule* find(const NormalizedEvent& event) const {
+                if (m_rules.empty()) {
+                    return nullptr;
+                }
+
+                const auto started = std::chrono::steady_clock::now();
+                std::size_t best = m_rules.size();
+                std::uint64_t checked = 0;
+
+                const std::string* symbols[] = {
+                    &event.original_symbol,
+                    &event.symbol,
+                    &m_empty
+                };
+                const std::string* alert_ids[] = {
+                    &event.alert_id,
+                    &event.fire_id,
+                    &m_empty
+                };
+                for (std::size_t si = 0; si < 3; ++si) {
+                    if (is_repeated(symbols, si)) {
+                        continue;
+                    }
+                    for (std::size_t ai = 0; ai < 3; ++ai) {
+                        if (is_repeated(alert_ids, ai)) {
+                            continue;
+                        }
+                        const auto it = m_buckets.find(bucket_key(*symbols[si], *alert_ids[ai]));
+                        if (it == m_buckets.end()) {
+                            continue;
+                        }
+                        for (const auto index : it->second) {
+                            if (index >= best) {
+                                break;
+                            }
+                            ++checked;
+                            if (matches(index, event)) {
+                                best = index;
+                                break;
+                            }
+                        }
+                    }
+                }
+
+                const auto elapsed_ns = static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - started).count());
+                m_lookups.fetch_add(1, std::memory_order_relaxed);
+                m_candidates_checked.fetch_add(checked, std::memory_order_relaxed);
+                m_total_match_ns.fetch_add(elapsed_ns, std::memory_order_relaxed);
+                auto max_ns = m_max_match_ns.load(std::memory_order_relaxed);
+                while (elapsed_ns > max_ns &&
+                       !m_max_match_ns.compare_exchange_weak(
+                           max_ns,
+                           elapsed_ns,
+                           std::memory_order_relaxed)) {
+                }
+
+                if (best == m_rules.size()) {
+                    return nullptr;
+                }
+                m_matches.fetch_add(1, std::memory_order_relaxed);
+                return &m_rules[best];
+            }
+
+            /// \brief Returns a snapshot of lookup counters.
+            TradingViewRuleMatchStats stats() const {
+                TradingViewRuleMatchStats stats;
+                stats.rule_count = m_rules.size();
+                stats.bucket_count = m_buckets.size();
+                stats.lookups = m_lookups.load(std::memory_order_relaxed);
+                stats.matches = m_matches.load(std::memory_order_relaxed);
+                stats.candidates_checked = m_candidates_checked.load(std::memory_order_relaxed);
+                stats.total_match_ns = m_total_match_ns.load(std::memory_order_relaxed);
+                stats.max_match_ns = m_max_match_ns.load(std::memory_order_relaxed);
+                return stats;
+            }
+
+        private:
+            struct CompiledRule {
+                bool symbol_required = false;
+                std::string symbol;
+                std::string condition_type;
+            };
+
+            std::vector<TradingViewLevelAlertRule> m_rules;
+            std::vector<CompiledRule> m_compiled;
+            std::unordered_map<std::string, std::vector<std::uint32_t>> m_buckets;
+            const std::string m_empty;
+
+            mutable std::atomic<std::uint64_t> m_lookups{0};
+            mutable std::atomic<std::uint64_t> m_matches{0};
+            mutable std::atomic<std::uint64_t> m_candidates_checked{0};
+            mutable std::atomic<std::uint64_t> m_total_match_ns{0};
+            mutable std::atomic<std::uint64_t> m_max_match_ns{0};
+
+            static std::string bucket_key(const std::string& symbol, const std::string& alert_id) {
+                std::string key;
+                key.reserve(symbol.size() + alert_id.size() + 1);
+                key += symbol;
+                key += '\x1F';
+                key += alert_id;
+                return key;
+            }
+
+            static bool is_repeated(const std::string* const (&values)[3], std::size_t index) {
+                for (std::size_t prev = 0; prev < index; ++prev) {
+                    if (*values[prev] == *values[index]) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            bool matches(std::size_t index, const NormalizedEvent& event) const {
+                const auto& rule = m_rules[index];
+                const auto& compiled = m_compiled[index];
+                if (!rule.alert_id.empty() &&
+                    rule.alert_id != event.alert_id &&
+                    rule.alert_id != event.fire_id) {
+                    return false;
+                }
+                if (compiled.symbol_required &&
+                    compiled.symbol != event.original_symbol &&
+                    compiled.symbol != event.symbol) {
+                    return false;
+                }
+                if (!compiled.condition_type.empty() &&
+                    compiled.condition_type != event.condition_type) {
+                    return false;
+                }
+                if (!rule.message_equals.empty() && rule.message_equals != event.message) {
+                    return false;
+                }
+                if (!rule.message_contains.empty() &&
+                    event.message.find(rule.message_contains) == std::string::npos) {
+                    return false;
+                }
+                return true;
+            }
+        };
+
         inline NormalizedEvent parse_pricealerts_private_feed(const nlohmann::json& payload) {
             NormalizedEvent event;
             event.source_kind = "private_pricealerts_ws";
@@ -1293,14 +1486,29 @@ namespace optionx::bridges::tradingview::detail {
 
     } // namespace protocol
 
+    /// \struct TradingViewParseContext
+    /// \brief Lookup structures compiled once per bridge config revision.
+    struct TradingViewParseContext {
+        /// \brief Compiles action keywords and level alert rules from `config`.
+        explicit TradingViewParseContext(const TradingViewExtensionBridgeConfig& config)
+            : keyword_matcher(protocol::make_action_keyword_matcher(config)),
+              level_rules(config) {}
+
+        TradingViewActionKeywordMatcher keyword_matcher; ///< Buy/sell keyword classifier.
+        protocol::LevelRuleIndex level_rules;            ///< Indexed level alert rules.
+    };
+
     /// \brief Parses a TradingView extension payload into a trade signal.
     /// \param payload JSON payload received from the browser extension.
+    /// \param request_secret Secret received in the HTTP header.
     /// \param config Bridge configuration.
+    /// \param context Keyword matcher and rule index compiled from `config`.
     /// \return Parse result with signal or rejection reason.
     inline TradingViewParseResult parse_extension_payload(
             const nlohmann::json& payload,
             const std::string& request_secret,
-            const TradingViewExtensionBridgeConfig& config) {
+            const TradingViewExtensionBridgeConfig& config,
+            const TradingViewParseContext& context) {
         TradingViewParseResult result;
         result.raw_payload = protocol::redact_payload_secrets(payload);
 
@@ -1383,11 +1591,11 @@ namespace optionx::bridges::tradingview::detail {
         auto order_type = protocol::order_type_from_action(event.action);
         std::string signal_name = event.signal_name;
         const auto keyword_order_type = order_type == OrderType::UNKNOWN
-            ? protocol::order_type_from_action_keywords(config, event)
+            ? protocol::order_type_from_action_keywords(context.keyword_matcher, event)
             : OrderType::UNKNOWN;
 
         if (order_type == OrderType::UNKNOWN && event.is_level_alert) {
-            if (const auto* rule = protocol::find_level_rule(config, event)) {
+            if (const auto* rule = context.level_rules.find(event)) {
                 const auto action = protocol::lower_copy(protocol::trim_copy(rule->action));
                 if (action == "reject" || action == "ignore") {
                     result.reason = "level_alert_rejected_by_rule";
@@ -1453,6 +1661,17 @@ namespace optionx::bridges::tradingview::detail {
         return result;
     }
 
+    /// \brief Parses a payload and compiles a parse context for this call only.
+    /// \details Long-lived callers should build `TradingViewParseContext` once
+    ///          per config revision and use the overload that accepts it.
+    inline TradingViewParseResult parse_extension_payload(
+            const nlohmann::json& payload,
+            const std::string& request_secret,
+            const TradingViewExtensionBridgeConfig& config) {
+        const TradingViewParseContext context(config);
+        return parse_extension_payload(payload, request_secret, config, context);
+    }
+
     /// \brief Parses a payload without an HTTP header secret.
     /// \details JSON body secret fallback is disabled unless the config opts in.
     inline TradingViewParseResult parse_extension_payload(
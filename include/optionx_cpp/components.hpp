@@ -12,9 +12,14 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "utils.hpp"
@@ -24,6 +29,7 @@
 #include "components/BaseTradeExecutionComponent.hpp"
 #include "components/BaseHttpClientComponent.hpp"
 #include "components/BaseAccountInfoHandler.hpp"
+#include "components/detail/ScopedDeliveryCursor.hpp"
 #include "components/IAccountInfoSubscriber.hpp"
 #include "components/AccountInfoHub.hpp"
 #include "components/BaseTradingConditionHandler.hpp"
@@ -16,6 +16,14 @@ namespace optionx::components {
     /// update to late subscribers. Subscribers are stored as weak references,
     /// so caller code must keep subscriber objects alive while they should
     /// receive callbacks.
+    ///
+    /// The latest update is also cached per internal account ID with a
+    /// version number. Account subscribers register for specific account IDs,
+    /// receive the cached update of each account on subscribe and afterwards
+    /// only updates of those accounts. No hub lock is held while callbacks
+    /// run; account deliveries are numbered per account and pass through a
+    /// per-subscriber cursor, so the snapshot and later updates arrive in
+    /// publish order even with concurrent publishers.
     class AccountInfoHub {
     public:
         /// \brief Constructs an account-info hub.
@@ -49,9 +57,9 @@ namespace optionx::components {
             std::optional<AccountInfoUpdate> replay_update;
             {
                 std::lock_guard<std::mutex> lock(m_mutex);
-                prune_expired_no_lock();
+                prune_expired_no_lock(m_subscribers);
                 bool inserted = false;
-                if (!contains_subscriber_no_lock(locked.get())) {
+                if (!contains_subscriber_no_lock(m_subscribers, locked.get())) {
                     m_subscribers.push_back(std::move(subscriber));
                     inserted = true;
                 }
@@ -67,28 +75,91 @@ namespace optionx::components {
             }
         }
 
+        /// \brief Adds a shared subscriber for specific accounts.
+        /// \details The subscriber immediately receives the cached latest
+        ///          update of every requested account and then only updates
+        ///          whose `account_id` matches. The hub stores only a weak
+        ///          reference.
+        /// \param subscriber Subscriber object; ignored when null.
+        /// \param account_ids Internal OptionX account IDs.
+        void add_account_subscriber(
+                std::shared_ptr<IAccountInfoSubscriber> subscriber,
+                const std::vector<std::int64_t>& account_ids) {
+            if (!subscriber) return;
+            add_weak_account_subscriber(
+                std::weak_ptr<IAccountInfoSubscriber>(subscriber),
+                account_ids);
+        }
+
+        /// \brief Adds a weak subscriber for specific accounts.
+        /// \param subscriber Weak subscriber reference; ignored when expired.
+        /// \param account_ids Internal OptionX account IDs.
+        void add_weak_account_subscriber(
+                std::weak_ptr<IAccountInfoSubscriber> subscriber,
+                const std::vector<std::int64_t>& account_ids) {
+            const auto locked = subscriber.lock();
+            if (!locked) return;
+
+            struct PendingSnapshot {
+                std::shared_ptr<cursor_t> cursor;
+                std::uint64_t sequence = 0;
+                std::shared_ptr<const AccountInfoUpdate> snapshot;
+            };
+            std::vector<PendingSnapshot> snapshots;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (const auto account_id : account_ids) {
+                    auto& scope = m_accounts[account_id];
+                    prune_expired_no_lock(scope.subscribers);
+                    if (contains_subscriber_no_lock(scope.subscribers, locked.get())) continue;
+                    if (!scope.last_update) {
+                        scope.subscribers.push_back(AccountSubscriber{
+                            subscriber,
+                            std::make_shared<cursor_t>(scope.sequence + 1)});
+                        continue;
+                    }
+                    // The snapshot takes the current account sequence, so the
+                    // next update (sequence + 1) is delivered after it.
+                    auto cursor = std::make_shared<cursor_t>(scope.sequence);
+                    scope.subscribers.push_back(AccountSubscriber{subscriber, cursor});
+                    snapshots.push_back(PendingSnapshot{
+                        std::move(cursor),
+                        scope.sequence,
+                        std::make_shared<const AccountInfoUpdate>(*scope.last_update)});
+                }
+            }
+
+            for (auto& item : snapshots) {
+                item.cursor->offer(
+                    item.sequence,
+                    std::move(item.snapshot),
+                    [&locked](const AccountInfoUpdate& update) {
+                        locked->on_account_info(update);
+                    });
+            }
+        }
+
         /// \brief Removes a subscriber by object address.
+        /// \details Removes both the plain and all account registrations.
         /// \param subscriber Subscriber object address.
         void remove_subscriber(const IAccountInfoSubscriber* subscriber) {
             std::lock_guard<std::mutex> lock(m_mutex);
-            m_subscribers.erase(
-                std::remove_if(
-                    m_subscribers.begin(),
-                    m_subscribers.end(),
-                    [subscriber](const std::weak_ptr<IAccountInfoSubscriber>& item) {
-                        const auto locked = item.lock();
-                        return !locked || locked.get() == subscriber;
-                    }),
-                m_subscribers.end());
+            remove_subscriber_no_lock(m_subscribers, subscriber);
+            for (auto& item : m_accounts) {
+                remove_subscriber_no_lock(item.second.subscribers, subscriber);
+            }
         }
 
         /// \brief Removes all subscribers.
         void clear_subscribers() {
             std::lock_guard<std::mutex> lock(m_mutex);
             m_subscribers.clear();
+            for (auto& item : m_accounts) {
+                item.second.subscribers.clear();
+            }
         }
 
-        /// \brief Returns the number of live subscribers.
+        /// \brief Returns the number of live plain subscribers.
         /// \return Count of non-expired subscribers.
         std::size_t subscriber_count() const {
             std::lock_guard<std::mutex> lock(m_mutex);
@@ -101,6 +172,21 @@ namespace optionx::components {
             return count;
         }
 
+        /// \brief Returns the number of live subscribers for an account.
+        /// \param account_id Internal OptionX account ID.
+        /// \return Count of non-expired account subscribers.
+        std::size_t account_subscriber_count(std::int64_t account_id) const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const auto it = m_accounts.find(account_id);
+            if (it == m_accounts.end()) return 0;
+            return static_cast<std::size_t>(std::count_if(
+                it->second.subscribers.begin(),
+                it->second.subscribers.end(),
+                [](const AccountSubscriber& item) {
+                    return !item.subscriber.expired();
+                }));
+        }
+
         /// \brief Binds the hub to a platform/account callback.
         /// \details Replaces the callback with a dispatcher that calls
         ///          `publish()`. Call `unbind_from()` before destroying the hub
@@ -128,24 +214,38 @@ namespace optionx::components {
         }
 
         /// \brief Publishes an account update to all live subscribers.
+        /// \details Plain subscribers receive every update; account
+        ///          subscribers receive updates of their accounts only.
         /// \param update Account update payload.
         void publish(AccountInfoUpdate update) {
             std::vector<std::shared_ptr<IAccountInfoSubscriber>> subscribers;
+            std::vector<LiveAccountSubscriber> account_subscribers;
+            std::uint64_t sequence = 0;
             {
                 std::lock_guard<std::mutex> lock(m_mutex);
                 m_last_update = update;
-                prune_expired_no_lock();
-                subscribers.reserve(m_subscribers.size());
-                for (const auto& subscriber : m_subscribers) {
-                    if (auto locked = subscriber.lock()) {
-                        subscribers.push_back(std::move(locked));
-                    }
-                }
+                auto& scope = m_accounts[update.account_id];
+                scope.last_update = update;
+                scope.version = ++m_version_counter;
+                sequence = ++scope.sequence;
+                lock_live_no_lock(m_subscribers, subscribers);
+                lock_live_account_no_lock(scope.subscribers, account_subscribers);
             }
 
             for (const auto& subscriber : subscribers) {
                 subscriber->on_account_info(update);
             }
+            if (account_subscribers.empty()) return;
+            const auto shared_update = std::make_shared<const AccountInfoUpdate>(std::move(update));
+            for (const auto& item : account_subscribers) {
+                const auto& subscriber = item.subscriber;
+                item.cursor->offer(
+                    sequence,
+                    shared_update,
+                    [&subscriber](const AccountInfoUpdate& value) {
+                        subscriber->on_account_info(value);
+                    });
+            }
         }
 
         /// \brief Returns the latest cached update when one exists.
@@ -155,41 +255,156 @@ namespace optionx::components {
             return m_last_update;
         }
 
-        /// \brief Clears the cached latest update.
+        /// \brief Returns the latest cached update of an account.
+        /// \param account_id Internal OptionX account ID.
+        /// \return Last update of the account, or `std::nullopt`.
+        std::optional<AccountInfoUpdate> last_update(std::int64_t account_id) const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const auto it = m_accounts.find(account_id);
+            if (it == m_accounts.end()) return std::nullopt;
+            return it->second.last_update;
+        }
+
+        /// \brief Returns the version of the latest cached update of an account.
+        /// \details Versions are taken from a hub-wide counter and grow with
+        ///          every update published for the account.
+        /// \param account_id Internal OptionX account ID.
+        /// \return Account version, or 0 when no update is cached.
+        std::uint64_t account_version(std::int64_t account_id) const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const auto it = m_accounts.find(account_id);
+            if (it == m_accounts.end() || !it->second.last_update) return 0;
+            return it->second.version;
+        }
+
+        /// \brief Clears the cached latest updates.
         void clear_last_update() {
             std::lock_guard<std::mutex> lock(m_mutex);
             m_last_update.reset();
+            for (auto& item : m_accounts) {
+                item.second.last_update.reset();
+            }
         }
 
     private:
+        using subscriber_list_t = std::vector<std::weak_ptr<IAccountInfoSubscriber>>;
+        using cursor_t = detail::ScopedDeliveryCursor<AccountInfoUpdate>;
+
+        /// \brief Account registration with its delivery cursor.
+        struct AccountSubscriber {
+            std::weak_ptr<IAccountInfoSubscriber> subscriber;
+            std::shared_ptr<cursor_t> cursor;
+        };
+
+        struct LiveAccountSubscriber {
+            std::shared_ptr<IAccountInfoSubscriber> subscriber;
+            std::shared_ptr<cursor_t> cursor;
+        };
+
+        /// \brief Cached state and subscribers of one account.
+        struct AccountScope {
+            std::optional<AccountInfoUpdate> last_update;
+            std::uint64_t version = 0;
+            std::uint64_t sequence = 0; ///< Number of the last update sent to account subscribers.
+            std::vector<AccountSubscriber> subscribers;
+        };
+
         mutable std::mutex m_mutex;
-        std::vector<std::weak_ptr<IAccountInfoSubscriber>> m_subscribers;
+        subscriber_list_t m_subscribers;
         std::optional<AccountInfoUpdate> m_last_update;
+        std::unordered_map<std::int64_t, AccountScope> m_accounts;
+        std::uint64_t m_version_counter = 0;
         account_info_callback_t* m_bound_callback = nullptr;
         bool m_replay_last_update_to_new_subscribers = true;
 
+        /// \brief Collects live subscribers and drops expired ones if any were found.
+        static void lock_live_no_lock(
+                subscriber_list_t& list,
+                std::vector<std::shared_ptr<IAccountInfoSubscriber>>& out) {
+            out.reserve(out.size() + list.size());
+            bool has_expired = false;
+            for (const auto& subscriber : list) {
+                if (auto locked = subscriber.lock()) {
+                    out.push_back(std::move(locked));
+                } else {
+                    has_expired = true;
+                }
+            }
+            if (has_expired) {
+                prune_expired_no_lock(list);
+            }
+        }
+
+        /// \brief Collects live account subscribers and drops expired ones if any were found.
+        static void lock_live_account_no_lock(
+                std::vector<AccountSubscriber>& list,
+                std::vector<LiveAccountSubscriber>& out) {
+            out.reserve(out.size() + list.size());
+            bool has_expired = false;
+            for (const auto& item : list) {
+                if (auto locked = item.subscriber.lock()) {
+                    out.push_back(LiveAccountSubscriber{std::move(locked), item.cursor});
+                } else {
+                    has_expired = true;
+                }
+            }
+            if (has_expired) {
+                prune_expired_no_lock(list);
+            }
+        }
+
+        static const std::weak_ptr<IAccountInfoSubscriber>& weak_of(
+                const std::weak_ptr<IAccountInfoSubscriber>& item) noexcept {
+            return item;
+        }
+
+        static const std::weak_ptr<IAccountInfoSubscriber>& weak_of(
+                const AccountSubscriber& item) noexcept {
+            return item.subscriber;
+        }
+
         /// \brief Removes expired weak subscribers.
-        void prune_expired_no_lock() {
-            m_subscribers.erase(
+        template <class List>
+        static void prune_expired_no_lock(List& list) {
+            list.erase(
                 std::remove_if(
-                    m_subscribers.begin(),
-                    m_subscribers.end(),
-                    [](const std::weak_ptr<IAccountInfoSubscriber>& item) {
-                        return item.expired();
+                    list.begin(),
+                    list.end(),
+                    [](const typename List::value_type& item) {
+                        return weak_of(item).expired();
+                    }),
+                list.end());
+        }
+
+        /// \brief Removes a subscriber and expired entries from a list.
+        template <class List>
+        static void remove_subscriber_no_lock(
+                List& list,
+                const IAccountInfoSubscriber* subscriber) {
+            list.erase(
+                std::remove_if(
+                    list.begin(),
+                    list.end(),
+                    [subscriber](const typename List::value_type& item) {
+                        const auto locked = weak_of(item).lock();
+                        return !locked || locked.get() == subscriber;
                     }),
-                m_subscribers.end());
+                list.end());
         }
 
         /// \brief Checks whether a subscriber is already registered.
+        /// \param list Subscriber list to search.
         /// \param subscriber Subscriber object address.
         /// \return True if the subscriber is already present.
-        bool contains_subscriber_no_lock(
-                const IAccountInfoSubscriber* subscriber) const {
+        template <class List>
+        static bool contains_subscriber_no_lock(
+                const List& list,
+                const IAccountInfoSubscriber* subscriber) {
             return std::any_of(
-                m_subscribers.begin(),
-                m_subscribers.end(),
-                [subscriber](const std::weak_ptr<IAccountInfoSubscriber>& item) {
-                    const auto locked = item.lock();
+                list.begin(),
+                list.end(),
+                [subscriber](const typename List::value_type& item) {
+                    const auto locked = weak_of(item).lock();
                     return locked && locked.get() == subscriber;
                 });
         }
@@ -27,6 +27,7 @@ namespace optionx::components {
         virtual ~BaseHttpClientComponent() noexcept override {
             deinitialize_rate_limits();
             m_client.cancel_requests();
+            Metrics::instance().in_flight.add(-static_cast<std::int64_t>(m_http_tasks.size()));
             m_http_tasks.clear();
         }
 
@@ -68,7 +69,8 @@ namespace optionx::components {
         void add_http_request_task(
                 std::future<kurlyk::HttpResponsePtr> future,
                 std::function<void(kurlyk::HttpResponsePtr)> callback) {
-            m_http_tasks.push_back({std::move(future), std::move(callback)});
+            m_http_tasks.push_back({std::move(future), std::move(callback), std::chrono::steady_clock::now()});
+            Metrics::instance().in_flight.add(1);
         }
 
     protected:
@@ -80,6 +82,7 @@ namespace optionx::components {
         struct HttpRequestTask {
             std::future<kurlyk::HttpResponsePtr>            future;     ///< Future holding the HTTP response.
             std::function<void(kurlyk::HttpResponsePtr)>    callback;   ///< Callback for processing the response.
+            std::chrono::steady_clock::time_point           submitted;  ///< Time the task was added, rate-limit wait included.
 
             /// \brief Checks if the response is ready.
             /// \return True if the future is ready, false otherwise.
@@ -90,6 +93,35 @@ namespace optionx::components {
 
         std::list<HttpRequestTask> m_http_tasks;      ///< List of pending HTTP request tasks.
 
+        /// \brief Process-wide HTTP client metrics.
+        struct Metrics {
+            utils::metrics::Gauge&     in_flight;  ///< Tasks waiting for a response.
+            utils::metrics::Counter&   ok;         ///< Responses without a transport error.
+            utils::metrics::Counter&   error;      ///< Responses with a transport error.
+            utils::metrics::Histogram& duration_ms; ///< Time from submission to response.
+
+            static Metrics& instance() {
+                auto& registry = utils::metrics::MetricsRegistry::global();
+                static Metrics s_metrics{
+                    registry.gauge("optionx_http_requests_in_flight", "HTTP requests waiting for a response."),
+                    registry.counter("optionx_http_responses_total", "HTTP responses by transport result.", {{"result", "ok"}}),
+                    registry.counter("optionx_http_responses_total", "HTTP responses by transport result.", {{"result", "error"}}),
+                    registry.histogram("optionx_http_request_duration_ms", "HTTP request time including rate-limit waits, in milliseconds.")
+                };
+                return s_metrics;
+            }
+        };
+
+        /// \brief Records the outcome of a completed task.
+        static void record_http_response(const HttpRequestTask& task, bool ok) {
+            auto& metrics = Metrics::instance();
+            metrics.in_flight.add(-1);
+            (ok ? metrics.ok : metrics.error).inc();
+            const auto elapsed = std::chrono::steady_clock::now() - task.submitted;
+            metrics.duration_ms.record(static_cast<std::uint64_t>(
+                std::max<std::int64_t>(0, std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count())));
+        }
+
         /// \brief Deinitializes all rate limits by resetting them.
         void deinitialize_rate_limits() {
             for (auto& item : m_rate_limits) {
@@ -139,12 +171,16 @@ namespace optionx::components {
             auto it = m_http_tasks.begin();
             while (it != m_http_tasks.end()) {
                 if (it->ready()) {
+                    bool recorded = false;
                     try {
                         // Retrieve the response and call the callback.
                         auto response = it->future.get();
+                        record_http_response(*it, response && !response->error_code);
+                        recorded = true;
                         if (it->callback) it->callback(std::move(response));
                     } catch (const std::exception& ex) {
                         LOGIT_ERROR(ex);
+                        if (!recorded) record_http_response(*it, false);
                         try {
                             auto response = std::make_unique<kurlyk::HttpResponse>();
                             response->ready = true;
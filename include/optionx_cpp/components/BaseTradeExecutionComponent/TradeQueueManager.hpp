@@ -50,8 +50,13 @@ namespace optionx::components {
             subscribe<events::OpenTradesSnapshotEvent>();
         }
 
-        /// \brief Virtual destructor.
-        virtual ~TradeQueueManager() = default;
+        /// \brief Virtual destructor; removes this queue's share from the depth metrics.
+        virtual ~TradeQueueManager() {
+            auto& metrics = Metrics::instance();
+            std::lock_guard<std::mutex> lock(m_pending_mutex);
+            metrics.pending.add(-static_cast<std::int64_t>(m_pending_transactions.size()));
+            metrics.open.add(-m_local_open_trades);
+        }
 
         /// \brief Handles an event notification received as a raw pointer.
         /// \param event The received event.
@@ -173,6 +178,29 @@ namespace optionx::components {
         int64_t                  m_last_trade_activity_ms = 0; ///< Last local trade open/finalize timestamp.
         static constexpr int64_t kTradeStormIdleMs = time_shield::MS_PER_15_SEC; ///< Quiet period before trusting a fresh balance.
 
+        /// \brief Process-wide trade queue metrics, summed over all queues.
+        struct Metrics {
+            utils::metrics::Counter&   enqueued;  ///< Trades accepted by add_trade().
+            utils::metrics::Counter&   sent;      ///< Orders emitted as TradeRequestEvent.
+            utils::metrics::Counter&   rejected;  ///< Trades failed before sending (validation or queue timeout).
+            utils::metrics::Gauge&     pending;   ///< Trades waiting in the pending queue.
+            utils::metrics::Gauge&     open;      ///< Locally tracked open trades.
+            utils::metrics::Histogram& wait_ms;   ///< Time from place_date to send_date.
+
+            static Metrics& instance() {
+                auto& registry = utils::metrics::MetricsRegistry::global();
+                static Metrics s_metrics{
+                    registry.counter("optionx_trade_queue_enqueued_total", "Trades accepted by TradeQueueManager::add_trade."),
+                    registry.counter("optionx_trade_queue_sent_total", "Orders sent to the broker component."),
+                    registry.counter("optionx_trade_queue_rejected_total", "Trades finalized with OPEN_ERROR before sending."),
+                    registry.gauge("optionx_trade_queue_pending", "Trades waiting in trade queues."),
+                    registry.gauge("optionx_trade_queue_open", "Open trades tracked by trade queues."),
+                    registry.histogram("optionx_trade_queue_wait_ms", "Time from placing a trade to sending it, in milliseconds.")
+                };
+                return s_metrics;
+            }
+        };
+
         /// \brief Dispatches a trade event notification.
         /// \param transaction The trade transaction event to be dispatched.
         void dispatch_trade_event(const transaction_t& transaction);
@@ -252,8 +280,11 @@ namespace optionx::components {
 
         LOGIT_0TRACE();
         auto trade_event = std::make_shared<events::TradeTransactionEvent>(request, result);
+        auto& metrics = Metrics::instance();
+        metrics.enqueued.inc();
         std::lock_guard<std::mutex> lock(m_pending_mutex);
         m_pending_transactions.push_back(std::move(trade_event));
+        metrics.pending.add(1);
         return true;
     }
 
@@ -276,6 +307,7 @@ namespace optionx::components {
             int64_t open_trades = m_account_info.get_for_trade<int64_t>(AccountInfoType::OPEN_TRADES, request);
             if (open_trades < m_account_info.get_for_trade<int64_t>(AccountInfoType::MAX_TRADES, request)) {
                 m_pending_transactions.erase(it);
+                Metrics::instance().pending.add(-1);
                 return transaction;
             }
         }
@@ -284,6 +316,7 @@ namespace optionx::components {
 
     inline void TradeQueueManager::handle_canceled_transactions(std::list<transaction_t>& calceled_transactions) {
         const int64_t timestamp = OPTIONX_TIMESTAMP_MS;
+        Metrics::instance().rejected.inc(calceled_transactions.size());
         for (const auto &transaction : calceled_transactions) {
             m_trade_state_manager.finalize_transaction_with_error(
                 transaction,
@@ -304,6 +337,7 @@ namespace optionx::components {
             if (delay_ms >= timeout_ms) {
                 calceled_transactions.push_back(std::move(transaction));
                 it = m_pending_transactions.erase(it);
+                Metrics::instance().pending.add(-1);
             } else {
                 ++it;
             }
@@ -356,6 +390,10 @@ namespace optionx::components {
 
                 m_last_order_time = std::chrono::steady_clock::now();
                 m_has_sent_order = true;
+                auto& metrics = Metrics::instance();
+                metrics.sent.inc();
+                metrics.wait_ms.record(static_cast<std::uint64_t>(
+                    std::max<int64_t>(0, result->send_date - result->place_date)));
                 increment_open_trades(request, result);
                 dispatch_trade_event(transaction);
 
@@ -365,6 +403,7 @@ namespace optionx::components {
                 m_open_transactions.push_back(std::move(transaction));
             } else {
                 LOGIT_0TRACE();
+                Metrics::instance().rejected.inc();
                 m_trade_state_manager.finalize_transaction_with_error(transaction, result->error_code, TradeState::OPEN_ERROR, timestamp);
                 dispatch_trade_event(transaction);
             }
@@ -466,6 +505,7 @@ namespace optionx::components {
         std::unique_lock<std::mutex> lock(m_pending_mutex);
         if (!m_pending_transactions.empty()) {
             pending_transactions.swap(m_pending_transactions);
+            Metrics::instance().pending.add(-static_cast<std::int64_t>(pending_transactions.size()));
         }
         lock.unlock();
 
@@ -497,6 +537,7 @@ namespace optionx::components {
         const std::shared_ptr<TradeRequest>& request,
         const std::shared_ptr<TradeResult>& result) {
         m_local_open_trades++;
+        Metrics::instance().open.add(1);
         m_last_trade_activity_ms = OPTIONX_TIMESTAMP_MS;
         emit_open_trades(request, result);
     }
@@ -507,6 +548,7 @@ namespace optionx::components {
         if (m_local_open_trades > 0) {
             add_realized_profit_to_storm(result);
             m_local_open_trades--;
+            Metrics::instance().open.add(-1);
             m_last_trade_activity_ms = OPTIONX_TIMESTAMP_MS;
             emit_open_trades(request, result);
         }
@@ -9,6 +9,17 @@ namespace optionx::components {
 
     /// \class TradingConditionHub
     /// \brief Routes trading-condition deltas and keeps merged condition snapshots.
+    /// \details Cached snapshots are indexed by condition scope and carry a
+    ///          version that grows whenever a publish changes a field.
+    ///          Plain subscribers receive every update as published. Scoped
+    ///          subscribers register for concrete scopes, receive the current
+    ///          snapshot of each scope on subscribe and afterwards only deltas
+    ///          with the fields that actually changed.
+    ///
+    ///          No hub lock is held while callbacks run. Scoped deliveries are
+    ///          numbered per scope and pass through a per-subscriber cursor,
+    ///          so a subscriber sees the snapshot and the deltas of a scope in
+    ///          publish order even when several threads publish at once.
     class TradingConditionHub {
     public:
         /// \brief Constructs a trading-condition hub.
@@ -46,9 +57,9 @@ namespace optionx::components {
             std::vector<TradingConditionUpdate> replay_updates;
             {
                 std::lock_guard<std::mutex> lock(m_mutex);
-                prune_expired_no_lock();
+                prune_expired_no_lock(m_subscribers);
                 bool inserted = false;
-                if (!contains_subscriber_no_lock(locked.get())) {
+                if (!contains_subscriber_no_lock(m_subscribers, locked.get())) {
                     m_subscribers.push_back(std::move(subscriber));
                     inserted = true;
                 }
@@ -62,28 +73,93 @@ namespace optionx::components {
             }
         }
 
+        /// \brief Adds a shared subscriber for specific condition scopes.
+        /// \details The subscriber immediately receives the cached snapshot of
+        ///          every requested scope and then only deltas for those scopes.
+        ///          The hub stores only a weak reference.
+        /// \param subscriber Subscriber object; ignored when null.
+        /// \param scopes Identity fields of the requested condition scopes.
+        void add_scoped_subscriber(
+                std::shared_ptr<ITradingConditionSubscriber> subscriber,
+                const std::vector<TradingConditionUpdate>& scopes) {
+            if (!subscriber) return;
+            add_weak_scoped_subscriber(
+                std::weak_ptr<ITradingConditionSubscriber>(subscriber),
+                scopes);
+        }
+
+        /// \brief Adds a weak subscriber for specific condition scopes.
+        /// \param subscriber Weak subscriber reference; ignored when expired.
+        /// \param scopes Identity fields of the requested condition scopes.
+        void add_weak_scoped_subscriber(
+                std::weak_ptr<ITradingConditionSubscriber> subscriber,
+                const std::vector<TradingConditionUpdate>& scopes) {
+            const auto locked = subscriber.lock();
+            if (!locked) return;
+
+            struct PendingSnapshot {
+                std::shared_ptr<cursor_t> cursor;
+                std::uint64_t sequence = 0;
+                std::shared_ptr<const TradingConditionUpdate> snapshot;
+            };
+            std::vector<PendingSnapshot> snapshots;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (const auto& scope : scopes) {
+                    const ScopeKey key(scope);
+                    auto& entry = m_scoped_subscribers[key];
+                    prune_expired_no_lock(entry.subscribers);
+                    if (contains_subscriber_no_lock(entry.subscribers, locked.get())) continue;
+
+                    // The snapshot takes the current scope sequence, so the
+                    // next delta (sequence + 1) is delivered after it.
+                    const auto it = m_scope_index.find(key);
+                    if (it == m_scope_index.end()) {
+                        entry.subscribers.push_back(ScopedSubscriber{
+                            subscriber,
+                            std::make_shared<cursor_t>(entry.sequence + 1)});
+                        continue;
+                    }
+                    auto cursor = std::make_shared<cursor_t>(entry.sequence);
+                    entry.subscribers.push_back(ScopedSubscriber{subscriber, cursor});
+                    snapshots.push_back(PendingSnapshot{
+                        std::move(cursor),
+                        entry.sequence,
+                        std::make_shared<const TradingConditionUpdate>(
+                            m_cached_updates[it->second])});
+                }
+            }
+
+            for (auto& item : snapshots) {
+                item.cursor->offer(
+                    item.sequence,
+                    std::move(item.snapshot),
+                    [&locked](const TradingConditionUpdate& update) {
+                        locked->on_trading_condition(update);
+                    });
+            }
+        }
+
         /// \brief Removes a subscriber by object address.
+        /// \details Removes both the plain and all scoped registrations.
         /// \param subscriber Subscriber object address.
         void remove_subscriber(const ITradingConditionSubscriber* subscriber) {
             std::lock_guard<std::mutex> lock(m_mutex);
-            m_subscribers.erase(
-                std::remove_if(
-                    m_subscribers.begin(),
-                    m_subscribers.end(),
-                    [subscriber](const std::weak_ptr<ITradingConditionSubscriber>& item) {
-                        const auto locked = item.lock();
-                        return !locked || locked.get() == subscriber;
-                    }),
-                m_subscribers.end());
+            remove_subscriber_no_lock(m_subscribers, subscriber);
+            for (auto it = m_scoped_subscribers.begin(); it != m_scoped_subscribers.end();) {
+                remove_subscriber_no_lock(it->second.subscribers, subscriber);
+                it = it->second.subscribers.empty() ? m_scoped_subscribers.erase(it) : std::next(it);
+            }
         }
 
         /// \brief Removes all subscribers.
         void clear_subscribers() {
             std::lock_guard<std::mutex> lock(m_mutex);
             m_subscribers.clear();
+            m_scoped_subscribers.clear();
         }
 
-        /// \brief Returns the number of live subscribers.
+        /// \brief Returns the number of live plain subscribers.
         /// \return Count of non-expired subscribers.
         std::size_t subscriber_count() const {
             std::lock_guard<std::mutex> lock(m_mutex);
@@ -96,6 +172,21 @@ namespace optionx::components {
             return count;
         }
 
+        /// \brief Returns the number of live subscribers for a scope.
+        /// \param scope Identity fields describing the condition scope.
+        /// \return Count of non-expired scoped subscribers.
+        std::size_t scoped_subscriber_count(const TradingConditionUpdate& scope) const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const auto it = m_scoped_subscribers.find(ScopeKey(scope));
+            if (it == m_scoped_subscribers.end()) return 0;
+            return static_cast<std::size_t>(std::count_if(
+                it->second.subscribers.begin(),
+                it->second.subscribers.end(),
+                [](const ScopedSubscriber& item) {
+                    return !item.subscriber.expired();
+                }));
+        }
+
         /// \brief Binds the hub to a trading-condition callback.
         /// \param callback Callback to replace with this hub dispatcher.
         void bind_to(trading_condition_callback_t& callback) {
@@ -120,20 +211,28 @@ namespace optionx::components {
         }
 
         /// \brief Publishes a trading-condition update.
-        /// \details Live subscribers receive the update as-is. The internal
-        ///          cache merges optional fields by condition scope and can be
-        ///          queried as the current condition snapshot.
+        /// \details Live plain subscribers receive the update as-is. The
+        ///          internal cache merges optional fields by condition scope and
+        ///          can be queried as the current condition snapshot. Scoped
+        ///          subscribers of the update scope receive only the changed
+        ///          fields, and nothing when the update changes no field.
         /// \param update Trading-condition update payload.
         void publish(TradingConditionUpdate update) {
             std::vector<std::shared_ptr<ITradingConditionSubscriber>> subscribers;
+            std::vector<LiveScopedSubscriber> scoped_subscribers;
+            std::shared_ptr<const TradingConditionUpdate> delta;
+            std::uint64_t sequence = 0;
             {
                 std::lock_guard<std::mutex> lock(m_mutex);
-                upsert_cached_update_no_lock(update);
-                prune_expired_no_lock();
-                subscribers.reserve(m_subscribers.size());
-                for (const auto& subscriber : m_subscribers) {
-                    if (auto locked = subscriber.lock()) {
-                        subscribers.push_back(std::move(locked));
+                const ScopeKey key(update);
+                auto changed = upsert_cached_update_no_lock(key, update);
+                lock_live_no_lock(m_subscribers, subscribers);
+                if (!changed.empty()) {
+                    const auto it = m_scoped_subscribers.find(key);
+                    if (it != m_scoped_subscribers.end()) {
+                        sequence = ++it->second.sequence;
+                        lock_live_scoped_no_lock(it->second.subscribers, scoped_subscribers);
+                        delta = std::make_shared<const TradingConditionUpdate>(std::move(changed));
                     }
                 }
             }
@@ -141,6 +240,15 @@ namespace optionx::components {
             for (const auto& subscriber : subscribers) {
                 subscriber->on_trading_condition(update);
             }
+            for (const auto& item : scoped_subscribers) {
+                const auto& subscriber = item.subscriber;
+                item.cursor->offer(
+                    sequence,
+                    delta,
+                    [&subscriber](const TradingConditionUpdate& value) {
+                        subscriber->on_trading_condition(value);
+                    });
+            }
         }
 
         /// \brief Returns cached current condition snapshots.
@@ -156,68 +264,208 @@ namespace optionx::components {
         std::optional<TradingConditionUpdate> current_condition(
                 const TradingConditionUpdate& scope) const {
             std::lock_guard<std::mutex> lock(m_mutex);
-            const auto it = std::find_if(
-                m_cached_updates.begin(),
-                m_cached_updates.end(),
-                [&scope](const TradingConditionUpdate& cached) {
-                    return cached.same_scope(scope);
-                });
-            if (it == m_cached_updates.end()) {
+            const auto it = m_scope_index.find(ScopeKey(scope));
+            if (it == m_scope_index.end()) {
                 return std::nullopt;
             }
-            return *it;
+            return m_cached_updates[it->second];
+        }
+
+        /// \brief Returns the version of the cached condition for a scope.
+        /// \details Versions are taken from a hub-wide counter and grow every
+        ///          time a publish changes a field of the scope.
+        /// \param scope Identity fields describing the requested condition scope.
+        /// \return Scope version, or 0 when the scope is not cached.
+        std::uint64_t scope_version(const TradingConditionUpdate& scope) const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const auto it = m_scope_index.find(ScopeKey(scope));
+            return it == m_scope_index.end() ? 0 : m_cached_versions[it->second];
         }
 
         /// \brief Clears cached updates.
         void clear_cached_updates() {
             std::lock_guard<std::mutex> lock(m_mutex);
             m_cached_updates.clear();
+            m_cached_versions.clear();
+            m_scope_index.clear();
         }
 
     private:
+        using subscriber_list_t = std::vector<std::weak_ptr<ITradingConditionSubscriber>>;
+        using cursor_t = detail::ScopedDeliveryCursor<TradingConditionUpdate>;
+
+        /// \brief Scoped registration with its delivery cursor.
+        struct ScopedSubscriber {
+            std::weak_ptr<ITradingConditionSubscriber> subscriber;
+            std::shared_ptr<cursor_t> cursor;
+        };
+
+        struct LiveScopedSubscriber {
+            std::shared_ptr<ITradingConditionSubscriber> subscriber;
+            std::shared_ptr<cursor_t> cursor;
+        };
+
+        /// \brief Scoped subscribers of one scope and the sequence of its last delta.
+        struct ScopeSubscribers {
+            std::vector<ScopedSubscriber> subscribers;
+            std::uint64_t sequence = 0;
+        };
+
+        /// \brief Identity fields of a condition scope, as compared by `same_scope()`.
+        struct ScopeKey {
+            std::string symbol;
+            PlatformType platform_type = PlatformType::UNKNOWN;
+            AccountType account_type = AccountType::UNKNOWN;
+            CurrencyType currency = CurrencyType::UNKNOWN;
+            OptionType option_type = OptionType::UNKNOWN;
+
+            explicit ScopeKey(const TradingConditionUpdate& update)
+                : symbol(update.symbol),
+                  platform_type(update.platform_type),
+                  account_type(update.account_type),
+                  currency(update.currency),
+                  option_type(update.option_type) {}
+
+            bool operator==(const ScopeKey& other) const {
+                return symbol == other.symbol &&
+                       platform_type == other.platform_type &&
+                       account_type == other.account_type &&
+                       currency == other.currency &&
+                       option_type == other.option_type;
+            }
+        };
+
+        struct ScopeKeyHash {
+            std::size_t operator()(const ScopeKey& key) const noexcept {
+                std::size_t seed = std::hash<std::string>{}(key.symbol);
+                const auto mix = [&seed](std::size_t value) {
+                    seed ^= value + 0x9e3779b9u + (seed << 6) + (seed >> 2);
+                };
+                mix(static_cast<std::size_t>(key.platform_type));
+                mix(static_cast<std::size_t>(key.account_type));
+                mix(static_cast<std::size_t>(key.currency));
+                mix(static_cast<std::size_t>(key.option_type));
+                return seed;
+            }
+        };
+
         mutable std::mutex m_mutex;
-        std::vector<std::weak_ptr<ITradingConditionSubscriber>> m_subscribers;
-        std::vector<TradingConditionUpdate> m_cached_updates;
+        subscriber_list_t m_subscribers;
+        std::unordered_map<ScopeKey, ScopeSubscribers, ScopeKeyHash> m_scoped_subscribers;
+        std::vector<TradingConditionUpdate> m_cached_updates; ///< Snapshots in first-seen order.
+        std::vector<std::uint64_t> m_cached_versions; ///< Versions parallel to m_cached_updates.
+        std::unordered_map<ScopeKey, std::size_t, ScopeKeyHash> m_scope_index; ///< Scope to cache slot.
+        std::uint64_t m_version_counter = 0;
         trading_condition_callback_t* m_bound_callback = nullptr;
         bool m_replay_cached_updates_to_new_subscribers = true;
 
         /// \brief Inserts or merges a cached update by condition scope.
-        void upsert_cached_update_no_lock(const TradingConditionUpdate& update) {
-            const auto it = std::find_if(
-                m_cached_updates.begin(),
-                m_cached_updates.end(),
-                [&update](const TradingConditionUpdate& cached) {
-                    return cached.same_scope(update);
-                });
-
-            if (it == m_cached_updates.end()) {
+        /// \return Fields that changed; a new scope returns the update itself.
+        TradingConditionUpdate upsert_cached_update_no_lock(
+                const ScopeKey& key,
+                const TradingConditionUpdate& update) {
+            const auto it = m_scope_index.find(key);
+            if (it == m_scope_index.end()) {
+                m_scope_index.emplace(key, m_cached_updates.size());
                 m_cached_updates.push_back(update);
-                return;
+                m_cached_versions.push_back(++m_version_counter);
+                return update;
+            }
+
+            auto& cached = m_cached_updates[it->second];
+            auto delta = cached.diff_patch(update);
+            cached.merge_patch(update);
+            if (!delta.empty()) {
+                m_cached_versions[it->second] = ++m_version_counter;
+            }
+            return delta;
+        }
+
+        /// \brief Collects live subscribers and drops expired ones if any were found.
+        static void lock_live_no_lock(
+                subscriber_list_t& list,
+                std::vector<std::shared_ptr<ITradingConditionSubscriber>>& out) {
+            out.reserve(out.size() + list.size());
+            bool has_expired = false;
+            for (const auto& subscriber : list) {
+                if (auto locked = subscriber.lock()) {
+                    out.push_back(std::move(locked));
+                } else {
+                    has_expired = true;
+                }
+            }
+            if (has_expired) {
+                prune_expired_no_lock(list);
+            }
+        }
+
+        /// \brief Collects live scoped subscribers and drops expired ones if any were found.
+        static void lock_live_scoped_no_lock(
+                std::vector<ScopedSubscriber>& list,
+                std::vector<LiveScopedSubscriber>& out) {
+            out.reserve(out.size() + list.size());
+            bool has_expired = false;
+            for (const auto& item : list) {
+                if (auto locked = item.subscriber.lock()) {
+                    out.push_back(LiveScopedSubscriber{std::move(locked), item.cursor});
+                } else {
+                    has_expired = true;
+                }
+            }
+            if (has_expired) {
+                prune_expired_no_lock(list);
             }
+        }
+
+        static const std::weak_ptr<ITradingConditionSubscriber>& weak_of(
+                const std::weak_ptr<ITradingConditionSubscriber>& item) noexcept {
+            return item;
+        }
 
-            it->merge_patch(update);
+        static const std::weak_ptr<ITradingConditionSubscriber>& weak_of(
+                const ScopedSubscriber& item) noexcept {
+            return item.subscriber;
         }
 
         /// \brief Removes expired weak subscribers.
-        void prune_expired_no_lock() {
-            m_subscribers.erase(
+        template <class List>
+        static void prune_expired_no_lock(List& list) {
+            list.erase(
+                std::remove_if(
+                    list.begin(),
+                    list.end(),
+                    [](const typename List::value_type& item) {
+                        return weak_of(item).expired();
+                    }),
+                list.end());
+        }
+
+        /// \brief Removes a subscriber and expired entries from a list.
+        template <class List>
+        static void remove_subscriber_no_lock(
+                List& list,
+                const ITradingConditionSubscriber* subscriber) {
+            list.erase(
                 std::remove_if(
-                    m_subscribers.begin(),
-                    m_subscribers.end(),
-                    [](const std::weak_ptr<ITradingConditionSubscriber>& item) {
-                        return item.expired();
+                    list.begin(),
+                    list.end(),
+                    [subscriber](const typename List::value_type& item) {
+                        const auto locked = weak_of(item).lock();
+                        return !locked || locked.get() == subscriber;
                     }),
-                m_subscribers.end());
+                list.end());
         }
 
         /// \brief Checks whether a subscriber is already registered.
-        bool contains_subscriber_no_lock(
-                const ITradingConditionSubscriber* subscriber) const {
+        template <class List>
+        static bool contains_subscriber_no_lock(
+                const List& list,
+                const ITradingConditionSubscriber* subscriber) {
             return std::any_of(
-                m_subscribers.begin(),
-                m_subscribers.end(),
-                [subscriber](const std::weak_ptr<ITradingConditionSubscriber>& item) {
-                    const auto locked = item.lock();
+                list.begin(),
+                list.end(),
+                [subscriber](const typename List::value_type& item) {
+                    const auto locked = weak_of(item).lock();
                     return locked && locked.get() == subscriber;
                 });
         }
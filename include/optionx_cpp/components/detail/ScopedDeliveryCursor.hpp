@@ -0,0 +1,79 @@
+#pragma once
+#ifndef OPTIONX_HEADER_COMPONENTS_DETAIL_SCOPED_DELIVERY_CURSOR_HPP_INCLUDED
+#define OPTIONX_HEADER_COMPONENTS_DETAIL_SCOPED_DELIVERY_CURSOR_HPP_INCLUDED
+
+/// \file ScopedDeliveryCursor.hpp
+/// \brief Defines the per-subscriber ordering used by scoped hub subscriptions.
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace optionx::components::detail {
+
+    /// \class ScopedDeliveryCursor
+    /// \brief Delivers the updates of one scope to one subscriber in sequence order.
+    /// \details Hubs number the changes of a scope under their own mutex and
+    ///          offer them here after releasing it. An update that arrives
+    ///          ahead of its turn is parked and delivered by the thread that
+    ///          fills the gap, so neither concurrent publishers nor the
+    ///          snapshot sent on subscribe can overtake each other. No lock is
+    ///          held while the callback runs; an update published from inside
+    ///          the callback is delivered right after it returns.
+    /// \tparam Payload Update type passed to the callback.
+    template <class Payload>
+    class ScopedDeliveryCursor {
+    public:
+        using payload_ptr_t = std::shared_ptr<const Payload>;
+
+        /// \brief Constructs a cursor waiting for a given sequence number.
+        /// \param next_sequence First sequence number to deliver; smaller ones are dropped.
+        explicit ScopedDeliveryCursor(std::uint64_t next_sequence)
+            : m_next_sequence(next_sequence) {}
+
+        ScopedDeliveryCursor(const ScopedDeliveryCursor&) = delete;
+        ScopedDeliveryCursor& operator=(const ScopedDeliveryCursor&) = delete;
+
+        /// \brief Offers an update and delivers every update that is now in turn.
+        /// \param sequence Scope sequence number of the update.
+        /// \param payload Update payload; shared between subscribers of the scope.
+        /// \param deliver Callback invoked as `deliver(const Payload&)`.
+        template <class Deliver>
+        void offer(std::uint64_t sequence, payload_ptr_t payload, Deliver&& deliver) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (sequence < m_next_sequence || !payload) return;
+            m_pending.emplace(sequence, std::move(payload));
+            if (m_draining) return;
+
+            m_draining = true;
+            for (;;) {
+                const auto it = m_pending.begin();
+                if (it == m_pending.end() || it->first != m_next_sequence) break;
+                const auto item = std::move(it->second);
+                m_pending.erase(it);
+                ++m_next_sequence;
+
+                lock.unlock();
+                try {
+                    deliver(*item);
+                } catch (...) {
+                    lock.lock();
+                    m_draining = false;
+                    throw;
+                }
+                lock.lock();
+            }
+            m_draining = false;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::map<std::uint64_t, payload_ptr_t> m_pending; ///< Updates that arrived ahead of their turn.
+        std::uint64_t m_next_sequence = 0;
+        bool m_draining = false;
+    };
+
+} // namespace optionx::components::detail
+
+#endif // OPTIONX_HEADER_COMPONENTS_DETAIL_SCOPED_DELIVERY_CURSOR_HPP_INCLUDED
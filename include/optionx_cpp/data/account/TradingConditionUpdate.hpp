@@ -69,6 +69,37 @@ namespace optionx {
             if (!patch.message.empty()) message = patch.message;
         }
 
+        /// \brief Returns the part of a patch that would change this snapshot.
+        /// \details The result carries this snapshot's scope, the patch timestamp
+        ///          and only those optional fields whose value differs, so
+        ///          `diff_patch(patch).empty()` means `merge_patch(patch)` would
+        ///          not change any condition field.
+        /// \param patch Incremental update for the same condition scope.
+        /// \return Delta update with changed fields only.
+        TradingConditionUpdate diff_patch(const TradingConditionUpdate& patch) const {
+            TradingConditionUpdate delta;
+            delta.symbol = symbol;
+            delta.platform_type = platform_type;
+            delta.account_type = account_type;
+            delta.currency = currency;
+            delta.option_type = option_type;
+            delta.timestamp = patch.timestamp != 0 ? patch.timestamp : timestamp;
+            if (patch.market_open && patch.market_open != market_open) delta.market_open = patch.market_open;
+            if (patch.tradable && patch.tradable != tradable) delta.tradable = patch.tradable;
+            if (patch.payout && patch.payout != payout) delta.payout = patch.payout;
+            if (patch.min_amount && patch.min_amount != min_amount) delta.min_amount = patch.min_amount;
+            if (patch.max_amount && patch.max_amount != max_amount) delta.max_amount = patch.max_amount;
+            if (patch.min_refund && patch.min_refund != min_refund) delta.min_refund = patch.min_refund;
+            if (patch.max_refund && patch.max_refund != max_refund) delta.max_refund = patch.max_refund;
+            if (patch.min_duration && patch.min_duration != min_duration) delta.min_duration = patch.min_duration;
+            if (patch.max_duration && patch.max_duration != max_duration) delta.max_duration = patch.max_duration;
+            if (patch.max_open_trades && patch.max_open_trades != max_open_trades) delta.max_open_trades = patch.max_open_trades;
+            if (patch.session_start && patch.session_start != session_start) delta.session_start = patch.session_start;
+            if (patch.session_end && patch.session_end != session_end) delta.session_end = patch.session_end;
+            if (!patch.message.empty() && patch.message != message) delta.message = patch.message;
+            return delta;
+        }
+
         /// \brief Returns true when no condition field is populated.
         /// \return True if the update contains only identity/context fields.
         bool empty() const noexcept {
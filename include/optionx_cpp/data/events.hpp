@@ -28,5 +28,7 @@
 #include "events/OpenTradesEvent.hpp"
 #include "events/OpenTradesSnapshotEvent.hpp"
 #include "events/OpenTradesSnapshotRefreshRequestEvent.hpp"
+#include "events/BalanceUpdateEvent.hpp"
+#include "events/BrokerTradeUpdateEvent.hpp"
 
 #endif // OPTIONX_HEADER_DATA_EVENTS_HPP_INCLUDED
@@ -0,0 +1,41 @@
+#pragma once
+#ifndef OPTIONX_HEADER_DATA_EVENTS_BALANCE_UPDATE_EVENT_HPP_INCLUDED
+#define OPTIONX_HEADER_DATA_EVENTS_BALANCE_UPDATE_EVENT_HPP_INCLUDED
+
+/// \file BalanceUpdateEvent.hpp
+/// \brief Defines the event used to publish broker-pushed balance snapshots.
+
+namespace optionx::events {
+
+    /// \class BalanceUpdateEvent
+    /// \brief Carries a balance pushed by the broker stream.
+    /// \details Stream components publish it with `notify_async`, so the
+    ///          balance owner applies it on the platform loop thread.
+    class BalanceUpdateEvent : public utils::Event {
+    public:
+        double       balance      = 0.0;                   ///< Reported balance.
+        CurrencyType currency     = CurrencyType::UNKNOWN; ///< Reported currency, if any.
+        AccountType  account_type = AccountType::UNKNOWN;  ///< Account the balance belongs to.
+
+        /// \brief Constructor initializing the balance snapshot.
+        /// \param balance Reported balance.
+        /// \param currency Reported currency, or `CurrencyType::UNKNOWN`.
+        /// \param account_type Account the balance belongs to.
+        BalanceUpdateEvent(double balance, CurrencyType currency, AccountType account_type)
+            : balance(balance), currency(currency), account_type(account_type) {}
+
+        /// \brief Default virtual destructor.
+        virtual ~BalanceUpdateEvent() = default;
+
+        std::type_index type() const override {
+            return typeid(BalanceUpdateEvent);
+        }
+
+        const char* name() const override {
+            return "BalanceUpdateEvent";
+        }
+    };
+
+} // namespace optionx::events
+
+#endif // OPTIONX_HEADER_DATA_EVENTS_BALANCE_UPDATE_EVENT_HPP_INCLUDED
@@ -0,0 +1,37 @@
+#pragma once
+#ifndef OPTIONX_HEADER_DATA_EVENTS_BROKER_TRADE_UPDATE_EVENT_HPP_INCLUDED
+#define OPTIONX_HEADER_DATA_EVENTS_BROKER_TRADE_UPDATE_EVENT_HPP_INCLUDED
+
+/// \file BrokerTradeUpdateEvent.hpp
+/// \brief Defines the event used to publish broker-pushed trade snapshots.
+
+namespace optionx::events {
+
+    /// \class BrokerTradeUpdateEvent
+    /// \brief Carries a trade snapshot pushed by the broker stream.
+    /// \details The snapshot is not bound to a local TradeRequest yet;
+    ///          subscribers match it by `option_id` or `option_hash`.
+    class BrokerTradeUpdateEvent : public utils::Event {
+    public:
+        std::shared_ptr<TradeResult> result; ///< Broker-side trade snapshot.
+
+        /// \brief Constructor initializing the broker trade snapshot.
+        /// \param trade_result Shared pointer to the broker trade snapshot.
+        explicit BrokerTradeUpdateEvent(std::shared_ptr<TradeResult> trade_result)
+            : result(std::move(trade_result)) {}
+
+        /// \brief Default virtual destructor.
+        virtual ~BrokerTradeUpdateEvent() = default;
+
+        std::type_index type() const override {
+            return typeid(BrokerTradeUpdateEvent);
+        }
+
+        const char* name() const override {
+            return "BrokerTradeUpdateEvent";
+        }
+    };
+
+} // namespace optionx::events
+
+#endif // OPTIONX_HEADER_DATA_EVENTS_BROKER_TRADE_UPDATE_EVENT_HPP_INCLUDED
@@ -6,6 +6,7 @@
 /// \brief 
 
 #include "symbol/SymbolInfo.hpp"
+#include "symbol/SymbolRegistry.hpp"
 #include "symbol/SymbolsInfo.hpp"
 
 #endif // OPTIONX_HEADER_DATA_SYMBOL_HPP_INCLUDED
\ No newline at end of file
@@ -0,0 +1,238 @@
+#pragma once
+#ifndef OPTIONX_HEADER_DATA_SYMBOL_SYMBOL_REGISTRY_HPP_INCLUDED
+#define OPTIONX_HEADER_DATA_SYMBOL_SYMBOL_REGISTRY_HPP_INCLUDED
+
+/// \file SymbolRegistry.hpp
+/// \brief Contains the immutable hashed SymbolRegistry used by SymbolsInfo.
+
+#include "SymbolInfo.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace optionx {
+
+    /// \class SymbolRegistry
+    /// \brief Immutable symbol table with hashed lookup by name, alias and interned id.
+    /// \details By default names and aliases match exactly. With
+    ///          MatchMode::NORMALIZED keys are folded once while the registry
+    ///          is built (ASCII upper case, other ASCII characters than letters
+    ///          and digits dropped), so `eur/usd`, `EUR_USD` and `EURUSD`
+    ///          resolve to the same entry. Folding never depends on the C locale.
+    ///          A built registry is never modified; readers share it through
+    ///          a `std::shared_ptr<const SymbolRegistry>` snapshot.
+    class SymbolRegistry {
+    public:
+        using alias_t = std::pair<std::string, std::string>; ///< Alias and the symbol it refers to.
+
+        /// \enum MatchMode
+        /// \brief Defines how lookup keys are compared with listed names.
+        enum class MatchMode {
+            EXACT = 0,  ///< Names must match byte for byte.
+            NORMALIZED  ///< ASCII case and separators are ignored.
+        };
+
+        static constexpr std::uint32_t INVALID_ID = (std::numeric_limits<std::uint32_t>::max)(); ///< Id of unknown symbols.
+        static constexpr std::size_t MAX_INLINE_KEY_SIZE = 32; ///< Longest key normalized without allocation.
+
+        /// \brief Creates an empty registry.
+        SymbolRegistry() = default;
+
+        /// \brief Builds a registry from a symbol list.
+        /// \param symbols Symbols to index; the first of several entries with the same normalized name wins.
+        /// \param aliases Alternative names mapped to symbols from the list; aliases of unknown symbols are ignored.
+        /// \param previous Optional earlier registry whose interned ids are kept for symbols that are still listed.
+        /// \param mode How names are compared; ids are only carried over from a registry with the same mode.
+        explicit SymbolRegistry(
+                const std::vector<SymbolInfo>& symbols,
+                const std::vector<alias_t>& aliases = {},
+                const SymbolRegistry* previous = nullptr,
+                MatchMode mode = MatchMode::EXACT)
+            : m_mode(mode) {
+            if (previous && previous->m_mode != m_mode) previous = nullptr;
+            if (previous) {
+                // Keep ids stable across refreshes; dropped symbols leave holes.
+                m_symbols.resize(previous->m_symbols.size());
+            }
+
+            m_keys.reserve(symbols.size() + aliases.size());
+            for (const auto& info : symbols) {
+                std::string key = make_key(info.symbol);
+                if (key.empty() || find_key(key) != INVALID_ID) continue;
+
+                std::uint32_t id = previous ? previous->find_key(key) : INVALID_ID;
+                if (id != INVALID_ID && make_key(previous->m_symbols[id].symbol) != key) {
+                    id = INVALID_ID; // matched an alias, not the symbol itself
+                }
+                if (id == INVALID_ID || !m_symbols[id].symbol.empty()) {
+                    id = static_cast<std::uint32_t>(m_symbols.size());
+                    m_symbols.emplace_back();
+                }
+                m_symbols[id] = info;
+                ++m_size;
+                insert_key(std::move(key), id);
+            }
+
+            for (const auto& [alias, symbol] : aliases) {
+                std::string key = make_key(alias);
+                if (key.empty() || find_key(key) != INVALID_ID) continue;
+                const auto id = find_key(make_key(symbol));
+                if (id == INVALID_ID) continue;
+                insert_key(std::move(key), id);
+            }
+        }
+
+        /// \brief Folds a symbol name the way MatchMode::NORMALIZED stores keys.
+        /// \param symbol Raw symbol name.
+        /// \return ASCII upper-case name with only ASCII letters and digits kept; other bytes are dropped.
+        static std::string normalize(std::string_view symbol) {
+            std::string out;
+            out.reserve(symbol.size());
+            for (const char ch : symbol) {
+                if (!is_ascii_alnum(ch)) continue;
+                out.push_back(to_ascii_upper(ch));
+            }
+            return out;
+        }
+
+        /// \brief Returns how this registry compares names.
+        MatchMode match_mode() const noexcept {
+            return m_mode;
+        }
+
+        /// \brief Resolves a symbol name or alias to its interned id.
+        /// \param symbol Raw symbol name, compared according to match_mode().
+        /// \return Interned id, or INVALID_ID when the symbol is unknown.
+        std::uint32_t find_id(std::string_view symbol) const {
+            if (m_slots.empty()) return INVALID_ID;
+            if (m_mode == MatchMode::EXACT) return find_key(symbol);
+
+            char buffer[MAX_INLINE_KEY_SIZE];
+            std::size_t size = 0;
+            for (const char ch : symbol) {
+                if (!is_ascii_alnum(ch)) continue;
+                if (size == MAX_INLINE_KEY_SIZE) return find_key(normalize(symbol));
+                buffer[size++] = to_ascii_upper(ch);
+            }
+            return find_key(std::string_view(buffer, size));
+        }
+
+        /// \brief Finds symbol information by name or alias.
+        /// \param symbol Raw symbol name, compared according to match_mode().
+        /// \return Pointer into this registry, or nullptr when the symbol is unknown.
+        const SymbolInfo* find(std::string_view symbol) const {
+            return at(find_id(symbol));
+        }
+
+        /// \brief Returns symbol information by interned id.
+        /// \param id Id returned by find_id() on this or an earlier registry.
+        /// \return Pointer into this registry, or nullptr for unknown or removed ids.
+        const SymbolInfo* at(std::uint32_t id) const noexcept {
+            if (id >= m_symbols.size() || m_symbols[id].symbol.empty()) return nullptr;
+            return &m_symbols[id];
+        }
+
+        /// \brief Checks whether a symbol name or alias is known.
+        bool contains(std::string_view symbol) const {
+            return find_id(symbol) != INVALID_ID;
+        }
+
+        /// \brief Returns the number of symbols in the registry.
+        std::size_t size() const noexcept {
+            return m_size;
+        }
+
+        /// \brief Checks whether the registry has no symbols.
+        bool empty() const noexcept {
+            return m_size == 0;
+        }
+
+        /// \brief Returns the upper bound of interned ids, including removed ones.
+        std::size_t id_capacity() const noexcept {
+            return m_symbols.size();
+        }
+
+    private:
+        struct Key {
+            std::string name;   ///< Name or alias as stored by make_key().
+            std::uint64_t hash; ///< Cached hash of `name`.
+            std::uint32_t id;   ///< Interned id of the symbol.
+        };
+
+        std::vector<SymbolInfo> m_symbols;  ///< Symbols indexed by interned id; removed ids hold empty names.
+        std::vector<Key> m_keys;            ///< Names and aliases.
+        std::vector<std::uint32_t> m_slots; ///< Open-addressing table of `m_keys` indices plus one; zero is empty.
+        std::size_t m_size = 0;             ///< Number of live symbols.
+        MatchMode m_mode = MatchMode::EXACT; ///< How names are compared.
+
+        static constexpr bool is_ascii_alnum(char ch) noexcept {
+            return (ch >= '0' && ch <= '9') || (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z');
+        }
+
+        static constexpr char to_ascii_upper(char ch) noexcept {
+            return (ch >= 'a' && ch <= 'z') ? static_cast<char>(ch - 'a' + 'A') : ch;
+        }
+
+        std::string make_key(std::string_view symbol) const {
+            return m_mode == MatchMode::EXACT ? std::string(symbol) : normalize(symbol);
+        }
+
+        static std::uint64_t hash_key(std::string_view key) noexcept {
+            std::uint64_t hash = 1469598103934665603ULL;
+            for (const char ch : key) {
+                hash ^= static_cast<unsigned char>(ch);
+                hash *= 1099511628211ULL;
+            }
+            return hash;
+        }
+
+        std::uint32_t find_key(std::string_view key) const noexcept {
+            if (m_slots.empty()) return INVALID_ID;
+            const auto hash = hash_key(key);
+            const std::size_t mask = m_slots.size() - 1;
+            for (std::size_t pos = static_cast<std::size_t>(hash) & mask;; pos = (pos + 1) & mask) {
+                const auto slot = m_slots[pos];
+                if (slot == 0) return INVALID_ID;
+                const auto& entry = m_keys[slot - 1];
+                if (entry.hash == hash && entry.name == key) return entry.id;
+            }
+        }
+
+        void insert_key(std::string key, std::uint32_t id) {
+            const auto hash = hash_key(key);
+            m_keys.push_back(Key{std::move(key), hash, id});
+            if (m_slots.size() < m_keys.size() * 2) {
+                rehash(m_keys.size() * 4);
+                return;
+            }
+            place(m_keys.size() - 1);
+        }
+
+        void rehash(std::size_t min_capacity) {
+            std::size_t capacity = 16;
+            while (capacity < min_capacity) capacity <<= 1;
+            m_slots.assign(capacity, 0);
+            for (std::size_t i = 0; i < m_keys.size(); ++i) {
+                place(i);
+            }
+        }
+
+        void place(std::size_t index) {
+            const std::size_t mask = m_slots.size() - 1;
+            std::size_t pos = static_cast<std::size_t>(m_keys[index].hash) & mask;
+            while (m_slots[pos] != 0) pos = (pos + 1) & mask;
+            m_slots[pos] = static_cast<std::uint32_t>(index + 1);
+        }
+    }; // SymbolRegistry
+
+    /// \brief Shared read-only handle to a SymbolRegistry snapshot.
+    using SymbolRegistrySnapshot = std::shared_ptr<const SymbolRegistry>;
+
+} // namespace optionx
+
+#endif // OPTIONX_HEADER_DATA_SYMBOL_SYMBOL_REGISTRY_HPP_INCLUDED
@@ -6,39 +6,182 @@
 /// \brief Contains the SymbolsInfo struct for managing a collection of trading symbols information.
 
 #include "SymbolInfo.hpp"
+#include "SymbolRegistry.hpp"
+#include <atomic>
+#include <cstddef>
+#include <memory>
 #include <vector>
 #include <string>
 #include <optional>
+#include <utility>
 
 namespace optionx {
 
-    /// \struct SymbolsInfo
+    /// \class SymbolsInfo
     /// \brief Manages a collection of SymbolInfo objects, representing information for multiple trading symbols.
-    struct SymbolsInfo {
-        std::vector<SymbolInfo> symbols; ///< Collection of SymbolInfo objects.
+    /// \details Lookups go through an immutable SymbolRegistry that is rebuilt
+    ///          and swapped atomically whenever the list changes. Readers can
+    ///          keep a snapshot() and query it without further synchronization
+    ///          while the broker's symbol list is refreshed. Updates are
+    ///          expected from a single writer at a time; bulk loads should be
+    ///          wrapped in begin_update() / end_update() so the registry is
+    ///          rebuilt once instead of after every added symbol.
+    ///          Names match exactly unless normalized matching is enabled
+    ///          with set_match_mode().
+    class SymbolsInfo {
+    public:
+        using alias_t = SymbolRegistry::alias_t;
+        using MatchMode = SymbolRegistry::MatchMode;
+
+        SymbolsInfo() = default;
+
+        /// \brief Creates an empty collection with the given matching rule.
+        /// \param mode How find_symbol() compares names.
+        explicit SymbolsInfo(MatchMode mode)
+            : m_mode(mode) {}
+
+        SymbolsInfo(const SymbolsInfo& other)
+            : m_symbols(other.m_symbols),
+              m_aliases(other.m_aliases),
+              m_registry(other.snapshot()),
+              m_mode(other.m_mode) {}
+
+        SymbolsInfo(SymbolsInfo&& other) noexcept
+            : m_symbols(std::move(other.m_symbols)),
+              m_aliases(std::move(other.m_aliases)),
+              m_registry(std::atomic_exchange(&other.m_registry, SymbolRegistrySnapshot())),
+              m_mode(other.m_mode),
+              m_update_depth(std::exchange(other.m_update_depth, 0)) {}
+
+        SymbolsInfo& operator=(const SymbolsInfo& other) {
+            if (this != &other) {
+                m_symbols = other.m_symbols;
+                m_aliases = other.m_aliases;
+                m_mode = other.m_mode;
+                std::atomic_store(&m_registry, other.snapshot());
+            }
+            return *this;
+        }
+
+        SymbolsInfo& operator=(SymbolsInfo&& other) noexcept {
+            if (this != &other) {
+                m_symbols = std::move(other.m_symbols);
+                m_aliases = std::move(other.m_aliases);
+                m_mode = other.m_mode;
+                m_update_depth = std::exchange(other.m_update_depth, 0);
+                std::atomic_store(&m_registry, std::atomic_exchange(&other.m_registry, SymbolRegistrySnapshot()));
+            }
+            return *this;
+        }
+
+        /// \brief Returns the symbol list in insertion order.
+        const std::vector<SymbolInfo>& symbols() const noexcept {
+            return m_symbols;
+        }
+
+        /// \brief Returns the alternative names mapped to symbols.
+        const std::vector<alias_t>& aliases() const noexcept {
+            return m_aliases;
+        }
+
+        /// \brief Returns how find_symbol() compares names.
+        MatchMode match_mode() const noexcept {
+            return m_mode;
+        }
+
+        /// \brief Changes how find_symbol() compares names and rebuilds the registry.
+        /// \param mode MatchMode::NORMALIZED ignores ASCII case and separators;
+        ///             MatchMode::EXACT (the default) compares names byte for byte.
+        /// \note Interned ids are reassigned when the mode changes.
+        void set_match_mode(MatchMode mode) {
+            if (m_mode == mode) return;
+            m_mode = mode;
+            publish_if_idle();
+        }
 
         /// \brief Adds a new symbol to the collection.
         /// \param symbol The name of the trading symbol.
         /// \param digits Number of decimal places for the symbol's price values.
         void add_symbol(const std::string& symbol, int64_t digits) {
-            symbols.emplace_back(symbol, digits);
+            m_symbols.emplace_back(symbol, digits);
+            publish_if_idle();
+        }
+
+        /// \brief Adds an alternative name for a symbol.
+        /// \param alias Alternative name, e.g. `BTCUSD`.
+        /// \param symbol Name of a symbol from the collection, e.g. `BTCUSDT`.
+        void add_alias(const std::string& alias, const std::string& symbol) {
+            m_aliases.emplace_back(alias, symbol);
+            publish_if_idle();
+        }
+
+        /// \brief Replaces the whole symbol list, e.g. after the broker refreshed it.
+        /// \param list New symbol list; interned ids of symbols that remain are kept.
+        void assign(std::vector<SymbolInfo> list) {
+            m_symbols = std::move(list);
+            publish_if_idle();
+        }
+
+        /// \brief Clears all symbols and aliases; readers see an empty registry.
+        void clear() {
+            m_symbols.clear();
+            m_aliases.clear();
+            publish_if_idle();
+        }
+
+        /// \brief Starts a batch of changes; lookups keep the last published list until end_update().
+        /// \details Calls may be nested; the registry is rebuilt when the outermost batch ends.
+        void begin_update() noexcept {
+            ++m_update_depth;
+        }
+
+        /// \brief Ends a batch started by begin_update() and publishes the result.
+        void end_update() {
+            if (m_update_depth == 0) return;
+            if (--m_update_depth == 0) publish();
+        }
+
+        /// \brief Returns the current registry snapshot.
+        /// \return Shared read-only registry, or nullptr if nothing was published yet.
+        SymbolRegistrySnapshot snapshot() const {
+            return std::atomic_load(&m_registry);
         }
 
         /// \brief Finds information about a symbol by name.
-        /// \param symbol The name of the symbol to find.
+        /// \param symbol The name or alias of the symbol to find.
         /// \return Optional SymbolInfo if the symbol is found; std::nullopt otherwise.
+        /// \note Names match exactly by default. With MatchMode::NORMALIZED,
+        ///       ASCII case and characters other than ASCII letters and digits
+        ///       are ignored, so `eur/usd` finds `EURUSD`; symbols whose names
+        ///       differ only in case or separators then share one entry and
+        ///       the first one listed wins.
         std::optional<SymbolInfo> find_symbol(const std::string& symbol) const {
-            for (const auto& sym_info : symbols) {
-                if (sym_info.symbol == symbol) {
-                    return sym_info;
-                }
+            const auto registry = snapshot();
+            if (!registry) return std::nullopt;
+            if (const auto* info = registry->find(symbol)) {
+                return *info;
             }
             return std::nullopt;
         }
 
-        /// \brief Clears all symbols from the collection.
-        void clear() {
-            symbols.clear();
+    private:
+        std::vector<SymbolInfo> m_symbols;  ///< Collection of SymbolInfo objects.
+        std::vector<alias_t> m_aliases;     ///< Alternative names mapped to symbols.
+        SymbolRegistrySnapshot m_registry;  ///< Current registry; accessed with atomic shared_ptr operations.
+        MatchMode m_mode = MatchMode::EXACT; ///< How names are compared.
+        std::size_t m_update_depth = 0;     ///< Nesting depth of begin_update() calls.
+
+        void publish_if_idle() {
+            if (m_update_depth == 0) publish();
+        }
+
+        /// \brief Rebuilds the registry from the symbol list and swaps it in.
+        void publish() {
+            const auto previous = snapshot();
+            std::atomic_store(
+                &m_registry,
+                SymbolRegistrySnapshot(std::make_shared<const SymbolRegistry>(
+                    m_symbols, m_aliases, previous.get(), m_mode)));
         }
     }; // SymbolsInfo
 
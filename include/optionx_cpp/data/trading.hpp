@@ -12,6 +12,7 @@
 /// intended to be included through this umbrella header.
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -44,6 +45,8 @@
 #include "trading/IMoneyManagementParams.hpp"
 #include "trading/ITradeDecisionParams.hpp"
 #include "trading/TradeSignal.hpp"
+#include "trading/MmSeriesConfig.hpp"
+#include "trading/MmSeriesEngine.hpp"
 #include "trading/SignalRecord.hpp"
 #include "trading/TradeRecord.hpp"
 #include "trading/TradeRecordFilter.hpp"
@@ -0,0 +1,274 @@
+#pragma once
+#ifndef OPTIONX_HEADER_DATA_TRADING_MM_SERIES_CONFIG_HPP_INCLUDED
+#define OPTIONX_HEADER_DATA_TRADING_MM_SERIES_CONFIG_HPP_INCLUDED
+
+/// \file MmSeriesConfig.hpp
+/// \brief Defines stake-series configuration and its compiled step table.
+
+namespace optionx {
+
+    /// \enum MmSeriesScope
+    /// \brief Which trades share one series state.
+    enum class MmSeriesScope : std::uint8_t {
+        SIGNAL,  ///< One series per signal group.
+        SYMBOL,  ///< One series per signal group and symbol.
+        BAR      ///< One series per signal group, symbol and bar.
+    };
+
+    /// \enum MmSeriesEndAction
+    /// \brief What happens when a series advances past its last step.
+    enum class MmSeriesEndAction : std::uint8_t {
+        RESET,   ///< Start over from the first step.
+        HOLD     ///< Stay on the last step until the series is reset by the opposite outcome.
+    };
+
+    /// \brief Returns the series scope implied by a money management type.
+    inline MmSeriesScope mm_series_scope(MmSystemType type) noexcept {
+        switch (type) {
+        case MmSystemType::MARTINGALE_SYMBOL:
+        case MmSystemType::ANTI_MARTINGALE_SYMBOL:
+        case MmSystemType::LABOUCHERE_SYMBOL:
+        case MmSystemType::SKU_SYMBOL:
+            return MmSeriesScope::SYMBOL;
+        case MmSystemType::MARTINGALE_BAR:
+        case MmSystemType::ANTI_MARTINGALE_BAR:
+        case MmSystemType::LABOUCHERE_BAR:
+        case MmSystemType::SKU_BAR:
+            return MmSeriesScope::BAR;
+        default:
+            return MmSeriesScope::SIGNAL;
+        }
+    }
+
+    /// \brief Checks whether a money management type advances its series on wins.
+    inline bool mm_series_advances_on_win(MmSystemType type) noexcept {
+        return type == MmSystemType::ANTI_MARTINGALE_SIGNAL ||
+               type == MmSystemType::ANTI_MARTINGALE_SYMBOL ||
+               type == MmSystemType::ANTI_MARTINGALE_BAR;
+    }
+
+    /// \struct MmSeriesConfig
+    /// \brief Stake series description for FIXED, PERCENT, KELLY_CRITERION and
+    ///        the (anti-)martingale types.
+    ///
+    /// Step `i` stakes `amounts[i]` when `amounts` is set, otherwise
+    /// `base * multiplier^i`, where the base is `amount` for fixed stakes,
+    /// `percent / 100` of the balance for PERCENT and the scaled Kelly
+    /// fraction for KELLY_CRITERION. Martingale types advance on losses,
+    /// anti-martingale types on wins; the opposite outcome returns to step 0,
+    /// while standoffs and refunds repeat the step.
+    struct MmSeriesConfig {
+        MmSystemType type = MmSystemType::FIXED; ///< Series type; LABOUCHERE and SKU are not supported.
+        double amount = 0.0;             ///< Base stake in account currency.
+        double percent = 0.0;            ///< Base stake in percent of the balance (PERCENT).
+        double multiplier = 2.0;         ///< Stake multiplier between steps.
+        std::vector<double> amounts;     ///< Explicit stakes (or balance fractions) per step; overrides the formula.
+        std::uint32_t steps = 1;         ///< Number of steps when `amounts` is empty.
+        MmSeriesEndAction end_action = MmSeriesEndAction::RESET; ///< Behaviour after the last step.
+        double kelly_win_rate = 0.0;     ///< Estimated win probability (KELLY_CRITERION).
+        double kelly_payout = 0.0;       ///< Net payout ratio, e.g. 0.8 for 80% (KELLY_CRITERION).
+        double kelly_scale = 1.0;        ///< Fraction of the full Kelly stake to use.
+        double min_amount = 0.0;         ///< Lower stake limit; 0 disables it.
+        double max_amount = 0.0;         ///< Upper stake limit; 0 disables it.
+    };
+
+    /// \class MmStepTable
+    /// \brief Flat step table compiled from MmSeriesConfig.
+    ///
+    /// Stakes and outcome transitions are precomputed, so picking the stake of
+    /// a step and the step after a result are plain array reads.
+    class MmStepTable {
+    public:
+        static constexpr std::uint32_t MAX_STEPS = 1024; ///< Largest supported series.
+
+        /// \brief Compiles a series configuration.
+        /// \throws std::invalid_argument if the type is unsupported or the values are out of range.
+        static MmStepTable compile(const MmSeriesConfig& config) {
+            MmStepTable table;
+            table.m_type = config.type;
+            table.m_scope = mm_series_scope(config.type);
+            table.m_min_amount = config.min_amount;
+            table.m_max_amount = config.max_amount;
+            if (config.min_amount < 0.0 || config.max_amount < 0.0 ||
+                (config.max_amount > 0.0 && config.min_amount > config.max_amount)) {
+                throw std::invalid_argument("MmSeriesConfig: invalid stake limits.");
+            }
+
+            double base = config.amount;
+            bool series = false;
+            switch (config.type) {
+            case MmSystemType::NONE:
+            case MmSystemType::FIXED:
+                break;
+            case MmSystemType::PERCENT:
+                table.m_relative = true;
+                base = config.percent / 100.0;
+                series = true;
+                break;
+            case MmSystemType::KELLY_CRITERION: {
+                if (config.kelly_payout <= 0.0 || config.kelly_win_rate < 0.0 || config.kelly_win_rate > 1.0) {
+                    throw std::invalid_argument("MmSeriesConfig: Kelly win rate or payout out of range.");
+                }
+                const double p = config.kelly_win_rate;
+                table.m_relative = true;
+                base = (std::max)(0.0, (p - (1.0 - p) / config.kelly_payout) * config.kelly_scale);
+                series = true;
+                break;
+            }
+            case MmSystemType::MARTINGALE_SIGNAL:
+            case MmSystemType::MARTINGALE_SYMBOL:
+            case MmSystemType::MARTINGALE_BAR:
+            case MmSystemType::ANTI_MARTINGALE_SIGNAL:
+            case MmSystemType::ANTI_MARTINGALE_SYMBOL:
+            case MmSystemType::ANTI_MARTINGALE_BAR:
+                series = true;
+                break;
+            default:
+                throw std::invalid_argument("MmSeriesConfig: " + to_str(config.type) + " has no step table form.");
+            }
+
+            if (!config.amounts.empty() && series) {
+                table.m_values = config.amounts;
+            } else {
+                const std::uint32_t steps = series ? (std::max)(config.steps, std::uint32_t{1}) : 1;
+                if (steps > MAX_STEPS) {
+                    throw std::invalid_argument("MmSeriesConfig: too many steps.");
+                }
+                table.m_values.reserve(steps);
+                double value = base;
+                for (std::uint32_t i = 0; i < steps; ++i) {
+                    table.m_values.push_back(value);
+                    value *= config.multiplier;
+                }
+            }
+            if (table.m_values.size() > MAX_STEPS) {
+                throw std::invalid_argument("MmSeriesConfig: too many steps.");
+            }
+            for (auto& value : table.m_values) {
+                if (!std::isfinite(value) || value < 0.0) {
+                    throw std::invalid_argument("MmSeriesConfig: stake must be a finite non-negative number.");
+                }
+                if (!table.m_relative) value = table.clamp(value);
+            }
+
+            const auto size = static_cast<std::uint16_t>(table.m_values.size());
+            const auto last = static_cast<std::uint16_t>(size - 1);
+            const bool advance_on_win = mm_series_advances_on_win(config.type);
+            table.m_next_win.resize(size);
+            table.m_next_loss.resize(size);
+            for (std::uint16_t step = 0; step < size; ++step) {
+                std::uint16_t advanced = static_cast<std::uint16_t>(step + 1);
+                if (step == last) {
+                    advanced = config.end_action == MmSeriesEndAction::HOLD ? last : 0;
+                }
+                table.m_next_win[step] = advance_on_win ? advanced : 0;
+                table.m_next_loss[step] = advance_on_win ? 0 : advanced;
+            }
+            return table;
+        }
+
+        /// \brief Returns the stake of a step.
+        /// \param step Series step; values past the end use the last step.
+        /// \param balance Account balance, used by balance-relative tables.
+        /// \return Zero for a default-constructed table.
+        double amount(std::uint32_t step, double balance) const noexcept {
+            if (m_values.empty()) return 0.0;
+            const double value = m_values[(std::min)(step, static_cast<std::uint32_t>(m_values.size() - 1))];
+            return m_relative ? clamp(value * balance) : value;
+        }
+
+        /// \brief Returns the step that follows a finished trade.
+        /// \param step Step the trade was opened at.
+        /// \param state Final trade state; non-decisive states keep the step.
+        /// \return Zero for a default-constructed table.
+        std::uint32_t next_step(std::uint32_t step, TradeState state) const noexcept {
+            if (m_values.empty()) return 0;
+            if (step >= m_values.size()) step = static_cast<std::uint32_t>(m_values.size() - 1);
+            if (state == TradeState::WIN) return m_next_win[step];
+            if (state == TradeState::LOSS) return m_next_loss[step];
+            return step;
+        }
+
+        std::size_t size() const noexcept { return m_values.size(); }
+        MmSystemType type() const noexcept { return m_type; }
+        MmSeriesScope scope() const noexcept { return m_scope; }
+        bool relative() const noexcept { return m_relative; }
+
+    private:
+        std::vector<double> m_values;
+        std::vector<std::uint16_t> m_next_win;
+        std::vector<std::uint16_t> m_next_loss;
+        double m_min_amount = 0.0;
+        double m_max_amount = 0.0;
+        MmSystemType m_type = MmSystemType::FIXED;
+        MmSeriesScope m_scope = MmSeriesScope::SIGNAL;
+        bool m_relative = false;
+
+        double clamp(double value) const noexcept {
+            if (m_max_amount > 0.0 && value > m_max_amount) value = m_max_amount;
+            if (value < m_min_amount) value = m_min_amount;
+            return value;
+        }
+    };
+
+    /// \class MmSeriesParams
+    /// \brief Money management parameters that carry an MmSeriesConfig.
+    class MmSeriesParams final : public IMoneyManagementParams {
+    public:
+        MmSeriesConfig config; ///< Series description.
+
+        MmSeriesParams() = default;
+
+        explicit MmSeriesParams(MmSeriesConfig value)
+            : config(std::move(value)) {}
+
+        MmSystemType get_type() const override {
+            return config.type;
+        }
+
+        std::unique_ptr<IMoneyManagementParams> clone() const override {
+            return std::make_unique<MmSeriesParams>(config);
+        }
+
+        nlohmann::json to_json() const override {
+            return nlohmann::json{
+                {"type", config.type},
+                {"amount", config.amount},
+                {"percent", config.percent},
+                {"multiplier", config.multiplier},
+                {"amounts", config.amounts},
+                {"steps", config.steps},
+                {"end_action", config.end_action == MmSeriesEndAction::HOLD ? "HOLD" : "RESET"},
+                {"kelly_win_rate", config.kelly_win_rate},
+                {"kelly_payout", config.kelly_payout},
+                {"kelly_scale", config.kelly_scale},
+                {"min_amount", config.min_amount},
+                {"max_amount", config.max_amount}
+            };
+        }
+
+        /// \brief Reads parameters written by to_json(); missing fields keep their defaults.
+        static MmSeriesParams from_json(const nlohmann::json& j) {
+            MmSeriesParams params;
+            auto& config = params.config;
+            config.type = j.value("type", MmSystemType::FIXED);
+            config.amount = j.value("amount", config.amount);
+            config.percent = j.value("percent", config.percent);
+            config.multiplier = j.value("multiplier", config.multiplier);
+            config.amounts = j.value("amounts", config.amounts);
+            config.steps = j.value("steps", config.steps);
+            config.end_action = j.value("end_action", std::string("RESET")) == "HOLD"
+                ? MmSeriesEndAction::HOLD
+                : MmSeriesEndAction::RESET;
+            config.kelly_win_rate = j.value("kelly_win_rate", config.kelly_win_rate);
+            config.kelly_payout = j.value("kelly_payout", config.kelly_payout);
+            config.kelly_scale = j.value("kelly_scale", config.kelly_scale);
+            config.min_amount = j.value("min_amount", config.min_amount);
+            config.max_amount = j.value("max_amount", config.max_amount);
+            return params;
+        }
+    };
+
+} // namespace optionx
+
+#endif // OPTIONX_HEADER_DATA_TRADING_MM_SERIES_CONFIG_HPP_INCLUDED
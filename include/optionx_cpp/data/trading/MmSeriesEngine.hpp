@@ -0,0 +1,240 @@
+#pragma once
+#ifndef OPTIONX_HEADER_DATA_TRADING_MM_SERIES_ENGINE_HPP_INCLUDED
+#define OPTIONX_HEADER_DATA_TRADING_MM_SERIES_ENGINE_HPP_INCLUDED
+
+/// \file MmSeriesEngine.hpp
+/// \brief Defines MmSeriesEngine, which picks stakes from compiled step tables.
+
+namespace optionx {
+
+    /// \struct MmDecision
+    /// \brief Stake chosen for the next trade of a series.
+    struct MmDecision {
+        double amount = 0.0;     ///< Trade amount.
+        std::uint32_t step = 0;  ///< Series step; store it as `mm_step` of the trade.
+        bool valid = false;      ///< False if the table id is unknown.
+
+        explicit operator bool() const noexcept { return valid; }
+    };
+
+    /// \class MmSeriesEngine
+    /// \brief Keeps per-series steps and picks stakes from MmStepTable tables.
+    ///
+    /// Configurations are compiled once by add_table(). On the order path
+    /// decide() is one hash-map probe plus one table read, and on_result()
+    /// moves the series through a precomputed transition. Series state lives
+    /// in an open-addressing table of 16-byte slots keyed by a 64-bit series
+    /// key, see series_key().
+    ///
+    /// The engine is not synchronized; use it from one thread, such as the
+    /// trade queue worker, or guard it externally.
+    class MmSeriesEngine {
+    public:
+        using table_id_t = std::uint32_t;
+
+        static constexpr table_id_t INVALID_TABLE = (std::numeric_limits<table_id_t>::max)(); ///< Id of unknown tables.
+
+        /// \brief Compiles and stores a series configuration.
+        /// \return Table id for decide() and on_result().
+        /// \throws std::invalid_argument if the configuration cannot be compiled.
+        table_id_t add_table(const MmSeriesConfig& config) {
+            m_tables.push_back(MmStepTable::compile(config));
+            return static_cast<table_id_t>(m_tables.size() - 1);
+        }
+
+        /// \brief Compiles the series parameters attached to a signal.
+        /// \return Table id, or INVALID_TABLE if the signal has no MmSeriesParams.
+        table_id_t add_table(const TradeSignal& signal) {
+            const auto* params = dynamic_cast<const MmSeriesParams*>(signal.mm_params.get());
+            return params ? add_table(params->config) : INVALID_TABLE;
+        }
+
+        /// \brief Returns a compiled table, or nullptr for an unknown id.
+        const MmStepTable* table(table_id_t id) const noexcept {
+            return id < m_tables.size() ? &m_tables[id] : nullptr;
+        }
+
+        /// \brief Picks the stake for the next trade of a series.
+        /// \param id Table id from add_table().
+        /// \param key Series key from series_key().
+        /// \param balance Account balance for balance-relative tables.
+        MmDecision decide(table_id_t id, std::uint64_t key, double balance = 0.0) const noexcept {
+            MmDecision decision;
+            if (id >= m_tables.size()) return decision;
+            const auto* slot = find(id, key);
+            decision.step = slot ? slot->step : 0;
+            decision.amount = m_tables[id].amount(decision.step, balance);
+            decision.valid = true;
+            return decision;
+        }
+
+        /// \brief Applies a finished trade to its series.
+        /// \param id Table id the trade was sized with.
+        /// \param key Series key of the trade.
+        /// \param step Step the trade was opened at (`mm_step`).
+        /// \param state Final trade state.
+        /// \return Step for the next trade of the series.
+        std::uint32_t on_result(table_id_t id, std::uint64_t key, std::uint32_t step, TradeState state) {
+            if (id >= m_tables.size()) return 0;
+            const auto next = m_tables[id].next_step(step, state);
+            if (next == 0) {
+                erase(id, key);
+            } else {
+                insert(id, key)->step = static_cast<std::uint16_t>(next);
+            }
+            return next;
+        }
+
+        /// \brief Returns the current step of a series.
+        std::uint32_t step(table_id_t id, std::uint64_t key) const noexcept {
+            const auto* slot = find(id, key);
+            return slot ? slot->step : 0;
+        }
+
+        /// \brief Starts a series over from step 0.
+        void reset(table_id_t id, std::uint64_t key) {
+            erase(id, key);
+        }
+
+        /// \brief Drops all series state; compiled tables are kept.
+        void clear_series() noexcept {
+            std::fill(m_slots.begin(), m_slots.end(), Slot{});
+            m_size = 0;
+        }
+
+        /// \brief Returns the number of series away from step 0.
+        std::size_t active_series() const noexcept {
+            return m_size;
+        }
+
+        /// \brief Builds the series key of a signal for a table scope.
+        /// \details The signal group is `mm_group_hash`, else `mm_group_id`,
+        ///          else `signal_name`, combined with the account; SYMBOL and
+        ///          BAR scopes add the symbol and BAR adds `bar_time`.
+        ///          Hashing is done here, so callers that repeat orders for one
+        ///          series can keep the key.
+        static std::uint64_t series_key(const TradeSignal& signal, MmSeriesScope scope, std::int64_t bar_time = 0) noexcept {
+            std::uint64_t hash = FNV_OFFSET;
+            if (!signal.mm_group_hash.empty()) {
+                hash = fnv1a(hash, signal.mm_group_hash);
+            } else
+            if (signal.mm_group_id != 0) {
+                hash = fnv1a(hash, &signal.mm_group_id, sizeof(signal.mm_group_id));
+            } else {
+                hash = fnv1a(hash, signal.signal_name);
+            }
+            hash = fnv1a(hash, &signal.account_id, sizeof(signal.account_id));
+            if (scope != MmSeriesScope::SIGNAL) {
+                hash = fnv1a(hash, signal.symbol);
+            }
+            if (scope == MmSeriesScope::BAR) {
+                hash = fnv1a(hash, &bar_time, sizeof(bar_time));
+            }
+            return hash;
+        }
+
+    private:
+        /// Series state slot; `used == 0` marks an empty slot.
+        struct Slot {
+            std::uint64_t key = 0;
+            std::uint32_t table = 0;
+            std::uint16_t step = 0;
+            std::uint16_t used = 0;
+        };
+        static_assert(sizeof(Slot) == 16, "MmSeriesEngine slots must stay compact");
+
+        static constexpr std::uint64_t FNV_OFFSET = 14695981039346656037ULL;
+        static constexpr std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+        std::vector<MmStepTable> m_tables;
+        std::vector<Slot> m_slots;  ///< Power-of-two sized, linear probing.
+        std::size_t m_size = 0;
+
+        static std::uint64_t fnv1a(std::uint64_t hash, const void* data, std::size_t size) noexcept {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < size; ++i) {
+                hash ^= bytes[i];
+                hash *= FNV_PRIME;
+            }
+            return hash;
+        }
+
+        static std::uint64_t fnv1a(std::uint64_t hash, const std::string& value) noexcept {
+            hash = fnv1a(hash, value.data(), value.size());
+            hash ^= 0xFF; // field separator
+            return hash * FNV_PRIME;
+        }
+
+        /// \brief Mixes the table id into the key and spreads the bits (SplitMix64 finalizer).
+        static std::uint64_t slot_hash(table_id_t id, std::uint64_t key) noexcept {
+            std::uint64_t x = key ^ (static_cast<std::uint64_t>(id) * 0x9E3779B97F4A7C15ULL);
+            x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+            return x ^ (x >> 31);
+        }
+
+        const Slot* find(table_id_t id, std::uint64_t key) const noexcept {
+            if (m_size == 0) return nullptr;
+            const std::size_t mask = m_slots.size() - 1;
+            for (std::size_t i = slot_hash(id, key) & mask;; i = (i + 1) & mask) {
+                const auto& slot = m_slots[i];
+                if (!slot.used) return nullptr;
+                if (slot.key == key && slot.table == id) return &slot;
+            }
+        }
+
+        Slot* insert(table_id_t id, std::uint64_t key) {
+            if ((m_size + 1) * 4 > m_slots.size() * 3) {
+                rehash(m_slots.empty() ? 16 : m_slots.size() * 2);
+            }
+            const std::size_t mask = m_slots.size() - 1;
+            for (std::size_t i = slot_hash(id, key) & mask;; i = (i + 1) & mask) {
+                auto& slot = m_slots[i];
+                if (slot.used && slot.key == key && slot.table == id) return &slot;
+                if (!slot.used) {
+                    slot.key = key;
+                    slot.table = id;
+                    slot.step = 0;
+                    slot.used = 1;
+                    ++m_size;
+                    return &slot;
+                }
+            }
+        }
+
+        void erase(table_id_t id, std::uint64_t key) noexcept {
+            if (m_size == 0) return;
+            const std::size_t mask = m_slots.size() - 1;
+            std::size_t i = slot_hash(id, key) & mask;
+            for (;; i = (i + 1) & mask) {
+                if (!m_slots[i].used) return;
+                if (m_slots[i].key == key && m_slots[i].table == id) break;
+            }
+            // Backward-shift deletion keeps probe chains intact without tombstones.
+            for (std::size_t j = (i + 1) & mask; m_slots[j].used; j = (j + 1) & mask) {
+                const std::size_t home = slot_hash(m_slots[j].table, m_slots[j].key) & mask;
+                if (((j - home) & mask) >= ((j - i) & mask)) {
+                    m_slots[i] = m_slots[j];
+                    i = j;
+                }
+            }
+            m_slots[i] = Slot{};
+            --m_size;
+        }
+
+        void rehash(std::size_t capacity) {
+            std::vector<Slot> old(capacity);
+            old.swap(m_slots);
+            const std::size_t mask = m_slots.size() - 1;
+            for (const auto& slot : old) {
+                if (!slot.used) continue;
+                std::size_t i = slot_hash(slot.table, slot.key) & mask;
+                while (m_slots[i].used) i = (i + 1) & mask;
+                m_slots[i] = slot;
+            }
+        }
+    };
+
+} // namespace optionx
+
+#endif // OPTIONX_HEADER_DATA_TRADING_MM_SERIES_ENGINE_HPP_INCLUDED
@@ -5,7 +5,9 @@
 /// \file TradeStats.hpp
 /// \brief DTOs for trade statistics, charting, and meta-analysis.
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <map>
@@ -167,39 +169,250 @@ namespace optionx {
     };
 
     /// \class TradeCurrencyConversionMatrix
-    /// \brief Static currency conversion rates for portfolio statistics.
+    /// \brief Currency conversion rates for portfolio statistics.
+    /// \details Static rates are resolved into a dense CurrencyType x CurrencyType
+    /// table (direct, inverse, then cross rates via the base currency or another
+    /// pivot) by every setter, so convert() is a single array lookup. The rate
+    /// map and base currency are private so the table cannot go stale. Optional
+    /// per-day rates override the static table for timestamped conversions;
+    /// days without a quote reuse the latest earlier quote.
     class TradeCurrencyConversionMatrix {
     public:
-        CurrencyType base_currency = CurrencyType::UNKNOWN; ///< Reporting currency for converted values.
-        std::map<std::pair<CurrencyType, CurrencyType>, double> rates; ///< Pair(from, to) -> multiplier.
+        static constexpr std::size_t CURRENCY_COUNT = static_cast<std::size_t>(CurrencyType::KZT) + 1;
+        static constexpr std::int64_t MS_PER_DAY = 86400000;
 
-        /// \brief Sets a direct conversion multiplier.
+        using rate_map_t = std::map<std::pair<CurrencyType, CurrencyType>, double>;
+
+        TradeCurrencyConversionMatrix() {
+            resolve();
+        }
+
+        /// \brief Returns the reporting currency for converted values.
+        CurrencyType base_currency() const noexcept {
+            return m_base_currency;
+        }
+
+        /// \brief Sets the reporting currency and re-resolves the table.
+        void set_base_currency(CurrencyType currency) {
+            if (m_base_currency == currency) return;
+            m_base_currency = currency;
+            resolve();
+        }
+
+        /// \brief Returns the configured direct rates, pair(from, to) -> multiplier.
+        const rate_map_t& rates() const noexcept {
+            return m_rates;
+        }
+
+        /// \brief Sets a direct conversion multiplier and re-resolves the table.
         void set_rate(CurrencyType from, CurrencyType to, double rate) {
-            rates[{from, to}] = rate;
+            m_rates[{from, to}] = rate;
+            resolve();
+        }
+
+        /// \brief Replaces all direct rates and re-resolves the table once.
+        void set_rates(rate_map_t rates) {
+            m_rates = std::move(rates);
+            resolve();
         }
 
-        /// \brief Converts a value between currencies, using inverse rates when possible.
+        /// \brief Sets a conversion multiplier valid from the UTC day of \p timestamp_ms.
+        /// \param from Source currency.
+        /// \param to Target currency.
+        /// \param timestamp_ms Any timestamp within the quoted day.
+        /// \param rate Multiplier; non-positive values are ignored.
+        void set_daily_rate(CurrencyType from, CurrencyType to, std::int64_t timestamp_ms, double rate) {
+            if (!is_indexed(from) || !is_indexed(to) || from == to || !(rate > 0.0)) return;
+            auto& slot = m_series_index[index(from, to)];
+            if (slot < 0) {
+                slot = static_cast<std::int16_t>(m_series.size());
+                m_series.emplace_back();
+            }
+            m_series[static_cast<std::size_t>(slot)].set(day_of(timestamp_ms), rate);
+        }
+
+        /// \brief Checks whether any per-day rates are configured.
+        bool has_daily_rates() const noexcept {
+            return !m_series.empty();
+        }
+
+        /// \brief Returns the static multiplier from one currency to another, or 0 when unknown.
+        double rate(CurrencyType from, CurrencyType to) const {
+            if (from == to) return 1.0;
+            if (!is_indexed(from) || !is_indexed(to)) return 0.0;
+            return m_table[index(from, to)];
+        }
+
+        /// \brief Returns the multiplier effective on the day of \p timestamp_ms, or 0 when unknown.
+        /// \details Per-day quotes (direct, inverse, or via the base currency) take
+        /// precedence over the static table.
+        double rate(CurrencyType from, CurrencyType to, std::int64_t timestamp_ms) const {
+            if (from == to || m_series.empty()) return rate(from, to);
+            if (!is_indexed(from) || !is_indexed(to)) return 0.0;
+            const auto day = day_of(timestamp_ms);
+            const double quoted = daily_rate(from, to, day);
+            if (quoted > 0.0) return quoted;
+
+            if (is_indexed(m_base_currency) && m_base_currency != CurrencyType::UNKNOWN &&
+                m_base_currency != from && m_base_currency != to) {
+                const double to_base = daily_rate(from, m_base_currency, day);
+                const double from_base = daily_rate(m_base_currency, to, day);
+                if (to_base > 0.0 || from_base > 0.0) {
+                    const double a = to_base > 0.0 ? to_base : rate(from, m_base_currency);
+                    const double b = from_base > 0.0 ? from_base : rate(m_base_currency, to);
+                    if (a > 0.0 && b > 0.0) return a * b;
+                }
+            }
+            return rate(from, to);
+        }
+
+        /// \brief Converts a value between currencies using static rates.
+        /// \return Converted value, or \p value unchanged when no rate is known.
         double convert(double value, CurrencyType from, CurrencyType to) const {
             if (from == to || from == CurrencyType::UNKNOWN || to == CurrencyType::UNKNOWN) {
                 return value;
             }
+            const double multiplier = rate(from, to);
+            return multiplier != 0.0 ? value * multiplier : value;
+        }
+
+        /// \brief Converts a value between currencies at the rate effective on \p timestamp_ms.
+        double convert(double value, CurrencyType from, CurrencyType to, std::int64_t timestamp_ms) const {
+            if (from == to || from == CurrencyType::UNKNOWN || to == CurrencyType::UNKNOWN) {
+                return value;
+            }
+            const double multiplier = rate(from, to, timestamp_ms);
+            return multiplier != 0.0 ? value * multiplier : value;
+        }
+
+        /// \brief Converts a value to the base currency when it is configured.
+        double convert_to_base(double value, CurrencyType from) const {
+            return convert(value, from, m_base_currency);
+        }
+
+        /// \brief Converts a value to the base currency at the rate effective on \p timestamp_ms.
+        double convert_to_base(double value, CurrencyType from, std::int64_t timestamp_ms) const {
+            return convert(value, from, m_base_currency, timestamp_ms);
+        }
 
-            const auto direct = rates.find({from, to});
-            if (direct != rates.end()) {
-                return value * direct->second;
+    private:
+        /// \brief Rebuilds the dense table from the rate map and base currency.
+        void resolve() {
+            m_table.fill(0.0);
+            for (std::size_t i = 0; i < CURRENCY_COUNT; ++i) {
+                m_table[i * CURRENCY_COUNT + i] = 1.0;
+            }
+            for (const auto& [pair, rate] : m_rates) {
+                if (!is_indexed(pair.first) || !is_indexed(pair.second) || !(rate > 0.0)) continue;
+                m_table[index(pair.first, pair.second)] = rate;
+            }
+            for (const auto& [pair, rate] : m_rates) {
+                if (!is_indexed(pair.first) || !is_indexed(pair.second) || !(rate > 0.0)) continue;
+                auto& inverse = m_table[index(pair.second, pair.first)];
+                if (inverse == 0.0) inverse = 1.0 / rate;
             }
 
-            const auto inverse = rates.find({to, from});
-            if (inverse != rates.end() && inverse->second != 0.0) {
-                return value / inverse->second;
+            std::array<double, CURRENCY_COUNT * CURRENCY_COUNT> direct = m_table;
+            std::vector<std::size_t> pivots;
+            if (is_indexed(m_base_currency) && m_base_currency != CurrencyType::UNKNOWN) {
+                pivots.push_back(static_cast<std::size_t>(m_base_currency));
+            }
+            for (std::size_t p = 1; p < CURRENCY_COUNT; ++p) {
+                if (pivots.empty() || pivots.front() != p) pivots.push_back(p);
             }
+            for (std::size_t from = 1; from < CURRENCY_COUNT; ++from) {
+                for (std::size_t to = 1; to < CURRENCY_COUNT; ++to) {
+                    auto& cell = m_table[from * CURRENCY_COUNT + to];
+                    if (cell != 0.0) continue;
+                    for (const auto pivot : pivots) {
+                        const double a = direct[from * CURRENCY_COUNT + pivot];
+                        const double b = direct[pivot * CURRENCY_COUNT + to];
+                        if (a != 0.0 && b != 0.0) {
+                            cell = a * b;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        /// \brief Forward-filled per-day quotes for one currency pair.
+        struct DailyRateSeries {
+            std::int64_t first_day = 0;
+            std::vector<double> rates;  ///< Index = day - first_day.
+            std::vector<bool> quoted;   ///< True where the rate was set explicitly.
 
-            return value;
+            double at(std::int64_t day) const noexcept {
+                if (rates.empty() || day < first_day) return 0.0;
+                const auto offset = static_cast<std::size_t>(day - first_day);
+                return rates[std::min(offset, rates.size() - 1)];
+            }
+
+            void set(std::int64_t day, double rate) {
+                if (rates.empty()) {
+                    first_day = day;
+                    rates.assign(1, rate);
+                    quoted.assign(1, true);
+                    return;
+                }
+                if (day < first_day) {
+                    const auto shift = static_cast<std::size_t>(first_day - day);
+                    rates.insert(rates.begin(), shift, rate);
+                    quoted.insert(quoted.begin(), shift, false);
+                    first_day = day;
+                }
+                auto offset = static_cast<std::size_t>(day - first_day);
+                if (offset >= rates.size()) {
+                    const double last = rates.back();
+                    rates.resize(offset + 1, last);
+                    quoted.resize(offset + 1, false);
+                }
+                rates[offset] = rate;
+                quoted[offset] = true;
+                for (++offset; offset < rates.size() && !quoted[offset]; ++offset) {
+                    rates[offset] = rate;
+                }
+            }
+        };
+
+        CurrencyType m_base_currency = CurrencyType::UNKNOWN; ///< Reporting currency for converted values.
+        rate_map_t m_rates; ///< Direct rates, pair(from, to) -> multiplier.
+        std::array<double, CURRENCY_COUNT * CURRENCY_COUNT> m_table{};  ///< Resolved rates; 0 = no known rate.
+        std::array<std::int16_t, CURRENCY_COUNT * CURRENCY_COUNT> m_series_index = make_series_index();
+        std::vector<DailyRateSeries> m_series;
+
+        static constexpr std::array<std::int16_t, CURRENCY_COUNT * CURRENCY_COUNT> make_series_index() {
+            std::array<std::int16_t, CURRENCY_COUNT * CURRENCY_COUNT> result{};
+            for (auto& value : result) value = -1;
+            return result;
         }
 
-        /// \brief Converts a value to base_currency when it is configured.
-        double convert_to_base(double value, CurrencyType from) const {
-            return convert(value, from, base_currency);
+        static constexpr bool is_indexed(CurrencyType currency) noexcept {
+            return static_cast<std::size_t>(currency) < CURRENCY_COUNT;
+        }
+
+        static constexpr std::size_t index(CurrencyType from, CurrencyType to) noexcept {
+            return static_cast<std::size_t>(from) * CURRENCY_COUNT + static_cast<std::size_t>(to);
+        }
+
+        static constexpr std::int64_t day_of(std::int64_t timestamp_ms) noexcept {
+            return timestamp_ms >= 0
+                ? timestamp_ms / MS_PER_DAY
+                : -((-timestamp_ms + MS_PER_DAY - 1) / MS_PER_DAY);
+        }
+
+        double daily_rate(CurrencyType from, CurrencyType to, std::int64_t day) const noexcept {
+            const auto direct = m_series_index[index(from, to)];
+            if (direct >= 0) {
+                const double value = m_series[static_cast<std::size_t>(direct)].at(day);
+                if (value > 0.0) return value;
+            }
+            const auto inverse = m_series_index[index(to, from)];
+            if (inverse >= 0) {
+                const double value = m_series[static_cast<std::size_t>(inverse)].at(day);
+                if (value > 0.0) return 1.0 / value;
+            }
+            return 0.0;
         }
     };
 
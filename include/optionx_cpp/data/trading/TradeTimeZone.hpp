@@ -5,7 +5,13 @@
 /// \file TradeTimeZone.hpp
 /// \brief Defines a local-time context for trade queries and statistics.
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include <time_shield/constants.hpp>
 #include <time_shield/date_time_conversions.hpp>
@@ -15,6 +21,113 @@
 
 namespace optionx {
 
+    /// \class TradeTimeZoneTransitions
+    /// \brief Precomputed UTC offset intervals of one time-shield named zone.
+    /// \details Built once per zone by probing time-shield daily over
+    ///          [TABLE_BEGIN_UTC_MS, TABLE_END_UTC_MS) and bisecting every
+    ///          offset change to the millisecond. Interval `i` covers
+    ///          [starts()[i], starts()[i + 1]) with offset `offsets_sec()[i]`.
+    ///          Timestamps outside the window are resolved by time-shield.
+    class TradeTimeZoneTransitions {
+    public:
+        static constexpr std::int64_t TABLE_BEGIN_UTC_MS = 946684800000;  ///< 2000-01-01T00:00:00Z.
+        static constexpr std::int64_t TABLE_END_UTC_MS = 4102444800000;   ///< 2100-01-01T00:00:00Z.
+
+        /// \brief Returns the shared table for \p zone, building it on first use.
+        /// \return Table pointer, or nullptr when the table could not be built.
+        static const TradeTimeZoneTransitions* get(time_shield::TimeZone zone) noexcept {
+            try {
+                static std::mutex mutex;
+                static std::map<time_shield::TimeZone, std::unique_ptr<const TradeTimeZoneTransitions>> tables;
+                std::lock_guard<std::mutex> lock(mutex);
+                auto& table = tables[zone];
+                if (!table) table = build(zone);
+                return table.get();
+            } catch (...) {
+                return nullptr;
+            }
+        }
+
+        /// \brief Checks whether \p utc_ms lies inside the precomputed window.
+        static constexpr bool contains(std::int64_t utc_ms) noexcept {
+            return utc_ms >= TABLE_BEGIN_UTC_MS && utc_ms < TABLE_END_UTC_MS;
+        }
+
+        /// \brief Returns the interval index containing \p utc_ms (binary search).
+        /// \pre contains(utc_ms).
+        std::size_t find(std::int64_t utc_ms) const noexcept {
+            const auto it = std::upper_bound(m_starts.begin(), m_starts.end(), utc_ms);
+            return static_cast<std::size_t>(it - m_starts.begin()) - 1;
+        }
+
+        /// \brief Returns the interval index containing \p utc_ms, trying \p hint and its successor first.
+        /// \pre contains(utc_ms).
+        std::size_t find(std::int64_t utc_ms, std::size_t hint) const noexcept {
+            const std::size_t size = m_starts.size();
+            if (hint < size && m_starts[hint] <= utc_ms) {
+                if (hint + 1 == size || utc_ms < m_starts[hint + 1]) return hint;
+                if (hint + 2 == size || utc_ms < m_starts[hint + 2]) return hint + 1;
+            }
+            return find(utc_ms);
+        }
+
+        /// \brief Returns the UTC offset in seconds of interval \p index.
+        std::int64_t offset_sec(std::size_t index) const noexcept {
+            return m_offsets_sec[index];
+        }
+
+        /// \brief Returns interval start instants (UTC milliseconds, ascending).
+        const std::vector<std::int64_t>& starts() const noexcept {
+            return m_starts;
+        }
+
+        /// \brief Returns interval offsets in seconds, parallel to starts().
+        const std::vector<std::int64_t>& offsets_sec() const noexcept {
+            return m_offsets_sec;
+        }
+
+    private:
+        std::vector<std::int64_t> m_starts;
+        std::vector<std::int64_t> m_offsets_sec;
+
+        static std::int64_t probe(time_shield::TimeZone zone, std::int64_t utc_ms) noexcept {
+            time_shield::tz_t resolved = 0;
+            return time_shield::zone_offset_at_utc_ms(
+                static_cast<time_shield::ts_ms_t>(utc_ms),
+                zone,
+                resolved)
+                    ? static_cast<std::int64_t>(resolved)
+                    : 0;
+        }
+
+        static std::unique_ptr<const TradeTimeZoneTransitions> build(time_shield::TimeZone zone) {
+            auto table = std::make_unique<TradeTimeZoneTransitions>();
+            std::int64_t current = probe(zone, TABLE_BEGIN_UTC_MS);
+            table->m_starts.push_back(TABLE_BEGIN_UTC_MS);
+            table->m_offsets_sec.push_back(current);
+            for (std::int64_t day = TABLE_BEGIN_UTC_MS + time_shield::MS_PER_DAY;
+                 day < TABLE_END_UTC_MS;
+                 day += time_shield::MS_PER_DAY) {
+                const std::int64_t next = probe(zone, day);
+                if (next == current) continue;
+                std::int64_t lo = day - time_shield::MS_PER_DAY;
+                std::int64_t hi = day;
+                while (hi - lo > 1) {
+                    const std::int64_t mid = lo + (hi - lo) / 2;
+                    if (probe(zone, mid) == current) {
+                        lo = mid;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                table->m_starts.push_back(hi);
+                table->m_offsets_sec.push_back(next);
+                current = next;
+            }
+            return table;
+        }
+    };
+
     /// \enum TradeTimeZoneMode
     /// \brief Selects whether local-time calculations use a fixed offset or a named zone.
     enum class TradeTimeZoneMode {
@@ -26,8 +139,9 @@ namespace optionx {
     /// \brief Time-zone context used by local-time filters, buckets and day queries.
     ///
     /// Fixed-offset mode preserves the old `time_zone_sec` behavior. Named-zone
-    /// mode delegates offset resolution to time-shield and therefore accounts for
-    /// DST transitions supported by `time_shield::TimeZone`.
+    /// mode resolves offsets from a TradeTimeZoneTransitions table derived from
+    /// time-shield and therefore accounts for DST transitions supported by
+    /// `time_shield::TimeZone`.
     ///
     /// Conversion helpers are total functions: if an unsupported named-zone
     /// conversion cannot be resolved, the context falls back to UTC/identity
@@ -61,6 +175,7 @@ namespace optionx {
             result.m_mode = TradeTimeZoneMode::NAMED_ZONE;
             result.m_offset_sec = 0;
             result.m_zone = value;
+            result.m_transitions = TradeTimeZoneTransitions::get(value);
             return result;
         }
 
@@ -93,6 +208,9 @@ namespace optionx {
             if (!is_named_zone()) {
                 return m_offset_sec;
             }
+            if (m_transitions && TradeTimeZoneTransitions::contains(utc_ms)) {
+                return m_transitions->offset_sec(m_transitions->find(utc_ms));
+            }
 
             time_shield::tz_t resolved = 0;
             return time_shield::zone_offset_at_utc_ms(
@@ -108,6 +226,21 @@ namespace optionx {
             return utc_ms + offset_at_utc_ms(utc_ms) * time_shield::MS_PER_SEC;
         }
 
+        /// \brief Converts a column of UTC timestamps to local civil milliseconds.
+        /// \details Uses a TradeTimeZoneCursor, so ascending input costs amortized
+        ///          O(1) per element. \p local_ms may alias \p utc_ms.
+        /// \param utc_ms Source timestamps.
+        /// \param count Number of timestamps.
+        /// \param local_ms Destination for \p count local timestamps.
+        void to_local_ms(const std::int64_t* utc_ms, std::size_t count, std::int64_t* local_ms) const noexcept;
+
+        /// \brief Converts a column of UTC timestamps to local civil milliseconds.
+        std::vector<std::int64_t> to_local_ms(const std::vector<std::int64_t>& utc_ms) const {
+            std::vector<std::int64_t> result(utc_ms.size());
+            to_local_ms(utc_ms.data(), utc_ms.size(), result.data());
+            return result;
+        }
+
         /// \brief Converts local civil milliseconds in this context back to UTC.
         /// \details Unsupported named-zone conversions fall back to treating the
         ///          supplied civil timestamp as UTC.
@@ -151,8 +284,60 @@ namespace optionx {
         TradeTimeZoneMode m_mode = TradeTimeZoneMode::FIXED_OFFSET;
         std::int64_t m_offset_sec = 0;
         time_shield::TimeZone m_zone = time_shield::UTC;
+        const TradeTimeZoneTransitions* m_transitions = nullptr; ///< Shared table for named zones.
+
+        friend class TradeTimeZoneCursor;
+    };
+
+    /// \class TradeTimeZoneCursor
+    /// \brief Stateful offset resolver that remembers the last transition interval.
+    /// \details Meant for one thread walking many timestamps, e.g. a statistics
+    ///          pass or a parsed history column. Sorted input resolves in
+    ///          amortized O(1); unsorted input degrades to a binary search.
+    ///          The cursor references \p time_zone, which must outlive it.
+    class TradeTimeZoneCursor {
+    public:
+        explicit TradeTimeZoneCursor(const TradeTimeZone& time_zone) noexcept
+            : m_time_zone(time_zone) {}
+
+        /// \brief Resolves UTC offset in seconds, same result as TradeTimeZone::offset_at_utc_ms().
+        std::int64_t offset_at_utc_ms(std::int64_t utc_ms) noexcept {
+            const auto* transitions = m_time_zone.m_transitions;
+            if (!m_time_zone.is_named_zone() || !transitions ||
+                !TradeTimeZoneTransitions::contains(utc_ms)) {
+                return m_time_zone.offset_at_utc_ms(utc_ms);
+            }
+            m_index = transitions->find(utc_ms, m_index);
+            return transitions->offset_sec(m_index);
+        }
+
+        /// \brief Converts UTC milliseconds to local civil milliseconds.
+        std::int64_t to_local_ms(std::int64_t utc_ms) noexcept {
+            return utc_ms + offset_at_utc_ms(utc_ms) * time_shield::MS_PER_SEC;
+        }
+
+    private:
+        const TradeTimeZone& m_time_zone;
+        std::size_t m_index = 0;
     };
 
+    inline void TradeTimeZone::to_local_ms(
+            const std::int64_t* utc_ms,
+            std::size_t count,
+            std::int64_t* local_ms) const noexcept {
+        if (!is_named_zone()) {
+            const auto offset_ms = m_offset_sec * time_shield::MS_PER_SEC;
+            for (std::size_t i = 0; i < count; ++i) {
+                local_ms[i] = utc_ms[i] + offset_ms;
+            }
+            return;
+        }
+        TradeTimeZoneCursor cursor(*this);
+        for (std::size_t i = 0; i < count; ++i) {
+            local_ms[i] = cursor.to_local_ms(utc_ms[i]);
+        }
+    }
+
 } // namespace optionx
 
 #endif // OPTIONX_HEADER_DATA_TRADING_TRADE_TIME_ZONE_HPP_INCLUDED
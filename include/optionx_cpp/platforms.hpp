@@ -26,6 +26,7 @@
 #include "platforms/common/BaseTradingApi.hpp"
 #include "platforms/common/BaseTradingPlatform.hpp"
 #include "platforms/IntradeBarPlatform.hpp"
-//#include "platforms/TradeUpPlatform.hpp"
+#include "platforms/SimulatedTradingPlatform.hpp"
+#include "platforms/TradeUpPlatform.hpp"
 
 #endif // OPTIONX_HEADER_PLATFORMS_HPP_INCLUDED
@@ -17,10 +17,13 @@
 #include "IntradeBarPlatform/http_utils.hpp"
 #include "IntradeBarPlatform/http_parsers.hpp"
 #include "IntradeBarPlatform/HttpClientComponent.hpp"
+#include "IntradeBarPlatform/DomainHealthTable.hpp"
+#include "IntradeBarPlatform/AdaptivePollScheduler.hpp"
 #include "IntradeBarPlatform/RequestManager.hpp"
 #include "IntradeBarPlatform/AuthManager.hpp"
 #include "IntradeBarPlatform/TradeExecutionComponent.hpp"
 #include "IntradeBarPlatform/BalanceManager.hpp"
+#include "IntradeBarPlatform/ActiveTradesSnapshotTracker.hpp"
 #include "IntradeBarPlatform/ActiveTradesSyncManager.hpp"
 #include "IntradeBarPlatform/PriceManager.hpp"
 #include "IntradeBarPlatform/BtcPriceManager.hpp"
@@ -0,0 +1,113 @@
+#pragma once
+#ifndef OPTIONX_HEADER_PLATFORMS_INTRADE_BAR_PLATFORM_ACTIVE_TRADES_SNAPSHOT_TRACKER_HPP_INCLUDED
+#define OPTIONX_HEADER_PLATFORMS_INTRADE_BAR_PLATFORM_ACTIVE_TRADES_SNAPSHOT_TRACKER_HPP_INCLUDED
+
+/// \file ActiveTradesSnapshotTracker.hpp
+/// \brief Reconciles broker active-trades snapshots with the locally reported open trades.
+
+namespace optionx::platforms::intrade_bar {
+
+    /// \class ActiveTradesSnapshotTracker
+    /// \brief Decides which active-trades snapshots are published and when the next refresh is due.
+    /// \details Snapshots are compared as sorted (id, close time) sets against
+    ///          the last published one. An unchanged snapshot is dropped unless
+    ///          the trade queue asked for a refresh, since the queue keeps that
+    ///          request open until an answer arrives. The open-trades count
+    ///          reported by OpenTradesEvent decides whether refreshes stay at
+    ///          the active period.
+    class ActiveTradesSnapshotTracker {
+    public:
+        /// \brief Result of reconciling one snapshot.
+        struct Decision {
+            bool changed = false; ///< Snapshot differs from the last published one.
+            bool publish = false; ///< Snapshot must be published to the trade queue.
+        };
+
+        /// \brief Compares a snapshot with the last published one.
+        /// \details Also records the earliest close time after `now_ms`. A
+        ///          published snapshot becomes the new reference and answers a
+        ///          pending refresh request.
+        /// \param snapshot Broker active trades.
+        /// \param now_ms Current time, ms.
+        /// \return Whether the snapshot changed and whether it must be published.
+        Decision reconcile(const ActiveTradesSnapshot& snapshot, int64_t now_ms) {
+            std::vector<std::pair<int64_t, int64_t>> trades;
+            trades.reserve(snapshot.trades.size());
+            int64_t next_close_ms = 0;
+            for (const auto& trade : snapshot.trades) {
+                trades.emplace_back(trade.id, trade.close_time_ms);
+                if (trade.close_time_ms > now_ms &&
+                    (next_close_ms == 0 || trade.close_time_ms < next_close_ms)) {
+                    next_close_ms = trade.close_time_ms;
+                }
+            }
+            std::sort(trades.begin(), trades.end());
+            m_next_close_ms = next_close_ms;
+
+            Decision decision;
+            decision.changed = !m_has_published || trades != m_published;
+            decision.publish = decision.changed || m_refresh_requested;
+            if (decision.publish) {
+                m_published = std::move(trades);
+                m_has_published = true;
+                m_refresh_requested = false;
+            }
+            return decision;
+        }
+
+        /// \brief Records that the trade queue waits for a snapshot.
+        void request_refresh() noexcept {
+            m_refresh_requested = true;
+        }
+
+        /// \brief Returns true while the trade queue waits for a snapshot.
+        bool refresh_requested() const noexcept {
+            return m_refresh_requested;
+        }
+
+        /// \brief Applies an open-trades count from OpenTradesEvent.
+        /// \param open_trades Reported count; negative values count as zero.
+        /// \return True if the count changed.
+        bool update_open_trades(int64_t open_trades) noexcept {
+            open_trades = std::max<int64_t>(0, open_trades);
+            if (open_trades == m_open_trades) return false;
+            m_open_trades = open_trades;
+            return true;
+        }
+
+        /// \brief Returns the last reported open-trades count.
+        int64_t open_trades() const noexcept {
+            return m_open_trades;
+        }
+
+        /// \brief Returns true while open trades exist; refreshes then stay at the active period.
+        bool has_open_trades() const noexcept {
+            return m_open_trades > 0;
+        }
+
+        /// \brief Returns the earliest future close time of the last snapshot, or 0.
+        int64_t next_close_ms() const noexcept {
+            return m_next_close_ms;
+        }
+
+        /// \brief Forgets snapshots of a previous account context.
+        /// \details The open-trades count is kept: it comes from the trade queue,
+        ///          which reports it again on its own changes.
+        void reset() noexcept {
+            m_published.clear();
+            m_has_published = false;
+            m_refresh_requested = false;
+            m_next_close_ms = 0;
+        }
+
+    private:
+        std::vector<std::pair<int64_t, int64_t>> m_published; ///< Sorted (id, close time) pairs of the last published snapshot.
+        int64_t m_next_close_ms = 0;    ///< Earliest future close time from the last snapshot, or 0.
+        int64_t m_open_trades = 0;      ///< Last reported open trades count.
+        bool m_has_published = false;   ///< True once a snapshot was published for the current account context.
+        bool m_refresh_requested = false; ///< True while the trade queue waits for a snapshot answer.
+    };
+
+} // namespace optionx::platforms::intrade_bar
+
+#endif // OPTIONX_HEADER_PLATFORMS_INTRADE_BAR_PLATFORM_ACTIVE_TRADES_SNAPSHOT_TRACKER_HPP_INCLUDED
@@ -28,6 +28,11 @@ namespace optionx::platforms::intrade_bar {
             subscribe<events::DisconnectRequestEvent>();
             subscribe<events::AccountInfoUpdateEvent>();
             subscribe<events::OpenTradesSnapshotRefreshRequestEvent>();
+            subscribe<events::OpenTradesEvent>();
+            m_refresh_schedule.configure(
+                m_active_trades_sync_period_ms,
+                m_active_trades_sync_period_ms,
+                m_active_trades_sync_max_period_ms);
             platform.register_component(this);
         }
 
@@ -57,8 +62,12 @@ namespace optionx::platforms::intrade_bar {
         std::shared_ptr<BaseAccountInfoData> m_account_info; ///< Shared pointer to account information.
         int64_t m_active_trades_close_buffer_ms = time_shield::MS_PER_SEC; ///< Safety delay after broker close time.
         int64_t m_active_trades_sync_period_ms = time_shield::MS_PER_15_SEC; ///< Delayed refresh period for uncertain snapshots.
+        int64_t m_active_trades_sync_max_period_ms = time_shield::MS_PER_5_MIN; ///< Upper bound for repeated refresh backoff.
+        AdaptivePollScheduler m_refresh_schedule; ///< Delay policy for delayed refresh requests.
+        ActiveTradesSnapshotTracker m_snapshots; ///< Last published snapshot and open trades count.
         bool m_sync_in_progress = false; ///< True while a snapshot request is running.
         bool m_refresh_scheduled = false; ///< True while a delayed refresh task is pending.
+        std::uint64_t m_refresh_generation = 0; ///< Invalidates superseded delayed refresh tasks.
         std::uint64_t m_sync_generation = 0; ///< Monotonic request generation for stale callback filtering.
         std::uint64_t m_active_sync_generation = 0; ///< Generation of the currently active snapshot request.
         std::uint64_t m_account_context_generation = 0; ///< Changes whenever broker account identity changes.
@@ -74,6 +83,11 @@ namespace optionx::platforms::intrade_bar {
         /// \brief Resets active sync request state and invalidates pending callbacks.
         void reset_sync_state();
 
+        /// \brief Publishes a snapshot unless it repeats the last published one.
+        /// \param snapshot Broker active trades.
+        /// \param reason Human-readable trigger reason for logs.
+        void publish_snapshot(const ActiveTradesSnapshot& snapshot, const std::string& reason);
+
         /// \brief Invalidates sync state because account identity or connection context changed.
         /// \param reason Human-readable reason for diagnostics.
         void invalidate_account_context(const char* reason);
@@ -112,6 +126,10 @@ namespace optionx::platforms::intrade_bar {
         /// \param event Refresh request event.
         void handle_event(const events::OpenTradesSnapshotRefreshRequestEvent& event);
 
+        /// \brief Tracks open trades count changes to adapt refresh delays.
+        /// \param event Open trades event.
+        void handle_event(const events::OpenTradesEvent& event);
+
         /// \brief Retrieves the account information as an AccountInfoData instance.
         /// \return A shared pointer to AccountInfoData.
         std::shared_ptr<AccountInfoData> get_account_info();
@@ -132,6 +150,9 @@ namespace optionx::platforms::intrade_bar {
         } else
         if (const auto* msg = dynamic_cast<const events::OpenTradesSnapshotRefreshRequestEvent*>(event)) {
             handle_event(*msg);
+        } else
+        if (const auto* msg = dynamic_cast<const events::OpenTradesEvent*>(event)) {
+            handle_event(*msg);
         }
     }
 
@@ -164,6 +185,7 @@ namespace optionx::platforms::intrade_bar {
 
         m_sync_in_progress = true;
         m_refresh_scheduled = false;
+        ++m_refresh_generation;
         const std::uint64_t generation = ++m_sync_generation;
         m_active_sync_generation = generation;
         const AccountContext account_context = capture_account_context(account_info);
@@ -213,31 +235,49 @@ namespace optionx::platforms::intrade_bar {
                     return;
                 }
 
-                std::vector<int64_t> close_times_ms;
-                close_times_ms.reserve(result.value.trades.size());
-                for (const auto& trade : result.value.trades) {
-                    if (trade.close_time_ms > 0) {
-                        close_times_ms.push_back(trade.close_time_ms);
-                    }
-                }
-
-                LOGIT_INFO(
-                    "Intrade Bar active trades sync: snapshot received. reason=",
-                    reason,
-                    ", active_trades=",
-                    result.value.trades.size(),
-                    ", close_times=",
-                    close_times_ms.size(),
-                    ", close_buffer_ms=",
-                    m_active_trades_close_buffer_ms);
-
-                notify(events::OpenTradesSnapshotEvent(
-                    static_cast<int64_t>(result.value.trades.size()),
-                    std::move(close_times_ms),
-                    m_active_trades_close_buffer_ms));
+                publish_snapshot(result.value, reason);
             });
     }
 
+    inline void ActiveTradesSyncManager::publish_snapshot(
+            const ActiveTradesSnapshot& snapshot,
+            const std::string& reason) {
+        const auto decision = m_snapshots.reconcile(snapshot, OPTIONX_TIMESTAMP_MS);
+        if (decision.changed) m_refresh_schedule.reset_backoff();
+
+        if (!decision.publish) {
+            LOGIT_DEBUG(
+                "Intrade Bar active trades sync: unchanged snapshot not republished. reason=",
+                reason,
+                ", active_trades=",
+                snapshot.trades.size());
+            return;
+        }
+
+        std::vector<int64_t> close_times_ms;
+        close_times_ms.reserve(snapshot.trades.size());
+        for (const auto& trade : snapshot.trades) {
+            if (trade.close_time_ms > 0) close_times_ms.push_back(trade.close_time_ms);
+        }
+
+        LOGIT_INFO(
+            "Intrade Bar active trades sync: snapshot received. reason=",
+            reason,
+            ", active_trades=",
+            snapshot.trades.size(),
+            ", close_times=",
+            close_times_ms.size(),
+            ", changed=",
+            decision.changed,
+            ", close_buffer_ms=",
+            m_active_trades_close_buffer_ms);
+
+        notify(events::OpenTradesSnapshotEvent(
+            static_cast<int64_t>(snapshot.trades.size()),
+            std::move(close_times_ms),
+            m_active_trades_close_buffer_ms));
+    }
+
     inline void ActiveTradesSyncManager::reset_sync_state() {
         m_sync_in_progress = false;
         m_active_sync_generation = 0;
@@ -248,6 +288,8 @@ namespace optionx::platforms::intrade_bar {
         ++m_account_context_generation;
         m_task_manager.shutdown();
         m_refresh_scheduled = false;
+        m_snapshots.reset();
+        m_refresh_schedule.reset_backoff();
         reset_sync_state();
         LOGIT_DEBUG(
             "Intrade Bar active trades sync: account context invalidated. reason=",
@@ -292,18 +334,36 @@ namespace optionx::platforms::intrade_bar {
             return;
         }
 
+        // Refresh at the sync period while trades are open, or right after
+        // the nearest known close. Without open trades, refreshes that find
+        // nothing new back off; any change resets that backoff.
+        const int64_t now_ms = OPTIONX_TIMESTAMP_MS;
+        const int64_t next_close_ms = m_snapshots.next_close_ms();
+        const int64_t due_in_ms = next_close_ms > now_ms
+            ? next_close_ms - now_ms + m_active_trades_close_buffer_ms
+            : 0;
+        const bool active = m_snapshots.has_open_trades();
+        const int64_t delay_ms = m_refresh_schedule.next_delay_ms(active, due_in_ms);
+
         LOGIT_INFO(
             "Intrade Bar active trades sync: scheduling broker snapshot refresh. reason=",
             reason,
+            ", active=",
+            active,
             ", delay_ms=",
-            m_active_trades_sync_period_ms);
+            delay_ms);
         const std::string log_reason = reason;
+        const std::uint64_t generation = ++m_refresh_generation;
         m_refresh_scheduled = m_task_manager.add_delayed_task(
             "active-trades-sync-refresh",
-            m_active_trades_sync_period_ms,
-            [this, reason = std::move(reason)](std::shared_ptr<utils::Task> task) mutable {
+            delay_ms,
+            [this, generation, reason = std::move(reason)](std::shared_ptr<utils::Task> task) mutable {
+                if (task->is_shutdown()) {
+                    if (generation == m_refresh_generation) m_refresh_scheduled = false;
+                    return;
+                }
+                if (generation != m_refresh_generation) return;
                 m_refresh_scheduled = false;
-                if (task->is_shutdown()) return;
                 request_sync(std::move(reason));
             });
         if (!m_refresh_scheduled) {
@@ -317,6 +377,11 @@ namespace optionx::platforms::intrade_bar {
         if (auto auth_data = std::dynamic_pointer_cast<AuthData>(event.auth_data)) {
             m_active_trades_close_buffer_ms = auth_data->active_trades_close_buffer_ms;
             m_active_trades_sync_period_ms = auth_data->active_trades_sync_period_ms;
+            m_active_trades_sync_max_period_ms = auth_data->active_trades_sync_max_period_ms;
+            m_refresh_schedule.configure(
+                m_active_trades_sync_period_ms,
+                m_active_trades_sync_period_ms,
+                m_active_trades_sync_max_period_ms);
             const auto account_info = get_account_info();
             if (account_info->connect &&
                 ((auth_data->account_type != AccountType::UNKNOWN &&
@@ -329,7 +394,9 @@ namespace optionx::platforms::intrade_bar {
                 "Intrade Bar active trades sync: configured close buffer ms=",
                 m_active_trades_close_buffer_ms,
                 ", sync_period_ms=",
-                m_active_trades_sync_period_ms);
+                m_active_trades_sync_period_ms,
+                ", sync_max_period_ms=",
+                m_active_trades_sync_max_period_ms);
         }
     }
 
@@ -359,9 +426,23 @@ namespace optionx::platforms::intrade_bar {
 
     inline void ActiveTradesSyncManager::handle_event(
             const events::OpenTradesSnapshotRefreshRequestEvent& event) {
+        m_snapshots.request_refresh();
         schedule_sync(event.reason.empty() ? "refresh-request" : event.reason);
     }
 
+    inline void ActiveTradesSyncManager::handle_event(const events::OpenTradesEvent& event) {
+        if (!m_snapshots.update_open_trades(event.open_trades)) return;
+        const bool all_closed = !m_snapshots.has_open_trades();
+        m_refresh_schedule.reset_backoff();
+
+        // A refresh that waited for the local queue to drain can run now.
+        if (all_closed && m_refresh_scheduled && !m_sync_in_progress) {
+            ++m_refresh_generation;
+            m_refresh_scheduled = false;
+            request_sync("trades-closed");
+        }
+    }
+
     inline std::shared_ptr<AccountInfoData> ActiveTradesSyncManager::get_account_info() {
         if (auto account_info = std::dynamic_pointer_cast<AccountInfoData>(m_account_info)) {
             return account_info;
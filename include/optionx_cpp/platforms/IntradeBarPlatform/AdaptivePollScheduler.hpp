@@ -0,0 +1,86 @@
+#pragma once
+#ifndef OPTIONX_HEADER_PLATFORMS_INTRADE_BAR_PLATFORM_ADAPTIVE_POLL_SCHEDULER_HPP_INCLUDED
+#define OPTIONX_HEADER_PLATFORMS_INTRADE_BAR_PLATFORM_ADAPTIVE_POLL_SCHEDULER_HPP_INCLUDED
+
+/// \file AdaptivePollScheduler.hpp
+/// \brief Poll delay policy that stays fast during trading activity and backs off when idle.
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace optionx::platforms::intrade_bar {
+
+    /// \class AdaptivePollScheduler
+    /// \brief Computes the delay before the next broker poll.
+    /// \details Active polls use a fixed period. Consecutive idle polls start at
+    ///          the idle period and double up to the idle cap. Any activity
+    ///          resets the backoff.
+    class AdaptivePollScheduler {
+    public:
+        AdaptivePollScheduler() = default;
+
+        /// \brief Constructs a configured scheduler.
+        /// \param active_period_ms Delay used while activity is reported.
+        /// \param idle_period_ms First idle delay.
+        /// \param idle_max_period_ms Upper bound for idle backoff.
+        AdaptivePollScheduler(
+                std::int64_t active_period_ms,
+                std::int64_t idle_period_ms,
+                std::int64_t idle_max_period_ms) {
+            configure(active_period_ms, idle_period_ms, idle_max_period_ms);
+        }
+
+        /// \brief Updates periods and restarts the idle backoff.
+        /// \param active_period_ms Delay used while activity is reported.
+        /// \param idle_period_ms First idle delay.
+        /// \param idle_max_period_ms Upper bound for idle backoff; raised to the idle period if lower.
+        void configure(
+                std::int64_t active_period_ms,
+                std::int64_t idle_period_ms,
+                std::int64_t idle_max_period_ms) {
+            m_active_period_ms = std::max<std::int64_t>(1, active_period_ms);
+            m_idle_period_ms = std::max<std::int64_t>(1, idle_period_ms);
+            m_idle_max_period_ms = std::max(m_idle_period_ms, idle_max_period_ms);
+            reset_backoff();
+        }
+
+        /// \brief Restarts the idle backoff from the idle period.
+        void reset_backoff() {
+            m_idle_delay_ms = m_idle_period_ms;
+        }
+
+        /// \brief Returns the delay before the next poll and advances the backoff.
+        /// \param active True while trades are open, near expiry or just changed.
+        /// \param due_in_ms Time until a known deadline such as a trade close; values <= 0 are ignored.
+        /// \return Delay in milliseconds, at least 1.
+        std::int64_t next_delay_ms(bool active, std::int64_t due_in_ms = 0) {
+            std::int64_t delay_ms = 0;
+            if (active) {
+                reset_backoff();
+                delay_ms = m_active_period_ms;
+            } else {
+                delay_ms = m_idle_delay_ms;
+                m_idle_delay_ms = m_idle_delay_ms > m_idle_max_period_ms / 2
+                    ? m_idle_max_period_ms
+                    : m_idle_delay_ms * 2;
+            }
+            if (due_in_ms > 0) delay_ms = std::min(delay_ms, due_in_ms);
+            return std::max<std::int64_t>(1, delay_ms);
+        }
+
+        /// \brief Returns the idle delay the next idle poll would use.
+        std::int64_t idle_delay_ms() const noexcept {
+            return m_idle_delay_ms;
+        }
+
+    private:
+        std::int64_t m_active_period_ms = 1;   ///< Delay while activity is reported.
+        std::int64_t m_idle_period_ms = 1;     ///< First idle delay.
+        std::int64_t m_idle_max_period_ms = 1; ///< Idle backoff cap.
+        std::int64_t m_idle_delay_ms = 1;      ///< Next idle delay.
+    };
+
+} // namespace optionx::platforms::intrade_bar
+
+#endif // OPTIONX_HEADER_PLATFORMS_INTRADE_BAR_PLATFORM_ADAPTIVE_POLL_SCHEDULER_HPP_INCLUDED
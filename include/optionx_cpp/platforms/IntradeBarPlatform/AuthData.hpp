@@ -29,13 +29,16 @@ namespace optionx::platforms::intrade_bar {
         bool auto_find_domain  = false;            ///< Whether to perform automatic domain discovery.
         int domain_index_min   = 0;                ///< Minimum domain index to scan (negative excludes intrade.bar).
         int domain_index_max   = 1000;             ///< Maximum domain index to scan (e.g., intrade1000.bar).
+        int64_t balance_active_period_ms = time_shield::MS_PER_15_SEC; ///< Balance polling period while trades are open.
         int64_t balance_check_period_ms = time_shield::MS_PER_15_MIN; ///< Connected balance polling period.
+        int64_t balance_idle_max_period_ms = time_shield::MS_PER_HOUR; ///< Upper bound for idle balance polling backoff.
         int64_t disconnected_domain_retry_period_ms = time_shield::MS_PER_15_SEC; ///< Disconnected host/domain recovery period.
         int64_t settings_switch_retry_timeout_ms = time_shield::MS_PER_10_MIN; ///< Max time to retry broker settings switches.
         int64_t settings_switch_retry_delay_ms = time_shield::MS_PER_15_SEC; ///< Fallback retry delay for settings switches.
         int64_t settings_switch_active_trade_buffer_ms = time_shield::MS_PER_5_SEC; ///< Delay after active trade close before retry.
         int64_t active_trades_close_buffer_ms = time_shield::MS_PER_SEC; ///< Delay after broker close time before reducing snapshot open trades.
         int64_t active_trades_sync_period_ms = time_shield::MS_PER_15_SEC; ///< Delayed refresh period for uncertain active-trades snapshots.
+        int64_t active_trades_sync_max_period_ms = time_shield::MS_PER_5_MIN; ///< Upper bound for repeated active-trades refresh backoff.
         int64_t order_interval_ms = 1000; ///< Minimum delay between broker order requests.
         TradeHistorySource trade_history_source = TradeHistorySource::CSV; ///< Source used for closed trade history requests.
 
@@ -125,13 +128,16 @@ namespace optionx::platforms::intrade_bar {
                 j["auto_find_domain"] = auto_find_domain;
                 j["domain_index_min"] = domain_index_min;
                 j["domain_index_max"] = domain_index_max;
+                j["balance_active_period_ms"] = balance_active_period_ms;
                 j["balance_check_period_ms"] = balance_check_period_ms;
+                j["balance_idle_max_period_ms"] = balance_idle_max_period_ms;
                 j["disconnected_domain_retry_period_ms"] = disconnected_domain_retry_period_ms;
                 j["settings_switch_retry_timeout_ms"] = settings_switch_retry_timeout_ms;
                 j["settings_switch_retry_delay_ms"] = settings_switch_retry_delay_ms;
                 j["settings_switch_active_trade_buffer_ms"] = settings_switch_active_trade_buffer_ms;
                 j["active_trades_close_buffer_ms"] = active_trades_close_buffer_ms;
                 j["active_trades_sync_period_ms"] = active_trades_sync_period_ms;
+                j["active_trades_sync_max_period_ms"] = active_trades_sync_max_period_ms;
                 j["order_interval_ms"] = order_interval_ms;
                 j["trade_history_source"] = trade_history_source_to_string(trade_history_source);
             } catch (const std::exception& ex) {
@@ -167,7 +173,11 @@ namespace optionx::platforms::intrade_bar {
                 auto_find_domain = j.value("auto_find_domain", auto_find_domain);
                 domain_index_min = j.value("domain_index_min", domain_index_min);
                 domain_index_max = j.value("domain_index_max", domain_index_max);
+                balance_active_period_ms = j.value("balance_active_period_ms", balance_active_period_ms);
                 balance_check_period_ms = j.value("balance_check_period_ms", balance_check_period_ms);
+                balance_idle_max_period_ms = j.value(
+                    "balance_idle_max_period_ms",
+                    balance_idle_max_period_ms);
                 disconnected_domain_retry_period_ms = j.value(
                     "disconnected_domain_retry_period_ms",
                     disconnected_domain_retry_period_ms);
@@ -186,6 +196,9 @@ namespace optionx::platforms::intrade_bar {
                 active_trades_sync_period_ms = j.value(
                     "active_trades_sync_period_ms",
                     active_trades_sync_period_ms);
+                active_trades_sync_max_period_ms = j.value(
+                    "active_trades_sync_max_period_ms",
+                    active_trades_sync_max_period_ms);
                 order_interval_ms = j.value(
                     "order_interval_ms",
                     order_interval_ms);
@@ -209,9 +222,15 @@ namespace optionx::platforms::intrade_bar {
             if (auto_find_domain && domain_index_min > domain_index_max) {
                 return { false, "Invalid domain index range: min > max" };
             }
+            if (balance_active_period_ms <= 0) {
+                return { false, "Balance active period must be positive" };
+            }
             if (balance_check_period_ms <= 0) {
                 return { false, "Balance check period must be positive" };
             }
+            if (balance_idle_max_period_ms <= 0) {
+                return { false, "Balance idle max period must be positive" };
+            }
             if (disconnected_domain_retry_period_ms <= 0) {
                 return { false, "Disconnected domain retry period must be positive" };
             }
@@ -230,6 +249,9 @@ namespace optionx::platforms::intrade_bar {
             if (active_trades_sync_period_ms <= 0) {
                 return { false, "Active trades sync period must be positive" };
             }
+            if (active_trades_sync_max_period_ms <= 0) {
+                return { false, "Active trades sync max period must be positive" };
+            }
             if (order_interval_ms < 0) {
                 return { false, "Order interval must be non-negative" };
             }
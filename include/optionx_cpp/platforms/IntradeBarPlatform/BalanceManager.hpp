@@ -32,6 +32,7 @@ namespace optionx::platforms::intrade_bar {
             subscribe<events::BalanceRequestEvent>();
             subscribe<events::TradeRequestEvent>();
             subscribe<events::AccountInfoUpdateEvent>();
+            subscribe<events::OpenTradesEvent>();
             m_request_time = m_last_trades_time =
                 time_shield::ms_to_sec(OPTIONX_TIMESTAMP_MS);
             platform.register_component(this);
@@ -56,7 +57,11 @@ namespace optionx::platforms::intrade_bar {
         std::shared_ptr<BaseAccountInfoData> m_account_info; ///< Shared pointer to account information.
         int64_t m_last_trades_time;           ///< Timestamp of the last trade activity.
         int64_t m_request_time;               ///< Timestamp of the last balance request.
+        int64_t m_balance_active_period_ms = time_shield::MS_PER_15_SEC; ///< Balance polling period while trades are open.
         int64_t m_balance_check_period_ms = time_shield::MS_PER_15_MIN; ///< Connected balance polling period.
+        int64_t m_balance_idle_max_period_ms = time_shield::MS_PER_HOUR; ///< Upper bound for idle balance polling backoff.
+        int64_t m_open_trades = 0;            ///< Last reported open trades count.
+        AdaptivePollScheduler m_balance_schedule; ///< Delay policy for connected balance polling.
         int64_t m_disconnected_domain_retry_period_ms = time_shield::MS_PER_15_SEC; ///< Disconnected host/domain recovery period.
         bool m_has_balance_update = false;    ///< Flag indicating if a balance update is in progress.
         bool m_check_host_in_progress = false;
@@ -64,6 +69,7 @@ namespace optionx::platforms::intrade_bar {
         std::uint64_t m_active_balance_request_generation = 0; ///< Currently active balance request generation.
         std::uint64_t m_host_request_generation = 0; ///< Monotonic host/domain request generation.
         std::uint64_t m_active_host_request_generation = 0; ///< Currently active host/domain request generation.
+        std::uint64_t m_balance_poll_generation = 0; ///< Invalidates superseded balance poll tasks.
 
         /// \brief Starts a balance request generation.
         /// \param reason Human-readable trigger for diagnostics.
@@ -106,6 +112,18 @@ namespace optionx::platforms::intrade_bar {
          /// \brief Initiates a balance update request.
         void handle_balance_update();
 
+        /// \brief Checks whether trades are open.
+        /// \return True if balance polling should use the active period.
+        bool has_open_trades() const;
+
+        /// \brief Checks whether a trade was requested or expired less than three minutes ago.
+        /// \return True if balance polling should not back off.
+        bool is_trading_recent() const;
+
+        /// \brief Replaces the pending connected balance poll with a newly computed delay.
+        /// \param reason Human-readable trigger for diagnostics.
+        void schedule_balance_poll(const char* reason);
+
         /// \brief Processes a successful balance update.
         /// \param balance The updated balance value.
         /// \param currency The account currency type.
@@ -144,6 +162,10 @@ namespace optionx::platforms::intrade_bar {
         /// \param event The account info update event.
         void handle_event(const events::AccountInfoUpdateEvent& event);
 
+        /// \brief Handles open trades count changes.
+        /// \param event The open trades event.
+        void handle_event(const events::OpenTradesEvent& event);
+
         /// \brief Handles account connection events.
         void handle_connected();
 
@@ -173,6 +195,9 @@ namespace optionx::platforms::intrade_bar {
         } else
         if (const auto* msg = dynamic_cast<const events::AccountInfoUpdateEvent*>(event)) {
             handle_event(*msg);
+        } else
+        if (const auto* msg = dynamic_cast<const events::OpenTradesEvent*>(event)) {
+            handle_event(*msg);
         }
     };
 
@@ -305,6 +330,43 @@ namespace optionx::platforms::intrade_bar {
         });
     }
 
+    inline bool BalanceManager::has_open_trades() const {
+        return m_open_trades > 0;
+    }
+
+    inline bool BalanceManager::is_trading_recent() const {
+        return time_shield::ms_to_sec(OPTIONX_TIMESTAMP_MS) < m_last_trades_time;
+    }
+
+    inline void BalanceManager::schedule_balance_poll(const char* reason) {
+        if (!get_account_info()->connect) return;
+        // Open trades poll at the active period; right after trading the
+        // regular check period is kept without idle backoff.
+        const bool active = has_open_trades();
+        if (!active && is_trading_recent()) {
+            m_balance_schedule.reset_backoff();
+        }
+        const int64_t delay_ms = m_balance_schedule.next_delay_ms(active);
+        const std::uint64_t generation = ++m_balance_poll_generation;
+        LOGIT_DEBUG(
+            "Intrade Bar balance: next balance poll scheduled. reason=",
+            reason,
+            ", active=",
+            active,
+            ", delay_ms=",
+            delay_ms);
+        m_task_manager.add_delayed_task(
+                "connected-balance-check",
+                delay_ms,
+                [this, generation](std::shared_ptr<utils::Task> task) {
+            if (task->is_shutdown()) return;
+            if (generation != m_balance_poll_generation) return;
+            LOGIT_TRACE0();
+            handle_balance_update();
+            schedule_balance_poll("poll");
+        });
+    }
+
     // Processes successful balance updates.
     inline void BalanceManager::process_balance_success(
             double balance,
@@ -353,12 +415,24 @@ namespace optionx::platforms::intrade_bar {
     inline void BalanceManager::handle_event(const events::AuthDataEvent& event) {
         if (auto auth_data = std::dynamic_pointer_cast<AuthData>(event.auth_data)) {
             invalidate_async_requests("auth-data");
+            if (auth_data->balance_active_period_ms > 0) {
+                m_balance_active_period_ms = auth_data->balance_active_period_ms;
+                LOGIT_INFO(
+                    "Intrade Bar balance: configured active balance period ms=",
+                    m_balance_active_period_ms);
+            }
             if (auth_data->balance_check_period_ms > 0) {
                 m_balance_check_period_ms = auth_data->balance_check_period_ms;
                 LOGIT_INFO(
                     "Intrade Bar balance: configured balance check period ms=",
                     m_balance_check_period_ms);
             }
+            if (auth_data->balance_idle_max_period_ms > 0) {
+                m_balance_idle_max_period_ms = auth_data->balance_idle_max_period_ms;
+                LOGIT_INFO(
+                    "Intrade Bar balance: configured idle balance backoff cap ms=",
+                    m_balance_idle_max_period_ms);
+            }
             if (auth_data->disconnected_domain_retry_period_ms > 0) {
                 m_disconnected_domain_retry_period_ms =
                     auth_data->disconnected_domain_retry_period_ms;
@@ -370,6 +444,7 @@ namespace optionx::platforms::intrade_bar {
     }
 
     inline void BalanceManager::handle_event(const events::TradeRequestEvent& event) {
+        const bool was_active = has_open_trades() || is_trading_recent();
         m_last_trades_time = time_shield::ms_to_sec(OPTIONX_TIMESTAMP_MS);
         auto request = event.request;
         //auto result  = event.result;
@@ -384,6 +459,9 @@ namespace optionx::platforms::intrade_bar {
         }
         const int64_t max_elapsed = 3 * time_shield::SEC_PER_MIN;
         m_last_trades_time += max_elapsed;
+        if (!was_active) {
+            schedule_balance_poll("trade-request");
+        }
     }
 
     inline void BalanceManager::handle_event(const events::ConnectRequestEvent& event) {
@@ -408,6 +486,22 @@ namespace optionx::platforms::intrade_bar {
         }
     }
 
+    inline void BalanceManager::handle_event(const events::OpenTradesEvent& event) {
+        const bool had_open_trades = has_open_trades();
+        const bool closed = event.open_trades < m_open_trades;
+        m_open_trades = std::max<int64_t>(0, event.open_trades);
+        if (!get_account_info()->connect) return;
+
+        // Local trades fetch the balance on close; snapshot trades closing
+        // on the broker side are not checked, so refresh it here.
+        if (closed && !event.request) {
+            handle_balance_update();
+        }
+        if (had_open_trades != has_open_trades()) {
+            schedule_balance_poll("open-trades-changed");
+        }
+    }
+
     /// \brief Handles account connection event.
     inline void BalanceManager::handle_connected() {
         LOGIT_TRACE0();
@@ -416,17 +510,18 @@ namespace optionx::platforms::intrade_bar {
         invalidate_async_requests("connected");
         
         LOGIT_INFO(
-            "Intrade Bar balance: starting connected balance polling. period_ms=",
-            m_balance_check_period_ms);
-
-        m_task_manager.add_periodic_task(
-                "connected-balance-check",
-                m_balance_check_period_ms,
-                [this](std::shared_ptr<utils::Task> task){
-            if (task->is_shutdown()) return;
-            LOGIT_TRACE0();
-            handle_balance_update();
-        });
+            "Intrade Bar balance: starting connected balance polling. active_period_ms=",
+            m_balance_active_period_ms,
+            ", period_ms=",
+            m_balance_check_period_ms,
+            ", idle_max_period_ms=",
+            m_balance_idle_max_period_ms);
+
+        m_balance_schedule.configure(
+            m_balance_active_period_ms,
+            m_balance_check_period_ms,
+            m_balance_idle_max_period_ms);
+        schedule_balance_poll("connected");
         
         m_task_manager.add_periodic_task(
                 "connected-15sec",
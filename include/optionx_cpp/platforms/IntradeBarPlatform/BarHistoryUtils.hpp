@@ -6,6 +6,7 @@
 /// \brief Helpers for Intrade Bar historical bar request slicing.
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <string>
@@ -157,6 +158,23 @@ namespace optionx::platforms::intrade_bar {
         return chunks;
     }
 
+    /// \brief Counts bar slots in an inclusive history range.
+    /// \param from_ts Inclusive start timestamp in seconds.
+    /// \param to_ts Inclusive end timestamp in seconds.
+    /// \param timeframe_sec Bar timeframe in seconds.
+    /// \param max_bars Upper bound for the result; values <= 0 disable the cap.
+    /// \return Number of bars the range can hold, used to preallocate sequences.
+    inline std::size_t bar_history_slot_count(
+            std::int64_t from_ts,
+            std::int64_t to_ts,
+            std::int64_t timeframe_sec,
+            std::int64_t max_bars = 0) {
+        if (from_ts <= 0 || to_ts < from_ts || timeframe_sec <= 0) return 0;
+        auto count = (to_ts - from_ts) / timeframe_sec + 1;
+        if (max_bars > 0) count = std::min(count, max_bars);
+        return static_cast<std::size_t>(count);
+    }
+
 } // namespace optionx::platforms::intrade_bar
 
 #endif // OPTIONX_HEADER_PLATFORMS_INTRADE_BAR_PLATFORM_BAR_HISTORY_UTILS_HPP_INCLUDED
@@ -0,0 +1,105 @@
+#pragma once
+#ifndef OPTIONX_HEADER_PLATFORMS_INTRADE_BAR_PLATFORM_DOMAIN_HEALTH_TABLE_HPP_INCLUDED
+#define OPTIONX_HEADER_PLATFORMS_INTRADE_BAR_PLATFORM_DOMAIN_HEALTH_TABLE_HPP_INCLUDED
+
+/// \file DomainHealthTable.hpp
+/// \brief Per-mirror probe latency and health used to order domain discovery.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace optionx::platforms::intrade_bar {
+
+    /// \class DomainHealthTable
+    /// \brief Remembers probe outcomes per mirror index.
+    /// \details Healthy mirrors are ranked by smoothed latency, mirrors without
+    ///          history keep their configured order, and failing mirrors go
+    ///          last so reconnects start from the fastest known domain.
+    class DomainHealthTable {
+    public:
+        /// \brief Probe statistics for one mirror.
+        struct Entry {
+            double latency_ms = 0.0;        ///< Exponentially smoothed probe latency.
+            std::uint32_t successes = 0;    ///< Successful probes seen so far.
+            std::uint32_t failures = 0;     ///< Consecutive failed probes.
+            std::int64_t last_success_ms = 0; ///< Time of the last successful probe.
+        };
+
+        /// \brief Records a successful probe.
+        /// \param index Mirror index (0 = intrade.bar).
+        /// \param latency_ms Round-trip time of the probe.
+        /// \param now_ms Current timestamp in milliseconds.
+        void record_success(int index, std::int64_t latency_ms, std::int64_t now_ms) {
+            auto& entry = m_entries[index];
+            const double sample = static_cast<double>(std::max<std::int64_t>(0, latency_ms));
+            entry.latency_ms = entry.successes == 0
+                ? sample
+                : entry.latency_ms + LATENCY_SMOOTHING * (sample - entry.latency_ms);
+            ++entry.successes;
+            entry.failures = 0;
+            entry.last_success_ms = now_ms;
+        }
+
+        /// \brief Records a failed or timed-out probe.
+        /// \param index Mirror index (0 = intrade.bar).
+        void record_failure(int index) {
+            auto& entry = m_entries[index];
+            if (entry.failures < MAX_TRACKED_FAILURES) ++entry.failures;
+        }
+
+        /// \brief Returns statistics for a mirror, or nullptr when it was never probed.
+        const Entry* find(int index) const {
+            const auto it = m_entries.find(index);
+            return it == m_entries.end() ? nullptr : &it->second;
+        }
+
+        /// \brief Reorders candidates so the most promising mirrors are probed first.
+        /// \param candidates Mirror indices in configured order.
+        /// \return Candidates ordered by health tier, latency and configured position.
+        std::vector<int> order(const std::vector<int>& candidates) const {
+            // (tier, metric, configured position): 0 healthy, 1 unknown, 2 failing.
+            using Rank = std::tuple<int, double, std::size_t>;
+            std::vector<std::pair<Rank, int>> ranked;
+            ranked.reserve(candidates.size());
+            for (std::size_t i = 0; i < candidates.size(); ++i) {
+                const Entry* entry = find(candidates[i]);
+                Rank rank{1, 0.0, i};
+                if (entry && entry->failures == 0 && entry->successes > 0) {
+                    rank = Rank{0, entry->latency_ms, i};
+                } else if (entry && entry->failures > 0) {
+                    rank = Rank{2, static_cast<double>(entry->failures), i};
+                }
+                ranked.emplace_back(rank, candidates[i]);
+            }
+            std::sort(ranked.begin(), ranked.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.first < rhs.first;
+            });
+
+            std::vector<int> ordered;
+            ordered.reserve(ranked.size());
+            for (const auto& item : ranked) {
+                ordered.push_back(item.second);
+            }
+            return ordered;
+        }
+
+        /// \brief Forgets all recorded probes.
+        void clear() {
+            m_entries.clear();
+        }
+
+    private:
+        static constexpr double LATENCY_SMOOTHING = 0.3;
+        static constexpr std::uint32_t MAX_TRACKED_FAILURES = 1000;
+
+        std::unordered_map<int, Entry> m_entries;
+    };
+
+} // namespace optionx::platforms::intrade_bar
+
+#endif // OPTIONX_HEADER_PLATFORMS_INTRADE_BAR_PLATFORM_DOMAIN_HEALTH_TABLE_HPP_INCLUDED
@@ -462,10 +462,9 @@ namespace optionx::platforms::intrade_bar {
                     for (const auto& removed : removed_subscriptions) {
                         if (uses_btc_websocket_source(removed) &&
                             !m_btc_websocket_source->add_market_data_subscription()) {
-                            LOGIT_WARN(
-                                "Failed to restore Intrade Bar BTC websocket tick source for ",
-                                removed.symbol,
-                                " after subscription batch rollback.");
+                            OPTIONX_ASYNC_LOG_WARN(
+                                "Failed to restore Intrade Bar BTC websocket tick source for %s after subscription batch rollback.",
+                                removed.symbol);
                         }
                     }
 
@@ -531,20 +530,18 @@ namespace optionx::platforms::intrade_bar {
                         for (const auto& removed : removed_subscriptions) {
                             if (uses_btc_websocket_source(removed) &&
                                 !m_btc_websocket_source->add_market_data_subscription()) {
-                                LOGIT_WARN(
-                                    "Failed to restore Intrade Bar BTC websocket tick source for ",
-                                    removed.symbol,
-                                    " after subscription batch rollback.");
+                                OPTIONX_ASYNC_LOG_WARN(
+                                    "Failed to restore Intrade Bar BTC websocket tick source for %s after subscription batch rollback.",
+                                    removed.symbol);
                             }
                         }
                     }
                     for (const auto& removed : removed_subscriptions) {
                         if (uses_fx_websocket_source(removed) &&
                             !m_fx_websocket_source->add_symbol_subscription(removed.symbol)) {
-                            LOGIT_WARN(
-                                "Failed to restore Intrade Bar FX websocket tick source for ",
-                                removed.symbol,
-                                " after subscription batch rollback.");
+                            OPTIONX_ASYNC_LOG_WARN(
+                                "Failed to restore Intrade Bar FX websocket tick source for %s after subscription batch rollback.",
+                                removed.symbol);
                         }
                     }
 
@@ -10,6 +10,7 @@
 
 #include "ApiResponses.hpp"
 #include "BarHistoryUtils.hpp"
+#include "DomainHealthTable.hpp"
 
 namespace optionx::platforms::intrade_bar {
 
@@ -305,6 +306,7 @@ namespace optionx::platforms::intrade_bar {
         int m_domain_index_max = 0;      ///< Maximum domain index to scan (e.g., intrade1000.bar).
         bool m_domain_include_primary = true; ///< Whether to include https://intrade.bar in domain discovery.
         TradeHistorySource m_trade_history_source = TradeHistorySource::CSV; ///< Closed trade history source mode.
+        DomainHealthTable m_domain_health; ///< Probe latency and health per mirror index.
 
         /// \brief Returns a reference to the HTTP client.
         /// \return Reference to the `kurlyk::HttpClient` instance.
@@ -756,14 +758,17 @@ namespace optionx::platforms::intrade_bar {
 
         auto state = std::make_shared<DomainCheckState>();
         state->on_complete = std::move(find_callback);
+        std::vector<int> indices;
         if (include_primary) {
-            state->indices.push_back(0);
+            indices.push_back(0);
         }
         for (int i = std::max(1, min_index); i <= max_index; ++i) {
-            state->indices.push_back(i);
+            indices.push_back(i);
         }
+        // Mirrors that answered quickly last time are raced first.
+        state->indices = m_domain_health.order(indices);
 
-        constexpr int domain_check_batch_size = 50;
+        constexpr int domain_probe_concurrency = 50;
 
         auto make_host = [](int index) {
             return (index == 0)
@@ -797,11 +802,13 @@ namespace optionx::platforms::intrade_bar {
             state->on_complete(success, selected_host);
         };
 
-        auto launch_batch = std::make_shared<std::function<void()>>();
-        *launch_batch = [this, state, make_host, complete, launch_batch]() {
+        // Keeps up to domain_probe_concurrency probes in flight and refills the
+        // window as each one finishes, so a dead mirror only delays its own slot.
+        auto launch_probes = std::make_shared<std::function<void()>>();
+        *launch_probes = [this, state, make_host, complete, launch_probes]() {
             if (state->completed) return;
             if (state->next_index >= state->indices.size()) {
-                complete(false, 0);
+                if (state->pending_requests == 0) complete(false, 0);
                 return;
             }
 
@@ -811,21 +818,29 @@ namespace optionx::platforms::intrade_bar {
             client.set_timeout(5);
             client.set_connect_timeout(5);
 
-            state->pending_requests = 0;
-            for (int sent = 0;
-                 sent < domain_check_batch_size && state->next_index < state->indices.size();
-                 ++sent, ++state->next_index) {
-                const int index = state->indices[state->next_index];
+            while (state->pending_requests < domain_probe_concurrency &&
+                   state->next_index < state->indices.size()) {
+                const int index = state->indices[state->next_index++];
                 const std::string host = make_host(index);
 
                 client.set_host(host);
                 auto future = client.get("/", {}, {});
+                const int64_t started_ms = OPTIONX_TIMESTAMP_MS;
 
-                auto callback = [state, complete, launch_batch, index](
+                auto callback = [this, state, complete, launch_probes, index, started_ms](
                         kurlyk::HttpResponsePtr response) {
+                    --state->pending_requests;
+                    const bool healthy = response && response->ready && response->status_code == 200;
+                    // Late probes still feed the health table after a winner is chosen.
+                    if (healthy) {
+                        const int64_t now_ms = OPTIONX_TIMESTAMP_MS;
+                        m_domain_health.record_success(index, now_ms - started_ms, now_ms);
+                    } else {
+                        m_domain_health.record_failure(index);
+                    }
                     if (state->completed) return;
 
-                    if (response && response->ready && response->status_code == 200) {
+                    if (healthy) {
                         complete(true, index);
                         return;
                     }
@@ -833,20 +848,12 @@ namespace optionx::platforms::intrade_bar {
                     if (!response || !response->ready) {
                         LOGIT_ERROR("Domain check: response not ready or null.");
                     }
-
-                    --state->pending_requests;
-                    if (state->pending_requests == 0) {
-                        (*launch_batch)();
-                    }
+                    (*launch_probes)();
                 };
 
                 ++state->pending_requests;
                 add_http_request_task(std::move(future), std::move(callback));
             }
-
-            if (state->pending_requests == 0) {
-                (*launch_batch)();
-            }
         };
 
         if (state->indices.empty()) {
@@ -854,7 +861,7 @@ namespace optionx::platforms::intrade_bar {
             return;
         }
 
-        (*launch_batch)();
+        (*launch_probes)();
     }
     
     /// \brief Checks if the currently set host in the HTTP client is available.
@@ -1916,6 +1923,7 @@ namespace optionx::platforms::intrade_bar {
             std::string binance_interval;
             BarSequence sequence;
             std::size_t next_index = 0;
+            std::int64_t max_bars_per_request = 0;
             long last_status = BarHistoryApiResult::NO_HTTP_STATUS;
             bool use_binance = false;
             std::function<void(BarHistoryApiResult)> callback;
@@ -1926,9 +1934,17 @@ namespace optionx::platforms::intrade_bar {
         state->chunks = std::move(chunks);
         state->binance_interval = std::move(binance_interval);
         state->use_binance = use_binance;
+        state->max_bars_per_request = max_bars_per_request;
         state->sequence = make_empty_sequence(
             effective_request,
             use_binance ? BarPriceSource::LAST : effective_request.price_source);
+        // Only the first response is preallocated; long ranges grow per chunk,
+        // so a wide request cannot reserve memory for bars it never receives.
+        state->sequence.bars.reserve(bar_history_slot_count(
+            effective_request.from_ts,
+            effective_request.to_ts,
+            effective_request.timeframe,
+            max_bars_per_request));
         state->callback = std::move(callback);
 
         auto finish_success = [state]() {
@@ -1984,7 +2000,7 @@ namespace optionx::platforms::intrade_bar {
                     get_rate_limit(RateLimitType::FX_BAR_HISTORY));
             }
 
-            auto response_callback = [state, request_next](
+            auto response_callback = [state, request_next, chunk](
                     kurlyk::HttpResponsePtr response) {
                 if (!validate_response(response)) {
                     state->callback(BarHistoryApiResult::fail(
@@ -1994,15 +2010,25 @@ namespace optionx::platforms::intrade_bar {
                 }
 
                 state->last_status = response->status_code;
+                auto& bars = state->sequence.bars;
+                const auto needed = bars.size() + bar_history_slot_count(
+                    chunk.from_ts,
+                    chunk.to_ts,
+                    state->request.timeframe,
+                    state->max_bars_per_request);
+                if (needed > bars.capacity()) {
+                    bars.reserve(std::max(needed, bars.capacity() * 2));
+                }
                 try {
-                    auto chunk_sequence = state->use_binance
-                        ? parse_binance_klines_bar_history(response->content, state->request)
-                        : parse_fxhis_bar_history(response->content, state->request);
-                    auto& target = state->sequence.bars;
-                    target.insert(
-                        target.end(),
-                        std::make_move_iterator(chunk_sequence.bars.begin()),
-                        std::make_move_iterator(chunk_sequence.bars.end()));
+                    // Candles go straight into the shared, preallocated sequence.
+                    BarHistoryStreamParser parser(
+                        state->use_binance
+                            ? BarHistoryStreamParser::Format::BINANCE_KLINES
+                            : BarHistoryStreamParser::Format::FX_HISTORY,
+                        state->request,
+                        state->sequence);
+                    parser.feed(response->content);
+                    parser.finish();
                 } catch (const std::exception& ex) {
                     state->callback(BarHistoryApiResult::fail(
                         std::string("Failed to parse bar history: ") + ex.what(),
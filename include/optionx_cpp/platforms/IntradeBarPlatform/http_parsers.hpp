@@ -12,15 +12,18 @@
 #include <vector>
 #include <unordered_map>
 #include <sstream>
+#include <charconv>
 #include <cmath>
 #include <limits>
 #include <optional>
-#include <regex>
+#include <string_view>
+#include <system_error>
 #include <stdexcept>
 #include <utility>
 
 #include "utils/response_parse_utils.hpp"
 #include "ApiResponses.hpp"
+#include "BarHistoryUtils.hpp"
 #include "http_utils.hpp"
 
 namespace optionx::platforms::intrade_bar {
@@ -198,23 +201,100 @@ namespace optionx::platforms::intrade_bar {
 
     namespace detail {
 
+        /// \brief Forward-only cursor used by the hand-written history scanners.
+        struct TextScanner {
+            std::string_view text;
+            std::size_t pos = 0;
+
+            bool at_end() const noexcept {
+                return pos >= text.size();
+            }
+
+            void skip_spaces() noexcept {
+                while (pos < text.size() &&
+                       std::isspace(static_cast<unsigned char>(text[pos])) != 0) {
+                    ++pos;
+                }
+            }
+
+            bool consume(char ch) noexcept {
+                if (pos >= text.size() || text[pos] != ch) return false;
+                ++pos;
+                return true;
+            }
+
+            bool consume(std::string_view token) noexcept {
+                if (text.compare(pos, token.size(), token) != 0) return false;
+                pos += token.size();
+                return true;
+            }
+
+            /// \brief Reads between `min_digits` and `max_digits` decimal digits.
+            bool read_int(std::size_t min_digits, std::size_t max_digits, int& value) noexcept {
+                std::size_t count = 0;
+                int result = 0;
+                while (pos < text.size() && count < max_digits &&
+                       text[pos] >= '0' && text[pos] <= '9') {
+                    result = result * 10 + (text[pos] - '0');
+                    ++pos;
+                    ++count;
+                }
+                if (count < min_digits) return false;
+                if (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') return false;
+                value = result;
+                return true;
+            }
+
+            /// \brief Returns the run of decimal digits at the cursor.
+            std::string_view read_digits() noexcept {
+                const std::size_t start = pos;
+                while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') ++pos;
+                return text.substr(start, pos - start);
+            }
+        };
+
         inline std::optional<int64_t> parse_active_trade_close_time_ms(
-                const std::string& row,
+                std::string_view row,
                 int64_t trade_id) {
-            std::smatch match;
-            static const std::regex close_time_regex(
-                R"(setInterval\s*\(\s*showRemaining[^;]*'([0-9]+)'\s*\))");
-            if (std::regex_search(row, match, close_time_regex) && match.size() >= 2) {
-                if (auto close_time = utils::parse_i64_strict(match[1].str())) {
-                    return time_shield::sec_to_ms(*close_time);
+            // setInterval(showRemaining...'<close_time_sec>') within one statement.
+            for (std::size_t pos = row.find("setInterval"); pos != std::string_view::npos;
+                 pos = row.find("setInterval", pos + 1)) {
+                TextScanner scanner{row, pos + 11};
+                scanner.skip_spaces();
+                if (!scanner.consume('(')) continue;
+                scanner.skip_spaces();
+                if (!scanner.consume("showRemaining")) continue;
+
+                const std::size_t statement_end = std::min(row.find(';', scanner.pos), row.size());
+                const auto statement = row.substr(scanner.pos, statement_end - scanner.pos);
+                // The last quoted number closed by `)` wins, like a greedy `[^;]*`.
+                for (std::size_t quote = statement.rfind('\''); quote != std::string_view::npos;
+                     quote = quote == 0 ? std::string_view::npos : statement.rfind('\'', quote - 1)) {
+                    TextScanner tail{statement, quote + 1};
+                    const auto digits = tail.read_digits();
+                    if (digits.empty() || !tail.consume('\'')) continue;
+                    tail.skip_spaces();
+                    if (!tail.consume(')')) continue;
+                    if (auto close_time = utils::parse_i64_strict(digits)) {
+                        return time_shield::sec_to_ms(*close_time);
+                    }
+                    return std::nullopt;
                 }
-                return std::nullopt;
             }
 
-            const std::regex remaining_regex(
-                "time_time_" + std::to_string(trade_id) + R"(\s*=\s*([0-9]+)\s*(?:;|$))");
-            if (std::regex_search(row, match, remaining_regex) && match.size() >= 2) {
-                if (auto remaining_sec = utils::parse_i64_strict(match[1].str())) {
+            // time_time_<id> = <remaining_sec>; or at the end of the row.
+            const std::string key = "time_time_" + std::to_string(trade_id);
+            for (std::size_t pos = row.find(key); pos != std::string_view::npos;
+                 pos = row.find(key, pos + 1)) {
+                TextScanner scanner{row, pos + key.size()};
+                scanner.skip_spaces();
+                if (!scanner.consume('=')) continue;
+                scanner.skip_spaces();
+                const auto digits = scanner.read_digits();
+                if (digits.empty()) continue;
+                scanner.skip_spaces();
+                if (!scanner.at_end() && !scanner.consume(';')) continue;
+                if (auto remaining_sec = utils::parse_i64_strict(digits)) {
                     return OPTIONX_TIMESTAMP_MS + time_shield::sec_to_ms(*remaining_sec);
                 }
                 return std::nullopt;
@@ -266,19 +346,27 @@ namespace optionx::platforms::intrade_bar {
             return value;
         }
 
-        inline int history_month_from_name(std::string month) {
-            month = lower_ascii_copy(utils::trim_copy(month));
-            static const std::unordered_map<std::string, int> months = {
-                {"jan", 1}, {"feb", 2}, {"mar", 3}, {"apr", 4},
-                {"may", 5}, {"jun", 6}, {"jul", 7}, {"aug", 8},
-                {"sep", 9}, {"oct", 10}, {"nov", 11}, {"dec", 12}
+        inline int history_month_from_name(std::string_view month) {
+            month = utils::trim_view(month);
+            if (month.size() != 3) return 0;
+            static constexpr std::string_view months[] = {
+                "jan", "feb", "mar", "apr", "may", "jun",
+                "jul", "aug", "sep", "oct", "nov", "dec"
+            };
+            const char lower[3] = {
+                static_cast<char>(std::tolower(static_cast<unsigned char>(month[0]))),
+                static_cast<char>(std::tolower(static_cast<unsigned char>(month[1]))),
+                static_cast<char>(std::tolower(static_cast<unsigned char>(month[2])))
             };
-            const auto it = months.find(month);
-            return it == months.end() ? 0 : it->second;
+            const std::string_view key(lower, 3);
+            for (int i = 0; i < 12; ++i) {
+                if (months[i] == key) return i + 1;
+            }
+            return 0;
         }
 
-        inline std::optional<int64_t> parse_history_datetime_ms(const std::string& raw) {
-            std::smatch match;
+        /// \brief Parses `H:MM:SS, D Mon YY` or `H:MM:SS, D.M.YY` broker time.
+        inline std::optional<int64_t> parse_history_datetime_ms(std::string_view raw) {
             int hour = 0;
             int minute = 0;
             int second = 0;
@@ -286,41 +374,37 @@ namespace optionx::platforms::intrade_bar {
             int month = 0;
             int year = 0;
 
-            static const std::regex named_month(
-                R"(^\s*([0-9]{1,2}):([0-9]{2}):([0-9]{2}),\s*([0-9]{1,2})\s+([A-Za-z]{3})\s+([0-9]{2,4})\s*$)");
-            static const std::regex numeric_month(
-                R"(^\s*([0-9]{1,2}):([0-9]{2}):([0-9]{2}),\s*([0-9]{1,2})\.([0-9]{1,2})\.([0-9]{2,4})\s*$)");
-
-            if (std::regex_match(raw, match, named_month) && match.size() == 7) {
-                auto parsed_hour = utils::parse_int_strict(match[1].str());
-                auto parsed_minute = utils::parse_int_strict(match[2].str());
-                auto parsed_second = utils::parse_int_strict(match[3].str());
-                auto parsed_day = utils::parse_int_strict(match[4].str());
-                auto parsed_year = utils::parse_int_strict(match[6].str());
-                if (!parsed_hour || !parsed_minute || !parsed_second || !parsed_day || !parsed_year) return std::nullopt;
-                hour = *parsed_hour;
-                minute = *parsed_minute;
-                second = *parsed_second;
-                day = *parsed_day;
-                month = history_month_from_name(match[5].str());
-                year = *parsed_year;
-            } else if (std::regex_match(raw, match, numeric_month) && match.size() == 7) {
-                auto parsed_hour = utils::parse_int_strict(match[1].str());
-                auto parsed_minute = utils::parse_int_strict(match[2].str());
-                auto parsed_second = utils::parse_int_strict(match[3].str());
-                auto parsed_day = utils::parse_int_strict(match[4].str());
-                auto parsed_month = utils::parse_int_strict(match[5].str());
-                auto parsed_year = utils::parse_int_strict(match[6].str());
-                if (!parsed_hour || !parsed_minute || !parsed_second || !parsed_day || !parsed_month || !parsed_year) return std::nullopt;
-                hour = *parsed_hour;
-                minute = *parsed_minute;
-                second = *parsed_second;
-                day = *parsed_day;
-                month = *parsed_month;
-                year = *parsed_year;
-            } else {
+            TextScanner scanner{utils::trim_view(raw)};
+            if (!scanner.read_int(1, 2, hour) || !scanner.consume(':') ||
+                !scanner.read_int(2, 2, minute) || !scanner.consume(':') ||
+                !scanner.read_int(2, 2, second) || !scanner.consume(',')) {
                 return std::nullopt;
             }
+            scanner.skip_spaces();
+            if (!scanner.read_int(1, 2, day)) return std::nullopt;
+
+            if (scanner.consume('.')) {
+                if (!scanner.read_int(1, 2, month) || !scanner.consume('.')) {
+                    return std::nullopt;
+                }
+            } else {
+                const std::size_t spaces_start = scanner.pos;
+                scanner.skip_spaces();
+                if (scanner.pos == spaces_start) return std::nullopt;
+
+                const std::size_t name_start = scanner.pos;
+                while (scanner.pos < scanner.text.size() &&
+                       std::isalpha(static_cast<unsigned char>(scanner.text[scanner.pos])) != 0) {
+                    ++scanner.pos;
+                }
+                if (scanner.pos - name_start != 3) return std::nullopt;
+                month = history_month_from_name(scanner.text.substr(name_start, 3));
+
+                const std::size_t year_start = scanner.pos;
+                scanner.skip_spaces();
+                if (scanner.pos == year_start) return std::nullopt;
+            }
+            if (!scanner.read_int(2, 4, year) || !scanner.at_end()) return std::nullopt;
 
             if (year < 100) year += 2000;
             if (month < 1 || month > 12 || day < 1 || day > 31 ||
@@ -333,59 +417,66 @@ namespace optionx::platforms::intrade_bar {
             return time_shield::sec_to_ms(timestamp_sec);
         }
 
-        inline std::optional<HistoryMoney> parse_history_money(std::string raw) {
-            raw = utils::trim_copy(raw);
-            std::replace(raw.begin(), raw.end(), ',', '.');
+        /// \brief Parses an amount such as `1 000,50 $` or `-15.00 RUB`.
+        inline std::optional<HistoryMoney> parse_history_money(std::string_view raw) {
+            raw = utils::trim_view(raw);
 
             CurrencyType currency = CurrencyType::UNKNOWN;
-            static const std::string rub_sign_utf8 = "\xE2\x82\xBD";
-            if (raw.find("USD") != std::string::npos || raw.find('$') != std::string::npos) {
+            static constexpr std::string_view rub_sign_utf8 = "\xE2\x82\xBD";
+            if (raw.find("USD") != std::string_view::npos || raw.find('$') != std::string_view::npos) {
                 currency = CurrencyType::USD;
-            } else if (raw.find(rub_sign_utf8) != std::string::npos) {
+            } else if (raw.find(rub_sign_utf8) != std::string_view::npos) {
                 currency = CurrencyType::RUB;
-            } else if (raw.find("RUB") != std::string::npos) {
+            } else if (raw.find("RUB") != std::string_view::npos) {
                 currency = CurrencyType::RUB;
             }
 
-            std::smatch match;
-            static const std::regex number_regex(R"([-+]?[0-9]+(?:\.[0-9]+)?)");
-            if (!std::regex_search(raw, match, number_regex) || match.empty()) {
-                return std::nullopt;
+            const auto is_digit = [&](std::size_t i) {
+                return i < raw.size() && raw[i] >= '0' && raw[i] <= '9';
+            };
+
+            // Leftmost [-+]?[0-9]+([.,][0-9]+)?, with ',' read as the decimal point.
+            std::size_t start = 0;
+            while (start < raw.size() &&
+                   !is_digit(start) &&
+                   !((raw[start] == '-' || raw[start] == '+') && is_digit(start + 1))) {
+                ++start;
             }
-            auto amount = utils::parse_double_strict(match[0].str());
-            if (!amount) return std::nullopt;
-            return HistoryMoney{*amount, currency};
-        }
+            if (start >= raw.size()) return std::nullopt;
 
-        inline void replace_all_inplace(
-                std::string& value,
-                const std::string& from,
-                const std::string& to) {
-            if (from.empty()) return;
-            std::size_t pos = 0;
-            while ((pos = value.find(from, pos)) != std::string::npos) {
-                value.replace(pos, from.size(), to);
-                pos += to.size();
+            std::size_t end = start + 1;
+            while (is_digit(end)) ++end;
+            std::size_t point = std::string_view::npos;
+            if (end < raw.size() && (raw[end] == '.' || raw[end] == ',') && is_digit(end + 1)) {
+                point = end - start;
+                end += 2;
+                while (is_digit(end)) ++end;
             }
+
+            std::string number(raw.substr(start, end - start));
+            if (point != std::string_view::npos) number[point] = '.';
+            auto amount = utils::parse_double_strict(number);
+            if (!amount) return std::nullopt;
+            return HistoryMoney{*amount, currency};
         }
 
-        inline std::string html_block_from_element_id(
-                const std::string& content,
-                const std::string& tag_name,
-                const std::string& element_id) {
-            const std::string open_tag = "<" + tag_name;
-            const std::string close_tag = "</" + tag_name + ">";
+        inline std::string_view html_block_from_element_id(
+                std::string_view content,
+                std::string_view tag_name,
+                std::string_view element_id) {
+            const std::string open_tag = "<" + std::string(tag_name);
+            const std::string close_tag = "</" + std::string(tag_name) + ">";
 
             std::size_t pos = 0;
-            while ((pos = content.find(open_tag, pos)) != std::string::npos) {
+            while ((pos = content.find(open_tag, pos)) != std::string_view::npos) {
                 const std::size_t tag_end = content.find('>', pos + open_tag.size());
-                if (tag_end == std::string::npos) break;
+                if (tag_end == std::string_view::npos) break;
 
-                const std::string tag_html = content.substr(pos, tag_end - pos + 1);
-                if (auto id = utils::extract_html_attr(tag_html, "id")) {
+                const auto tag_html = content.substr(pos, tag_end - pos + 1);
+                if (auto id = utils::extract_html_attr_view(tag_html, "id")) {
                     if (*id == element_id) {
                         const std::size_t block_end = content.find(close_tag, tag_end + 1);
-                        if (block_end == std::string::npos) {
+                        if (block_end == std::string_view::npos) {
                             return content.substr(pos);
                         }
                         return content.substr(pos, block_end + close_tag.size() - pos);
@@ -397,24 +488,24 @@ namespace optionx::platforms::intrade_bar {
             return {};
         }
 
-        inline std::string html_block_from_marker(
-                const std::string& content,
-                const std::string& marker) {
+        inline std::string_view html_block_from_marker(
+                std::string_view content,
+                std::string_view marker) {
             const std::size_t marker_pos = content.find(marker);
-            if (marker_pos == std::string::npos) return {};
+            if (marker_pos == std::string_view::npos) return {};
 
             std::size_t block_start = content.rfind("<tbody", marker_pos);
-            if (block_start == std::string::npos) {
+            if (block_start == std::string_view::npos) {
                 block_start = content.rfind("<table", marker_pos);
             }
-            if (block_start == std::string::npos) block_start = marker_pos;
+            if (block_start == std::string_view::npos) block_start = marker_pos;
 
             std::size_t block_end = content.find("</tbody>", marker_pos);
-            if (block_end != std::string::npos) {
+            if (block_end != std::string_view::npos) {
                 block_end += 8;
             } else {
                 block_end = content.find("</table>", marker_pos);
-                if (block_end != std::string::npos) {
+                if (block_end != std::string_view::npos) {
                     block_end += 8;
                 } else {
                     block_end = content.size();
@@ -423,8 +514,9 @@ namespace optionx::platforms::intrade_bar {
             return content.substr(block_start, block_end - block_start);
         }
 
-        inline std::string history_block_from_html(const std::string& content) {
-            std::string block = html_block_from_element_id(content, "tbody", "trade_close");
+        /// \brief Returns a view of the closed-trade rows inside `content`.
+        inline std::string_view history_block_from_html(std::string_view content) {
+            std::string_view block = html_block_from_element_id(content, "tbody", "trade_close");
             if (!block.empty()) return block;
 
             block = html_block_from_element_id(content, "tbody", "trade_history");
@@ -437,41 +529,63 @@ namespace optionx::platforms::intrade_bar {
             if (!block.empty()) return block;
 
             // trade_load_more2.php may return plain closed-trade rows plus a script.
-            return content.find("<tr") == std::string::npos ? std::string() : content;
+            return content.find("<tr") == std::string_view::npos ? std::string_view() : content;
         }
 
-        inline std::optional<int64_t> parse_first_i64_from_string(const std::string& value) {
-            std::smatch match;
-            static const std::regex number_regex(R"([0-9]+)");
-            if (!std::regex_search(value, match, number_regex) || match.empty()) {
-                return std::nullopt;
+        inline std::optional<int64_t> parse_first_i64_from_string(std::string_view value) {
+            TextScanner scanner{value};
+            while (!scanner.at_end() && (value[scanner.pos] < '0' || value[scanner.pos] > '9')) {
+                ++scanner.pos;
             }
-            return utils::parse_i64_strict(match[0].str());
+            const auto digits = scanner.read_digits();
+            if (digits.empty()) return std::nullopt;
+            return utils::parse_i64_strict(digits);
         }
 
         inline std::optional<std::string> parse_history_next_last(
-                const std::string& content) {
-            if (auto attr = utils::extract_html_attr(content, "data-last")) {
-                return utils::trim_copy(*attr);
+                std::string_view content) {
+            if (auto attr = utils::extract_html_attr_view(content, "data-last")) {
+                return std::string(utils::trim_view(*attr));
             }
 
-            std::smatch match;
-            static const std::regex script_data_last(
-                R"(attr\s*\(\s*['"]data-last['"]\s*,\s*['"]([^'"]*)['"]\s*\))");
-            if (std::regex_search(content, match, script_data_last) && match.size() >= 2) {
-                return utils::trim_copy(match[1].str());
+            // Script form: attr('data-last', '<cursor>')
+            const auto consume_quote = [](TextScanner& scanner) {
+                return scanner.consume('\'') || scanner.consume('"');
+            };
+            for (std::size_t pos = content.find("attr"); pos != std::string_view::npos;
+                 pos = content.find("attr", pos + 1)) {
+                TextScanner scanner{content, pos + 4};
+                scanner.skip_spaces();
+                if (!scanner.consume('(')) continue;
+                scanner.skip_spaces();
+                if (!consume_quote(scanner) || !scanner.consume("data-last") ||
+                    !consume_quote(scanner)) {
+                    continue;
+                }
+                scanner.skip_spaces();
+                if (!scanner.consume(',')) continue;
+                scanner.skip_spaces();
+                if (!consume_quote(scanner)) continue;
+
+                const std::size_t value_end = content.find_first_of("'\"", scanner.pos);
+                if (value_end == std::string_view::npos) continue;
+                const auto value = content.substr(scanner.pos, value_end - scanner.pos);
+                scanner.pos = value_end + 1;
+                scanner.skip_spaces();
+                if (!scanner.consume(')')) continue;
+                return std::string(utils::trim_view(value));
             }
             return std::nullopt;
         }
 
-        inline std::optional<int64_t> parse_history_row_option_id(const std::string& row) {
+        inline std::optional<int64_t> parse_history_row_option_id(std::string_view row) {
             if (auto id = utils::parse_i64_attr(row, "data-id"); id && *id > 0) {
                 return id;
             }
             if (auto id = utils::parse_i64_attr(row, "data-trade-id"); id && *id > 0) {
                 return id;
             }
-            if (auto row_id = utils::extract_html_attr(row, "id")) {
+            if (auto row_id = utils::extract_html_attr_view(row, "id")) {
                 if (row_id->rfind("trade_inv_", 0) == 0) {
                     return parse_first_i64_from_string(*row_id);
                 }
@@ -479,7 +593,7 @@ namespace optionx::platforms::intrade_bar {
             return std::nullopt;
         }
 
-        inline std::optional<int64_t> parse_history_row_time_ms(const std::string& row) {
+        inline std::optional<int64_t> parse_history_row_time_ms(std::string_view row) {
             const char* attr_names[] = {
                 "data-timeopen",
                 "data-open-time",
@@ -494,7 +608,7 @@ namespace optionx::platforms::intrade_bar {
             return std::nullopt;
         }
 
-        inline std::optional<int64_t> parse_history_row_close_time_ms(const std::string& row) {
+        inline std::optional<int64_t> parse_history_row_close_time_ms(std::string_view row) {
             const char* attr_names[] = {
                 "data-timeclose",
                 "data-close-time",
@@ -509,21 +623,22 @@ namespace optionx::platforms::intrade_bar {
             return std::nullopt;
         }
 
-        inline std::vector<std::string> extract_tag_contents(
-                const std::string& html,
-                const std::string& tag_name) {
-            std::vector<std::string> cells;
-            const std::string open_tag = "<" + tag_name;
-            const std::string close_tag = "</" + tag_name + ">";
+        /// \brief Returns views of the contents of every `<tag_name ...>...</tag_name>` in `html`.
+        inline std::vector<std::string_view> extract_tag_contents(
+                std::string_view html,
+                std::string_view tag_name) {
+            std::vector<std::string_view> cells;
+            const std::string open_tag = "<" + std::string(tag_name);
+            const std::string close_tag = "</" + std::string(tag_name) + ">";
 
             std::size_t pos = 0;
-            while ((pos = html.find(open_tag, pos)) != std::string::npos) {
+            while ((pos = html.find(open_tag, pos)) != std::string_view::npos) {
                 const std::size_t tag_end = html.find('>', pos + open_tag.size());
-                if (tag_end == std::string::npos) break;
+                if (tag_end == std::string_view::npos) break;
 
                 const std::size_t content_start = tag_end + 1;
                 const std::size_t content_end = html.find(close_tag, content_start);
-                if (content_end == std::string::npos) break;
+                if (content_end == std::string_view::npos) break;
 
                 cells.push_back(html.substr(content_start, content_end - content_start));
                 pos = content_end + close_tag.size();
@@ -532,43 +647,84 @@ namespace optionx::platforms::intrade_bar {
             return cells;
         }
 
-        inline std::string strip_html_tags(const std::string& html) {
-            std::string text;
-            text.reserve(html.size());
+        /// \brief Returns the length of a `<br>`, `<br/>` or `< BR / >` tag at `pos`, or 0.
+        inline std::size_t html_line_break_length(std::string_view html, std::size_t pos) noexcept {
+            TextScanner scanner{html, pos};
+            if (!scanner.consume('<')) return 0;
+            scanner.skip_spaces();
+            if (scanner.pos + 2 > html.size() ||
+                (html[scanner.pos] != 'b' && html[scanner.pos] != 'B') ||
+                (html[scanner.pos + 1] != 'r' && html[scanner.pos + 1] != 'R')) {
+                return 0;
+            }
+            scanner.pos += 2;
+            scanner.skip_spaces();
+            scanner.consume('/');
+            scanner.skip_spaces();
+            if (!scanner.consume('>')) return 0;
+            return scanner.pos - pos;
+        }
+
+        /// \brief Splits a table cell into trimmed text lines in one pass.
+        /// \details Lines break at `<br>` tags and raw newlines; other tags are
+        ///          dropped and the entities used by the broker are decoded.
+        inline std::vector<std::string> html_cell_lines(std::string_view cell_html) {
+            struct Entity {
+                std::string_view name;
+                std::string_view text;
+            };
+            static constexpr Entity entities[] = {
+                {"&nbsp;", " "},
+                {"&#160;", " "},
+                {"&amp;", "&"},
+                {"&#36;", "$"},
+                {"&#8381;", "\xE2\x82\xBD"}
+            };
+
+            std::vector<std::string> lines;
+            std::string line;
+            const auto flush_line = [&]() {
+                const auto text = utils::trim_view(line);
+                if (!text.empty()) lines.emplace_back(text);
+                line.clear();
+            };
 
             bool in_tag = false;
-            for (char ch : html) {
+            for (std::size_t i = 0; i < cell_html.size(); ++i) {
+                const char ch = cell_html[i];
+                if (in_tag) {
+                    if (ch == '>') in_tag = false;
+                    continue;
+                }
                 if (ch == '<') {
-                    in_tag = true;
+                    if (const std::size_t length = html_line_break_length(cell_html, i)) {
+                        flush_line();
+                        i += length - 1;
+                    } else {
+                        in_tag = true;
+                    }
                     continue;
                 }
-                if (ch == '>') {
-                    in_tag = false;
+                if (ch == '>') continue;
+                if (ch == '\n') {
+                    flush_line();
                     continue;
                 }
-                if (!in_tag) text.push_back(ch);
-            }
-
-            replace_all_inplace(text, "&nbsp;", " ");
-            replace_all_inplace(text, "&#160;", " ");
-            replace_all_inplace(text, "&amp;", "&");
-            replace_all_inplace(text, "&#36;", "$");
-            replace_all_inplace(text, "&#8381;", "\xE2\x82\xBD");
-            return text;
-        }
-
-        inline std::vector<std::string> html_cell_lines(std::string cell_html) {
-            static const std::regex br_regex(R"(<\s*br\s*/?\s*>)", std::regex_constants::icase);
-            cell_html = std::regex_replace(cell_html, br_regex, "\n");
-
-            const std::string text = strip_html_tags(cell_html);
-            std::vector<std::string> lines;
-            std::istringstream stream(text);
-            std::string line;
-            while (std::getline(stream, line)) {
-                line = utils::trim_copy(line);
-                if (!line.empty()) lines.push_back(std::move(line));
+                if (ch == '&') {
+                    bool decoded = false;
+                    for (const auto& entity : entities) {
+                        if (cell_html.compare(i, entity.name.size(), entity.name) == 0) {
+                            line.append(entity.text);
+                            i += entity.name.size() - 1;
+                            decoded = true;
+                            break;
+                        }
+                    }
+                    if (decoded) continue;
+                }
+                line.push_back(ch);
             }
+            flush_line();
             return lines;
         }
 
@@ -604,15 +760,15 @@ namespace optionx::platforms::intrade_bar {
         }
 
         inline std::optional<TradeRecord> parse_history_attr_row(
-                const std::string& row,
+                std::string_view row,
                 AccountType account_type) {
             auto option_id = parse_history_row_option_id(row);
             if (!option_id || *option_id <= 0) return std::nullopt;
 
             TradeRecord record;
             record.option_id = *option_id;
-            if (auto symbol = utils::extract_html_attr(row, "data-option")) {
-                record.symbol = normalize_symbol_name(*symbol);
+            if (auto symbol = utils::extract_html_attr_view(row, "data-option")) {
+                record.symbol = normalize_symbol_name(std::string(*symbol));
             }
             if (auto open_price = utils::parse_double_attr(row, "data-rate")) {
                 record.open_price = *open_price;
@@ -644,7 +800,7 @@ namespace optionx::platforms::intrade_bar {
         }
 
         inline std::optional<TradeRecord> parse_trade_close_table_row(
-                const std::string& row,
+                std::string_view row,
                 AccountType account_type) {
             const auto cells = extract_tag_contents(row, "th");
             if (cells.size() < 4) return std::nullopt;
@@ -685,9 +841,9 @@ namespace optionx::platforms::intrade_bar {
             if (record.currency == CurrencyType::UNKNOWN) {
                 record.currency = gross_result->currency;
             }
-            if (row.find("trading-table__up-td") != std::string::npos) {
+            if (row.find("trading-table__up-td") != std::string_view::npos) {
                 record.order_type = OrderType::BUY;
-            } else if (row.find("trading-table__down-td") != std::string::npos) {
+            } else if (row.find("trading-table__down-td") != std::string_view::npos) {
                 record.order_type = OrderType::SELL;
             }
             record.account_type = account_type;
@@ -731,16 +887,16 @@ namespace optionx::platforms::intrade_bar {
             page.next_last = *next_last;
         }
 
-        const std::string history_html = detail::history_block_from_html(content);
+        const std::string_view history_html = detail::history_block_from_html(content);
         if (history_html.empty()) return page;
 
         std::size_t pos = 0;
         for (;;) {
             const std::size_t row_start = history_html.find("<tr", pos);
-            if (row_start == std::string::npos) break;
+            if (row_start == std::string_view::npos) break;
             const std::size_t row_end = history_html.find("</tr>", row_start);
-            if (row_end == std::string::npos) break;
-            const std::string row = history_html.substr(row_start, row_end - row_start);
+            if (row_end == std::string_view::npos) break;
+            const std::string_view row = history_html.substr(row_start, row_end - row_start);
             pos = row_end + 5;
 
             if (auto trade = detail::parse_history_attr_row(row, account_type)) {
@@ -890,7 +1046,6 @@ namespace optionx::platforms::intrade_bar {
     inline std::vector<ActiveTradeInfo> parse_active_trades_snapshot(const std::string& content) {
         std::vector<ActiveTradeInfo> trades;
 
-        std::string active_html;
         const std::size_t active_id = content.find("id=\"trade_active\"");
         if (active_id == std::string::npos) {
             throw std::runtime_error("Authenticated active trades block not found.");
@@ -899,12 +1054,13 @@ namespace optionx::platforms::intrade_bar {
         if (block_start == std::string::npos) block_start = active_id;
         std::size_t block_end = content.find("</tbody>", active_id);
         if (block_end == std::string::npos) block_end = content.size();
-        active_html = content.substr(block_start, block_end - block_start);
+        const std::string_view active_html =
+            std::string_view(content).substr(block_start, block_end - block_start);
 
         std::size_t pos = 0;
         for (;;) {
             const std::size_t row_start = active_html.find("<tr", pos);
-            if (row_start == std::string::npos) break;
+            if (row_start == std::string_view::npos) break;
             if (row_start + 3 < active_html.size()) {
                 const unsigned char after_tr = static_cast<unsigned char>(active_html[row_start + 3]);
                 if (std::isspace(after_tr) == 0 &&
@@ -916,11 +1072,11 @@ namespace optionx::platforms::intrade_bar {
             }
 
             const std::size_t row_end = active_html.find("</tr>", row_start);
-            if (row_end == std::string::npos) break;
-            const std::string row = active_html.substr(row_start, row_end - row_start);
+            if (row_end == std::string_view::npos) break;
+            const std::string_view row = active_html.substr(row_start, row_end - row_start);
             pos = row_end + 5;
 
-            auto row_id = utils::extract_html_attr(row, "id");
+            auto row_id = utils::extract_html_attr_view(row, "id");
             if (!row_id || row_id->rfind("trade_inv_", 0) != 0) continue;
 
             auto id = utils::parse_i64_attr(row, "data-id");
@@ -928,8 +1084,8 @@ namespace optionx::platforms::intrade_bar {
 
             ActiveTradeInfo trade;
             trade.id = *id;
-            if (auto symbol = utils::extract_html_attr(row, "data-option")) {
-                trade.symbol = *symbol;
+            if (auto symbol = utils::extract_html_attr_view(row, "data-option")) {
+                trade.symbol = std::string(*symbol);
             }
             if (auto open_price = utils::parse_double_attr(row, "data-rate")) {
                 trade.open_price = *open_price;
@@ -1350,72 +1506,475 @@ namespace optionx::platforms::intrade_bar {
             return sequence;
         }
 
+        /// \brief Strips surrounding quotes from a JSON scalar token.
+        inline std::string_view unquote_bar_history_token(std::string_view token) noexcept {
+            if (token.size() >= 2 && token.front() == '"' && token.back() == '"') {
+                return token.substr(1, token.size() - 2);
+            }
+            return token;
+        }
+
+        /// \brief Parses a bare or string-encoded JSON decimal without allocating.
+        inline bool parse_bar_history_double(std::string_view token, double& value) noexcept {
+            token = unquote_bar_history_token(token);
+            if (token.empty()) return false;
+            if (token.front() == '+') token.remove_prefix(1);
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+            const char* last = token.data() + token.size();
+            const auto result = std::from_chars(token.data(), last, value);
+            if (result.ec != std::errc() || result.ptr != last) return false;
+#else
+            // Floating-point from_chars is unavailable; strtod needs a terminator.
+            char buffer[64];
+            if (token.size() >= sizeof(buffer)) return false;
+            std::copy(token.begin(), token.end(), buffer);
+            buffer[token.size()] = '\0';
+            char* end = nullptr;
+            value = std::strtod(buffer, &end);
+            if (end != buffer + token.size()) return false;
+#endif
+            return std::isfinite(value);
+        }
+
+        /// \brief Parses a bare or string-encoded JSON integer; decimals are truncated.
+        inline bool parse_bar_history_int64(std::string_view token, std::int64_t& value) noexcept {
+            token = unquote_bar_history_token(token);
+            if (token.empty()) return false;
+            const char* last = token.data() + token.size();
+            const auto result = std::from_chars(token.data(), last, value);
+            if (result.ec == std::errc() && result.ptr == last) return true;
+
+            double real = 0.0;
+            if (!parse_bar_history_double(token, real) ||
+                real < static_cast<double>((std::numeric_limits<std::int64_t>::min)()) ||
+                real > static_cast<double>((std::numeric_limits<std::int64_t>::max)())) {
+                return false;
+            }
+            value = static_cast<std::int64_t>(real);
+            return true;
+        }
+
     } // namespace detail
 
-    /// \brief Parses the Intrade `/fxhis` response into a normalized bar sequence.
-    /// \param content Raw JSON response body.
-    /// \param request Original bar history request.
-    /// \return Parsed bar sequence using the requested BID/ASK/MID price stream.
-    /// \throws std::runtime_error When the payload is malformed or broker rejected the request.
-    inline BarSequence parse_fxhis_bar_history(
-            const std::string& content,
-            const BarHistoryRequest& request) {
-        if (request.price_source == BarPriceSource::UNKNOWN ||
-            request.price_source == BarPriceSource::LAST) {
-            throw std::runtime_error("Intrade FX history supports only BID, ASK, or MID bars.");
+    /// \class BarHistoryStreamParser
+    /// \brief Incremental parser for Intrade `/fxhis` and Binance kline bodies.
+    /// \details The body may be fed in arbitrary chunks. Each candle is decoded
+    ///          as soon as its closing bracket arrives and appended to the target
+    ///          sequence, so only the current candle is buffered.
+    class BarHistoryStreamParser {
+    public:
+        /// \brief Response layout handled by the parser.
+        enum class Format {
+            FX_HISTORY,    ///< `{"response":{...},"candles":[[ts,bid...,ask...,volume],...]}`
+            BINANCE_KLINES ///< `[[open_time,"open","high","low","close","volume",...],...]`
+        };
+
+        /// \brief Creates a parser that appends bars to `target`.
+        /// \param format Response layout.
+        /// \param request Bar history request; selects the FX price stream.
+        /// \param target Destination sequence; its metadata is left untouched.
+        /// \throws std::runtime_error When the request price source is unsupported by the format.
+        BarHistoryStreamParser(
+                Format format,
+                const BarHistoryRequest& request,
+                BarSequence& target)
+            : m_format(format),
+              m_price_source(request.price_source),
+              m_target(target) {
+            if (m_format == Format::FX_HISTORY) {
+                if (m_price_source == BarPriceSource::UNKNOWN ||
+                    m_price_source == BarPriceSource::LAST) {
+                    throw std::runtime_error("Intrade FX history supports only BID, ASK, or MID bars.");
+                }
+                m_price_type = market_price_type_from_bar_price_source(m_price_source);
+                m_rows_depth = 2;
+            } else {
+                if (m_price_source == BarPriceSource::BID ||
+                    m_price_source == BarPriceSource::ASK) {
+                    throw std::runtime_error("Binance kline history does not provide bid/ask bars.");
+                }
+                m_price_type = MarketPriceType::LAST;
+                m_rows_depth = 1;
+            }
+        }
+
+        /// \brief Consumes the next part of the response body.
+        /// \throws std::runtime_error When the payload is malformed.
+        void feed(std::string_view chunk) {
+            for (const char ch : chunk) {
+                consume(ch);
+            }
+        }
+
+        /// \brief Validates the end of the body and the broker status.
+        /// \throws std::runtime_error When the body is truncated or the broker rejected the request.
+        void finish() {
+            if (!m_started) {
+                throw std::runtime_error(m_format == Format::FX_HISTORY
+                    ? "Intrade FX history response is empty."
+                    : "Binance kline response is empty.");
+            }
+            if (!m_done || m_in_string) {
+                throw std::runtime_error(m_format == Format::FX_HISTORY
+                    ? "Intrade FX history response is truncated."
+                    : "Binance kline response is truncated.");
+            }
+            if (m_format != Format::FX_HISTORY) return;
+
+            if (!m_response.empty()) {
+                const auto response = nlohmann::json::parse(m_response);
+                if (response.is_object()) {
+                    const bool executed = response.value("executed", false);
+                    const std::string error = response.value("error", std::string());
+                    if (!executed || !error.empty()) {
+                        throw std::runtime_error(
+                            error.empty()
+                                ? "Intrade FX history request was rejected."
+                                : "Intrade FX history request was rejected: " + error);
+                    }
+                }
+            }
+            if (!m_candles_seen) {
+                throw std::runtime_error("Intrade FX history response does not contain a candles array.");
+            }
+        }
+
+        /// \brief Returns the number of bars appended so far.
+        std::size_t bars_parsed() const noexcept {
+            return m_bars_parsed;
+        }
+
+    private:
+        Format m_format;
+        BarPriceSource m_price_source;
+        MarketPriceType m_price_type = MarketPriceType::UNKNOWN;
+        BarSequence& m_target;
+        std::size_t m_rows_depth = 1;     ///< Container depth of the array holding candles.
+        std::size_t m_bars_parsed = 0;
+
+        std::string m_stack;              ///< Open containers, `{` or `[`.
+        std::string m_key;                ///< Last top-level key of the FX object.
+        std::string m_response;           ///< Raw FX `response` value.
+        std::string m_row;                ///< Text of the candle being read.
+        bool m_started = false;
+        bool m_done = false;
+        bool m_in_string = false;
+        bool m_escape = false;
+        bool m_reading_key = false;
+        bool m_expect_key = false;
+        bool m_value_pending = false;
+        bool m_capture_response = false;
+        bool m_in_rows = false;
+        bool m_in_row = false;
+        bool m_expect_row = false;
+        bool m_row_seen = false;
+        bool m_candles_seen = false;
+
+        static bool is_space(char ch) noexcept {
+            return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r';
         }
 
-        const auto j = nlohmann::json::parse(content);
-        if (j.contains("response") && j["response"].is_object()) {
-            const auto& response = j["response"];
-            const bool executed = response.value("executed", false);
-            const std::string error = response.value("error", std::string());
-            if (!executed || !error.empty()) {
+        [[noreturn]] void throw_malformed_row() const {
+            throw std::runtime_error(m_format == Format::FX_HISTORY
+                ? "Malformed Intrade FX history candle."
+                : "Malformed Binance kline entry.");
+        }
+
+        [[noreturn]] void throw_malformed_body() const {
+            throw std::runtime_error(m_format == Format::FX_HISTORY
+                ? "Malformed Intrade FX history response."
+                : "Malformed Binance kline response.");
+        }
+
+        void consume(char ch) {
+            if (m_in_string) {
+                consume_string_char(ch);
+                return;
+            }
+            if (is_space(ch)) {
+                if (m_capture_response) m_response.push_back(ch);
+                return;
+            }
+            if (m_done) throw_malformed_body();
+
+            if (m_in_row) {
+                consume_row_char(ch);
+                return;
+            }
+            if (!m_started) {
+                start_body(ch);
+                return;
+            }
+            if (m_in_rows && m_stack.size() == m_rows_depth) {
+                consume_rows_char(ch);
+                return;
+            }
+            if (m_format == Format::FX_HISTORY && m_stack.size() == 1) {
+                consume_object_char(ch);
+                return;
+            }
+            consume_nested_char(ch);
+        }
+
+        void consume_string_char(char ch) {
+            if (m_in_row) m_row.push_back(ch);
+            if (m_capture_response) m_response.push_back(ch);
+            if (m_escape) {
+                m_escape = false;
+            } else if (ch == '\\') {
+                m_escape = true;
+            } else if (ch == '"') {
+                m_in_string = false;
+                m_reading_key = false;
+                return;
+            }
+            if (m_reading_key) m_key.push_back(ch);
+        }
+
+        void start_body(char ch) {
+            m_started = true;
+            if (m_format == Format::FX_HISTORY) {
+                if (ch != '{') {
+                    throw std::runtime_error("Intrade FX history response is not a JSON object.");
+                }
+                m_expect_key = true;
+            } else {
+                if (ch != '[') {
+                    throw std::runtime_error("Binance kline response is not an array.");
+                }
+                open_rows();
+            }
+            m_stack.push_back(ch);
+        }
+
+        void open_rows() {
+            m_in_rows = true;
+            m_expect_row = true;
+            m_row_seen = false;
+        }
+
+        void consume_rows_char(char ch) {
+            if (ch == '[' && m_expect_row) {
+                m_stack.push_back(ch);
+                m_in_row = true;
+                m_expect_row = false;
+                m_row_seen = true;
+                m_row.clear();
+                return;
+            }
+            if (ch == ',' && !m_expect_row) {
+                m_expect_row = true;
+                return;
+            }
+            if (ch == ']' && (!m_expect_row || !m_row_seen)) {
+                m_stack.pop_back();
+                m_in_rows = false;
+                if (m_stack.empty()) m_done = true;
+                return;
+            }
+            throw_malformed_row();
+        }
+
+        void consume_row_char(char ch) {
+            if (ch == '[' || ch == '{') throw_malformed_row();
+            if (ch == ']') {
+                m_stack.pop_back();
+                m_in_row = false;
+                decode_row();
+                return;
+            }
+            if (ch == '"') m_in_string = true;
+            m_row.push_back(ch);
+        }
+
+        void consume_object_char(char ch) {
+            if (m_expect_key) {
+                if (ch == '"') {
+                    m_key.clear();
+                    m_in_string = true;
+                    m_reading_key = true;
+                    m_expect_key = false;
+                    return;
+                }
+                if (ch == '}' && m_key.empty()) {
+                    close_object();
+                    return;
+                }
+                throw_malformed_body();
+            }
+            if (ch == ':' && !m_value_pending) {
+                m_value_pending = true;
+                return;
+            }
+            if (m_value_pending) {
+                m_value_pending = false;
+                start_value(ch);
+                return;
+            }
+            if (ch == ',') {
+                m_capture_response = false;
+                m_expect_key = true;
+                return;
+            }
+            if (ch == '}') {
+                m_capture_response = false;
+                close_object();
+                return;
+            }
+            // Continuation of a bare top-level scalar such as `true` or `123`.
+            if (m_capture_response) m_response.push_back(ch);
+        }
+
+        void close_object() {
+            m_stack.pop_back();
+            m_done = true;
+        }
+
+        void start_value(char ch) {
+            if (m_key == "candles" && ch == '[') {
+                m_stack.push_back(ch);
+                m_candles_seen = true;
+                open_rows();
+                return;
+            }
+            if (m_key == "response") {
+                m_response.clear();
+                m_capture_response = true;
+            }
+            consume_nested_char(ch);
+        }
+
+        void consume_nested_char(char ch) {
+            if (m_capture_response) m_response.push_back(ch);
+            if (ch == '"') {
+                m_in_string = true;
+            } else if (ch == '{' || ch == '[') {
+                m_stack.push_back(ch);
+            } else if (ch == '}' || ch == ']') {
+                const char open = ch == '}' ? '{' : '[';
+                if (m_stack.size() < 2 || m_stack.back() != open) throw_malformed_body();
+                m_stack.pop_back();
+            }
+        }
+
+        void decode_row() {
+            constexpr std::size_t max_fields = 10;
+            std::string_view fields[max_fields];
+            std::size_t count = 0;
+
+            const std::string_view row(m_row);
+            std::size_t start = 0;
+            bool in_string = false;
+            for (std::size_t i = 0; i <= row.size(); ++i) {
+                if (i < row.size()) {
+                    const char ch = row[i];
+                    if (in_string) {
+                        if (ch == '\\') ++i;
+                        else if (ch == '"') in_string = false;
+                        continue;
+                    }
+                    if (ch == '"') in_string = true;
+                    if (ch != ',') continue;
+                }
+                if (count < max_fields) fields[count] = row.substr(start, i - start);
+                ++count;
+                start = i + 1;
+            }
+
+            if (m_format == Format::FX_HISTORY) {
+                if (count < 10) throw_malformed_row();
+                decode_fx_row(fields);
+            } else {
+                if (count < 6) throw_malformed_row();
+                decode_kline_row(fields);
+            }
+            ++m_bars_parsed;
+        }
+
+        static double read_double(std::string_view token, const char* field_name) {
+            double value = 0.0;
+            if (!detail::parse_bar_history_double(token, value)) {
                 throw std::runtime_error(
-                    error.empty()
-                        ? "Intrade FX history request was rejected."
-                        : "Intrade FX history request was rejected: " + error);
+                    std::string("Expected numeric value for ") + field_name + ".");
             }
+            return value;
         }
 
-        if (!j.contains("candles") || !j["candles"].is_array()) {
-            throw std::runtime_error("Intrade FX history response does not contain a candles array.");
+        static std::int64_t read_int64(std::string_view token, const char* field_name) {
+            std::int64_t value = 0;
+            if (!detail::parse_bar_history_int64(token, value)) {
+                throw std::runtime_error(
+                    std::string("Expected integer value for ") + field_name + ".");
+            }
+            return value;
         }
 
-        auto sequence = detail::make_empty_bar_sequence(request, request.price_source);
-        const auto& candles = j["candles"];
-        sequence.bars.reserve(candles.size());
-        const auto price_type = market_price_type_from_bar_price_source(request.price_source);
-
-        for (const auto& item : candles) {
-            if (!item.is_array() || item.size() < 10) {
-                throw std::runtime_error("Malformed Intrade FX history candle.");
-            }
-
-            const auto ts = detail::read_json_int64(item.at(0), "time");
-            const auto bid_open = detail::read_json_double(item.at(1), "bid_open");
-            const auto bid_close = detail::read_json_double(item.at(2), "bid_close");
-            const auto bid_high = detail::read_json_double(item.at(3), "bid_high");
-            const auto bid_low = detail::read_json_double(item.at(4), "bid_low");
-            const auto ask_open = detail::read_json_double(item.at(5), "ask_open");
-            const auto ask_close = detail::read_json_double(item.at(6), "ask_close");
-            const auto ask_high = detail::read_json_double(item.at(7), "ask_high");
-            const auto ask_low = detail::read_json_double(item.at(8), "ask_low");
-            const auto volume = detail::read_json_double(item.at(9), "volume");
-
-            Bar bar(
-                detail::select_fx_history_price(bid_open, ask_open, request.price_source),
-                detail::select_fx_history_price(bid_high, ask_high, request.price_source),
-                detail::select_fx_history_price(bid_low, ask_low, request.price_source),
-                detail::select_fx_history_price(bid_close, ask_close, request.price_source),
+        void decode_fx_row(const std::string_view* fields) {
+            const auto ts = read_int64(fields[0], "time");
+            const auto bid_open = read_double(fields[1], "bid_open");
+            const auto bid_close = read_double(fields[2], "bid_close");
+            const auto bid_high = read_double(fields[3], "bid_high");
+            const auto bid_low = read_double(fields[4], "bid_low");
+            const auto ask_open = read_double(fields[5], "ask_open");
+            const auto ask_close = read_double(fields[6], "ask_close");
+            const auto ask_high = read_double(fields[7], "ask_high");
+            const auto ask_low = read_double(fields[8], "ask_low");
+            const auto volume = read_double(fields[9], "volume");
+
+            append_bar(
+                detail::select_fx_history_price(bid_open, ask_open, m_price_source),
+                detail::select_fx_history_price(bid_high, ask_high, m_price_source),
+                detail::select_fx_history_price(bid_low, ask_low, m_price_source),
+                detail::select_fx_history_price(bid_close, ask_close, m_price_source),
                 volume,
                 static_cast<std::uint64_t>(time_shield::sec_to_ms(ts)));
+        }
+
+        void decode_kline_row(const std::string_view* fields) {
+            const auto open_time = read_int64(fields[0], "open_time");
+            append_bar(
+                read_double(fields[1], "open"),
+                read_double(fields[2], "high"),
+                read_double(fields[3], "low"),
+                read_double(fields[4], "close"),
+                read_double(fields[5], "volume"),
+                static_cast<std::uint64_t>(open_time));
+        }
+
+        void append_bar(
+                double open,
+                double high,
+                double low,
+                double close,
+                double volume,
+                std::uint64_t time_ms) {
+            auto& bar = m_target.bars.emplace_back(open, high, low, close, volume, time_ms);
             bar.set_flag(MarketDataFlags::HISTORICAL);
             bar.set_flag(MarketDataFlags::FINALIZED);
-            bar.set_price_type(price_type);
-            sequence.bars.push_back(std::move(bar));
+            bar.set_price_type(m_price_type);
         }
+    }; // BarHistoryStreamParser
 
+    /// \brief Parses the Intrade `/fxhis` response into a normalized bar sequence.
+    /// \param content Raw JSON response body.
+    /// \param request Original bar history request.
+    /// \return Parsed bar sequence using the requested BID/ASK/MID price stream.
+    /// \throws std::runtime_error When the payload is malformed or broker rejected the request.
+    inline BarSequence parse_fxhis_bar_history(
+            const std::string& content,
+            const BarHistoryRequest& request) {
+        auto sequence = detail::make_empty_bar_sequence(request, request.price_source);
+        BarHistoryStreamParser parser(
+            BarHistoryStreamParser::Format::FX_HISTORY,
+            request,
+            sequence);
+        sequence.bars.reserve(bar_history_slot_count(
+            request.from_ts,
+            request.to_ts,
+            request.timeframe,
+            FX_HISTORY_MAX_BARS_PER_REQUEST));
+        parser.feed(content);
+        parser.finish();
         return sequence;
     }
 
@@ -1427,37 +1986,18 @@ namespace optionx::platforms::intrade_bar {
     inline BarSequence parse_binance_klines_bar_history(
             const std::string& content,
             const BarHistoryRequest& request) {
-        if (request.price_source == BarPriceSource::BID ||
-            request.price_source == BarPriceSource::ASK) {
-            throw std::runtime_error("Binance kline history does not provide bid/ask bars.");
-        }
-
-        const auto j = nlohmann::json::parse(content);
-        if (!j.is_array()) {
-            throw std::runtime_error("Binance kline response is not an array.");
-        }
-
         auto sequence = detail::make_empty_bar_sequence(request, BarPriceSource::LAST);
-        sequence.bars.reserve(j.size());
-
-        for (const auto& item : j) {
-            if (!item.is_array() || item.size() < 6) {
-                throw std::runtime_error("Malformed Binance kline entry.");
-            }
-
-            Bar bar(
-                detail::read_json_double(item.at(1), "open"),
-                detail::read_json_double(item.at(2), "high"),
-                detail::read_json_double(item.at(3), "low"),
-                detail::read_json_double(item.at(4), "close"),
-                detail::read_json_double(item.at(5), "volume"),
-                static_cast<std::uint64_t>(detail::read_json_int64(item.at(0), "open_time")));
-            bar.set_flag(MarketDataFlags::HISTORICAL);
-            bar.set_flag(MarketDataFlags::FINALIZED);
-            bar.set_price_type(MarketPriceType::LAST);
-            sequence.bars.push_back(std::move(bar));
-        }
-
+        BarHistoryStreamParser parser(
+            BarHistoryStreamParser::Format::BINANCE_KLINES,
+            request,
+            sequence);
+        sequence.bars.reserve(bar_history_slot_count(
+            request.from_ts,
+            request.to_ts,
+            request.timeframe,
+            BINANCE_KLINES_MAX_BARS_PER_REQUEST));
+        parser.feed(content);
+        parser.finish();
         return sequence;
     }
 
@@ -0,0 +1,132 @@
+#pragma once
+#ifndef OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_HPP_INCLUDED
+#define OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_HPP_INCLUDED
+
+/// \file SimulatedTradingPlatform.hpp
+/// \brief Deterministic simulated broker for load, latency and pipeline testing.
+
+#include "config.hpp"
+#include "market_data.hpp"
+#include "common/ApiResult.hpp"
+#include "common/BaseTradingPlatform.hpp"
+#include "SimulatedTradingPlatform/SimulationRandom.hpp"
+#include "SimulatedTradingPlatform/SimulationConfig.hpp"
+#include "SimulatedTradingPlatform/AccountInfoData.hpp"
+#include "SimulatedTradingPlatform/SimulatedPriceFeed.hpp"
+#include "SimulatedTradingPlatform/SimulationContext.hpp"
+#include "SimulatedTradingPlatform/TradeExecutionComponent.hpp"
+#include "SimulatedTradingPlatform/AuthManager.hpp"
+#include "SimulatedTradingPlatform/TradeManager.hpp"
+#include "SimulatedTradingPlatform/PriceManager.hpp"
+
+namespace optionx::platforms {
+
+    /// \class SimulatedTradingPlatform
+    /// \brief Trading platform backed by an in-process simulated broker.
+    ///
+    /// Orders go through the real BaseTradeExecutionComponent and
+    /// TradeQueueManager; only the broker side is simulated. Fill latency,
+    /// rejections, payouts and expiry resolution are configured with
+    /// simulator::SimulationConfig and drawn from its seed, keyed by the order
+    /// send sequence. Expiry is resolved against a synthetic or replayed price
+    /// feed, or from a seeded win rate.
+    ///
+    /// Everything runs on the platform event loop. For fully reproducible
+    /// timestamps and PRICE_FEED outcomes, define `OPTIONX_TIMESTAMP_MS` to a
+    /// virtual clock and drive the loop with `run(false)` and `process()`.
+    class SimulatedTradingPlatform final : public BaseTradingPlatform {
+    public:
+
+        /// \brief Constructs the simulated platform.
+        SimulatedTradingPlatform()
+            : BaseTradingPlatform(std::make_shared<simulator::AccountInfoData>()),
+              m_trade_execution(*this, m_account_info),
+              m_auth_manager(*this, m_context, m_account_info),
+              m_trade_manager(*this, m_context, m_account_info),
+              m_price_manager(*this, m_context, m_account_info) {
+        }
+
+        /// \brief Destructor; stops the event loop before components are destroyed.
+        ~SimulatedTradingPlatform() override {
+            shutdown();
+        }
+
+        /// \brief Places a trade request.
+        /// \param trade_request Unique pointer to the trade request.
+        /// \return True if the trade request was successfully queued.
+        bool place_trade(std::unique_ptr<TradeRequest> trade_request) override {
+            return m_trade_execution.place_trade(std::move(trade_request));
+        }
+
+        /// \brief Returns the final result of a closed or rejected simulated trade.
+        bool fetch_trade_result(
+                TradeResultQuery query,
+                std::unique_ptr<TradeResult> result,
+                trade_result_check_callback_t callback) override {
+            return m_trade_manager.fetch_trade_result(
+                std::move(query),
+                std::move(result),
+                std::move(callback));
+        }
+
+        /// \brief Returns closed simulated trades in the requested range.
+        bool fetch_trade_history(
+                const TradeHistoryRequest& request,
+                trade_history_callback_t callback) override {
+            return m_trade_manager.fetch_trade_history(request, std::move(callback));
+        }
+
+        /// \brief Returns all closed simulated trades.
+        bool fetch_trade_history(trade_history_callback_t callback) override {
+            return m_trade_manager.fetch_trade_history(
+                TradeHistoryRequest::all(),
+                std::move(callback));
+        }
+
+        /// \brief Returns the callback for trade result events.
+        trade_result_callback_t& on_trade_result() override {
+            return m_trade_execution.on_trade_result();
+        }
+
+        /// \brief Returns the callback providing trade IDs.
+        trade_id_provider_t& on_trade_id() override {
+            return m_trade_execution.on_trade_id();
+        }
+
+        /// \brief Returns the price feed used for fills and expiry.
+        /// \details Use it to install replays before connect(); call only from
+        ///          the event-loop thread once the platform is running.
+        simulator::SimulatedPriceFeed& price_feed() noexcept {
+            return m_context.price_feed;
+        }
+
+        /// \brief Returns the number of orders the simulated broker received.
+        std::uint64_t sent_orders() const {
+            return m_trade_manager.sent_orders();
+        }
+
+        /// \brief Returns the platform type.
+        /// \return `PlatformType::SIMULATOR`.
+        PlatformType platform_type() const override {
+            return PlatformType::SIMULATOR;
+        }
+
+    private:
+        simulator::SimulationContext       m_context;         ///< Active configuration and price feed.
+        simulator::TradeExecutionComponent m_trade_execution; ///< Manages trade execution.
+        simulator::AuthManager             m_auth_manager;    ///< Applies configuration and sessions.
+        simulator::TradeManager            m_trade_manager;   ///< Simulates fills, expiry and history.
+        simulator::PriceManager            m_price_manager;   ///< Publishes simulated prices.
+
+        /// \brief Runs extra trade queue passes so that order throughput is not capped by the 1 ms loop.
+        void on_loop() override {
+            const int passes = m_context.config.queue_passes_per_loop - 1;
+            if (passes <= 0) return;
+            m_trade_execution.process_passes(passes);
+            m_trade_manager.process();
+        }
+    }; // SimulatedTradingPlatform
+
+} // namespace optionx::platforms
+
+#endif // OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_HPP_INCLUDED
@@ -0,0 +1,209 @@
+#pragma once
+#ifndef OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_ACCOUNT_INFO_DATA_HPP_INCLUDED
+#define OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_ACCOUNT_INFO_DATA_HPP_INCLUDED
+
+/// \file AccountInfoData.hpp
+/// \brief Contains the AccountInfoData class for the simulated broker account.
+
+#include <unordered_map>
+
+namespace optionx::platforms::simulator {
+
+    /// \class AccountInfoData
+    /// \brief Account information data for the simulated broker.
+    ///
+    /// Limits are copied from SimulationConfig when the platform connects.
+    class AccountInfoData : public BaseAccountInfoData {
+    public:
+        int64_t         user_id         = 0;                        ///< User ID
+        double          balance         = 0.0;                      ///< Account balance
+        CurrencyType    currency        = CurrencyType::UNKNOWN;    ///< Account currency
+        AccountType     account_type    = AccountType::UNKNOWN;     ///< Account type (DEMO or REAL)
+        bool            connect         = false;                    ///< Connection status
+        int64_t         open_trades     = 0;                        ///< Number of open trades for the account
+
+        // --- Limits ----------------------------------------------------------
+
+        double  payout                  = 0.8;                      ///< Default payout ratio
+        double  min_amount              = 1.0;                      ///< Minimum trade amount
+        double  max_amount              = 1000.0;                   ///< Maximum trade amount
+        int64_t min_duration            = 1;                        ///< Minimum SPRINT duration (in seconds)
+        int64_t max_duration            = 86400;                    ///< Maximum SPRINT duration (in seconds)
+        int64_t max_trades              = 1000;                     ///< Maximum number of trades
+        int64_t order_queue_timeout     = 10;                       ///< Timeout for pending orders in the queue
+        int64_t response_timeout        = 10;                       ///< Timeout for server response related to opening or closing a trade
+        int64_t order_interval_ms       = 0;                        ///< Minimum time interval required between consecutive orders
+        std::unordered_map<std::string, double> symbol_payouts;     ///< Tradable symbols and their payout ratios
+
+        /// \brief Copies account state and limits from a simulation configuration.
+        /// \param config Simulation configuration.
+        void apply_config(const SimulationConfig& config) {
+            user_id = config.user_id;
+            balance = config.balance;
+            currency = config.currency;
+            account_type = config.account_type;
+            payout = config.payout;
+            min_amount = config.min_amount;
+            max_amount = config.max_amount;
+            min_duration = config.min_duration;
+            max_duration = config.max_duration;
+            max_trades = config.max_trades;
+            order_queue_timeout = config.order_queue_timeout;
+            response_timeout = config.response_timeout;
+            order_interval_ms = config.order_interval_ms;
+            symbol_payouts.clear();
+            for (const auto& symbol : config.effective_symbols()) {
+                symbol_payouts[symbol.symbol] = symbol.payout > 0.0 ? symbol.payout : config.payout;
+            }
+        }
+
+        /// \brief Retrieves the API type associated with this account data.
+        /// \return The type of API used.
+        const PlatformType platform_type() const override final {
+            return PlatformType::SIMULATOR;
+        }
+
+        /// \brief Creates a unique pointer to a clone of this account info data instance.
+        /// \return Unique pointer to a cloned `BaseAccountInfoData` instance.
+        std::unique_ptr<BaseAccountInfoData> clone_unique() const override final {
+            return std::make_unique<AccountInfoData>(*this);
+        }
+
+        /// \brief Creates a shared pointer to a clone of this account info data instance.
+        /// \return Shared pointer to a cloned `BaseAccountInfoData` instance.
+        std::shared_ptr<BaseAccountInfoData> clone_shared() const override final {
+            return std::make_shared<AccountInfoData>(*this);
+        }
+
+    protected:
+
+        /// \brief Retrieves a boolean account information based on the request type.
+        /// \param request Specifies the type of account information requested.
+        /// \return Boolean account information.
+        bool get_info_bool(const AccountInfoRequest& request) const override final {
+            switch (request.type) {
+            case AccountInfoType::CONNECTION_STATUS:
+                return connect;
+            case AccountInfoType::SYMBOL_AVAILABILITY:
+                return symbol_payouts.find(request.symbol) != symbol_payouts.end();
+            case AccountInfoType::OPTION_TYPE_AVAILABILITY:
+                return (request.option_type == OptionType::CLASSIC || request.option_type == OptionType::SPRINT);
+            case AccountInfoType::ORDER_TYPE_AVAILABILITY:
+                return (request.order_type == OrderType::BUY || request.order_type == OrderType::SELL);
+            case AccountInfoType::ACCOUNT_TYPE_AVAILABILITY:
+                return (account_type != AccountType::UNKNOWN && request.account_type == account_type);
+            case AccountInfoType::CURRENCY_AVAILABILITY:
+                return (currency != CurrencyType::UNKNOWN && request.currency == currency);
+            case AccountInfoType::TRADE_LIMIT_NOT_EXCEEDED:
+                return open_trades < max_trades;
+            case AccountInfoType::AMOUNT_BELOW_MAX:
+                return request.amount <= max_amount;
+            case AccountInfoType::AMOUNT_ABOVE_MIN:
+                return request.amount >= min_amount;
+            case AccountInfoType::REFUND_BELOW_MAX:
+                return true;
+            case AccountInfoType::REFUND_ABOVE_MIN:
+                return true;
+            case AccountInfoType::DURATION_AVAILABLE: {
+                if (request.option_type == OptionType::CLASSIC) return true;
+                const int64_t req_duration = request.duration;
+                return (req_duration >= min_duration && req_duration <= max_duration);
+            }
+            case AccountInfoType::EXPIRATION_DATE_AVAILABLE:
+                if (request.option_type == OptionType::SPRINT) return true;
+                return (request.expiry_time - request.timestamp) >= min_duration;
+            case AccountInfoType::PAYOUT_ABOVE_MIN:
+                if (request.min_payout == 0.0) return true;
+                return (get_payout(request) >= request.min_payout);
+            case AccountInfoType::AMOUNT_BELOW_BALANCE:
+                return (request.amount <= balance);
+            default:
+                break;
+            }
+            return false;
+        }
+
+        /// \brief Retrieves integer account information based on the request type.
+        /// \param request Specifies the type of account information requested.
+        /// \return Integer account information.
+        int64_t get_info_int64(const AccountInfoRequest& request) const override final {
+            switch (request.type) {
+                case AccountInfoType::USER_ID: return user_id;
+                case AccountInfoType::CONNECTION_STATUS: return static_cast<int64_t>(connect);
+                case AccountInfoType::BALANCE: return static_cast<int64_t>(balance);
+                case AccountInfoType::PLATFORM_TYPE: return static_cast<int64_t>(platform_type());
+                case AccountInfoType::ACCOUNT_TYPE: return static_cast<int64_t>(account_type);
+                case AccountInfoType::CURRENCY: return static_cast<int64_t>(currency);
+                case AccountInfoType::OPEN_TRADES: return open_trades;
+                case AccountInfoType::MAX_TRADES: return max_trades;
+                case AccountInfoType::PAYOUT: return static_cast<int64_t>(get_payout(request) * 100.0);
+                case AccountInfoType::MIN_AMOUNT: return static_cast<int64_t>(min_amount);
+                case AccountInfoType::MAX_AMOUNT: return static_cast<int64_t>(max_amount);
+                case AccountInfoType::MIN_DURATION: return min_duration;
+                case AccountInfoType::MAX_DURATION: return max_duration;
+                case AccountInfoType::START_TIME: return time_shield::start_of_day(request.timestamp);
+                case AccountInfoType::END_TIME: return time_shield::start_of_day(request.timestamp) + time_shield::SEC_PER_DAY - 1;
+                case AccountInfoType::ORDER_QUEUE_TIMEOUT: return order_queue_timeout;
+                case AccountInfoType::RESPONSE_TIMEOUT: return response_timeout;
+                case AccountInfoType::ORDER_INTERVAL_MS: return order_interval_ms;
+                default: break;
+            }
+            return 0;
+        }
+
+        /// \brief Retrieves floating-point account information based on the request type.
+        /// \param request Specifies the type of account information requested.
+        /// \return Floating-point account information.
+        double get_info_f64(const AccountInfoRequest& request) const override final {
+            switch (request.type) {
+                case AccountInfoType::BALANCE: return balance;
+                case AccountInfoType::PAYOUT: return get_payout(request);
+                case AccountInfoType::MIN_AMOUNT: return min_amount;
+                case AccountInfoType::MAX_AMOUNT: return max_amount;
+                default: break;
+            }
+            return 0;
+        }
+
+        /// \brief Retrieves string account information based on the request type.
+        /// \param request Specifies the type of account information requested.
+        /// \return String account information.
+        std::string get_info_str(const AccountInfoRequest& request) const override final {
+            switch (request.type) {
+                case AccountInfoType::USER_ID: return std::to_string(user_id);
+                case AccountInfoType::BALANCE: return utils::format("%.2f", balance);
+                case AccountInfoType::PLATFORM_TYPE: return to_str(platform_type());
+                case AccountInfoType::ACCOUNT_TYPE: return to_str(account_type);
+                case AccountInfoType::CURRENCY: return to_str(currency);
+                default: break;
+            }
+            return std::string();
+        }
+
+        /// \brief Retrieves the account type.
+        /// \param request The account information request.
+        /// \return The account's type (DEMO or REAL).
+        AccountType get_info_account_type(const AccountInfoRequest& request) const override final {
+            return account_type;
+        }
+
+        /// \brief Retrieves the account currency.
+        /// \param request The account information request.
+        /// \return The account's currency type.
+        CurrencyType get_info_currency(const AccountInfoRequest& request) const override final {
+            return currency;
+        }
+
+        /// \brief Gets the payout ratio for the requested symbol.
+        /// \param request The account information request.
+        /// \return Symbol payout, the default payout for an empty symbol, or 0 for unknown symbols.
+        double get_payout(const AccountInfoRequest& request) const {
+            if (request.symbol.empty()) return payout;
+            auto it = symbol_payouts.find(request.symbol);
+            return it == symbol_payouts.end() ? 0.0 : it->second;
+        }
+    }; // AccountInfoData
+
+} // namespace optionx::platforms::simulator
+
+#endif // OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_ACCOUNT_INFO_DATA_HPP_INCLUDED
@@ -0,0 +1,124 @@
+#pragma once
+#ifndef OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_AUTH_MANAGER_HPP_INCLUDED
+#define OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_AUTH_MANAGER_HPP_INCLUDED
+
+/// \file AuthManager.hpp
+/// \brief Handles configuration, connection and disconnection of the simulated broker.
+
+namespace optionx::platforms::simulator {
+
+    /// \class AuthManager
+    /// \brief Accepts SimulationConfig and opens or closes simulated sessions.
+    ///
+    /// Connecting is immediate: the configuration is applied to the account,
+    /// the price feed is rebuilt with its origin at the current time and the
+    /// connect callback is invoked from the same event-loop pass.
+    class AuthManager final : public components::BaseComponent {
+    public:
+        /// \brief Constructs the auth manager.
+        /// \param platform Reference to the trading platform.
+        /// \param context Shared simulator state.
+        /// \param account_info Shared pointer to account information structure.
+        explicit AuthManager(
+                BaseTradingPlatform& platform,
+                SimulationContext& context,
+                std::shared_ptr<BaseAccountInfoData> account_info)
+                : BaseComponent(platform.event_bus()),
+                  m_context(context),
+                  m_account_info(std::move(account_info)) {
+            subscribe<events::AuthDataEvent>();
+            subscribe<events::ConnectRequestEvent>();
+            subscribe<events::DisconnectRequestEvent>();
+            platform.register_component(this);
+        }
+
+        /// \brief Default destructor.
+        virtual ~AuthManager() = default;
+
+        /// \brief Processes incoming events and dispatches them to appropriate handlers.
+        /// \param event The received event.
+        void on_event(const utils::Event* const event) override {
+            if (const auto* msg = dynamic_cast<const events::AuthDataEvent*>(event)) {
+                handle_event(*msg);
+            } else
+            if (const auto* msg = dynamic_cast<const events::ConnectRequestEvent*>(event)) {
+                handle_event(*msg);
+            } else
+            if (const auto* msg = dynamic_cast<const events::DisconnectRequestEvent*>(event)) {
+                handle_event(*msg);
+            }
+        }
+
+    private:
+        SimulationContext& m_context; ///< Shared simulator state.
+        std::shared_ptr<BaseAccountInfoData> m_account_info; ///< Shared pointer to account information.
+        std::unique_ptr<SimulationConfig> m_pending_config; ///< Last accepted configuration.
+
+        /// \brief Stores a validated configuration for the next connect.
+        void handle_event(const events::AuthDataEvent& event) {
+            auto config = std::dynamic_pointer_cast<SimulationConfig>(event.auth_data);
+            if (!config) return;
+            auto [success, message] = config->validate();
+            if (success) {
+                m_pending_config = std::make_unique<SimulationConfig>(*config);
+            } else {
+                LOGIT_WARN("Simulator: configuration rejected. ", message);
+            }
+            config->dispatch_callbacks(success, message);
+        }
+
+        /// \brief Opens a simulated session.
+        void handle_event(const events::ConnectRequestEvent& event) {
+            auto account_info = get_account_info();
+            if (!m_pending_config) {
+                if (event.callback) event.callback({false, "Simulation config is missing."});
+                return;
+            }
+            if (account_info->connect) {
+                if (event.callback) event.callback({true, "Already connected.", m_context.config.clone_unique()});
+                return;
+            }
+
+            m_context.config = *m_pending_config;
+            m_context.price_feed.configure(m_context.config.seed, m_context.config.effective_symbols());
+            m_context.price_feed.set_origin(OPTIONX_TIMESTAMP_MS);
+            const int64_t open_trades = account_info->open_trades;
+            account_info->apply_config(m_context.config);
+            account_info->open_trades = open_trades;
+            account_info->connect = true;
+            LOGIT_INFO("Simulator: connected. seed=", m_context.config.seed);
+
+            using Status = events::AccountInfoUpdateEvent::Status;
+            const std::string event_text("Connected to simulator.");
+            if (event.callback) event.callback({true, event_text, m_context.config.clone_unique()});
+            notify(events::AccountInfoUpdateEvent(account_info, Status::CONNECTED, event_text));
+        }
+
+        /// \brief Closes the simulated session.
+        void handle_event(const events::DisconnectRequestEvent& event) {
+            auto account_info = get_account_info();
+            if (!account_info->connect) {
+                if (event.callback) event.callback({false, "Already disconnected."});
+                return;
+            }
+            account_info->connect = false;
+            using Status = events::AccountInfoUpdateEvent::Status;
+            const std::string event_text("Successfully disconnected.");
+            if (event.callback) event.callback({true, event_text, m_context.config.clone_unique()});
+            notify(events::AccountInfoUpdateEvent(account_info, Status::DISCONNECTED, event_text));
+        }
+
+        /// \brief Retrieves the account information object.
+        /// \return Shared pointer to `AccountInfoData`.
+        std::shared_ptr<AccountInfoData> get_account_info() {
+            if (auto account_info = std::dynamic_pointer_cast<AccountInfoData>(m_account_info)) {
+                return account_info;
+            }
+            LOGIT_FATAL("Failed to cast IAccountInfoData to AccountInfoData");
+            throw std::runtime_error("Invalid account information type");
+        }
+    }; // AuthManager
+
+} // namespace optionx::platforms::simulator
+
+#endif // OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_AUTH_MANAGER_HPP_INCLUDED
@@ -0,0 +1,93 @@
+#pragma once
+#ifndef OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_PRICE_MANAGER_HPP_INCLUDED
+#define OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_PRICE_MANAGER_HPP_INCLUDED
+
+/// \file PriceManager.hpp
+/// \brief Publishes simulated prices to the event bus.
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace optionx::platforms::simulator {
+
+    /// \class PriceManager
+    /// \brief Emits a PriceUpdateEvent whenever a simulated symbol moves to its next step.
+    ///
+    /// The published ticks feed the same live-state path as real brokers
+    /// (TradeQueueManager updates `live_state` from them). Publishing is
+    /// skipped while disconnected or when `SimulationConfig::publish_prices`
+    /// is false.
+    class PriceManager final : public components::BaseComponent {
+    public:
+        /// \brief Constructs the price manager.
+        /// \param platform Reference to the trading platform.
+        /// \param context Shared simulator state.
+        /// \param account_info Shared pointer to account information structure.
+        explicit PriceManager(
+                BaseTradingPlatform& platform,
+                SimulationContext& context,
+                std::shared_ptr<BaseAccountInfoData> account_info)
+                : BaseComponent(platform.event_bus()),
+                  m_context(context),
+                  m_account_info(std::move(account_info)) {
+            subscribe<events::AccountInfoUpdateEvent>();
+            platform.register_component(this);
+        }
+
+        /// \brief Default destructor.
+        virtual ~PriceManager() = default;
+
+        /// \brief Resets published steps when the session changes.
+        /// \param event The received event.
+        void on_event(const utils::Event* const event) override {
+            if (const auto* msg = dynamic_cast<const events::AccountInfoUpdateEvent*>(event)) {
+                using Status = events::AccountInfoUpdateEvent::Status;
+                if (msg->status == Status::CONNECTED ||
+                    msg->status == Status::DISCONNECTED) {
+                    m_steps.clear();
+                }
+            }
+        }
+
+        /// \brief Publishes symbols whose price step changed since the last call.
+        void process() override {
+            if (!m_context.config.publish_prices) return;
+            if (!m_account_info->get_info<bool>(AccountInfoType::CONNECTION_STATUS)) return;
+
+            const std::int64_t timestamp = OPTIONX_TIMESTAMP_MS;
+            auto& feed = m_context.price_feed;
+            std::vector<events::TickUpdateBatch> batches;
+            for (const auto& symbol : feed.symbols()) {
+                const std::int64_t step = feed.step_at(symbol, timestamp);
+                auto it = m_steps.find(symbol);
+                if (it != m_steps.end() && it->second == step) continue;
+                m_steps[symbol] = step;
+
+                const double price = feed.price_at(symbol, timestamp);
+                Tick tick(price, price, 0.0,
+                          static_cast<std::uint64_t>(timestamp),
+                          static_cast<std::uint64_t>(timestamp), 0);
+                tick.set_flag(TickUpdateFlags::ASK_UPDATED);
+                tick.set_flag(TickUpdateFlags::BID_UPDATED);
+                tick.set_flag(MarketDataFlags::INITIALIZED);
+                batches.push_back(events::PriceUpdateEvent::make_tick_batch(
+                    tick,
+                    symbol,
+                    to_str(PlatformType::SIMULATOR),
+                    feed.digits(symbol),
+                    0));
+            }
+            if (batches.empty()) return;
+            notify(events::PriceUpdateEvent(std::move(batches), MarketDataUpdateSource::POLLING));
+        }
+
+    private:
+        SimulationContext& m_context; ///< Shared simulator state.
+        std::shared_ptr<BaseAccountInfoData> m_account_info; ///< Shared pointer to account information.
+        std::unordered_map<std::string, std::int64_t> m_steps; ///< Last published step per symbol.
+    }; // PriceManager
+
+} // namespace optionx::platforms::simulator
+
+#endif // OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_PRICE_MANAGER_HPP_INCLUDED
@@ -0,0 +1,179 @@
+#pragma once
+#ifndef OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_SIMULATED_PRICE_FEED_HPP_INCLUDED
+#define OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_SIMULATED_PRICE_FEED_HPP_INCLUDED
+
+/// \file SimulatedPriceFeed.hpp
+/// \brief Deterministic synthetic or replayed prices for the simulated broker.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace optionx::platforms::simulator {
+
+    /// \class SimulatedPriceFeed
+    /// \brief Answers "what was the price of a symbol at time t" for the simulated broker.
+    ///
+    /// A symbol is either a synthetic geometric random walk or a replayed tick
+    /// sequence. Time is measured from the feed origin, which the platform sets
+    /// when it connects: step `k` of a walk covers
+    /// `[origin + k * tick_interval_ms, origin + (k + 1) * tick_interval_ms)`
+    /// and its value depends only on the seed, the symbol and `k`. Replayed
+    /// ticks are shifted so that the first tick lands on the origin; after the
+    /// last tick the last price is held.
+    ///
+    /// Walk steps are generated lazily and cached, one double per step, so
+    /// memory grows with the simulated time span, not with the query count.
+    /// The feed is owned by the platform event loop; configure replays before
+    /// run() or from the loop thread.
+    class SimulatedPriceFeed {
+    public:
+        /// \brief Rebuilds the synthetic walks; replayed symbols keep their ticks.
+        /// \param seed Simulation seed.
+        /// \param symbols Symbols and walk parameters.
+        void configure(std::uint64_t seed, const std::vector<SimulatedSymbol>& symbols) {
+            m_seed = seed;
+            m_series.clear();
+            for (const auto& symbol : symbols) {
+                Series series;
+                series.config = symbol;
+                series.stream = SimulationRandom::hash(symbol.symbol);
+                series.log_price = std::log(symbol.start_price);
+                series.prices.push_back(round_price(symbol.start_price, symbol.digits));
+                m_series[symbol.symbol] = std::move(series);
+            }
+            for (const auto& item : m_replays) {
+                m_series[item.first] = item.second;
+            }
+        }
+
+        /// \brief Replaces a symbol's walk with replayed ticks.
+        /// \details The replay survives later configure() calls. The symbol
+        ///          must also be listed in SimulationConfig::symbols to be tradable.
+        /// \param symbol Symbol name.
+        /// \param ticks Ticks ordered by `time_ms`; mid prices are replayed.
+        /// \param digits Price precision of the ticks.
+        /// \return False if no tick has a usable price.
+        bool set_replay(const std::string& symbol, const std::vector<Tick>& ticks, std::uint32_t digits) {
+            Series series;
+            series.config.symbol = symbol;
+            series.config.digits = digits;
+            series.replay = true;
+            for (const auto& tick : ticks) {
+                const double price = tick.mid_price();
+                if (!(price > 0.0)) continue;
+                if (series.times.empty()) series.first_tick_ms = static_cast<std::int64_t>(tick.time_ms);
+                series.times.push_back(static_cast<std::int64_t>(tick.time_ms) - series.first_tick_ms);
+                series.prices.push_back(round_price(price, digits));
+            }
+            if (series.prices.empty()) return false;
+            series.config.start_price = series.prices.front();
+            m_series[symbol] = series;
+            m_replays[symbol] = std::move(series);
+            return true;
+        }
+
+        /// \brief Sets the time that maps to step 0 of every series.
+        /// \param origin_ms Unix time in milliseconds.
+        void set_origin(std::int64_t origin_ms) noexcept {
+            m_origin_ms = origin_ms;
+        }
+
+        /// \brief Returns the feed origin in milliseconds.
+        std::int64_t origin() const noexcept {
+            return m_origin_ms;
+        }
+
+        /// \brief Checks whether a symbol has prices.
+        bool contains(const std::string& symbol) const {
+            return m_series.find(symbol) != m_series.end();
+        }
+
+        /// \brief Returns the price precision of a symbol, or 0 if it is unknown.
+        std::uint32_t digits(const std::string& symbol) const {
+            auto it = m_series.find(symbol);
+            return it == m_series.end() ? 0 : it->second.config.digits;
+        }
+
+        /// \brief Returns the configured symbols.
+        std::vector<std::string> symbols() const {
+            std::vector<std::string> names;
+            names.reserve(m_series.size());
+            for (const auto& item : m_series) names.push_back(item.first);
+            std::sort(names.begin(), names.end());
+            return names;
+        }
+
+        /// \brief Returns the index of the walk step or replayed tick active at a time.
+        /// \param symbol Symbol name.
+        /// \param time_ms Unix time in milliseconds.
+        /// \return Step index; 0 before the origin, -1 for unknown symbols.
+        std::int64_t step_at(const std::string& symbol, std::int64_t time_ms) const {
+            auto it = m_series.find(symbol);
+            if (it == m_series.end()) return -1;
+            return step_index(it->second, time_ms);
+        }
+
+        /// \brief Returns the price of a symbol at a time.
+        /// \param symbol Symbol name.
+        /// \param time_ms Unix time in milliseconds.
+        /// \return Price rounded to the symbol precision, or 0 for unknown symbols.
+        double price_at(const std::string& symbol, std::int64_t time_ms) {
+            auto it = m_series.find(symbol);
+            if (it == m_series.end()) return 0.0;
+            auto& series = it->second;
+            const std::int64_t step = step_index(series, time_ms);
+            if (series.replay) return series.prices[static_cast<std::size_t>(step)];
+            extend(series, step);
+            return series.prices[static_cast<std::size_t>(step)];
+        }
+
+    private:
+        struct Series {
+            SimulatedSymbol config;           ///< Walk parameters and precision.
+            std::uint64_t stream = 0;         ///< Stream key derived from the symbol name.
+            bool replay = false;              ///< True when prices come from replayed ticks.
+            std::int64_t first_tick_ms = 0;   ///< Time of the first replayed tick.
+            double log_price = 0.0;           ///< Unrounded log price of the last generated step.
+            std::vector<std::int64_t> times;  ///< Replayed tick offsets from the first tick.
+            std::vector<double> prices;       ///< Walk prices by step, or replayed prices.
+        };
+
+        std::unordered_map<std::string, Series> m_series;
+        std::unordered_map<std::string, Series> m_replays;
+        std::uint64_t m_seed = 1;
+        std::int64_t m_origin_ms = 0;
+
+        std::int64_t step_index(const Series& series, std::int64_t time_ms) const {
+            const std::int64_t offset = time_ms - m_origin_ms;
+            if (offset <= 0) return 0;
+            if (series.replay) {
+                auto it = std::upper_bound(series.times.begin(), series.times.end(), offset);
+                return static_cast<std::int64_t>(std::distance(series.times.begin(), it)) - 1;
+            }
+            return offset / series.config.tick_interval_ms;
+        }
+
+        void extend(Series& series, std::int64_t step) {
+            const auto& config = series.config;
+            const double sigma = config.volatility *
+                std::sqrt(static_cast<double>(config.tick_interval_ms) / 1000.0);
+            while (static_cast<std::int64_t>(series.prices.size()) <= step) {
+                SimulationRandom rng(m_seed ^ series.stream, series.prices.size());
+                series.log_price += sigma * rng.normal();
+                series.prices.push_back(round_price(std::exp(series.log_price), config.digits));
+            }
+        }
+
+        static double round_price(double price, std::uint32_t digits) {
+            return utils::normalize_double(price, digits);
+        }
+    }; // SimulatedPriceFeed
+
+} // namespace optionx::platforms::simulator
+
+#endif // OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_SIMULATED_PRICE_FEED_HPP_INCLUDED
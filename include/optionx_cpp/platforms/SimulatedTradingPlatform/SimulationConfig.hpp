@@ -0,0 +1,269 @@
+#pragma once
+#ifndef OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_SIMULATION_CONFIG_HPP_INCLUDED
+#define OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_SIMULATION_CONFIG_HPP_INCLUDED
+
+/// \file SimulationConfig.hpp
+/// \brief Contains the SimulationConfig class that configures the simulated broker.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "SimulationRandom.hpp"
+
+namespace optionx::platforms::simulator {
+
+    /// \enum ExpiryResolution
+    /// \brief Defines how the simulated broker decides the outcome of an expired trade.
+    enum class ExpiryResolution {
+        PRICE_FEED, ///< Compare feed prices at open_date and close_date.
+        SEEDED      ///< Draw WIN/LOSS/STANDOFF from the trade's seeded stream.
+    };
+
+    /// \brief Converts an expiry resolution mode to its config string.
+    inline const char* expiry_resolution_to_string(ExpiryResolution mode) noexcept {
+        switch (mode) {
+        case ExpiryResolution::PRICE_FEED: return "PRICE_FEED";
+        case ExpiryResolution::SEEDED:     return "SEEDED";
+        }
+        return "PRICE_FEED";
+    }
+
+    /// \brief Parses an expiry resolution mode from config text.
+    /// \param value Mode name, case-insensitive.
+    /// \param fallback Value returned when the input is unknown.
+    inline ExpiryResolution expiry_resolution_from_string(
+            std::string value,
+            ExpiryResolution fallback = ExpiryResolution::PRICE_FEED) {
+        std::transform(value.begin(), value.end(), value.begin(), [](unsigned char ch) {
+            return static_cast<char>(std::toupper(ch));
+        });
+        if (value == "PRICE_FEED") return ExpiryResolution::PRICE_FEED;
+        if (value == "SEEDED") return ExpiryResolution::SEEDED;
+        return fallback;
+    }
+
+    /// \struct SimulatedSymbol
+    /// \brief Tradable symbol of the simulated broker and its synthetic price walk.
+    struct SimulatedSymbol {
+        std::string   symbol;                 ///< Symbol name as used in TradeRequest::symbol.
+        double        start_price = 1.0;      ///< First price of the synthetic walk.
+        std::uint32_t digits = 5;             ///< Price precision.
+        double        volatility = 0.0002;    ///< Relative volatility per square root of a second.
+        std::int64_t  tick_interval_ms = 250; ///< Step of the synthetic walk and of published ticks.
+        double        payout = 0.0;           ///< Symbol payout; 0 uses SimulationConfig::payout.
+
+        /// \brief Serializes the symbol.
+        void to_json(nlohmann::json& j) const {
+            j["symbol"] = symbol;
+            j["start_price"] = start_price;
+            j["digits"] = digits;
+            j["volatility"] = volatility;
+            j["tick_interval_ms"] = tick_interval_ms;
+            j["payout"] = payout;
+        }
+
+        /// \brief Reads the symbol; missing keys keep their values.
+        void from_json(const nlohmann::json& j) {
+            symbol = j.value("symbol", symbol);
+            start_price = j.value("start_price", start_price);
+            digits = j.value("digits", digits);
+            volatility = j.value("volatility", volatility);
+            tick_interval_ms = j.value("tick_interval_ms", tick_interval_ms);
+            payout = j.value("payout", payout);
+        }
+    }; // SimulatedSymbol
+
+    /// \class SimulationConfig
+    /// \brief Configuration of the simulated broker, passed through `configure()` like broker auth data.
+    ///
+    /// Every random decision of a trade (rejection, open latency, close latency,
+    /// seeded outcome) is drawn from a stream keyed by `seed` and the trade's
+    /// send sequence number, and synthetic prices are keyed by `seed`, symbol
+    /// and step index, so the same seed and the same order flow reproduce the
+    /// same fills and outcomes.
+    class SimulationConfig : public IAuthData {
+    public:
+        std::uint64_t seed = 1;                            ///< Seed of every random stream.
+        std::int64_t  user_id = 1;                         ///< Reported user ID.
+        AccountType   account_type = AccountType::DEMO;    ///< Simulated account type.
+        CurrencyType  currency = CurrencyType::USD;        ///< Simulated account currency.
+        double        balance = 10000.0;                   ///< Starting balance.
+        double        payout = 0.8;                        ///< Default payout ratio.
+        double        min_amount = 1.0;                    ///< Minimum trade amount.
+        double        max_amount = 1000.0;                 ///< Maximum trade amount.
+        std::int64_t  min_duration = 1;                    ///< Minimum SPRINT duration in seconds.
+        std::int64_t  max_duration = 86400;                ///< Maximum SPRINT duration in seconds.
+        std::int64_t  max_trades = 1000;                   ///< Maximum concurrently open trades.
+        std::int64_t  order_interval_ms = 0;               ///< Minimum delay between sent orders.
+        std::int64_t  order_queue_timeout = 10;            ///< Pending order timeout in seconds.
+        std::int64_t  response_timeout = 10;               ///< Close response timeout in seconds.
+
+        LatencyDistribution open_latency = LatencyDistribution::log_normal(80.0, 0.4);   ///< Send-to-fill latency.
+        LatencyDistribution close_latency = LatencyDistribution::log_normal(150.0, 0.4); ///< Expiry-to-result latency.
+        double        rejection_rate = 0.0;                ///< Probability that the broker rejects an order.
+
+        ExpiryResolution expiry_resolution = ExpiryResolution::PRICE_FEED; ///< Outcome source.
+        double        win_rate = 0.5;                      ///< WIN probability in SEEDED mode.
+        double        standoff_rate = 0.0;                 ///< STANDOFF probability in SEEDED mode.
+
+        std::vector<SimulatedSymbol> symbols;              ///< Tradable symbols; empty uses EURUSD, GBPUSD and USDJPY.
+        bool          publish_prices = true;               ///< Emit PriceUpdateEvent on each walk step.
+        int           queue_passes_per_loop = 8;           ///< Trade queue passes per 1 ms platform loop.
+        std::size_t   max_history_records = 100000;        ///< Closed and rejected trades kept for result queries; 0 keeps all.
+
+        SimulationConfig() = default;
+
+        virtual ~SimulationConfig() = default;
+
+        /// \brief Returns the configured symbols, or the default set when none are configured.
+        std::vector<SimulatedSymbol> effective_symbols() const {
+            if (!symbols.empty()) return symbols;
+            std::vector<SimulatedSymbol> defaults(3);
+            defaults[0].symbol = "EURUSD";
+            defaults[0].start_price = 1.08;
+            defaults[1].symbol = "GBPUSD";
+            defaults[1].start_price = 1.27;
+            defaults[2].symbol = "USDJPY";
+            defaults[2].start_price = 150.0;
+            defaults[2].digits = 3;
+            return defaults;
+        }
+
+        /// \brief Serializes the configuration to a JSON object.
+        /// \param j JSON object to populate.
+        void to_json(nlohmann::json& j) const override {
+            try {
+                j["seed"] = seed;
+                j["user_id"] = user_id;
+                j["account_type"] = optionx::to_str(account_type);
+                j["currency"] = optionx::to_str(currency);
+                j["balance"] = balance;
+                j["payout"] = payout;
+                j["min_amount"] = min_amount;
+                j["max_amount"] = max_amount;
+                j["min_duration"] = min_duration;
+                j["max_duration"] = max_duration;
+                j["max_trades"] = max_trades;
+                j["order_interval_ms"] = order_interval_ms;
+                j["order_queue_timeout"] = order_queue_timeout;
+                j["response_timeout"] = response_timeout;
+                open_latency.to_json(j["open_latency"]);
+                close_latency.to_json(j["close_latency"]);
+                j["rejection_rate"] = rejection_rate;
+                j["expiry_resolution"] = expiry_resolution_to_string(expiry_resolution);
+                j["win_rate"] = win_rate;
+                j["standoff_rate"] = standoff_rate;
+                j["symbols"] = nlohmann::json::array();
+                for (const auto& symbol : symbols) {
+                    nlohmann::json item;
+                    symbol.to_json(item);
+                    j["symbols"].push_back(std::move(item));
+                }
+                j["publish_prices"] = publish_prices;
+                j["queue_passes_per_loop"] = queue_passes_per_loop;
+                j["max_history_records"] = max_history_records;
+            } catch (const std::exception& ex) {
+                LOGIT_ERROR(ex);
+            }
+        }
+
+        /// \brief Deserializes JSON data; missing keys keep their current values.
+        /// \param j JSON object to parse.
+        void from_json(const nlohmann::json& j) override {
+            try {
+                seed = j.value("seed", seed);
+                user_id = j.value("user_id", user_id);
+                account_type = to_enum<AccountType>(j.value("account_type", optionx::to_str(account_type)));
+                currency = to_enum<CurrencyType>(j.value("currency", optionx::to_str(currency)));
+                balance = j.value("balance", balance);
+                payout = j.value("payout", payout);
+                min_amount = j.value("min_amount", min_amount);
+                max_amount = j.value("max_amount", max_amount);
+                min_duration = j.value("min_duration", min_duration);
+                max_duration = j.value("max_duration", max_duration);
+                max_trades = j.value("max_trades", max_trades);
+                order_interval_ms = j.value("order_interval_ms", order_interval_ms);
+                order_queue_timeout = j.value("order_queue_timeout", order_queue_timeout);
+                response_timeout = j.value("response_timeout", response_timeout);
+                if (j.contains("open_latency")) open_latency.from_json(j.at("open_latency"));
+                if (j.contains("close_latency")) close_latency.from_json(j.at("close_latency"));
+                rejection_rate = j.value("rejection_rate", rejection_rate);
+                expiry_resolution = expiry_resolution_from_string(
+                    j.value("expiry_resolution", expiry_resolution_to_string(expiry_resolution)),
+                    expiry_resolution);
+                win_rate = j.value("win_rate", win_rate);
+                standoff_rate = j.value("standoff_rate", standoff_rate);
+                if (j.contains("symbols") && j.at("symbols").is_array()) {
+                    symbols.clear();
+                    for (const auto& item : j.at("symbols")) {
+                        SimulatedSymbol symbol;
+                        symbol.from_json(item);
+                        symbols.push_back(std::move(symbol));
+                    }
+                }
+                publish_prices = j.value("publish_prices", publish_prices);
+                queue_passes_per_loop = j.value("queue_passes_per_loop", queue_passes_per_loop);
+                max_history_records = j.value("max_history_records", max_history_records);
+            } catch (const std::exception& ex) {
+                LOGIT_ERROR(ex);
+            }
+        }
+
+        /// \brief Validates the configuration with a detailed error message.
+        /// \return A pair where the first element is true if the configuration is valid, and the second element contains an error message in case of failure.
+        std::pair<bool, std::string> validate() const override {
+            if (account_type == AccountType::UNKNOWN) return { false, "Account type is not set" };
+            if (currency == CurrencyType::UNKNOWN) return { false, "Currency is not set" };
+            if (balance < 0.0) return { false, "Balance must be non-negative" };
+            if (payout < 0.0) return { false, "Payout must be non-negative" };
+            if (min_amount < 0.0 || max_amount < min_amount) return { false, "Invalid amount range" };
+            if (min_duration <= 0 || max_duration < min_duration) return { false, "Invalid duration range" };
+            if (max_trades <= 0) return { false, "Max trades must be positive" };
+            if (order_interval_ms < 0) return { false, "Order interval must be non-negative" };
+            if (order_queue_timeout <= 0) return { false, "Order queue timeout must be positive" };
+            if (response_timeout <= 0) return { false, "Response timeout must be positive" };
+            const auto open_error = open_latency.validate();
+            if (!open_error.empty()) return { false, "Open latency: " + open_error };
+            const auto close_error = close_latency.validate();
+            if (!close_error.empty()) return { false, "Close latency: " + close_error };
+            if (rejection_rate < 0.0 || rejection_rate > 1.0) return { false, "Rejection rate must be in [0, 1]" };
+            if (win_rate < 0.0 || standoff_rate < 0.0 || win_rate + standoff_rate > 1.0) {
+                return { false, "Seeded win and standoff rates must be non-negative and sum to at most 1" };
+            }
+            for (const auto& symbol : symbols) {
+                if (symbol.symbol.empty()) return { false, "Symbol name is empty" };
+                if (symbol.start_price <= 0.0) return { false, "Start price must be positive: " + symbol.symbol };
+                if (symbol.volatility < 0.0) return { false, "Volatility must be non-negative: " + symbol.symbol };
+                if (symbol.tick_interval_ms <= 0) return { false, "Tick interval must be positive: " + symbol.symbol };
+                if (symbol.payout < 0.0) return { false, "Payout must be non-negative: " + symbol.symbol };
+            }
+            if (queue_passes_per_loop <= 0) return { false, "Queue passes per loop must be positive" };
+            return { true, std::string() };
+        }
+
+        /// \brief Clones the configuration to a unique pointer.
+        /// \return Unique pointer to a cloned IAuthData instance.
+        std::unique_ptr<IAuthData> clone_unique() const override {
+            return std::make_unique<SimulationConfig>(*this);
+        }
+
+        /// \brief Clones the configuration to a shared pointer.
+        /// \return Shared pointer to a cloned IAuthData instance.
+        std::shared_ptr<IAuthData> clone_shared() const override {
+            return std::make_shared<SimulationConfig>(*this);
+        }
+
+        /// \brief Returns the platform type.
+        /// \return Platform type identifier (`PlatformType::SIMULATOR`).
+        PlatformType platform_type() const override {
+            return PlatformType::SIMULATOR;
+        }
+    }; // SimulationConfig
+
+} // namespace optionx::platforms::simulator
+
+#endif // OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_SIMULATION_CONFIG_HPP_INCLUDED
@@ -0,0 +1,23 @@
+#pragma once
+#ifndef OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_SIMULATION_CONTEXT_HPP_INCLUDED
+#define OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_SIMULATION_CONTEXT_HPP_INCLUDED
+
+/// \file SimulationContext.hpp
+/// \brief Shared state of the simulated broker components.
+
+namespace optionx::platforms::simulator {
+
+    /// \struct SimulationContext
+    /// \brief Active configuration and price feed shared by the simulator components.
+    ///
+    /// Owned by SimulatedTradingPlatform and touched only from its event loop.
+    /// AuthManager replaces `config` and rebuilds `price_feed` on connect;
+    /// TradeManager and PriceManager read them.
+    struct SimulationContext {
+        SimulationConfig   config;     ///< Configuration of the current session.
+        SimulatedPriceFeed price_feed; ///< Prices used for fills, expiry and published ticks.
+    };
+
+} // namespace optionx::platforms::simulator
+
+#endif // OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_SIMULATION_CONTEXT_HPP_INCLUDED
@@ -0,0 +1,204 @@
+#pragma once
+#ifndef OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_SIMULATION_RANDOM_HPP_INCLUDED
+#define OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_SIMULATION_RANDOM_HPP_INCLUDED
+
+/// \file SimulationRandom.hpp
+/// \brief Seeded random streams and latency distributions for the simulated broker.
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+namespace optionx::platforms::simulator {
+
+    /// \class SimulationRandom
+    /// \brief Counter-based SplitMix64 stream keyed by a seed and a stream index.
+    /// \details Every simulated trade and every price step gets its own stream,
+    ///          so a draw depends only on `(seed, stream, draw number)` and never
+    ///          on how many other trades were processed before it. The standard
+    ///          `<random>` distributions are not used because their output is
+    ///          implementation-defined and would differ between compilers.
+    class SimulationRandom {
+    public:
+        /// \brief Creates a stream.
+        /// \param seed Simulation seed.
+        /// \param stream Stream index, e.g. the trade sequence number.
+        SimulationRandom(std::uint64_t seed, std::uint64_t stream) noexcept
+            : m_state(mix(seed ^ mix(stream + 0x9E3779B97F4A7C15ULL))) {}
+
+        /// \brief Returns the next 64-bit value of the stream.
+        std::uint64_t next_u64() noexcept {
+            m_state += 0x9E3779B97F4A7C15ULL;
+            return mix(m_state);
+        }
+
+        /// \brief Returns a uniform value in [0, 1).
+        double uniform() noexcept {
+            return static_cast<double>(next_u64() >> 11) * (1.0 / 9007199254740992.0);
+        }
+
+        /// \brief Returns a standard normal value; always consumes two draws.
+        double normal() noexcept {
+            const double u1 = 1.0 - uniform(); // (0, 1], keeps log() finite
+            const double u2 = uniform();
+            return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+        }
+
+        /// \brief Hashes a string into a stream key (FNV-1a).
+        /// \param text Text to hash, e.g. a symbol name.
+        /// \return 64-bit hash.
+        static std::uint64_t hash(const std::string& text) noexcept {
+            std::uint64_t value = 1469598103934665603ULL;
+            for (const char ch : text) {
+                value ^= static_cast<unsigned char>(ch);
+                value *= 1099511628211ULL;
+            }
+            return value;
+        }
+
+    private:
+        std::uint64_t m_state;
+
+        static std::uint64_t mix(std::uint64_t z) noexcept {
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+    }; // SimulationRandom
+
+    /// \enum LatencyModel
+    /// \brief Shape of a simulated latency distribution.
+    enum class LatencyModel {
+        FIXED,       ///< Always `a` milliseconds.
+        UNIFORM,     ///< Uniform in [a, b] milliseconds.
+        NORMAL,      ///< Normal with mean `a` and standard deviation `b`.
+        LOG_NORMAL,  ///< Log-normal with median `a` and log-space sigma `b`.
+        EXPONENTIAL  ///< Exponential with mean `a`.
+    };
+
+    /// \brief Converts a latency model to its config string.
+    inline const char* latency_model_to_string(LatencyModel model) noexcept {
+        switch (model) {
+        case LatencyModel::FIXED:       return "FIXED";
+        case LatencyModel::UNIFORM:     return "UNIFORM";
+        case LatencyModel::NORMAL:      return "NORMAL";
+        case LatencyModel::LOG_NORMAL:  return "LOG_NORMAL";
+        case LatencyModel::EXPONENTIAL: return "EXPONENTIAL";
+        }
+        return "FIXED";
+    }
+
+    /// \brief Parses a latency model from config text.
+    /// \param value Model name, case-insensitive.
+    /// \param fallback Value returned when the input is unknown.
+    inline LatencyModel latency_model_from_string(
+            std::string value,
+            LatencyModel fallback = LatencyModel::FIXED) {
+        std::transform(value.begin(), value.end(), value.begin(), [](unsigned char ch) {
+            return static_cast<char>(std::toupper(ch));
+        });
+        if (value == "FIXED") return LatencyModel::FIXED;
+        if (value == "UNIFORM") return LatencyModel::UNIFORM;
+        if (value == "NORMAL") return LatencyModel::NORMAL;
+        if (value == "LOG_NORMAL" || value == "LOGNORMAL") return LatencyModel::LOG_NORMAL;
+        if (value == "EXPONENTIAL") return LatencyModel::EXPONENTIAL;
+        return fallback;
+    }
+
+    /// \struct LatencyDistribution
+    /// \brief Latency distribution in milliseconds, clamped to [0, max_ms].
+    struct LatencyDistribution {
+        LatencyModel model = LatencyModel::FIXED; ///< Distribution shape.
+        double a = 0.0;             ///< First parameter, see LatencyModel.
+        double b = 0.0;             ///< Second parameter, see LatencyModel.
+        std::int64_t max_ms = 60000; ///< Upper clamp for sampled values.
+
+        /// \brief Constant latency.
+        static LatencyDistribution fixed(double ms) {
+            return {LatencyModel::FIXED, ms, 0.0};
+        }
+
+        /// \brief Uniform latency in [lo_ms, hi_ms].
+        static LatencyDistribution uniform(double lo_ms, double hi_ms) {
+            return {LatencyModel::UNIFORM, lo_ms, hi_ms};
+        }
+
+        /// \brief Normal latency.
+        static LatencyDistribution normal(double mean_ms, double stddev_ms) {
+            return {LatencyModel::NORMAL, mean_ms, stddev_ms};
+        }
+
+        /// \brief Log-normal latency, the usual shape of network round trips.
+        static LatencyDistribution log_normal(double median_ms, double sigma) {
+            return {LatencyModel::LOG_NORMAL, median_ms, sigma};
+        }
+
+        /// \brief Exponential latency.
+        static LatencyDistribution exponential(double mean_ms) {
+            return {LatencyModel::EXPONENTIAL, mean_ms, 0.0};
+        }
+
+        /// \brief Draws a latency value.
+        /// \details Consumes exactly two draws whatever the model, so changing
+        ///          the model of one distribution does not shift later draws.
+        /// \param rng Stream to draw from.
+        /// \return Latency in milliseconds.
+        std::int64_t sample(SimulationRandom& rng) const noexcept {
+            const double u = rng.uniform();
+            const double v = rng.uniform();
+            double value = a;
+            switch (model) {
+            case LatencyModel::FIXED:
+                break;
+            case LatencyModel::UNIFORM:
+                value = a + (b - a) * u;
+                break;
+            case LatencyModel::NORMAL:
+            case LatencyModel::LOG_NORMAL: {
+                const double z = std::sqrt(-2.0 * std::log(1.0 - u)) * std::cos(6.283185307179586 * v);
+                value = model == LatencyModel::NORMAL ? a + b * z : a * std::exp(b * z);
+                break;
+            }
+            case LatencyModel::EXPONENTIAL:
+                value = -a * std::log(1.0 - u);
+                break;
+            }
+            if (!(value > 0.0)) return 0;
+            const double limit = static_cast<double>(std::max<std::int64_t>(max_ms, 0));
+            return static_cast<std::int64_t>(std::llround(std::min(value, limit)));
+        }
+
+        /// \brief Checks the parameters.
+        /// \return Empty string when valid, otherwise the error text.
+        std::string validate() const {
+            if (max_ms < 0) return "max_ms must be non-negative";
+            if (a < 0.0) return "first latency parameter must be non-negative";
+            if (model == LatencyModel::UNIFORM && b < a) return "uniform latency requires b >= a";
+            if ((model == LatencyModel::NORMAL || model == LatencyModel::LOG_NORMAL) && b < 0.0) {
+                return "latency spread must be non-negative";
+            }
+            return std::string();
+        }
+
+        /// \brief Serializes the distribution.
+        void to_json(nlohmann::json& j) const {
+            j["model"] = latency_model_to_string(model);
+            j["a"] = a;
+            j["b"] = b;
+            j["max_ms"] = max_ms;
+        }
+
+        /// \brief Reads the distribution; missing keys keep their values.
+        void from_json(const nlohmann::json& j) {
+            model = latency_model_from_string(j.value("model", latency_model_to_string(model)), model);
+            a = j.value("a", a);
+            b = j.value("b", b);
+            max_ms = j.value("max_ms", max_ms);
+        }
+    }; // LatencyDistribution
+
+} // namespace optionx::platforms::simulator
+
+#endif // OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_SIMULATION_RANDOM_HPP_INCLUDED
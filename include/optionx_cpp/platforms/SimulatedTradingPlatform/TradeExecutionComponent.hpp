@@ -0,0 +1,51 @@
+#pragma once
+#ifndef OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_TRADE_EXECUTION_COMPONENT_HPP_INCLUDED
+#define OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_TRADE_EXECUTION_COMPONENT_HPP_INCLUDED
+
+/// \file TradeExecutionComponent.hpp
+/// \brief Implements trade execution functionality for the simulated broker.
+
+namespace optionx::platforms::simulator {
+
+    /// \class TradeExecutionComponent
+    /// \brief Runs the shared trade queue for the simulated broker.
+    ///
+    /// The queue sends at most one order per `process()` call, and the platform
+    /// loop runs once per millisecond. `process_passes()` lets the platform run
+    /// extra passes per loop so a load test is not capped at 1000 orders/s.
+    class TradeExecutionComponent final : public components::BaseTradeExecutionComponent {
+    public:
+
+        /// \brief Constructs the trade execution component.
+        /// \param platform Reference to the trading platform.
+        /// \param account_info Shared pointer to account information data.
+        explicit TradeExecutionComponent(
+                BaseTradingPlatform& platform,
+                std::shared_ptr<BaseAccountInfoData> account_info)
+                : components::BaseTradeExecutionComponent(
+                    platform.event_bus(),
+                    std::move(account_info)) {
+            platform.register_component(this);
+        }
+
+        /// \brief Default destructor.
+        virtual ~TradeExecutionComponent() = default;
+
+        /// \brief Runs additional trade queue passes.
+        /// \param passes Number of passes.
+        void process_passes(int passes) {
+            for (int i = 0; i < passes; ++i) {
+                m_trade_queue.process();
+            }
+        }
+
+        /// \brief Returns the platform type.
+        /// \return Platform type identifier (`PlatformType::SIMULATOR`).
+        PlatformType platform_type() const override final {
+            return PlatformType::SIMULATOR;
+        }
+    }; // class TradeExecutionComponent
+
+} // namespace optionx::platforms::simulator
+
+#endif // OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_TRADE_EXECUTION_COMPONENT_HPP_INCLUDED
@@ -0,0 +1,461 @@
+#pragma once
+#ifndef OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_TRADE_MANAGER_HPP_INCLUDED
+#define OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_TRADE_MANAGER_HPP_INCLUDED
+
+/// \file TradeManager.hpp
+/// \brief Implements the simulated broker: fills, rejections, expiry resolution and balance updates.
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+namespace optionx::platforms::simulator {
+
+    /// \class TradeManager
+    /// \brief Plays the broker side of the order pipeline for the simulator.
+    ///
+    /// Each order sent by the trade queue gets a sequence number in send order.
+    /// Its rejection draw, open latency, close latency and seeded outcome come
+    /// from `SimulationRandom(seed, sequence)`. Fills are due at
+    /// `send_date + open latency` and results at `close_date + close latency`.
+    /// Both are kept in one min-heap ordered by due time and scheduling order,
+    /// and `process()` applies every action that is due.
+    ///
+    /// The schedule is owned by the platform loop. Closed trades and the
+    /// sequence counter are also read by `fetch_trade_history()` and
+    /// `fetch_trade_result()` from the caller's thread, so they are guarded
+    /// by `m_closed_mutex`.
+    class TradeManager final : public components::BaseComponent {
+    public:
+        using trade_result_check_callback_t = BaseTradingPlatform::trade_result_check_callback_t;
+        using trade_history_callback_t = BaseTradingPlatform::trade_history_callback_t;
+
+        /// \brief Constructs the trade manager.
+        /// \param platform Reference to the trading platform.
+        /// \param context Shared simulator state.
+        /// \param account_info Shared pointer to account information structure.
+        explicit TradeManager(
+                BaseTradingPlatform& platform,
+                SimulationContext& context,
+                std::shared_ptr<BaseAccountInfoData> account_info)
+                : BaseComponent(platform.event_bus()),
+                  m_context(context),
+                  m_account_info(std::move(account_info)) {
+            subscribe<events::TradeRequestEvent>();
+            subscribe<events::TradeStatusEvent>();
+            subscribe<events::OpenTradesEvent>();
+            platform.register_component(this);
+        }
+
+        /// \brief Default destructor.
+        virtual ~TradeManager() = default;
+
+        /// \brief Processes incoming events and dispatches them to appropriate handlers.
+        /// \param event The received event.
+        void on_event(const utils::Event* const event) override;
+
+        /// \brief Applies all fills and results that are due.
+        void process() override;
+
+        /// \brief Drops scheduled fills and results.
+        void shutdown() override;
+
+        /// \brief Returns closed simulated trades.
+        /// \param request History range and timestamp field.
+        /// \param callback Callback receiving the records, ordered by the selected timestamp.
+        /// \return True if the request was accepted; the callback runs before return.
+        bool fetch_trade_history(
+                const TradeHistoryRequest& request,
+                trade_history_callback_t callback);
+
+        /// \brief Returns the final result of a closed or rejected simulated trade.
+        /// \param query Trade identity; `option_id` is the simulator order ID.
+        /// \param result Partially filled result object to update.
+        /// \param callback Callback receiving the updated result.
+        /// \return True if the request was accepted; the callback runs before return.
+        bool fetch_trade_result(
+                TradeResultQuery query,
+                std::unique_ptr<TradeResult> result,
+                trade_result_check_callback_t callback);
+
+        /// \brief Returns the number of fills and results waiting for their due time.
+        std::size_t pending_actions() const noexcept {
+            return m_actions.size();
+        }
+
+        /// \brief Returns the number of orders received from the trade queue.
+        std::uint64_t sent_orders() const {
+            std::lock_guard<std::mutex> lock(m_closed_mutex);
+            return m_next_sequence;
+        }
+
+    private:
+        /// \brief Random values of one trade, drawn in a fixed order.
+        struct TradeDraws {
+            double       reject = 0.0;    ///< Compared with the rejection rate.
+            std::int64_t open_ms = 0;     ///< Send-to-fill latency.
+            std::int64_t close_ms = 0;    ///< Expiry-to-result latency.
+            double       outcome = 0.0;   ///< Outcome draw for SEEDED resolution.
+        };
+
+        enum class ActionType {
+            OPEN,  ///< Fill or reject a sent order.
+            CLOSE  ///< Resolve an expired trade.
+        };
+
+        struct Action {
+            std::int64_t  due_ms = 0;    ///< Time when the action becomes due.
+            std::uint64_t order = 0;     ///< Scheduling order, breaks due-time ties.
+            ActionType    type = ActionType::OPEN;
+            std::shared_ptr<TradeRequest> request;
+            std::shared_ptr<TradeResult>  result;
+        };
+
+        struct ActionLater {
+            bool operator()(const Action& lhs, const Action& rhs) const noexcept {
+                return lhs.due_ms != rhs.due_ms ? lhs.due_ms > rhs.due_ms : lhs.order > rhs.order;
+            }
+        };
+
+        struct ClosedTrade {
+            TradeRecord record;                  ///< History view of the trade.
+            std::unique_ptr<TradeResult> result; ///< Final result snapshot.
+        };
+
+        SimulationContext& m_context; ///< Shared simulator state.
+        std::shared_ptr<BaseAccountInfoData> m_account_info; ///< Shared pointer to account information.
+        std::priority_queue<Action, std::vector<Action>, ActionLater> m_actions; ///< Scheduled fills and results.
+        std::uint64_t m_next_order = 0;    ///< Next scheduling order.
+        mutable std::mutex m_closed_mutex; ///< Guards the sequence counter and closed trades.
+        std::uint64_t m_next_sequence = 0; ///< Next order sequence number.
+        std::map<std::int64_t, ClosedTrade> m_closed_trades; ///< Closed trades by option ID.
+        std::deque<std::int64_t> m_closed_order; ///< Option IDs in close order, for eviction.
+
+        /// \brief Handles a trade request event.
+        /// \param event The trade request event.
+        void handle_event(const events::TradeRequestEvent& event);
+
+        /// \brief Handles a trade status update event.
+        /// \param event The trade status event.
+        void handle_event(const events::TradeStatusEvent& event);
+
+        /// \brief Handles an OpenTradesEvent.
+        /// \param event The OpenTradesEvent containing the number of open trades.
+        void handle_event(const events::OpenTradesEvent& event);
+
+        /// \brief Draws the random values of a trade.
+        TradeDraws draw(std::uint64_t sequence) const;
+
+        /// \brief Adds an action to the schedule.
+        void schedule(
+                ActionType type,
+                std::int64_t due_ms,
+                std::shared_ptr<TradeRequest> request,
+                std::shared_ptr<TradeResult> result);
+
+        /// \brief Fills or rejects a sent order.
+        void open_trade(const Action& action);
+
+        /// \brief Resolves an expired trade.
+        void close_trade(const Action& action);
+
+        /// \brief Stores a closed or rejected trade for history and result queries.
+        /// \details Called before `trade_state` is published, so the final state is taken from `live_state`.
+        void store_closed_trade(const TradeRequest& request, const TradeResult& result);
+
+        /// \brief Retrieves account information as an `AccountInfoData` instance.
+        /// \return A shared pointer to `AccountInfoData` containing account details.
+        std::shared_ptr<AccountInfoData> get_account_info();
+
+        /// \brief Returns the sequence number encoded in a simulator option ID.
+        static std::uint64_t sequence_of(const TradeResult& result) noexcept {
+            return static_cast<std::uint64_t>(result.option_id - 1);
+        }
+    };
+
+    inline void TradeManager::on_event(const utils::Event* const event) {
+        if (const auto* msg = dynamic_cast<const events::TradeRequestEvent*>(event)) {
+            handle_event(*msg);
+        } else
+        if (const auto* msg = dynamic_cast<const events::TradeStatusEvent*>(event)) {
+            handle_event(*msg);
+        } else
+        if (const auto* msg = dynamic_cast<const events::OpenTradesEvent*>(event)) {
+            handle_event(*msg);
+        }
+    }
+
+    inline void TradeManager::process() {
+        if (m_actions.empty()) return;
+        const std::int64_t timestamp = OPTIONX_TIMESTAMP_MS;
+        while (!m_actions.empty() && m_actions.top().due_ms <= timestamp) {
+            Action action = m_actions.top();
+            m_actions.pop();
+            if (action.type == ActionType::OPEN) {
+                open_trade(action);
+            } else {
+                close_trade(action);
+            }
+        }
+    }
+
+    inline void TradeManager::shutdown() {
+        m_actions = decltype(m_actions)();
+    }
+
+    inline bool TradeManager::fetch_trade_history(
+            const TradeHistoryRequest& request,
+            trade_history_callback_t callback) {
+        if (!callback || !request.has_valid_range()) return false;
+
+        std::vector<TradeRecord> records;
+        std::unique_lock<std::mutex> lock(m_closed_mutex);
+        for (const auto& item : m_closed_trades) {
+            const auto& record = item.second.record;
+            // Rejected orders never opened, so they are results but not history.
+            if (record.trade_state == TradeState::OPEN_ERROR) continue;
+            if (request.range_mode != TimeRangeMode::NONE) {
+                const std::int64_t time_ms = select_timestamp_ms(record, request.time_field);
+                if (time_ms < request.start_ms) continue;
+                if (request.range_mode == TimeRangeMode::CLOSED && time_ms > request.stop_ms) continue;
+                if (request.range_mode == TimeRangeMode::HALF_OPEN && time_ms >= request.stop_ms) continue;
+            }
+            records.push_back(record);
+            if (!request.comment.empty()) records.back().comment = request.comment;
+        }
+        lock.unlock();
+
+        std::stable_sort(records.begin(), records.end(), [&request](const TradeRecord& lhs, const TradeRecord& rhs) {
+            return select_timestamp_ms(lhs, request.time_field) < select_timestamp_ms(rhs, request.time_field);
+        });
+        callback(TradeHistoryResult::ok(std::move(records)));
+        return true;
+    }
+
+    inline bool TradeManager::fetch_trade_result(
+            TradeResultQuery query,
+            std::unique_ptr<TradeResult> result,
+            trade_result_check_callback_t callback) {
+        if (!result || !callback) return false;
+
+        if (query.trade_id == 0) query.trade_id = result->trade_id;
+        if (query.option_id == 0) query.option_id = result->option_id;
+        result->platform_type = PlatformType::SIMULATOR;
+
+        // Copy under the lock; the callback runs unlocked so it may query again.
+        std::unique_ptr<TradeResult> closed;
+        bool in_flight = false;
+        {
+            std::lock_guard<std::mutex> lock(m_closed_mutex);
+            auto it = m_closed_trades.find(query.option_id);
+            if (it != m_closed_trades.end()) {
+                closed = it->second.result->clone_unique();
+            } else {
+                in_flight =
+                    query.option_id > 0 &&
+                    static_cast<std::uint64_t>(query.option_id) <= m_next_sequence;
+            }
+        }
+        if (closed) {
+            if (closed->trade_id == 0) closed->trade_id = query.trade_id;
+            callback(std::move(closed));
+            return true;
+        }
+
+        result->option_id = query.option_id;
+        result->trade_state = result->live_state = TradeState::CHECK_ERROR;
+        result->error_code = TradeErrorCode::INVALID_REQUEST;
+        result->error_desc = in_flight ? "Trade is not closed yet." : "Trade not found.";
+        callback(std::move(result));
+        return true;
+    }
+
+    inline void TradeManager::handle_event(const events::TradeRequestEvent& event) {
+        auto request = event.request;
+        auto result  = event.result;
+        if (!request || !result) return;
+
+        std::uint64_t sequence = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_closed_mutex);
+            sequence = m_next_sequence++;
+        }
+        result->option_id = static_cast<std::int64_t>(sequence + 1);
+        const std::int64_t due_ms = result->send_date + draw(sequence).open_ms;
+        schedule(ActionType::OPEN, due_ms, std::move(request), std::move(result));
+    }
+
+    inline void TradeManager::handle_event(const events::TradeStatusEvent& event) {
+        auto request = event.request;
+        auto result  = event.result;
+        if (!request || !result) {
+            LOGIT_ERROR("TradeStatusEvent received with null request or result.");
+            return;
+        }
+        if (result->option_id <= 0) return;
+        const std::int64_t due_ms = result->close_date + draw(sequence_of(*result)).close_ms;
+        schedule(ActionType::CLOSE, due_ms, std::move(request), std::move(result));
+    }
+
+    inline void TradeManager::handle_event(const events::OpenTradesEvent& event) {
+        using Status = events::AccountInfoUpdateEvent::Status;
+        auto account_info = get_account_info();
+        account_info->open_trades = event.open_trades;
+        notify(events::AccountInfoUpdateEvent(account_info, Status::OPEN_TRADES_CHANGED));
+    }
+
+    inline TradeManager::TradeDraws TradeManager::draw(std::uint64_t sequence) const {
+        const auto& config = m_context.config;
+        SimulationRandom rng(config.seed, sequence);
+        TradeDraws draws;
+        draws.reject = rng.uniform();
+        draws.open_ms = config.open_latency.sample(rng);
+        draws.close_ms = config.close_latency.sample(rng);
+        draws.outcome = rng.uniform();
+        return draws;
+    }
+
+    inline void TradeManager::schedule(
+            ActionType type,
+            std::int64_t due_ms,
+            std::shared_ptr<TradeRequest> request,
+            std::shared_ptr<TradeResult> result) {
+        Action action;
+        action.due_ms = due_ms;
+        action.order = m_next_order++;
+        action.type = type;
+        action.request = std::move(request);
+        action.result = std::move(result);
+        m_actions.push(std::move(action));
+    }
+
+    inline void TradeManager::open_trade(const Action& action) {
+        auto& request = action.request;
+        auto& result  = action.result;
+        // The queue may have finalized the trade already, e.g. on disconnect.
+        if (result->trade_state != TradeState::WAITING_OPEN) return;
+
+        const auto& config = m_context.config;
+        const auto draws = draw(sequence_of(*result));
+        auto account_info = get_account_info();
+
+        result->open_date = action.due_ms;
+        result->close_date = request->option_type == OptionType::SPRINT
+            ? result->open_date + time_shield::sec_to_ms(request->duration)
+            : time_shield::sec_to_ms(request->expiry_time);
+        result->delay = result->open_date - result->send_date;
+        result->ping = result->delay / 2;
+
+        if (!account_info->connect || draws.reject < config.rejection_rate) {
+            result->error_code = account_info->connect
+                ? TradeErrorCode::CANCELED_TRADE
+                : TradeErrorCode::NO_CONNECTION;
+            result->error_desc = account_info->connect
+                ? "Order rejected by simulator."
+                : to_str(TradeErrorCode::NO_CONNECTION);
+            result->live_state = TradeState::OPEN_ERROR;
+            store_closed_trade(*request, *result);
+            result->trade_state = TradeState::OPEN_ERROR;
+            return;
+        }
+
+        result->open_price = result->close_price =
+            m_context.price_feed.price_at(request->symbol, result->open_date);
+        result->live_state = TradeState::STANDOFF;
+        result->error_code = TradeErrorCode::SUCCESS;
+        result->payout = account_info->get_for_trade<double>(
+            AccountInfoType::PAYOUT,
+            request,
+            time_shield::ms_to_sec(result->open_date));
+
+        const double previous_balance = account_info->balance;
+        account_info->balance -= request->amount;
+        result->set_balance(account_info->balance);
+        if (!result->has_open_balance()) {
+            result->set_open_balance(previous_balance);
+        }
+        result->trade_state = TradeState::OPEN_SUCCESS;
+
+        using Status = events::AccountInfoUpdateEvent::Status;
+        notify(events::AccountInfoUpdateEvent(account_info, Status::BALANCE_UPDATED));
+    }
+
+    inline void TradeManager::close_trade(const Action& action) {
+        auto& request = action.request;
+        auto& result  = action.result;
+        if (result->trade_state != TradeState::WAITING_CLOSE) return;
+
+        const auto& config = m_context.config;
+        auto account_info = get_account_info();
+        TradeState state = TradeState::STANDOFF;
+
+        if (config.expiry_resolution == ExpiryResolution::SEEDED) {
+            const double outcome = draw(sequence_of(*result)).outcome;
+            state = outcome < config.win_rate
+                ? TradeState::WIN
+                : (outcome < config.win_rate + config.standoff_rate ? TradeState::STANDOFF : TradeState::LOSS);
+            // Keep prices consistent with the drawn outcome: one point in the right direction.
+            const double point = std::pow(10.0, -static_cast<double>(m_context.price_feed.digits(request->symbol)));
+            const double direction = request->order_type == OrderType::SELL ? -1.0 : 1.0;
+            const double move = state == TradeState::WIN ? point : (state == TradeState::LOSS ? -point : 0.0);
+            result->close_price = result->open_price + direction * move;
+        } else {
+            result->close_price = m_context.price_feed.price_at(request->symbol, result->close_date);
+            if (request->order_type == OrderType::BUY) {
+                if (result->close_price > result->open_price) state = TradeState::WIN;
+                if (result->close_price < result->open_price) state = TradeState::LOSS;
+            } else
+            if (request->order_type == OrderType::SELL) {
+                if (result->close_price < result->open_price) state = TradeState::WIN;
+                if (result->close_price > result->open_price) state = TradeState::LOSS;
+            }
+        }
+
+        result->profit =
+            state == TradeState::WIN ? result->payout * request->amount :
+            (state == TradeState::LOSS ? -request->amount : 0.0);
+        account_info->balance += request->amount + result->profit;
+        result->set_balance(account_info->balance);
+        if (result->has_open_balance()) {
+            result->set_close_balance(result->open_balance + result->profit);
+        }
+        result->live_state = state;
+        store_closed_trade(*request, *result);
+        result->trade_state = state;
+
+        using Status = events::AccountInfoUpdateEvent::Status;
+        notify(events::AccountInfoUpdateEvent(account_info, Status::BALANCE_UPDATED));
+    }
+
+    inline void TradeManager::store_closed_trade(const TradeRequest& request, const TradeResult& result) {
+        std::lock_guard<std::mutex> lock(m_closed_mutex);
+        const auto max_records = m_context.config.max_history_records;
+        if (max_records > 0) {
+            while (m_closed_order.size() >= max_records) {
+                m_closed_trades.erase(m_closed_order.front());
+                m_closed_order.pop_front();
+            }
+        }
+        auto& closed = m_closed_trades[result.option_id];
+        closed.result = result.clone_unique();
+        closed.result->trade_state = result.live_state;
+        closed.record = TradeRecord::from_trade(request, result);
+        closed.record.trade_state = result.live_state;
+        m_closed_order.push_back(result.option_id);
+    }
+
+    inline std::shared_ptr<AccountInfoData> TradeManager::get_account_info() {
+        if (auto account_info = std::dynamic_pointer_cast<AccountInfoData>(m_account_info)) {
+            return account_info;
+        }
+        LOGIT_FATAL("Failed to cast IAccountInfoData to AccountInfoData");
+        throw std::runtime_error("Invalid account information type");
+    }
+
+} // namespace optionx::platforms::simulator
+
+#endif // OPTIONX_HEADER_PLATFORMS_SIMULATED_TRADING_PLATFORM_TRADE_MANAGER_HPP_INCLUDED
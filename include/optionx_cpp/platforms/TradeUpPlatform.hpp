@@ -16,7 +16,10 @@
 #include "TradeUpPlatform/AccountInfoData.hpp"
 #include "TradeUpPlatform/http_utils.hpp"
 #include "TradeUpPlatform/http_parsers.hpp"
+#include "TradeUpPlatform/ws_parsers.hpp"
 #include "TradeUpPlatform/HttpClientComponent.hpp"
+#include "TradeUpPlatform/RequestManager.hpp"
+#include "TradeUpPlatform/WebSocketManager.hpp"
 #include "TradeUpPlatform/AuthManager.hpp"
 #include "TradeUpPlatform/BalanceManager.hpp"
 
@@ -29,8 +32,10 @@ namespace optionx::platforms {
         TradeUpPlatform()
             : BaseTradingPlatform(std::make_shared<tradeup::AccountInfoData>()),
               m_http_client(*this),
-              m_auth_manager(*this, m_http_client, m_account_info),
-              m_balance_manager(*this, m_http_client, m_account_info) {
+              m_request_manager(*this, m_http_client),
+              m_ws_manager(*this),
+              m_auth_manager(*this, m_request_manager, m_account_info),
+              m_balance_manager(*this, m_request_manager, m_account_info) {
         }
 
         ~TradeUpPlatform() override {
@@ -47,7 +52,11 @@ namespace optionx::platforms {
         }
 
     private:
+        friend class TradeUpPlatformTestAccess; ///< Test-only access to components; defined by tests.
+
         tradeup::HttpClientComponent m_http_client;
+        tradeup::RequestManager   m_request_manager;
+        tradeup::WebSocketManager m_ws_manager;
         tradeup::AuthManager      m_auth_manager;
         tradeup::BalanceManager   m_balance_manager;
     };
@@ -13,7 +13,7 @@ namespace optionx::platforms::tradeup {
     public:
         std::string   user_id;                      ///< User identifier
         double        balance      = 0.0;           ///< Account balance
-        const CurrencyType currency = CurrencyType::USD;   ///< Account currency
+        CurrencyType  currency     = CurrencyType::USD;   ///< Account currency
         AccountType   account_type = AccountType::UNKNOWN; ///< Account type
         bool          connect      = false;         ///< Connection status flag
 
@@ -60,6 +60,14 @@ namespace optionx::platforms::tradeup {
             }
             return {};
         }
+
+        AccountType get_info_account_type(const AccountInfoRequest& request) const override {
+            return account_type;
+        }
+
+        CurrencyType get_info_currency(const AccountInfoRequest& request) const override {
+            return currency;
+        }
     };
 
 } // namespace optionx::platforms::tradeup
@@ -23,11 +23,18 @@ namespace optionx::platforms::tradeup {
         }
 
         void on_event(const utils::Event* const event) override;
-        void process() override {}
-        void shutdown() override {}
+
+        void process() override {
+            m_task_manager.process();
+        }
+
+        void shutdown() override {
+            m_task_manager.shutdown();
+        }
 
     private:
         RequestManager& m_request_manager;
+        utils::TaskManager m_task_manager;
         std::shared_ptr<BaseAccountInfoData> m_account_info;
         std::unique_ptr<AuthData> m_temp_auth_data;
         std::shared_ptr<AuthData> m_auth_data;
@@ -275,8 +282,8 @@ namespace optionx::platforms::tradeup {
                 const auto cid_open = utils::make_cid();
 
                 await_once<events::WebSocketResultEvent>(
-                    [cid_open, token = std::move(token)](const auto& ev){ return ev.correlation_id == cid_open; },
-                    [this, cb = std::move(cb)](const events::WebSocketResultEvent& ev_open) mutable {
+                    [cid_open](const auto& ev){ return ev.correlation_id == cid_open; },
+                    [this, cb = std::move(cb), token = std::move(token)](const events::WebSocketResultEvent& ev_open) mutable {
                         if (!ev_open.success) {
                             // Точно знаем, что не подключились
                             std::string err = ev_open.error_message.empty()
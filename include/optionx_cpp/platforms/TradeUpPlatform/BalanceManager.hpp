@@ -8,37 +8,111 @@
 namespace optionx::platforms::tradeup {
 
     /// \class BalanceManager
+    /// \brief Owns the balance and currency of the TradeUp account snapshot.
+    /// \details Balances pushed by WebSocketManager arrive as BalanceUpdateEvent
+    ///          and HTTP answers arrive through RequestManager; both are applied
+    ///          here on the platform loop thread. HTTP polling is only a fallback
+    ///          used while the stream stays silent, or when a closed deal is not
+    ///          followed by a pushed balance.
     class BalanceManager final : public components::BaseComponent {
     public:
+
+        /// \brief Constructs the BalanceManager.
+        /// \param platform Reference to the trading platform.
+        /// \param request_manager Reference to the request manager for making HTTP requests.
+        /// \param account_info Shared pointer to the account information data.
         BalanceManager(BaseTradingPlatform& platform,
-                       HttpClientComponent& http_client,
+                       RequestManager& request_manager,
                        std::shared_ptr<BaseAccountInfoData> account_info)
             : BaseComponent(platform.event_bus()),
-              m_http_client(http_client),
+              m_request_manager(request_manager),
               m_account_info(std::move(account_info)) {
             subscribe<events::BalanceRequestEvent>();
+            subscribe<events::BalanceUpdateEvent>();
+            subscribe<events::BrokerTradeUpdateEvent>();
+            subscribe<events::DisconnectRequestEvent>();
+            m_last_balance_time = OPTIONX_TIMESTAMP_MS;
             platform.register_component(this);
         }
 
+        /// \brief Default destructor.
+        virtual ~BalanceManager() = default;
+
+        /// \brief Processes incoming events and dispatches them to the appropriate handlers.
+        /// \param event The received event.
         void on_event(const utils::Event* const event) override;
-        void process() override {}
-        void shutdown() override {}
+
+        /// \brief Sends a fallback balance request when the stream has been silent too long.
+        void process() override;
+
+        /// \brief Drops the pending balance request.
+        void shutdown() override {
+            m_request_in_flight = false;
+        }
 
     private:
-        HttpClientComponent& m_http_client;
-        std::shared_ptr<BaseAccountInfoData> m_account_info;
+        RequestManager& m_request_manager; ///< Reference to the request manager.
+        std::shared_ptr<BaseAccountInfoData> m_account_info; ///< Shared pointer to account information.
+        int64_t m_last_balance_time = 0;   ///< Time of the last applied balance or request, ms.
+        int64_t m_fallback_period_ms = time_shield::MS_PER_MIN; ///< Stream silence before HTTP polling.
+        int64_t m_deal_closed_time = 0;    ///< Close time of a deal still waiting for a balance, ms; 0 if none.
+        int64_t m_deal_balance_grace_ms = time_shield::MS_PER_5_SEC; ///< Wait for a pushed balance after a deal closes.
+        bool    m_request_in_flight = false; ///< Flag indicating an HTTP balance request is pending.
 
+        /// \brief Handles an explicit balance request.
         void handle_event(const events::BalanceRequestEvent& event);
+
+        /// \brief Applies a balance pushed by the broker stream.
+        void handle_event(const events::BalanceUpdateEvent& event);
+
+        /// \brief Waits for a balance after a broker deal closes.
+        void handle_event(const events::BrokerTradeUpdateEvent& event);
+
+        /// \brief Resets the fallback timer on disconnect.
+        void handle_event(const events::DisconnectRequestEvent& event);
+
+        /// \brief Sends an HTTP balance request unless one is pending.
         void request_balance();
+
+        /// \brief Writes a balance to the account snapshot and publishes the change.
+        /// \param balance Reported balance.
+        /// \param currency Reported currency, or `CurrencyType::UNKNOWN` to keep the current one.
+        /// \param account_type Account the balance belongs to, or `AccountType::UNKNOWN`.
+        void apply_balance(double balance, CurrencyType currency, AccountType account_type);
+
         std::shared_ptr<AccountInfoData> get_account_info();
     };
 
     inline void BalanceManager::on_event(const utils::Event* const event) {
+        if (const auto* msg = dynamic_cast<const events::BalanceUpdateEvent*>(event)) {
+            handle_event(*msg);
+        } else
+        if (const auto* msg = dynamic_cast<const events::BrokerTradeUpdateEvent*>(event)) {
+            handle_event(*msg);
+        } else
         if (const auto* msg = dynamic_cast<const events::BalanceRequestEvent*>(event)) {
             handle_event(*msg);
+        } else
+        if (const auto* msg = dynamic_cast<const events::DisconnectRequestEvent*>(event)) {
+            handle_event(*msg);
         }
     }
 
+    inline void BalanceManager::process() {
+        auto info = get_account_info();
+        if (!info || !info->connect) return;
+        const int64_t now_ms = OPTIONX_TIMESTAMP_MS;
+        if (m_deal_closed_time > 0 && now_ms - m_deal_closed_time >= m_deal_balance_grace_ms) {
+            m_deal_closed_time = 0;
+            LOGIT_DEBUG("TradeUp balance: no balance pushed after a deal closed, reconciling over HTTP.");
+            request_balance();
+            return;
+        }
+        if (now_ms - m_last_balance_time < m_fallback_period_ms) return;
+        LOGIT_DEBUG("TradeUp balance: stream is silent, falling back to HTTP.");
+        request_balance();
+    }
+
     inline std::shared_ptr<AccountInfoData> BalanceManager::get_account_info() {
         return std::dynamic_pointer_cast<AccountInfoData>(m_account_info);
     }
@@ -48,43 +122,70 @@ namespace optionx::platforms::tradeup {
         request_balance();
     }
 
+    inline void BalanceManager::handle_event(const events::BalanceUpdateEvent& event) {
+        apply_balance(event.balance, event.currency, event.account_type);
+    }
+
+    inline void BalanceManager::handle_event(const events::BrokerTradeUpdateEvent& event) {
+        if (!event.result || event.result->trade_state == TradeState::IN_PROGRESS) return;
+        auto info = get_account_info();
+        if (!info) return;
+        if (info->account_type != AccountType::UNKNOWN &&
+            info->account_type != event.result->account_type) {
+            return;
+        }
+        if (m_deal_closed_time == 0) m_deal_closed_time = OPTIONX_TIMESTAMP_MS;
+    }
+
+    inline void BalanceManager::handle_event(const events::DisconnectRequestEvent& event) {
+        (void)event;
+        m_last_balance_time = OPTIONX_TIMESTAMP_MS;
+        m_deal_closed_time = 0;
+    }
+
     inline void BalanceManager::request_balance() {
-        if (m_http_client.auth_token().empty()) return;
-        kurlyk::Headers headers = {
-            {"Accept", "application/json"},
-            {"Content-Type", "application/json"},
-            {"Cookie", m_http_client.session_cookie()},
-            {"X-API-TOKEN", m_http_client.auth_token()}
-        };
-        auto future = m_http_client.get_http_client().post(
-            "/api/v1/info",
-            kurlyk::QueryParams(),
-            headers,
-            "{}",
-            m_http_client.get_rate_limit(RateLimitType::BALANCE)
-        );
-        m_http_client.add_http_request_task(std::move(future), [this](kurlyk::HttpResponsePtr response){
-            if (!validate_response(response)) return;
-            double bal = 0.0; CurrencyType cur = CurrencyType::UNKNOWN;
-            if (parse_info_response(response->content, bal, cur)) {
-                auto info = get_account_info();
-                if (!info) return;
-                bool was_connected = info->connect;
-                info->balance = bal;
-                info->currency = cur;
-                info->connect = true;
-                auto status = was_connected ?
-                    events::AccountInfoUpdateEvent::Status::BALANCE_UPDATED :
-                    events::AccountInfoUpdateEvent::Status::CONNECTED;
-                notify(events::AccountInfoUpdateEvent(info, status));
-                std::string session = extract_cookie(response->headers, "multibrand_session");
-                if (!session.empty()) {
-                    m_http_client.set_session_cookie("nip-auth-token=" + m_http_client.auth_token() + "; multibrand_session=" + session);
-                }
+        if (m_request_in_flight) return;
+        m_request_in_flight = true;
+        m_last_balance_time = OPTIONX_TIMESTAMP_MS;
+        m_request_manager.request_balance([this](
+                bool success,
+                std::string error_message,
+                double balance,
+                CurrencyType currency) {
+            if (!m_request_in_flight) return;
+            m_request_in_flight = false;
+            if (!success) {
+                LOGIT_PRINT_WARN("TradeUp balance: request failed: ", error_message);
+                return;
             }
+            apply_balance(balance, currency, AccountType::UNKNOWN);
         });
     }
 
+    inline void BalanceManager::apply_balance(
+            double balance,
+            CurrencyType currency,
+            AccountType account_type) {
+        auto info = get_account_info();
+        if (!info) return;
+        // Both sockets stream balances; only the selected account is applied.
+        if (account_type != AccountType::UNKNOWN &&
+            info->account_type != AccountType::UNKNOWN &&
+            info->account_type != account_type) {
+            return;
+        }
+
+        m_last_balance_time = OPTIONX_TIMESTAMP_MS;
+        m_deal_closed_time = 0;
+        if (currency == CurrencyType::UNKNOWN) currency = info->currency;
+        if (info->balance == balance && info->currency == currency) return;
+
+        info->balance = balance;
+        info->currency = currency;
+        notify(events::AccountInfoUpdateEvent(
+            info, events::AccountInfoUpdateEvent::Status::BALANCE_UPDATED));
+    }
+
 } // namespace optionx::platforms::tradeup
 
 #endif // OPTIONX_HEADER_PLATFORMS_TRADE_UP_PLATFORM_BALANCE_MANAGER_HPP_INCLUDED
@@ -73,6 +73,16 @@ namespace optionx::platforms::tradeup {
                 int64_t expire
             )> result_callback);
 
+        /// \brief Requests the current account balance.
+        /// \param result_callback Callback receiving the balance and currency.
+        void request_balance(
+            std::function<void(
+                bool success,
+                std::string error_message,
+                double balance,
+                CurrencyType currency
+            )> result_callback);
+
     private:
         HttpClientComponent& m_client;      ///< Reference to the HTTP client component.
         kurlyk::Headers   m_api_headers; ///< Default API headers.
@@ -93,6 +103,28 @@ namespace optionx::platforms::tradeup {
             return m_client.get_rate_limit<T>(rate_limit_id);
         }
 
+        /// \brief Replaces a default API header.
+        /// \param name Header name.
+        /// \param value Header value.
+        void set_api_header(const std::string& name, std::string value) {
+            m_api_headers.erase(name);
+            m_api_headers.emplace(name, std::move(value));
+        }
+
+        /// \brief Updates one cookie in the default `Cookie` header.
+        /// \param name Cookie name.
+        /// \param value Cookie value.
+        void set_api_cookie(const std::string& name, const std::string& value) {
+            ::kurlyk::Cookies cookies;
+            const auto it = m_api_headers.find("Cookie");
+            if (it != m_api_headers.end()) {
+                cookies = ::kurlyk::utils::parse_cookie(it->second);
+            }
+            cookies.erase(name);
+            cookies.emplace(name, value);
+            set_api_header("Cookie", ::kurlyk::utils::to_cookie_string(cookies));
+        }
+
         /// \brief Adds a new HTTP request task to the list.
         /// \param future The future object representing the pending HTTP response.
         /// \param callback The callback function to handle the response.
@@ -109,7 +141,7 @@ namespace optionx::platforms::tradeup {
             std::shared_ptr<AuthData> auth_data, 
             const std::string &token) {
         if (!token.empty()) {
-            LOGIT_DEBUG(utils::redact_secret(token));
+            LOGIT_DEBUG(utils::redact_secret_value(token));
             
             auto& client = get_http_client();
             m_host = auth_data->host;
@@ -138,8 +170,8 @@ namespace optionx::platforms::tradeup {
             m_api_headers = {
                 {"Accept", "application/json, text/plain, */*"},
                 {"Content-Type", "application/json"},
-                {"ngsw-bypass", "true"}
-				{"X-API-TOKEN", token}
+                {"ngsw-bypass", "true"},
+                {"X-API-TOKEN", token}
             };
 
             m_token = token;
@@ -242,7 +274,7 @@ namespace optionx::platforms::tradeup {
 
             m_token = token;
             if (!token.empty()) {
-                m_api_headers.emplace("X-API-TOKEN", token);
+                set_api_header("X-API-TOKEN", token);
             } else {
                 const std::string error_message = "Token is empty — X-API-TOKEN header will not be added.";
                 LOGIT_ERROR(error_message);
@@ -258,7 +290,7 @@ namespace optionx::platforms::tradeup {
             }
             
             if (!cookies.empty()) {
-                m_api_headers.emplace("Cookie", cookies);
+                set_api_header("Cookie", cookies);
             } else {
                 const std::string error_message = "Cookie is empty.";
                 LOGIT_ERROR(error_message);
@@ -273,7 +305,7 @@ namespace optionx::platforms::tradeup {
                 return;
             }
 
-            LOGIT_DEBUG(user_id, utils::redact_secret(token), affs_id, utils::redact_secret(cookies));
+            LOGIT_DEBUG(user_id, utils::redact_secret_value(token), affs_id, utils::redact_secret_value(cookies));
             result_callback(
                 true, 
                 {}, 
@@ -352,7 +384,7 @@ namespace optionx::platforms::tradeup {
         );
 
         auto callback = [this, result_callback = std::move(result_callback)](kurlyk::HttpResponsePtr response) {
-            if (!validate_response(response, [&result_callback](std::string error_message){
+            if (!validate_response(response, [this, &result_callback](std::string error_message){
                     result_callback(false, std::move(error_message), {}, {}, m_token, {}, 0);
                 })) {
                 return;
@@ -375,10 +407,10 @@ namespace optionx::platforms::tradeup {
             auto [success, ret, message, cookies, expire] = *parsed_data;
             
             if (success && !cookies.empty()) {
-                m_api_headers.insert_or_assign("Cookie", cookies);
+                set_api_header("Cookie", cookies);
             }
 
-            LOGIT_DEBUG(success, ret, message, utils::redact_secret(cookies), expire);
+            LOGIT_DEBUG(success, ret, message, utils::redact_secret_value(cookies), expire);
 
             result_callback(success, {}, std::move(ret), std::move(message), m_token, std::move(cookies), expire);
         };
@@ -386,6 +418,53 @@ namespace optionx::platforms::tradeup {
         add_http_request_task(std::move(future), std::move(callback));
     }
 
+    inline void RequestManager::request_balance(
+            std::function<void(
+                bool success,
+                std::string error_message,
+                double balance,
+                CurrencyType currency
+            )> result_callback) {
+        LOGIT_TRACE0();
+
+        auto future = get_http_client().post(
+            "/api/v1/info",
+            kurlyk::QueryParams(),
+            m_api_headers,
+            "{}",
+            get_rate_limit(RateLimitType::BALANCE)
+        );
+
+        auto callback = [this, result_callback = std::move(result_callback)](kurlyk::HttpResponsePtr response) {
+            if (!validate_response(response, [&result_callback](std::string error_message){
+                    result_callback(false, std::move(error_message), 0.0, CurrencyType::UNKNOWN);
+                })) {
+                return;
+            }
+
+            auto parsed_data = parse_info_response(response->content);
+            if (!parsed_data) {
+                LOGIT_PRINT_ERROR(
+                     "Failed to process server response. Status code: ",
+                    (response ? response->status_code : -1)
+                );
+                result_callback(false, "Failed to process server response.", 0.0, CurrencyType::UNKNOWN);
+                return;
+            }
+            // The broker rotates multibrand_session on info requests;
+            // later requests must send the new value.
+            const std::string session = extract_cookie(response->headers, "multibrand_session");
+            if (!session.empty()) {
+                set_api_cookie("multibrand_session", session);
+            }
+
+            auto [balance, currency] = *parsed_data;
+            result_callback(true, {}, balance, currency);
+        };
+
+        add_http_request_task(std::move(future), std::move(callback));
+    }
+
 } // namespace optionx::platforms::tradeup
 
 #endif // OPTIONX_HEADER_PLATFORMS_TRADE_UP_PLATFORM_REQUEST_MANAGER_HPP_INCLUDED
@@ -8,11 +8,14 @@
 namespace optionx::platforms::tradeup {
 
     /// \class WebSocketManager
+    /// \details Stream frames are classified by their top-level `evt` value
+    ///          first; balance and deal frames are decoded and posted to the
+    ///          bus, everything else is dropped without building a document.
+    ///          Socket callbacks never touch the account snapshot.
     class WebSocketManager final : public components::BaseComponent {
     public:
         explicit WebSocketManager(BaseTradingPlatform& platform)
-            : BaseComponent(platform.event_bus())
-        {
+            : BaseComponent(platform.event_bus()) {
             subscribe<events::WebSocketAuthDataEvent>();
             subscribe<events::WebSocketRequestEvent>();
             subscribe<events::ConnectRequestEvent>();
@@ -59,7 +62,7 @@ namespace optionx::platforms::tradeup {
                         break;
                     }
                     case kurlyk::WebSocketEventType::WS_MESSAGE: {
-                        handle_real_message(e->message);
+                        handle_frame(e->message, AccountType::REAL);
                         break;
                     }
                     case kurlyk::WebSocketEventType::WS_CLOSE: {
@@ -127,7 +130,7 @@ namespace optionx::platforms::tradeup {
                         break;
                     }
                     case kurlyk::WebSocketEventType::WS_MESSAGE: {
-                        handle_demo_message(e->message);
+                        handle_frame(e->message, AccountType::DEMO);
                         break;
                     }
                     case kurlyk::WebSocketEventType::WS_CLOSE: {
@@ -204,6 +207,40 @@ namespace optionx::platforms::tradeup {
             m_demo_ws.set_max_send_queue_size(max);
         }
 
+        /// \brief Handles a text frame received on the real or demo socket.
+        /// \details Called from the socket thread. Balances are posted as
+        ///          BalanceUpdateEvent and deals as BrokerTradeUpdateEvent with
+        ///          `notify_async`, so their owners apply them on the platform loop.
+        /// \param frame Raw WebSocket text frame.
+        /// \param account_type Socket the frame arrived on.
+        void handle_frame(std::string_view frame, AccountType account_type) {
+            const auto event_type = detect_ws_event(frame);
+            switch (event_type) {
+                case WsEventType::BALANCES: {
+                    if (account_type == AccountType::REAL) {
+                        m_real_balance_ready = true;
+                    } else {
+                        m_demo_balance_ready = true;
+                    }
+                    WsBalanceUpdate update;
+                    if (!parse_ws_balances(frame, update)) break;
+                    notify_async(std::make_unique<events::BalanceUpdateEvent>(
+                        update.balance, update.currency, account_type));
+                    break;
+                }
+                case WsEventType::DEAL_OPENED:
+                case WsEventType::DEAL_CLOSED: {
+                    auto result = std::make_shared<TradeResult>();
+                    if (!parse_ws_deal(frame, event_type == WsEventType::DEAL_CLOSED, *result)) break;
+                    result->account_type = account_type;
+                    notify_async(std::make_unique<events::BrokerTradeUpdateEvent>(std::move(result)));
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+
     private:
         // Sockets
         kurlyk::WebSocketClient m_real_ws;
@@ -248,21 +285,6 @@ namespace optionx::platforms::tradeup {
         }
 
         // ---- Handlers ----
-        void handle_real_message(const std::string& msg) {
-            // Мини-детектор прихода балансов
-            if (msg.find("\"evt\":\"balancesResults\"") != std::string::npos) {
-                m_real_balance_ready = true;
-            }
-            // Тут можно парсить JSON и эмитить баланс/валюту
-            // notify(events::AccountInfoUpdateEvent(..., Status::BALANCE_UPDATED));
-        }
-
-        void handle_demo_message(const std::string& msg) {
-            if (msg.find("\"evt\":\"balancesResults\"") != std::string::npos) {
-                m_demo_balance_ready = true;
-            }
-        }
-
         void handle_event(const events::WebSocketAuthDataEvent& event) {
             if (auto auth_data = std::dynamic_pointer_cast<AuthData>(event.auth_data)) {
                 auto [ok, message] = auth_data->validate();
@@ -328,7 +350,7 @@ namespace optionx::platforms::tradeup {
 
                     // Таймаут ожидания приходов balancesResults
                     const auto epoch = ++m_open_epoch;
-                    m_task_manager.add_single_task(
+                    m_task_manager.add_delayed_task(
                         "ws_open_timeout",
                         15000, // 15s таймаут
                         [this](std::shared_ptr<utils::Task> task){
@@ -352,7 +374,7 @@ namespace optionx::platforms::tradeup {
 						[this](std::shared_ptr<utils::Task> task){
 							if (task->is_shutdown()) return;
 							if (!m_is_real_connected) return;
-							static constexpr const std::string ping_str("{\"id\":\"\",\"param\":\"\",\"operation\":\"PING\"}");
+							static constexpr const char* ping_str = R"({"id":"","param":"","operation":"PING"})";
 							log_ws_submit_result("REAL scheduled ping message", m_real_ws.submit_message(ping_str, 0, [](const std::error_code& ec){
 								LOGIT_ERROR_IF(ec, ec);
 							}));
@@ -364,7 +386,7 @@ namespace optionx::platforms::tradeup {
 						[this](std::shared_ptr<utils::Task> task){
 							if (task->is_shutdown()) return;
 							if (!m_is_demo_connected) return;
-							static constexpr const std::string ping_str("{\"id\":\"\",\"param\":\"\",\"operation\":\"PING\"}");
+							static constexpr const char* ping_str = R"({"id":"","param":"","operation":"PING"})";
 							log_ws_submit_result("DEMO scheduled ping message", m_demo_ws.submit_message(ping_str, 0, [](const std::error_code& ec){
 								LOGIT_ERROR_IF(ec, ec);
 							}));
@@ -388,7 +410,7 @@ namespace optionx::platforms::tradeup {
 
                 // Таймаут ожидания фактического закрытия обоих
                 const auto epoch = ++m_close_epoch;
-                m_task_manager.add_single_task(
+                m_task_manager.add_delayed_task(
                     "ws_close_timeout",
                     5000, // 5s
                     [this, epoch](std::shared_ptr<utils::Task> task){
@@ -441,7 +463,7 @@ namespace optionx::platforms::tradeup {
 
             // Рассылаем результат всем ожидающим cid
             for (const auto& cid : m_open_cid) {
-                notify_async(events::WebSocketResultEvent(
+                notify_async(std::make_unique<events::WebSocketResultEvent>(
                     cid, events::WebSocketAction::OPEN, success, error));
             }
             m_open_cid.clear();
@@ -462,7 +484,7 @@ namespace optionx::platforms::tradeup {
         void complete_close(bool success, std::string error) {
             ++m_close_epoch;
             for (const auto& cid : m_close_cid) {
-                notify_async(events::WebSocketResultEvent(
+                notify_async(std::make_unique<events::WebSocketResultEvent>(
                     cid, events::WebSocketAction::CLOSE, success, error));
             }
             m_close_cid.clear();
@@ -60,8 +60,7 @@ namespace optionx::platforms::tradeup {
         }
 		// Add nip-auth-token header from parsed token
 		if (!token.empty()) {
-			Cookie cookie_obj{"nip-auth-token", token};
-            set_cookie.emplace(cookie_obj.name, cookie_obj);
+			set_cookie.emplace("nip-auth-token", token);
         }
 
         cookies = kurlyk::utils::to_cookie_string(set_cookie);
@@ -99,7 +98,7 @@ namespace optionx::platforms::tradeup {
     /// \brief Parses /api/v1/session/extension response.
     /// \param content Raw JSON body (e.g., {"return":"true","success":true,"message":"OK","data":{"expire":1754682885}}).
     /// \return Optional SessionExtension; std::nullopt on failure.
-    inline std::optional<std::tuple<bool, std::string, std::string, std::string, int64_t>
+    inline std::optional<std::tuple<bool, std::string, std::string, std::string, int64_t>>
         parse_session_extension_response(
             const std::string& token,
             const std::string& content, 
@@ -118,7 +117,7 @@ namespace optionx::platforms::tradeup {
             }
 
             // Extract expire
-            int64_t expire = data["data"]["expire"].get<int64_t>();
+            int64_t expire = j.at("data").at("expire").get<int64_t>();
 			
 			// Parse "set-cookie" headers
 			::kurlyk::Cookies set_cookie;
@@ -129,11 +128,10 @@ namespace optionx::platforms::tradeup {
 
 			// Add nip-auth-token header from parsed token
 			if (!token.empty()) {
-				Cookie cookie_obj{"nip-auth-token", token};
-				set_cookie.emplace(cookie_obj.name, cookie_obj);
+				set_cookie.emplace("nip-auth-token", token);
 			}
             
-            cookies = kurlyk::utils::to_cookie_string(set_cookie);
+            std::string cookies = kurlyk::utils::to_cookie_string(set_cookie);
             if (cookies.empty()) {
                 LOGIT_PRINT_ERROR("No cookies were found in the sign-in response.");
             }
@@ -159,6 +157,53 @@ namespace optionx::platforms::tradeup {
         return std::nullopt;
     }
 
+    /// \brief Parses /api/v1/info response.
+    /// \details Reads `balance` and the optional `currency` from the `data`
+    ///          object, or from the root when there is no `data`.
+    /// \param content Raw JSON body.
+    /// \return Optional tuple (balance, currency); std::nullopt on failure.
+    inline std::optional<std::tuple<double, CurrencyType>>
+        parse_info_response(const std::string& content) {
+        try {
+            const auto j = nlohmann::json::parse(content);
+            const auto it = j.find("data");
+            const auto& data = (it != j.end() && it->is_object()) ? *it : j;
+
+            const auto balance = data.find("balance");
+            if (balance == data.end()) {
+                LOGIT_PRINT_ERROR("Info response is missing 'balance' field.");
+                return std::nullopt;
+            }
+            const double value = balance->is_string()
+                ? std::stod(balance->get<std::string>())
+                : balance->get<double>();
+
+            CurrencyType currency = CurrencyType::UNKNOWN;
+            const auto currency_it = data.find("currency");
+            if (currency_it != data.end() && currency_it->is_string()) {
+                to_enum(currency_it->get<std::string>(), currency);
+            }
+            return std::make_tuple(value, currency);
+        } catch (const nlohmann::json::parse_error& e) {
+#           ifdef OPTIONX_LOG_UNIQUE_FILE_INDEX
+            const int log_index = OPTIONX_LOG_UNIQUE_FILE_INDEX;
+            LOGIT_STREAM_ERROR_TO(log_index) << content;
+            LOGIT_PRINT_ERROR(
+                "JSON parse error: ", e.what(),
+                ". Content log was written to file: ",
+                LOGIT_GET_LAST_FILE_NAME(log_index)
+            );
+#           else
+            LOGIT_PRINT_ERROR("JSON parse error: ", e.what());
+#           endif
+        } catch (const std::exception& e) {
+            LOGIT_PRINT_ERROR("Unexpected error: ", e.what());
+        } catch (...) {
+            LOGIT_PRINT_ERROR("Unknown error.");
+        }
+        return std::nullopt;
+    }
+
 } // namespace optionx::platforms::tradeup
 
 #endif // OPTIONX_HEADER_PLATFORMS_TRADE_UP_PLATFORM_HTTP_PARSERS_HPP_INCLUDED
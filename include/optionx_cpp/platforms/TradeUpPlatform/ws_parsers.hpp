@@ -0,0 +1,258 @@
+#pragma once
+#ifndef OPTIONX_HEADER_PLATFORMS_TRADE_UP_PLATFORM_WS_PARSERS_HPP_INCLUDED
+#define OPTIONX_HEADER_PLATFORMS_TRADE_UP_PLATFORM_WS_PARSERS_HPP_INCLUDED
+
+/// \file ws_parsers.hpp
+/// \brief Event detection and field parsers for TradeUp WebSocket frames.
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+namespace optionx::platforms::tradeup {
+
+    /// \enum WsEventType
+    /// \brief TradeUp stream events handled by WebSocketManager.
+    enum class WsEventType {
+        UNKNOWN = 0,  ///< Event is not handled; the frame is dropped without building a document.
+        BALANCES,     ///< `balancesResults`: account balance snapshot.
+        DEAL_OPENED,  ///< `dealOpened`: trade accepted by the broker.
+        DEAL_CLOSED   ///< `dealClosed`: trade settled by the broker.
+    };
+
+    /// \struct WsBalanceUpdate
+    /// \brief Fields extracted from a `balancesResults` frame.
+    struct WsBalanceUpdate {
+        double       balance  = 0.0;                    ///< Account balance.
+        CurrencyType currency = CurrencyType::UNKNOWN;  ///< Account currency, if reported.
+    };
+
+    namespace detail {
+
+        /// \class WsEventNameSax
+        /// \brief SAX handler that captures the string value of the top-level `evt` key.
+        /// \details Keys of nested objects are ignored. Parsing stops as soon as
+        ///          the value is read, so frames that start with `evt` are not
+        ///          scanned further.
+        class WsEventNameSax final : public nlohmann::json_sax<nlohmann::json> {
+        public:
+            std::string name; ///< Captured event name; empty when missing.
+
+            bool null() override { return value(); }
+            bool boolean(bool) override { return value(); }
+            bool number_integer(number_integer_t) override { return value(); }
+            bool number_unsigned(number_unsigned_t) override { return value(); }
+            bool number_float(number_float_t, const string_t&) override { return value(); }
+            bool binary(binary_t&) override { return value(); }
+
+            bool string(string_t& str) override {
+                if (!m_is_evt_value) return true;
+                name = std::move(str);
+                return false;
+            }
+
+            bool start_object(std::size_t) override {
+                ++m_depth;
+                return value();
+            }
+
+            bool key(string_t& str) override {
+                m_is_evt_value = m_depth == 1 && str == "evt";
+                return true;
+            }
+
+            bool end_object() override {
+                --m_depth;
+                return true;
+            }
+
+            bool start_array(std::size_t) override {
+                ++m_depth;
+                return value();
+            }
+
+            bool end_array() override {
+                --m_depth;
+                return true;
+            }
+
+            bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception&) override {
+                return false;
+            }
+
+        private:
+            int  m_depth = 0;
+            bool m_is_evt_value = false;
+
+            bool value() noexcept {
+                m_is_evt_value = false;
+                return true;
+            }
+        };
+
+    } // namespace detail
+
+    /// \brief Returns the value of the top-level `evt` key.
+    /// \details Runs a SAX pass without building a document; `evt` keys of
+    ///          nested objects do not count.
+    /// \param frame Raw WebSocket text frame.
+    /// \return Event name, or an empty string when the key is missing or the frame is invalid.
+    inline std::string find_ws_event_name(std::string_view frame) {
+        detail::WsEventNameSax sax;
+        nlohmann::json::sax_parse(frame.begin(), frame.end(), &sax);
+        return std::move(sax.name);
+    }
+
+    /// \brief Classifies a frame by its top-level `evt` value.
+    /// \note Only `balancesResults` was seen in captured traffic so far. The
+    ///       deal event names are kept in this single table so they can be
+    ///       corrected in one place.
+    inline WsEventType detect_ws_event(std::string_view frame) {
+        const auto name = find_ws_event_name(frame);
+        if (name == "balancesResults") return WsEventType::BALANCES;
+        if (name == "dealOpened") return WsEventType::DEAL_OPENED;
+        if (name == "dealClosed") return WsEventType::DEAL_CLOSED;
+        return WsEventType::UNKNOWN;
+    }
+
+    /// \brief Parses a frame into a document without throwing.
+    /// \return Parsed document; `is_discarded()` is true for invalid JSON.
+    inline nlohmann::json parse_ws_frame(std::string_view frame) {
+        return nlohmann::json::parse(frame.begin(), frame.end(), nullptr, false);
+    }
+
+    /// \brief Returns the top-level `data` payload of a frame, or the frame itself.
+    inline const nlohmann::json& ws_event_payload(const nlohmann::json& j) {
+        if (!j.is_object()) return j;
+        const auto it = j.find("data");
+        return it != j.end() ? *it : j;
+    }
+
+    /// \brief Reads a numeric field sent either as a JSON number or a numeric string.
+    inline bool read_ws_number(const nlohmann::json& object, const char* key, double& value) {
+        const auto it = object.find(key);
+        if (it == object.end()) return false;
+        if (it->is_number()) {
+            value = it->get<double>();
+            return true;
+        }
+        if (!it->is_string()) return false;
+        const auto& str = it->get_ref<const std::string&>();
+        if (str.empty()) return false;
+        char* end = nullptr;
+        const double parsed = std::strtod(str.c_str(), &end);
+        if (end != str.c_str() + str.size()) return false;
+        value = parsed;
+        return true;
+    }
+
+    /// \brief Reads a timestamp in seconds or milliseconds and returns milliseconds.
+    inline bool read_ws_time_ms(const nlohmann::json& object, const char* key, int64_t& value) {
+        double raw = 0.0;
+        if (!read_ws_number(object, key, raw)) return false;
+        const auto time = static_cast<int64_t>(raw);
+        value = time < 100000000000LL ? time * 1000 : time;
+        return true;
+    }
+
+    /// \brief Parses a `balancesResults` frame.
+    /// \details Reads `balance` (or `amount`) and `currency` from the top-level
+    ///          `data` object, or from its first element when `data` is a list.
+    /// \param frame Raw WebSocket text frame.
+    /// \param update Receives balance and currency.
+    /// \return `true` when a balance was found.
+    inline bool parse_ws_balances(std::string_view frame, WsBalanceUpdate& update) {
+        const auto j = parse_ws_frame(frame);
+        if (j.is_discarded()) return false;
+
+        const nlohmann::json* entry = &ws_event_payload(j);
+        if (entry->is_array()) {
+            if (entry->empty()) return false;
+            entry = &entry->front();
+        }
+        if (!entry->is_object()) return false;
+
+        double balance = 0.0;
+        if (!read_ws_number(*entry, "balance", balance) &&
+            !read_ws_number(*entry, "amount", balance)) {
+            return false;
+        }
+        update.balance = balance;
+
+        const auto currency = entry->find("currency");
+        if (currency != entry->end() && currency->is_string()) {
+            CurrencyType value = CurrencyType::UNKNOWN;
+            if (to_enum(currency->get_ref<const std::string&>(), value)) {
+                update.currency = value;
+            }
+        }
+        return true;
+    }
+
+    /// \brief Maps a deal status string to a trade state.
+    /// \param status Broker status, may be empty.
+    /// \param profit Deal profit, used when the status is missing.
+    /// \param closed `true` for `dealClosed` frames.
+    inline TradeState parse_ws_deal_status(const std::string& status, double profit, bool closed) {
+        if (status == "win" || status == "won") return TradeState::WIN;
+        if (status == "loss" || status == "lose" || status == "lost") return TradeState::LOSS;
+        if (status == "draw" || status == "standoff") return TradeState::STANDOFF;
+        if (status == "refund" || status == "canceled") return TradeState::REFUND;
+        if (!closed) return TradeState::IN_PROGRESS;
+        if (profit > 0.0) return TradeState::WIN;
+        if (profit < 0.0) return TradeState::LOSS;
+        return TradeState::STANDOFF;
+    }
+
+    /// \brief Parses a `dealOpened`/`dealClosed` frame into a trade snapshot.
+    /// \param frame Raw WebSocket text frame.
+    /// \param closed `true` for `dealClosed` frames.
+    /// \param result Receives broker ID, prices, times, amounts, and state.
+    /// \return `true` when the top-level `data` object carries a deal ID.
+    inline bool parse_ws_deal(std::string_view frame, bool closed, TradeResult& result) {
+        const auto j = parse_ws_frame(frame);
+        if (j.is_discarded()) return false;
+
+        const auto& deal = ws_event_payload(j);
+        if (!deal.is_object()) return false;
+
+        const auto id = deal.find("id");
+        if (id == deal.end()) return false;
+        if (id->is_number_integer()) {
+            result.option_id = id->get<int64_t>();
+            result.option_hash = std::to_string(result.option_id);
+        } else
+        if (id->is_string() && !id->get_ref<const std::string&>().empty()) {
+            result.option_hash = id->get<std::string>();
+        } else {
+            return false;
+        }
+
+        read_ws_number(deal, "amount", result.amount);
+        read_ws_number(deal, "profit", result.profit);
+        double payout = 0.0;
+        if (read_ws_number(deal, "payout", payout)) {
+            result.payout = payout > 1.0 ? payout / 100.0 : payout;
+        }
+        read_ws_number(deal, "openRate", result.open_price);
+        read_ws_number(deal, "closeRate", result.close_price);
+        read_ws_time_ms(deal, "openTime", result.open_date);
+        read_ws_time_ms(deal, "closeTime", result.close_date);
+
+        const auto status = deal.find("status");
+        result.trade_state = parse_ws_deal_status(
+            status != deal.end() && status->is_string()
+                ? status->get<std::string>()
+                : std::string(),
+            result.profit,
+            closed);
+        result.live_state = result.trade_state;
+        result.platform_type = PlatformType::TRADEUP;
+        return true;
+    }
+
+} // namespace optionx::platforms::tradeup
+
+#endif // OPTIONX_HEADER_PLATFORMS_TRADE_UP_PLATFORM_WS_PARSERS_HPP_INCLUDED
@@ -2,7 +2,7 @@
 #ifndef OPTIONX_HEADER_STORAGES_HPP_INCLUDED
 #define OPTIONX_HEADER_STORAGES_HPP_INCLUDED
 
-#include "crypto.hpp"
+#include "utils/crypto.hpp"
 #include "utils.hpp"
 #include "storages/common.hpp"
 #include "storages/ServiceSessionDB.hpp"
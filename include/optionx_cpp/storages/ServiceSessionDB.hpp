@@ -11,7 +11,9 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include <mdbx_containers/KeyValueTable.hpp>
@@ -50,6 +52,13 @@ namespace optionx::storage {
 
     /// \class ServiceSessionDB
     /// \brief Manages encrypted broker session data using an MDBX key-value table.
+    /// \details Decrypted values are cached per key with write-through, so
+    ///          repeated logins skip the database and AES work. Cache misses
+    ///          read and decrypt under the shared lock; the exclusive lock is
+    ///          only taken to publish the result. Values are stored as tagged
+    ///          binary ciphertext; legacy Base64 rows are still readable and
+    ///          are rewritten on first access once a caller-supplied key is
+    ///          set and the decrypted value checks out.
     class ServiceSessionDB {
     public:
 
@@ -88,16 +97,18 @@ namespace optionx::storage {
         }
 
         /// \brief Sets the encryption key.
+        /// \details Drops cached values, since stored rows are decrypted with the active key.
         /// \tparam T Type of the encryption key container (e.g., std::array, std::vector).
         /// \param key New encryption key.
         /// \return True if key is set successfully.
         template<class T>
         bool set_key(const T& key) {
-            std::lock_guard<std::mutex> lock(m_mutex);
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
             const bool success = m_aes.set_key(key);
             if (success) {
                 m_key_source = is_default_key(key) ? KeySource::DEFAULT : KeySource::CUSTOM;
                 m_default_key_warning_logged = false;
+                clear_cache();
             }
             return success;
         }
@@ -106,20 +117,20 @@ namespace optionx::storage {
         /// \details The default key is useful for tests and simple local apps, but
         /// should be treated as obfuscation rather than strong secret protection.
         bool uses_default_key() const {
-            std::lock_guard<std::mutex> lock(m_mutex);
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
             return m_key_source == KeySource::DEFAULT;
         }
 
         /// \brief Returns true after a caller-provided non-default key is installed.
         bool has_custom_key() const {
-            std::lock_guard<std::mutex> lock(m_mutex);
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
             return m_key_source == KeySource::CUSTOM;
         }
 
         /// \brief Checks whether the session database was opened successfully.
         /// \return True when the backing database is available.
         bool is_open() const {
-            std::lock_guard<std::mutex> lock(m_mutex);
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
             return static_cast<bool>(m_db);
         }
 
@@ -128,27 +139,50 @@ namespace optionx::storage {
         /// \param email Email address.
         /// \return Session value as a string, or std::nullopt if not found.
         std::optional<std::string> get_session_value(const std::string& platform, const std::string& email) {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            if (!m_db) {
-                LOGIT_WARN("Session database is not open.");
-                return std::nullopt;
+            const std::string key = make_key(platform, email);
+            LoadedRow row;
+            std::uint64_t generation = 0;
+            {
+                std::shared_lock<std::shared_mutex> lock(m_mutex);
+                if (!m_db) {
+                    LOGIT_WARN("Session database is not open.");
+                    return std::nullopt;
+                }
+                auto it = m_cache.find(key);
+                if (it != m_cache.end()) return it->second;
+
+                generation = m_generation;
+                try {
+                    row = load_value(key);
+                } catch (const mdbxc::MdbxException& ex) {
+                    LOGIT_PRINT_ERROR("Database error: ", ex);
+                    return std::nullopt;
+                } catch (const std::exception& ex) {
+                    LOGIT_PRINT_ERROR("General error: ", ex);
+                    return std::nullopt;
+                }
             }
-            std::string key = platform + ":" + email;
-            try {
-                std::string base64_encrypted_value;
-                auto result = m_db->find(utils::Base64::encode(key));
-                if (!result) return std::nullopt;
-                base64_encrypted_value = *result;
-                if (base64_encrypted_value.empty()) return std::nullopt;
-                std::string value = m_aes.decrypt(utils::Base64::decode(base64_encrypted_value));
-                if (value.empty()) return std::nullopt;
-                return {value};
-            } catch (const mdbxc::MdbxException& ex) {
-                LOGIT_PRINT_ERROR("Database error: ", ex);
-            } catch (const std::exception& ex) {
-                LOGIT_PRINT_ERROR("General error: ", ex);
-            };
-            return std::nullopt;
+
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
+            // The key, the table or the cache changed while decoding; the
+            // value is still a valid read, but must not be cached or migrated.
+            if (!m_db || m_generation != generation) return row.value;
+            // A concurrent login, store or remove already settled this key.
+            auto it = m_cache.find(key);
+            if (it != m_cache.end()) {
+                wipe(row.value);
+                return it->second;
+            }
+
+            if (!row.migrated.empty()) {
+                try {
+                    m_db->insert_or_assign(utils::Base64::encode(key), row.migrated);
+                } catch (const std::exception& ex) {
+                    LOGIT_WARN("Session row migration failed: ", ex.what());
+                }
+            }
+            m_cache[key] = row.value;
+            return row.value;
         }
 
         /// \brief Stores session value for a specific platform and email.
@@ -157,21 +191,23 @@ namespace optionx::storage {
         /// \param value Session value to store.
         /// \return True if session value is stored successfully, otherwise false.
         bool set_session_value(const std::string& platform, const std::string& email, const std::string& value) {
-            std::lock_guard<std::mutex> lock(m_mutex);
+            const std::string key = make_key(platform, email);
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
             if (!m_db) {
                 LOGIT_WARN("Session database is not open.");
                 return false;
             }
-            std::string key = platform + ":" + email;
             try {
                 warn_default_key_once();
-                m_db->insert_or_assign(utils::Base64::encode(key), utils::Base64::encode(m_aes.encrypt(value)));
+                store_value(key, value);
+                m_cache[key] = value.empty() ? std::nullopt : std::optional<std::string>(value);
                 return true;
             } catch(const mdbxc::MdbxException& ex){
                 LOGIT_PRINT_ERROR("Database error: ", ex);
             } catch(const std::exception& ex){
                 LOGIT_PRINT_ERROR("General error: ", ex);
             }
+            erase_cached(key);
             return false;
         }
 
@@ -180,14 +216,16 @@ namespace optionx::storage {
         /// \param email Email address.
         /// \return True if session value is removed successfully, otherwise false.
         bool remove_session(const std::string& platform, const std::string& email) {
-            std::lock_guard<std::mutex> lock(m_mutex);
+            const std::string key = make_key(platform, email);
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
             if (!m_db) {
                 LOGIT_WARN("Session database is not open.");
                 return false;
             }
-            std::string key = platform + ":" + email;
+            erase_cached(key);
             try {
                 m_db->erase(utils::Base64::encode(key));
+                m_cache[key] = std::nullopt;
                 return true;
             } catch(const mdbxc::MdbxException& ex){
                 LOGIT_PRINT_ERROR("Database error: ", ex);
@@ -200,11 +238,12 @@ namespace optionx::storage {
         /// \brief Clears all session data from the database.
         /// \return True if database is cleared successfully, otherwise false.
         bool clear() {
-            std::lock_guard<std::mutex> lock(m_mutex);
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
             if (!m_db) {
                 LOGIT_WARN("Session database is not open.");
                 return false;
             }
+            clear_cache();
             try {
                 m_db->clear();
                 return true;
@@ -217,13 +256,14 @@ namespace optionx::storage {
         }
 
         /// \brief Shuts down session service.
-        /// \details Disconnects database and clears encryption key.
+        /// \details Disconnects database, wipes cached values and clears encryption key.
         void shutdown() {
-            std::lock_guard<std::mutex> lock(m_mutex);
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
             if (m_db) {
                 m_db->disconnect();
                 m_db.reset();
             }
+            clear_cache();
             m_aes.clear_key();
             m_key_source = KeySource::NONE;
             m_default_key_warning_logged = false;
@@ -236,11 +276,22 @@ namespace optionx::storage {
             CUSTOM
         };
 
-        mutable std::mutex m_mutex; ///< Mutex for thread safety.
+        /// \brief Result of reading one row outside the exclusive lock.
+        struct LoadedRow {
+            std::optional<std::string> value; ///< Decrypted value; nullopt when missing.
+            std::string migrated;             ///< Binary row that replaces a verified legacy row; empty if none.
+        };
+
+        /// \brief Leading byte of binary ciphertext rows; never produced by Base64.
+        static constexpr char kBinaryValueTag = '\x01';
+
+        mutable std::shared_mutex m_mutex; ///< Shared for cache hits, exclusive for database access.
         crypto::AESCrypt m_aes;   ///< AES encryption and decryption instance.
         std::unique_ptr<mdbxc::KeyValueTable<std::string, std::string>> m_db; ///< MDBX-backed session key-value table.
+        std::unordered_map<std::string, std::optional<std::string>> m_cache; ///< Decrypted values by "platform:email"; nullopt = known missing.
         KeySource m_key_source = KeySource::NONE; ///< Source of the currently active AES key, if any.
         bool m_default_key_warning_logged = false; ///< Suppresses repeated default-key warnings.
+        std::uint64_t m_generation = 0; ///< Bumped by clear_cache(); stale cache misses are not published.
 
         /// \brief Private constructor for singleton pattern.
         ServiceSessionDB() : ServiceSessionDB(default_config()) {}
@@ -252,6 +303,123 @@ namespace optionx::storage {
             0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F
         }};
 
+        static std::string make_key(const std::string& platform, const std::string& email) {
+            std::string key;
+            key.reserve(platform.size() + 1 + email.size());
+            key += platform;
+            key += ':';
+            key += email;
+            return key;
+        }
+
+        /// \brief Reads and decrypts a row; called under the shared lock.
+        /// \details Row keys stay Base64-encoded so rows written by earlier
+        ///          versions remain addressable. A legacy row is returned once
+        ///          its CBC padding checks out, as before. That check alone
+        ///          passes for a wrong key about once in 256 tries, so the
+        ///          binary replacement is only prepared under a custom key and
+        ///          when the plaintext is also well-formed text; any other
+        ///          legacy row is left untouched.
+        LoadedRow load_value(const std::string& key) {
+            LoadedRow row;
+            auto result = m_db->find(utils::Base64::encode(key));
+            if (!result || result->empty()) return row;
+
+            std::string value;
+            if ((*result)[0] == kBinaryValueTag) {
+                value = m_aes.decrypt(result->substr(1));
+            } else {
+                value = m_aes.decrypt(utils::Base64::decode(*result));
+                // Under the default key the row may belong to a custom key
+                // that has not been set yet, so it is never rewritten.
+                if (m_key_source == KeySource::CUSTOM) {
+                    if (is_session_text(value)) {
+                        row.migrated = encode_value(value);
+                    } else {
+                        LOGIT_WARN("Legacy session row is not UTF-8 text; keeping it in the legacy format.");
+                    }
+                }
+            }
+            if (!value.empty()) row.value = std::move(value);
+            return row;
+        }
+
+        /// \brief Checks that a decrypted value is well-formed UTF-8 text.
+        /// \details Tokens, cookies and JSON blobs pass; C0 controls other than
+        ///          tab, CR and LF, DEL, overlong forms, surrogates and code
+        ///          points above U+10FFFF do not. A random 16-byte block passes
+        ///          with a probability well below 1e-6.
+        static bool is_session_text(const std::string& value) {
+            const auto* data = reinterpret_cast<const unsigned char*>(value.data());
+            const std::size_t size = value.size();
+            std::size_t i = 0;
+            while (i < size) {
+                const unsigned char lead = data[i];
+                if (lead < 0x80) {
+                    if ((lead < 0x20 && lead != '\t' && lead != '\n' && lead != '\r') || lead == 0x7F) {
+                        return false;
+                    }
+                    ++i;
+                    continue;
+                }
+
+                std::size_t length = 0;
+                unsigned char min_next = 0x80;
+                unsigned char max_next = 0xBF;
+                if (lead >= 0xC2 && lead <= 0xDF) {
+                    length = 2;
+                } else if (lead >= 0xE0 && lead <= 0xEF) {
+                    length = 3;
+                    if (lead == 0xE0) min_next = 0xA0; // overlong
+                    if (lead == 0xED) max_next = 0x9F; // surrogates
+                } else if (lead >= 0xF0 && lead <= 0xF4) {
+                    length = 4;
+                    if (lead == 0xF0) min_next = 0x90; // overlong
+                    if (lead == 0xF4) max_next = 0x8F; // above U+10FFFF
+                } else {
+                    return false;
+                }
+                if (size - i < length) return false;
+                if (data[i + 1] < min_next || data[i + 1] > max_next) return false;
+                for (std::size_t k = 2; k < length; ++k) {
+                    if (data[i + k] < 0x80 || data[i + k] > 0xBF) return false;
+                }
+                i += length;
+            }
+            return true;
+        }
+
+        void store_value(const std::string& key, const std::string& value) {
+            m_db->insert_or_assign(utils::Base64::encode(key), encode_value(value));
+        }
+
+        std::string encode_value(const std::string& value) const {
+            std::string row(1, kBinaryValueTag);
+            row += m_aes.encrypt(value);
+            return row;
+        }
+
+        void erase_cached(const std::string& key) {
+            auto it = m_cache.find(key);
+            if (it == m_cache.end()) return;
+            wipe(it->second);
+            m_cache.erase(it);
+        }
+
+        void clear_cache() {
+            ++m_generation;
+            for (auto& item : m_cache) {
+                wipe(item.second);
+            }
+            m_cache.clear();
+        }
+
+        static void wipe(std::optional<std::string>& value) {
+            if (value && !value->empty()) {
+                crypto::secure_clear(&(*value)[0], value->size());
+            }
+        }
+
         void initialize_default_key() {
             m_aes.set_key(kDefaultKey);
             m_key_source = KeySource::DEFAULT;
@@ -5,8 +5,9 @@
 /// \file TradeMetaStatsCalculator.hpp
 /// \brief Computes meta-statistics (available values + per-value breakdowns) over trade records.
 
-#include <memory>
+#include <algorithm>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "data/trading.hpp"
@@ -16,6 +17,11 @@ namespace optionx::storage {
 
     /// \class TradeMetaStatsCalculator
     /// \brief Static calculator producing per-dimension statistics (meta-analysis).
+    /// \details Records are filtered once; the matching ones are then routed
+    ///          into every dimension bucket they belong to, and each bucket is
+    ///          accumulated directly into its TradeMetaStats slot. Results equal
+    ///          running TradeStatsCalculator::calc with the dimension include
+    ///          list replaced by the bucket value.
     class TradeMetaStatsCalculator {
     public:
         /// \brief Calculates meta-statistics from a collection of trade records.
@@ -26,17 +32,49 @@ namespace optionx::storage {
                 const std::vector<optionx::TradeRecord>& records,
                 const optionx::TradeStatsConfig& config = {}) {
             optionx::TradeMetaStats meta{};
+            const auto& filter = config.filter;
 
-            // Collect unique values across all records (respecting the base filter).
+            // Hour and weekday buckets replace the base include list, so a
+            // record outside the base hours still lands in its own hour bucket.
+            auto filter_any_hour = filter;
+            filter_any_hour.hours.clear_include();
+            auto filter_any_weekday = filter;
+            filter_any_weekday.weekdays.clear_include();
+
+            // Pass 1: filter once and collect the values published by the base filter.
             std::set<optionx::PlatformType> platforms_set;
             std::set<optionx::AccountType> accounts_set;
             std::set<optionx::CurrencyType> currencies_set;
             std::set<std::string> symbols_set;
             std::set<std::string> signals_set;
             std::set<std::uint32_t> durations_set;
+            std::vector<MatchedRecord> matched;
+            optionx::TradeTimeZoneCursor cursor(config.time_zone);
 
             for (const auto& rec : records) {
-                if (!TradeRecordFilterMatcher::match_filter(rec, config.filter, config.time_zone)) continue;
+                const auto selected_ms =
+                    optionx::select_timestamp_ms(rec, optionx::TradeRecordTimeField::AUTO);
+                const bool base_match = TradeRecordFilterMatcher::match_filter(
+                    rec, filter, config.time_zone, selected_ms);
+                const bool hour_match = filter.hours.include.empty()
+                    ? base_match
+                    : TradeRecordFilterMatcher::match_filter(
+                        rec, filter_any_hour, config.time_zone, selected_ms);
+                const bool weekday_match = filter.weekdays.include.empty()
+                    ? base_match
+                    : TradeRecordFilterMatcher::match_filter(
+                        rec, filter_any_weekday, config.time_zone, selected_ms);
+                if (!base_match && !hour_match && !weekday_match) continue;
+
+                matched.push_back({
+                    &rec,
+                    TradeStatsCalculator::make_context(rec, config, selected_ms, &cursor),
+                    base_match,
+                    hour_match,
+                    weekday_match
+                });
+
+                if (!base_match) continue;
                 if (!config.include_errors && optionx::is_error_trade_state(rec.trade_state)) continue;
                 if (!config.include_non_terminal && !optionx::is_terminal_trade_state(rec.trade_state)) continue;
 
@@ -58,71 +96,104 @@ namespace optionx::storage {
             meta.signals.assign(signals_set.begin(), signals_set.end());
             meta.durations.assign(durations_set.begin(), durations_set.end());
 
-            // Compute per-platform stats
-            for (const auto& pt : meta.platforms) {
-                auto cfg = config;
-                cfg.filter.platforms.include.clear();
-                cfg.filter.platforms.add_include(pt);
-                meta.platform_stats.push_back(std::move(*TradeStatsCalculator::calc(records, cfg)));
-            }
-
-            // Per-account stats
-            for (const auto& at : meta.accounts) {
-                auto cfg = config;
-                cfg.filter.accounts.include.clear();
-                cfg.filter.accounts.add_include(at);
-                meta.account_stats.push_back(std::move(*TradeStatsCalculator::calc(records, cfg)));
+            // Accumulators write straight into the result vectors, which are
+            // sized up front so the large TradeStats are never copied.
+            auto platforms = make_accumulators(config, meta.platforms.size(), meta.platform_stats);
+            auto accounts = make_accumulators(config, meta.accounts.size(), meta.account_stats);
+            auto currencies = make_accumulators(config, meta.currencies.size(), meta.currency_stats);
+            auto symbols = make_accumulators(config, meta.symbols.size(), meta.symbol_stats);
+            auto signals = make_accumulators(config, meta.signals.size(), meta.signal_stats);
+            auto durations = make_accumulators(config, meta.durations.size(), meta.duration_stats);
+            // Hourly stats (0..23) and weekday stats (0=Sunday .. 6=Saturday)
+            auto hours = make_accumulators(config, 24, meta.hour_stats);
+            auto weekdays = make_accumulators(config, 7, meta.weekday_stats);
+
+            // Pass 2: route matched records into their buckets.
+            for (const auto& item : matched) {
+                const auto& rec = *item.record;
+                const auto& ctx = item.context;
+                if (item.base_match) {
+                    add_to_group(meta.platforms, platforms, rec.platform_type, rec, ctx);
+                    add_to_group(meta.accounts, accounts, rec.account_type, rec, ctx);
+                    add_to_group(meta.currencies, currencies, rec.currency, rec, ctx);
+                    add_to_group(meta.symbols, symbols, rec.symbol, rec, ctx);
+                    add_to_group(meta.signals, signals, rec.signal_name, rec, ctx);
+                    add_to_group(meta.durations, durations, rec.duration, rec, ctx);
+                }
+                if (item.hour_match) {
+                    add_to_time_buckets(
+                        hours, ctx.has_time, static_cast<std::uint32_t>(ctx.hour), filter.hours, rec, ctx);
+                }
+                if (item.weekday_match) {
+                    add_to_time_buckets(
+                        weekdays, ctx.has_time, static_cast<std::uint32_t>(ctx.weekday), filter.weekdays, rec, ctx);
+                }
             }
 
-            // Per-currency stats
-            for (const auto& ct : meta.currencies) {
-                auto cfg = config;
-                cfg.filter.currencies.include.clear();
-                cfg.filter.currencies.add_include(ct);
-                meta.currency_stats.push_back(std::move(*TradeStatsCalculator::calc(records, cfg)));
+            for (auto* group : {&platforms, &accounts, &currencies, &symbols,
+                                &signals, &durations, &hours, &weekdays}) {
+                for (auto& accumulator : *group) accumulator.finalize();
             }
 
-            // Per-symbol stats
-            for (const auto& sym : meta.symbols) {
-                auto cfg = config;
-                cfg.filter.symbols.include.clear();
-                cfg.filter.symbols.add_include(sym);
-                meta.symbol_stats.push_back(std::move(*TradeStatsCalculator::calc(records, cfg)));
-            }
-
-            // Per-signal stats
-            for (const auto& sig : meta.signals) {
-                auto cfg = config;
-                cfg.filter.signals.include.clear();
-                cfg.filter.signals.add_include(sig);
-                meta.signal_stats.push_back(std::move(*TradeStatsCalculator::calc(records, cfg)));
-            }
+            return meta;
+        }
 
-            // Per-duration stats
-            for (const auto& dur : meta.durations) {
-                auto cfg = config;
-                cfg.filter.durations.include.clear();
-                cfg.filter.durations.add_include(dur);
-                meta.duration_stats.push_back(std::move(*TradeStatsCalculator::calc(records, cfg)));
+    private:
+        using Accumulators = std::vector<TradeStatsCalculator::Accumulator>;
+
+        /// \brief Record that passed at least one of the base, hour or weekday filters.
+        struct MatchedRecord {
+            const optionx::TradeRecord* record;
+            TradeStatsCalculator::RecordContext context;
+            bool base_match;
+            bool hour_match;
+            bool weekday_match;
+        };
+
+        static Accumulators make_accumulators(
+                const optionx::TradeStatsConfig& config,
+                std::size_t count,
+                std::vector<optionx::TradeStats>& stats) {
+            stats.resize(count);
+            Accumulators accumulators;
+            accumulators.reserve(count);
+            for (auto& target : stats) {
+                accumulators.emplace_back(config, target);
             }
+            return accumulators;
+        }
 
-            // Hourly stats (0..23)
-            for (std::uint32_t h = 0; h < 24; ++h) {
-                auto cfg = config;
-                cfg.filter.hours.include.clear();
-                cfg.filter.hours.add_include(h);
-                meta.hour_stats.push_back(std::move(*TradeStatsCalculator::calc(records, cfg)));
-            }
+        /// \brief Adds a record to the bucket of its value, if that value is published.
+        template<class Key>
+        static void add_to_group(
+                const std::vector<Key>& values,
+                Accumulators& accumulators,
+                const Key& key,
+                const optionx::TradeRecord& rec,
+                const TradeStatsCalculator::RecordContext& ctx) {
+            const auto it = std::lower_bound(values.begin(), values.end(), key);
+            if (it == values.end() || *it != key) return;
+            accumulators[static_cast<std::size_t>(it - values.begin())].add(rec, ctx);
+        }
 
-            // Weekday stats (0=Sunday .. 6=Saturday)
-            for (std::uint32_t wd = 0; wd < 7; ++wd) {
-                auto cfg = config;
-                cfg.filter.weekdays.include.clear();
-                cfg.filter.weekdays.add_include(wd);
-                meta.weekday_stats.push_back(std::move(*TradeStatsCalculator::calc(records, cfg)));
+        /// \brief Routes a record into hour or weekday buckets.
+        /// \details Records without a timestamp skip local-time filters and
+        ///          therefore belong to every bucket.
+        static void add_to_time_buckets(
+                Accumulators& buckets,
+                bool has_time,
+                std::uint32_t value,
+                const optionx::IncludeExcludeFilter<std::uint32_t>& base_filter,
+                const optionx::TradeRecord& rec,
+                const TradeStatsCalculator::RecordContext& ctx) {
+            if (!has_time) {
+                for (auto& accumulator : buckets) accumulator.add(rec, ctx);
+                return;
             }
-
-            return meta;
+            if (value >= buckets.size()) return;
+            const auto& exclude = base_filter.exclude;
+            if (std::find(exclude.begin(), exclude.end(), value) != exclude.end()) return;
+            buckets[value].add(rec, ctx);
         }
     };
 
@@ -16,6 +16,35 @@
 
 namespace optionx::storage {
 
+    namespace detail {
+
+        /// \brief Process-wide TradeRecordDB metrics, summed over all instances.
+        struct DbMetrics {
+            utils::metrics::Histogram& upsert;      ///< upsert() transaction time.
+            utils::metrics::Histogram& write;       ///< write() transaction time.
+            utils::metrics::Histogram& read;        ///< Point lookups by trade id or unique id.
+            utils::metrics::Histogram& query;       ///< Range, day and filtered queries.
+            utils::metrics::Histogram& erase;       ///< erase_by_trade_id() and clear().
+            utils::metrics::Gauge&     queue_depth; ///< Commands waiting for the worker thread.
+
+            static DbMetrics& instance() {
+                auto& registry = utils::metrics::MetricsRegistry::global();
+                const char* name = "optionx_trade_record_db_txn_us";
+                const char* help = "TradeRecordDB operation time under the database lock, in microseconds.";
+                static DbMetrics s_metrics{
+                    registry.histogram(name, help, {{"op", "upsert"}}),
+                    registry.histogram(name, help, {{"op", "write"}}),
+                    registry.histogram(name, help, {{"op", "read"}}),
+                    registry.histogram(name, help, {{"op", "query"}}),
+                    registry.histogram(name, help, {{"op", "erase"}}),
+                    registry.gauge("optionx_trade_record_db_queue_depth", "TradeRecordDB commands waiting for the worker thread.")
+                };
+                return s_metrics;
+            }
+        };
+
+    } // namespace detail
+
     inline mdbxc::Config TradeRecordDB::default_config() {
         mdbxc::Config config;
         config.pathname = OPTIONX_TRADE_RECORD_DB_FILE;
@@ -89,6 +118,7 @@ namespace optionx::storage {
     inline TradeRecordDBWriteResult TradeRecordDB::upsert(TradeRecord record) {
         std::lock_guard<std::mutex> lock(m_db_mutex);
         try {
+            utils::metrics::ScopedTimer timer(detail::DbMetrics::instance().upsert);
             return upsert_no_lock(std::move(record));
         } catch (const mdbxc::MdbxException& ex) {
             LOGIT_PRINT_ERROR("TradeRecordDB upsert database error: ", ex);
@@ -102,6 +132,7 @@ namespace optionx::storage {
     inline TradeRecordDBWriteResult TradeRecordDB::write(TradeRecord record) {
         std::lock_guard<std::mutex> lock(m_db_mutex);
         try {
+            utils::metrics::ScopedTimer timer(detail::DbMetrics::instance().write);
             return write_no_lock(std::move(record));
         } catch (const mdbxc::MdbxException& ex) {
             LOGIT_PRINT_ERROR("TradeRecordDB write database error: ", ex);
@@ -115,6 +146,7 @@ namespace optionx::storage {
     inline TradeRecordDBReadResult TradeRecordDB::find_by_trade_id(std::uint32_t trade_id) const {
         std::lock_guard<std::mutex> lock(m_db_mutex);
         try {
+            utils::metrics::ScopedTimer timer(detail::DbMetrics::instance().read);
             return find_by_trade_id_no_lock(trade_id);
         } catch (const mdbxc::MdbxException& ex) {
             LOGIT_PRINT_ERROR("TradeRecordDB find_by_trade_id database error: ", ex);
@@ -128,6 +160,7 @@ namespace optionx::storage {
     inline TradeRecordDBReadResult TradeRecordDB::find_by_uid(std::int64_t unique_id) const {
         std::lock_guard<std::mutex> lock(m_db_mutex);
         try {
+            utils::metrics::ScopedTimer timer(detail::DbMetrics::instance().read);
             return find_by_uid_no_lock(unique_id);
         } catch (const mdbxc::MdbxException& ex) {
             LOGIT_PRINT_ERROR("TradeRecordDB find_by_uid database error: ", ex);
@@ -141,6 +174,7 @@ namespace optionx::storage {
     inline TradeRecordDBListResult TradeRecordDB::find_by_timestamp(std::int64_t timestamp_ms) const {
         std::lock_guard<std::mutex> lock(m_db_mutex);
         try {
+            utils::metrics::ScopedTimer timer(detail::DbMetrics::instance().query);
             return find_by_timestamp_no_lock(timestamp_ms);
         } catch (const mdbxc::MdbxException& ex) {
             LOGIT_PRINT_ERROR("TradeRecordDB find_by_timestamp database error: ", ex);
@@ -154,6 +188,7 @@ namespace optionx::storage {
     inline TradeRecordDBListResult TradeRecordDB::find_range(std::int64_t start_ms, std::int64_t stop_ms) const {
         std::lock_guard<std::mutex> lock(m_db_mutex);
         try {
+            utils::metrics::ScopedTimer timer(detail::DbMetrics::instance().query);
             return find_range_no_lock(start_ms, stop_ms);
         } catch (const mdbxc::MdbxException& ex) {
             LOGIT_PRINT_ERROR("TradeRecordDB find_range database error: ", ex);
@@ -167,6 +202,7 @@ namespace optionx::storage {
     inline TradeRecordDBListResult TradeRecordDB::find_records(const optionx::TradeRecordQuery& query) const {
         std::lock_guard<std::mutex> lock(m_db_mutex);
         try {
+            utils::metrics::ScopedTimer timer(detail::DbMetrics::instance().query);
             return find_records_no_lock(query);
         } catch (const mdbxc::MdbxException& ex) {
             LOGIT_PRINT_ERROR("TradeRecordDB find_records database error: ", ex);
@@ -190,6 +226,7 @@ namespace optionx::storage {
             const optionx::TradeTimeZone& time_zone) const {
         std::lock_guard<std::mutex> lock(m_db_mutex);
         try {
+            utils::metrics::ScopedTimer timer(detail::DbMetrics::instance().query);
             return find_today_no_lock(now_ms, time_zone);
         } catch (const mdbxc::MdbxException& ex) {
             LOGIT_PRINT_ERROR("TradeRecordDB find_today database error: ", ex);
@@ -211,6 +248,7 @@ namespace optionx::storage {
             const optionx::TradeTimeZone& time_zone) const {
         std::lock_guard<std::mutex> lock(m_db_mutex);
         try {
+            utils::metrics::ScopedTimer timer(detail::DbMetrics::instance().query);
             return find_day_no_lock(day_start_ms, time_zone);
         } catch (const mdbxc::MdbxException& ex) {
             LOGIT_PRINT_ERROR("TradeRecordDB find_day database error: ", ex);
@@ -230,6 +268,7 @@ namespace optionx::storage {
     inline TradeRecordDBStatus TradeRecordDB::erase_by_trade_id(std::uint32_t trade_id) {
         std::lock_guard<std::mutex> lock(m_db_mutex);
         try {
+            utils::metrics::ScopedTimer timer(detail::DbMetrics::instance().erase);
             return erase_by_trade_id_no_lock(trade_id);
         } catch (const mdbxc::MdbxException& ex) {
             LOGIT_PRINT_ERROR("TradeRecordDB erase_by_trade_id database error: ", ex);
@@ -242,6 +281,7 @@ namespace optionx::storage {
     inline TradeRecordDBStatus TradeRecordDB::clear() {
         std::lock_guard<std::mutex> lock(m_db_mutex);
         try {
+            utils::metrics::ScopedTimer timer(detail::DbMetrics::instance().erase);
             return clear_no_lock();
         } catch (const mdbxc::MdbxException& ex) {
             LOGIT_PRINT_ERROR("TradeRecordDB clear database error: ", ex);
@@ -950,6 +990,7 @@ namespace optionx::storage {
             std::lock_guard<std::mutex> lock(m_queue_mutex);
             if (!m_accepting) return TradeRecordDBStatus::QUEUE_CLOSED;
             m_work_queue.push_back(std::move(command));
+            detail::DbMetrics::instance().queue_depth.add(1);
         }
         m_work_cv.notify_one();
         return TradeRecordDBStatus::SUCCESS;
@@ -966,6 +1007,7 @@ namespace optionx::storage {
         command = std::move(m_work_queue.front());
         m_work_queue.pop_front();
         ++m_active_work;
+        detail::DbMetrics::instance().queue_depth.add(-1);
         return true;
     }
 
@@ -1029,6 +1071,7 @@ namespace optionx::storage {
                 m_work_queue.pop_front();
                 ++m_active_work;
             }
+            detail::DbMetrics::instance().queue_depth.add(-1);
             execute_command(std::move(command));
         }
 
@@ -23,46 +23,141 @@ namespace optionx::storage {
     /// \class TradeStatsCalculator
     /// \brief Static calculator producing a full statistical summary over trade records.
     class TradeStatsCalculator {
+    private:
+        struct AccountKey {
+            optionx::PlatformType platform_type = optionx::PlatformType::UNKNOWN;
+            optionx::AccountType account_type = optionx::AccountType::UNKNOWN;
+            std::int64_t account_id = 0;
+            optionx::CurrencyType currency = optionx::CurrencyType::UNKNOWN;
+
+            bool operator<(const AccountKey& other) const noexcept {
+                if (platform_type != other.platform_type) return platform_type < other.platform_type;
+                if (account_type != other.account_type) return account_type < other.account_type;
+                if (account_id != other.account_id) return account_id < other.account_id;
+                return currency < other.currency;
+            }
+        };
+
+        struct BalanceSnapshotEvent {
+            std::int64_t ts = 0;
+            std::int64_t open_ts = 0;
+            AccountKey account;
+            optionx::CurrencyType currency = optionx::CurrencyType::UNKNOWN;
+            double open_balance = 0.0;
+            bool has_open_balance = false;
+            double close_balance = 0.0;
+            double profit = 0.0;
+        };
+
+        struct OutcomeEvent {
+            std::int64_t result_ts = 0;
+            std::int64_t decision_ts = 0;
+            std::uint32_t trade_id = 0;
+            std::int64_t unique_id = 0;
+            optionx::TradeState trade_state = optionx::TradeState::UNKNOWN;
+        };
+
     public:
-        /// \brief Calculates statistics from a collection of trade records.
-        /// \param records Input trade records.
-        /// \param config Optional filtering and conversion configuration.
-        /// \return Heap-allocated TradeStats (large struct — never returned by value).
-        static std::unique_ptr<optionx::TradeStats> calc(
-                const std::vector<optionx::TradeRecord>& records,
-                const optionx::TradeStatsConfig& config = {}) {
-            auto stats_ptr = std::make_unique<optionx::TradeStats>();
-            auto& stats = *stats_ptr;
+        /// \brief Per-record values computed once and shared by every accumulator it is routed to.
+        struct RecordContext {
+            std::int64_t selected_ms = 0; ///< AUTO timestamp used by filters and time-of-day buckets.
+            bool has_time = false;        ///< True when selected_ms is positive.
+            int hour = 0;                 ///< Local hour (0..23).
+            int minute = 0;               ///< Local minute (0..59).
+            int second = 0;               ///< Local second (0..59).
+            int month_day = 0;            ///< Local day of month (1..31).
+            int month = 0;                ///< Local month (1..12).
+            int weekday = 0;              ///< Local weekday (0 = Sunday).
+            bool has_money = false;       ///< True when the record feeds monetary statistics.
+            std::int64_t curve_ts = 0;    ///< Result timestamp for realized-profit curves.
+            double amount = 0.0;          ///< Amount converted to the statistics currency.
+            double profit = 0.0;          ///< Profit converted to the statistics currency.
+        };
 
-            std::map<std::int64_t, double> realized_profit_by_ts;
-            std::map<std::int64_t, double> daily_profit_map;
-            std::map<std::int64_t, double> hourly_profit_map;
+        /// \brief Builds the shared per-record context.
+        /// \param rec Trade record that already passed the filter.
+        /// \param config Statistics configuration.
+        /// \param selected_ms Pre-computed AUTO timestamp (0 = derive from record).
+        /// \param cursor Optional cursor over config.time_zone reused across records.
+        /// \return Local-time components and converted money values.
+        static RecordContext make_context(
+                const optionx::TradeRecord& rec,
+                const optionx::TradeStatsConfig& config,
+                std::int64_t selected_ms = 0,
+                optionx::TradeTimeZoneCursor* cursor = nullptr) {
+            RecordContext ctx;
+            ctx.selected_ms = selected_ms != 0
+                ? selected_ms
+                : optionx::select_timestamp_ms(rec, optionx::TradeRecordTimeField::AUTO);
+            if (ctx.selected_ms > 0) {
+                const auto local_ms = cursor
+                    ? cursor->to_local_ms(ctx.selected_ms)
+                    : config.time_zone.to_local_ms(ctx.selected_ms);
+                const auto sec = time_shield::ms_to_sec<time_shield::ts_t>(local_ms);
+                const auto dt = time_shield::to_date_time<time_shield::DateTimeStruct>(sec);
+                ctx.has_time = true;
+                ctx.hour = dt.hour;
+                ctx.minute = dt.min;
+                ctx.second = dt.sec;
+                ctx.month_day = dt.day;
+                ctx.month = dt.mon;
+                ctx.weekday = time_shield::weekday_of_ts(sec);
+            }
 
-            std::uint64_t volume_trade_count = 0;
+            if (include_by_selection(rec, config) && optionx::is_result_state(rec.trade_state)) {
+                ctx.has_money = true;
+                ctx.curve_ts = rec.close_date > 0 ? rec.close_date : rec.open_date;
+                const auto amount_ts = rec.open_date > 0 ? rec.open_date : ctx.curve_ts;
+                ctx.amount = convert_money(rec.amount, rec.currency, amount_ts, config);
+                ctx.profit = convert_money(rec.profit, rec.currency, ctx.curve_ts, config);
+            }
+            return ctx;
+        }
 
-            struct Event {
-                std::int64_t ts;
-                double delta;
-            };
+        /// \class Accumulator
+        /// \brief Incrementally builds one TradeStats from pre-filtered records.
+        /// \details Lets grouped calculations feed several statistics from a
+        ///          single pass over the records.
+        class Accumulator {
+        public:
+            /// \brief Creates an empty accumulator.
+            /// \param config Statistics configuration; must outlive the accumulator.
+            /// \param expected_records Capacity hint for event buffers (0 = grow on demand).
+            explicit Accumulator(
+                    const optionx::TradeStatsConfig& config,
+                    std::size_t expected_records = 0)
+                : m_config(&config),
+                  m_owned_stats(std::make_unique<optionx::TradeStats>()),
+                  m_stats(m_owned_stats.get()) {
+                reserve(expected_records);
+            }
 
-            std::vector<Event> events;
-            events.reserve(records.size() * 2);
-            std::vector<BalanceSnapshotEvent> balance_events;
-            balance_events.reserve(records.size());
-            std::vector<OutcomeEvent> outcome_events;
-            outcome_events.reserve(records.size());
+            /// \brief Creates an accumulator that writes into caller-owned statistics.
+            /// \details Avoids copying the large TradeStats when the destination
+            ///          slot already exists, e.g. inside TradeMetaStats vectors.
+            /// \param config Statistics configuration; must outlive the accumulator.
+            /// \param target Default-constructed statistics to fill; must outlive the accumulator.
+            /// \param expected_records Capacity hint for event buffers (0 = grow on demand).
+            Accumulator(
+                    const optionx::TradeStatsConfig& config,
+                    optionx::TradeStats& target,
+                    std::size_t expected_records = 0)
+                : m_config(&config),
+                  m_stats(&target) {
+                reserve(expected_records);
+            }
 
-            for (const auto& rec : records) {
-                // 1. Filter predicate (applies to both outcome and monetary)
-                if (!TradeRecordFilterMatcher::match_filter(rec, config.filter, config.time_zone)) {
-                    continue;
-                }
+            /// \brief Adds a record that already passed the filter.
+            /// \param rec Trade record.
+            /// \param ctx Context built by make_context() for the same record.
+            void add(const optionx::TradeRecord& rec, const RecordContext& ctx) {
+                const auto& config = *m_config;
+                auto& stats = *m_stats;
 
-                // 2. Determine if this record contributes to selected statistics.
-                const bool include_selected = include_by_selection(rec, config);
-                bool include_outcome = include_selected;
+                // 1. Determine if this record contributes to selected statistics.
+                bool include_outcome = include_by_selection(rec, config);
 
-                // 3. Error / terminal inclusion for outcome stats
+                // 2. Error / terminal inclusion for outcome stats
                 if (include_outcome) {
                     if (!config.include_errors && optionx::is_error_trade_state(rec.trade_state)) {
                         include_outcome = false;
@@ -72,14 +167,13 @@ namespace optionx::storage {
                     }
                 }
 
-                // 4. Monetary aggregations (same selected result-state population)
-                if (include_selected && optionx::is_result_state(rec.trade_state)) {
-                    const auto curve_ts = rec.close_date > 0 ? rec.close_date : rec.open_date;
-                    const auto amount_ts = rec.open_date > 0 ? rec.open_date : curve_ts;
-                    const double amount = convert_money(rec.amount, rec.currency, amount_ts, config);
-                    const double profit = convert_money(rec.profit, rec.currency, curve_ts, config);
+                // 3. Monetary aggregations (same selected result-state population)
+                if (ctx.has_money) {
+                    const auto curve_ts = ctx.curve_ts;
+                    const double amount = ctx.amount;
+                    const double profit = ctx.profit;
 
-                    ++volume_trade_count;
+                    ++m_volume_trade_count;
                     stats.total_volume += amount;
                     stats.total_profit += profit;
                     if (profit > 0.0) stats.gross_profit += profit;
@@ -91,9 +185,9 @@ namespace optionx::storage {
                     // Realized-profit curves are built after aggregation by
                     // timestamp, so same-moment closes do not invent an order.
                     if (curve_ts > 0) {
-                        realized_profit_by_ts[curve_ts] += profit;
+                        m_realized_profit_by_ts[curve_ts] += profit;
                         if (rec.has_close_balance()) {
-                            balance_events.push_back({
+                            m_balance_events.push_back({
                                 curve_ts,
                                 rec.open_date > 0 ? rec.open_date : curve_ts,
                                 AccountKey{
@@ -111,11 +205,11 @@ namespace optionx::storage {
                         // Daily / hourly profit buckets
                         const auto day_utc =
                             config.time_zone.start_of_local_day_utc_ms(curve_ts);
-                        daily_profit_map[day_utc] += profit;
+                        m_daily_profit_map[day_utc] += profit;
 
                         const auto hour_utc =
                             config.time_zone.start_of_local_hour_utc_ms(curve_ts);
-                        hourly_profit_map[hour_utc] += profit;
+                        m_hourly_profit_map[hour_utc] += profit;
                     }
 
                     // Ping stats
@@ -126,15 +220,15 @@ namespace optionx::storage {
                     // Sweep-line events for free-funds curve
                     if (config.balance_mode == optionx::TradeStatsBalanceMode::SWEEP_LINE) {
                         if (rec.open_date > 0) {
-                            events.push_back({rec.open_date, -amount});
+                            m_events.push_back({rec.open_date, -amount});
                         }
                         if (curve_ts > 0) {
-                            events.push_back({curve_ts, amount + profit});
+                            m_events.push_back({curve_ts, amount + profit});
                         }
                     }
                 }
 
-                // 6. Winrate / outcome aggregations (terminal trades only, subject to selection)
+                // 4. Winrate / outcome aggregations (terminal trades only, subject to selection)
                 if (include_outcome && optionx::is_terminal_trade_state(rec.trade_state)) {
                     stats.total.add(rec);
                     if (rec.order_type == optionx::OrderType::BUY) stats.buy.add(rec);
@@ -148,13 +242,9 @@ namespace optionx::storage {
                     stats.by_mm_step[rec.mm_step].add(rec);
 
                     // Time-of-day buckets
-                    const auto ts = optionx::select_timestamp_ms(rec, optionx::TradeRecordTimeField::AUTO);
-                    if (ts > 0) {
-                        const auto local_ms = config.time_zone.to_local_ms(ts);
-                        const auto sec = time_shield::ms_to_sec<time_shield::ts_t>(local_ms);
-                        const auto dt = time_shield::to_date_time<time_shield::DateTimeStruct>(sec);
-                        const auto sec_of_day = dt.hour * 3600 + dt.min * 60 + dt.sec;
-                        const auto min_of_day = dt.hour * 60 + dt.min;
+                    if (ctx.has_time) {
+                        const auto sec_of_day = ctx.hour * 3600 + ctx.minute * 60 + ctx.second;
+                        const auto min_of_day = ctx.hour * 60 + ctx.minute;
 
                         if (sec_of_day >= 0 && sec_of_day < 86400) {
                             stats.by_sec[static_cast<std::size_t>(sec_of_day)].add(rec);
@@ -162,157 +252,182 @@ namespace optionx::storage {
                         if (min_of_day >= 0 && min_of_day < 1440) {
                             stats.by_min[static_cast<std::size_t>(min_of_day)].add(rec);
                         }
-                        if (dt.hour >= 0 && dt.hour < 24) {
-                            stats.by_hour[static_cast<std::size_t>(dt.hour)].add(rec);
+                        if (ctx.hour >= 0 && ctx.hour < 24) {
+                            stats.by_hour[static_cast<std::size_t>(ctx.hour)].add(rec);
                         }
-                        const auto weekday = time_shield::weekday_of_ts(sec);
-                        if (weekday >= 0 && weekday < 7) {
-                            stats.by_weekday[static_cast<std::size_t>(weekday)].add(rec);
+                        if (ctx.weekday >= 0 && ctx.weekday < 7) {
+                            stats.by_weekday[static_cast<std::size_t>(ctx.weekday)].add(rec);
                         }
-                        if (dt.day >= 1 && dt.day <= 31) {
-                            stats.by_month_day[static_cast<std::size_t>(dt.day - 1)].add(rec);
+                        if (ctx.month_day >= 1 && ctx.month_day <= 31) {
+                            stats.by_month_day[static_cast<std::size_t>(ctx.month_day - 1)].add(rec);
                         }
-                        if (dt.mon >= 1 && dt.mon <= 12) {
-                            stats.by_month[static_cast<std::size_t>(dt.mon - 1)].add(rec);
+                        if (ctx.month >= 1 && ctx.month <= 12) {
+                            stats.by_month[static_cast<std::size_t>(ctx.month - 1)].add(rec);
                         }
-                        if (dt.sec >= 0 && dt.sec < 60) {
-                            stats.by_second[static_cast<std::size_t>(dt.sec)].add(rec);
+                        if (ctx.second >= 0 && ctx.second < 60) {
+                            stats.by_second[static_cast<std::size_t>(ctx.second)].add(rec);
                         }
                     }
 
-                    outcome_events.push_back(make_outcome_event(rec));
+                    m_outcome_events.push_back(make_outcome_event(rec));
                 }
             }
 
-            recount_series(outcome_events, stats.series);
-
-            // Finalize winrate stats
-            stats.total.calc();
-            stats.buy.calc();
-            stats.sell.calc();
-            for (auto& kv : stats.by_symbol) kv.second.calc();
-            for (auto& kv : stats.by_signal) kv.second.calc();
-            for (auto& kv : stats.by_platform) kv.second.calc();
-            for (auto& kv : stats.by_currency) kv.second.calc();
-            for (auto& kv : stats.by_duration) kv.second.calc();
-            for (auto& kv : stats.by_mm_step) kv.second.calc();
-            for (auto& kv : stats.ping.by_ping_ms) kv.second.calc();
-            for (auto& s : stats.by_sec) s.calc();
-            for (auto& s : stats.by_min) s.calc();
-            for (auto& s : stats.by_hour) s.calc();
-            for (auto& s : stats.by_weekday) s.calc();
-            for (auto& s : stats.by_month_day) s.calc();
-            for (auto& s : stats.by_month) s.calc();
-            for (auto& s : stats.by_second) s.calc();
-
-            // Derived monetary stats
-            stats.profit_factor = (stats.gross_loss > 0.0)
-                ? (stats.gross_profit / stats.gross_loss)
-                : ((stats.gross_profit > 0.0)
-                    ? std::numeric_limits<double>::infinity()
-                    : 0.0);
-
-            if (volume_trade_count > 0) {
-                stats.average_amount = stats.total_volume / static_cast<double>(volume_trade_count);
-            }
-            if (volume_trade_count > 0) {
-                stats.average_profit_per_trade =
-                    stats.total_profit / static_cast<double>(volume_trade_count);
-                stats.average_profit =
-                    stats.total_profit / static_cast<double>(volume_trade_count);
+            /// \brief Finalizes derived statistics and curves.
+            /// \return Heap-allocated TradeStats, or nullptr when constructed with a target;
+            ///         the accumulator must not be reused afterwards.
+            std::unique_ptr<optionx::TradeStats> finish() {
+                finalize();
+                return std::move(m_owned_stats);
             }
 
-            if (config.equity_mode == optionx::TradeStatsEquityMode::RECORD_BALANCE) {
-                build_record_balance_curves(stats, config, balance_events);
-            } else if (config.equity_mode == optionx::TradeStatsEquityMode::PORTFOLIO_BALANCE) {
-                build_portfolio_balance_curves(stats, config, balance_events);
-            } else {
-                build_synthetic_curves(stats, config, realized_profit_by_ts);
-            }
+            /// \brief Finalizes derived statistics and curves in place.
+            /// \details The accumulator must not be reused afterwards.
+            void finalize() {
+                const auto& config = *m_config;
+                auto& stats = *m_stats;
+
+                recount_series(m_outcome_events, stats.series);
+
+                // Finalize winrate stats
+                stats.total.calc();
+                stats.buy.calc();
+                stats.sell.calc();
+                for (auto& kv : stats.by_symbol) kv.second.calc();
+                for (auto& kv : stats.by_signal) kv.second.calc();
+                for (auto& kv : stats.by_platform) kv.second.calc();
+                for (auto& kv : stats.by_currency) kv.second.calc();
+                for (auto& kv : stats.by_duration) kv.second.calc();
+                for (auto& kv : stats.by_mm_step) kv.second.calc();
+                for (auto& kv : stats.ping.by_ping_ms) kv.second.calc();
+                for (auto& s : stats.by_sec) s.calc();
+                for (auto& s : stats.by_min) s.calc();
+                for (auto& s : stats.by_hour) s.calc();
+                for (auto& s : stats.by_weekday) s.calc();
+                for (auto& s : stats.by_month_day) s.calc();
+                for (auto& s : stats.by_month) s.calc();
+                for (auto& s : stats.by_second) s.calc();
+
+                // Derived monetary stats
+                stats.profit_factor = (stats.gross_loss > 0.0)
+                    ? (stats.gross_profit / stats.gross_loss)
+                    : ((stats.gross_profit > 0.0)
+                        ? std::numeric_limits<double>::infinity()
+                        : 0.0);
+
+                if (m_volume_trade_count > 0) {
+                    stats.average_amount = stats.total_volume / static_cast<double>(m_volume_trade_count);
+                }
+                if (m_volume_trade_count > 0) {
+                    stats.average_profit_per_trade =
+                        stats.total_profit / static_cast<double>(m_volume_trade_count);
+                    stats.average_profit =
+                        stats.total_profit / static_cast<double>(m_volume_trade_count);
+                }
 
-            // Fill chart data
-            for (const auto& kv : daily_profit_map) {
-                stats.daily_profit.x_time.push_back(kv.first);
-                stats.daily_profit.y_value.push_back(kv.second);
-            }
-            for (const auto& kv : hourly_profit_map) {
-                stats.hourly_profit.x_time.push_back(kv.first);
-                stats.hourly_profit.y_value.push_back(kv.second);
-            }
+                if (config.equity_mode == optionx::TradeStatsEquityMode::RECORD_BALANCE) {
+                    build_record_balance_curves(stats, config, std::move(m_balance_events));
+                } else if (config.equity_mode == optionx::TradeStatsEquityMode::PORTFOLIO_BALANCE) {
+                    build_portfolio_balance_curves(stats, config, std::move(m_balance_events));
+                } else {
+                    build_synthetic_curves(stats, config, m_realized_profit_by_ts);
+                }
 
-            // Sweep-line free-funds curve
-            if (config.balance_mode == optionx::TradeStatsBalanceMode::SWEEP_LINE && !events.empty()) {
-                std::sort(events.begin(), events.end(), [](const Event& a, const Event& b) {
-                    return a.ts < b.ts;
-                });
+                // Fill chart data
+                for (const auto& kv : m_daily_profit_map) {
+                    stats.daily_profit.x_time.push_back(kv.first);
+                    stats.daily_profit.y_value.push_back(kv.second);
+                }
+                for (const auto& kv : m_hourly_profit_map) {
+                    stats.hourly_profit.x_time.push_back(kv.first);
+                    stats.hourly_profit.y_value.push_back(kv.second);
+                }
 
-                double free_funds = config.start_balance;
-                double peak_free = config.start_balance;
+                // Sweep-line free-funds curve
+                auto& events = m_events;
+                if (config.balance_mode == optionx::TradeStatsBalanceMode::SWEEP_LINE && !events.empty()) {
+                    std::sort(events.begin(), events.end(), [](const Event& a, const Event& b) {
+                        return a.ts < b.ts;
+                    });
 
-                for (std::size_t i = 0; i < events.size();) {
-                    const auto ts = events[i].ts;
-                    double delta = 0.0;
+                    double free_funds = config.start_balance;
+                    double peak_free = config.start_balance;
 
-                    do {
-                        delta += events[i].delta;
-                        ++i;
-                    } while (i < events.size() && events[i].ts == ts);
+                    for (std::size_t i = 0; i < events.size();) {
+                        const auto ts = events[i].ts;
+                        double delta = 0.0;
 
-                    free_funds += delta;
-                    peak_free = std::max(peak_free, free_funds);
+                        do {
+                            delta += events[i].delta;
+                            ++i;
+                        } while (i < events.size() && events[i].ts == ts);
 
-                    const auto dd = peak_free - free_funds;
-                    if (dd > stats.max_absolute_drawdown_free) {
-                        stats.max_absolute_drawdown_free = dd;
-                        stats.max_drawdown_date_free = ts;
-                    }
-                    if (peak_free > 0.0) {
-                        stats.max_relative_drawdown_free = std::max(
-                            stats.max_relative_drawdown_free, dd / peak_free);
-                    }
+                        free_funds += delta;
+                        peak_free = std::max(peak_free, free_funds);
 
-                    stats.free_funds_curve.x_time.push_back(ts);
-                    stats.free_funds_curve.y_value.push_back(free_funds);
+                        const auto dd = peak_free - free_funds;
+                        if (dd > stats.max_absolute_drawdown_free) {
+                            stats.max_absolute_drawdown_free = dd;
+                            stats.max_drawdown_date_free = ts;
+                        }
+                        if (peak_free > 0.0) {
+                            stats.max_relative_drawdown_free = std::max(
+                                stats.max_relative_drawdown_free, dd / peak_free);
+                        }
+
+                        stats.free_funds_curve.x_time.push_back(ts);
+                        stats.free_funds_curve.y_value.push_back(free_funds);
+                    }
                 }
             }
 
-            return stats_ptr;
-        }
-
-    private:
-        struct AccountKey {
-            optionx::PlatformType platform_type = optionx::PlatformType::UNKNOWN;
-            optionx::AccountType account_type = optionx::AccountType::UNKNOWN;
-            std::int64_t account_id = 0;
-            optionx::CurrencyType currency = optionx::CurrencyType::UNKNOWN;
+        private:
+            struct Event {
+                std::int64_t ts;
+                double delta;
+            };
 
-            bool operator<(const AccountKey& other) const noexcept {
-                if (platform_type != other.platform_type) return platform_type < other.platform_type;
-                if (account_type != other.account_type) return account_type < other.account_type;
-                if (account_id != other.account_id) return account_id < other.account_id;
-                return currency < other.currency;
+            const optionx::TradeStatsConfig* m_config;
+            std::unique_ptr<optionx::TradeStats> m_owned_stats;
+            optionx::TradeStats* m_stats;
+            std::map<std::int64_t, double> m_realized_profit_by_ts;
+            std::map<std::int64_t, double> m_daily_profit_map;
+            std::map<std::int64_t, double> m_hourly_profit_map;
+            std::uint64_t m_volume_trade_count = 0;
+            std::vector<Event> m_events;
+            std::vector<BalanceSnapshotEvent> m_balance_events;
+            std::vector<OutcomeEvent> m_outcome_events;
+
+            void reserve(std::size_t expected_records) {
+                if (expected_records == 0) return;
+                m_events.reserve(expected_records * 2);
+                m_balance_events.reserve(expected_records);
+                m_outcome_events.reserve(expected_records);
             }
         };
 
-        struct BalanceSnapshotEvent {
-            std::int64_t ts = 0;
-            std::int64_t open_ts = 0;
-            AccountKey account;
-            optionx::CurrencyType currency = optionx::CurrencyType::UNKNOWN;
-            double open_balance = 0.0;
-            bool has_open_balance = false;
-            double close_balance = 0.0;
-            double profit = 0.0;
-        };
-
-        struct OutcomeEvent {
-            std::int64_t result_ts = 0;
-            std::int64_t decision_ts = 0;
-            std::uint32_t trade_id = 0;
-            std::int64_t unique_id = 0;
-            optionx::TradeState trade_state = optionx::TradeState::UNKNOWN;
-        };
+        /// \brief Calculates statistics from a collection of trade records.
+        /// \param records Input trade records.
+        /// \param config Optional filtering and conversion configuration.
+        /// \return Heap-allocated TradeStats (large struct — never returned by value).
+        static std::unique_ptr<optionx::TradeStats> calc(
+                const std::vector<optionx::TradeRecord>& records,
+                const optionx::TradeStatsConfig& config = {}) {
+            Accumulator accumulator(config, records.size());
+            optionx::TradeTimeZoneCursor cursor(config.time_zone);
+            for (const auto& rec : records) {
+                const auto selected_ms =
+                    optionx::select_timestamp_ms(rec, optionx::TradeRecordTimeField::AUTO);
+                if (!TradeRecordFilterMatcher::match_filter(
+                        rec, config.filter, config.time_zone, selected_ms)) {
+                    continue;
+                }
+                accumulator.add(rec, make_context(rec, config, selected_ms, &cursor));
+            }
+            return accumulator.finish();
+        }
 
+    private:
         static std::int64_t outcome_result_timestamp(
                 const optionx::TradeRecord& rec) noexcept {
             if (rec.close_date > 0) return rec.close_date;
@@ -351,12 +466,12 @@ namespace optionx::storage {
                 optionx::CurrencyType from,
                 std::int64_t timestamp_ms,
                 const optionx::TradeStatsConfig& config) {
-            const auto to = config.currency_matrix.base_currency;
+            const auto to = config.currency_matrix.base_currency();
             if (config.convert_currency) {
                 return config.convert_currency(value, from, to, timestamp_ms);
             }
             if (to != optionx::CurrencyType::UNKNOWN) {
-                return config.currency_matrix.convert_to_base(value, from);
+                return config.currency_matrix.convert_to_base(value, from, timestamp_ms);
             }
             if (config.convert) {
                 return config.convert(value, from);
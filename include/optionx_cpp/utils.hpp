@@ -11,6 +11,7 @@
 ///          - Data encoding/decoding
 ///          - Asynchronous task management
 ///          - Pub/sub messaging patterns
+///          - In-process metrics
 ///          - Cryptographic functions
 
 // Core utilities
@@ -23,6 +24,7 @@
 #include "utils/time_utils.hpp"       ///< Time-related utilities, including timestamp retrieval.
 #include "utils/trade_id.hpp"         ///< Unique trade identifier generator
 #include "utils/correlation_id.hpp"   ///< Unique correlation identifier generator
+#include "utils/aho_corasick.hpp"     ///< Byte-level multi-pattern matching automaton.
 #include "utils/log_redaction.hpp"    ///< Secret redaction helpers for diagnostics.
 #include "utils/json_comments.hpp"    ///< JSONC-style comment stripping helpers.
 #include "utils/unicode_case.hpp"     ///< Unicode-aware caseless matching helpers.
@@ -32,9 +34,13 @@
 #include "utils/Base36.hpp"           ///< Base36 encoding/decoding implementation
 #include "utils/Base64.hpp"           ///< Base64 encoding/decoding implementation
 
+// Metrics
+#include "utils/metrics.hpp"          ///< Counters, gauges, histograms and Prometheus/JSON exporters
+
 // Concurrency patterns
 #include "utils/tasks.hpp"            ///< Task queues and asynchronous job management
 #include "utils/pubsub.hpp"           ///< Publish-subscribe messaging system
+#include "utils/async_log.hpp"        ///< Asynchronous logging with deferred formatting
 
 // Cryptographic utilities
 #include "utils/crypto.hpp"           ///< Cryptographic functions including encryption and secure key management.
@@ -0,0 +1,177 @@
+#pragma once
+#ifndef OPTIONX_HEADER_UTILS_AHO_CORASICK_HPP_INCLUDED
+#define OPTIONX_HEADER_UTILS_AHO_CORASICK_HPP_INCLUDED
+
+/// \file aho_corasick.hpp
+/// \brief Byte-level Aho-Corasick automaton shared by multi-keyword scanners.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace optionx::utils {
+
+    /// \class AhoCorasickAutomaton
+    /// \brief Dense Aho-Corasick DFA over compressed byte classes.
+    /// \details Patterns are added to a trie with add_pattern() and compiled
+    ///          once by build() into a transition table indexed by state and
+    ///          byte class, so scanning costs one table lookup per input byte
+    ///          regardless of the number of patterns. The automaton only
+    ///          reports states; callers attach their own per-state data
+    ///          (key indices, side masks) to the state ids returned by
+    ///          add_pattern() and walk matches through output_link().
+    class AhoCorasickAutomaton {
+    public:
+        static constexpr std::uint32_t ROOT = 0; ///< Start state; never terminal.
+
+        /// \brief Creates an empty automaton.
+        /// \param fold_ascii_case When true, 'A'..'Z' and 'a'..'z' share byte
+        ///        classes, so patterns and input match ASCII case-insensitively.
+        explicit AhoCorasickAutomaton(bool fold_ascii_case = false)
+            : m_fold_ascii_case(fold_ascii_case) {
+            m_nodes.emplace_back();
+            m_edges.emplace_back();
+            m_transitions.assign(1, ROOT);
+        }
+
+        /// \brief Adds a pattern to the trie; must be called before build().
+        /// \param pattern Pattern bytes; an empty pattern is ignored.
+        /// \return State reached at the end of the pattern, or ROOT for an empty pattern.
+        ///         Duplicate patterns return the same state.
+        std::uint32_t add_pattern(std::string_view pattern) {
+            std::uint32_t state = ROOT;
+            for (const char ch : pattern) {
+                const auto byte = static_cast<unsigned char>(fold(ch));
+                if (m_byte_class[byte] == 0) {
+                    const auto cls = static_cast<std::uint16_t>(m_alphabet_size++);
+                    m_byte_class[byte] = cls;
+                    if (m_fold_ascii_case && byte >= 'a' && byte <= 'z') {
+                        m_byte_class[byte - 'a' + 'A'] = cls;
+                    }
+                }
+
+                auto& edges = m_edges[state];
+                const auto it = std::find_if(
+                    edges.begin(),
+                    edges.end(),
+                    [byte](const std::pair<std::uint8_t, std::uint32_t>& edge) {
+                        return edge.first == byte;
+                    });
+                if (it != edges.end()) {
+                    state = it->second;
+                    continue;
+                }
+
+                const auto next = static_cast<std::uint32_t>(m_nodes.size());
+                Node node;
+                node.depth = m_nodes[state].depth + 1;
+                m_nodes.push_back(node);
+                m_edges[state].emplace_back(static_cast<std::uint8_t>(byte), next);
+                m_edges.emplace_back();
+                state = next;
+            }
+            if (state != ROOT) m_nodes[state].terminal = true;
+            return state;
+        }
+
+        /// \brief Compiles the trie into the transition table and suffix links.
+        /// \details States are visited breadth-first, so every fail state is
+        ///          complete before its dependants read it. The same order is
+        ///          kept in breadth_first_order() for callers that aggregate
+        ///          per-state data along suffix chains.
+        void build() {
+            const auto node_count = m_nodes.size();
+            m_transitions.assign(node_count * m_alphabet_size, ROOT);
+            m_order.clear();
+            m_order.reserve(node_count);
+
+            for (const auto& edge : m_edges[ROOT]) {
+                m_transitions[m_byte_class[edge.first]] = edge.second;
+                m_order.push_back(edge.second);
+            }
+            for (std::size_t head = 0; head < m_order.size(); ++head) {
+                const auto state = m_order[head];
+                auto& node = m_nodes[state];
+                const auto& fail_node = m_nodes[node.fail];
+                node.output_link = fail_node.terminal ? node.fail : fail_node.output_link;
+
+                const auto row = static_cast<std::size_t>(state) * m_alphabet_size;
+                const auto fail_row = static_cast<std::size_t>(node.fail) * m_alphabet_size;
+                std::copy_n(m_transitions.begin() + fail_row, m_alphabet_size, m_transitions.begin() + row);
+                for (const auto& edge : m_edges[state]) {
+                    const auto cls = m_byte_class[edge.first];
+                    m_nodes[edge.second].fail = m_transitions[fail_row + cls];
+                    m_transitions[row + cls] = edge.second;
+                    m_order.push_back(edge.second);
+                }
+            }
+
+            m_edges.clear();
+            m_edges.shrink_to_fit();
+        }
+
+        /// \brief Advances the automaton by one input byte.
+        std::uint32_t next(std::uint32_t state, char ch) const noexcept {
+            return m_transitions[
+                static_cast<std::size_t>(state) * m_alphabet_size +
+                m_byte_class[static_cast<unsigned char>(ch)]];
+        }
+
+        /// \brief Returns true when a pattern ends exactly at the state.
+        bool is_terminal(std::uint32_t state) const noexcept {
+            return m_nodes[state].terminal;
+        }
+
+        /// \brief Returns the nearest proper suffix state that ends a pattern, or ROOT.
+        std::uint32_t output_link(std::uint32_t state) const noexcept {
+            return m_nodes[state].output_link;
+        }
+
+        /// \brief Returns the longest proper suffix state.
+        std::uint32_t fail(std::uint32_t state) const noexcept {
+            return m_nodes[state].fail;
+        }
+
+        /// \brief Returns the length in bytes of the prefix spelled by the state.
+        std::uint32_t depth(std::uint32_t state) const noexcept {
+            return m_nodes[state].depth;
+        }
+
+        /// \brief Returns the number of states, including ROOT.
+        std::size_t state_count() const noexcept {
+            return m_nodes.size();
+        }
+
+        /// \brief Returns all states except ROOT in breadth-first order; valid after build().
+        const std::vector<std::uint32_t>& breadth_first_order() const noexcept {
+            return m_order;
+        }
+
+    private:
+        struct Node {
+            std::uint32_t fail = ROOT;        ///< Longest proper suffix state.
+            std::uint32_t output_link = ROOT; ///< Next suffix state that ends a pattern.
+            std::uint32_t depth = 0;          ///< Prefix length in bytes.
+            bool terminal = false;            ///< A pattern ends exactly here.
+        };
+
+        std::vector<Node> m_nodes;
+        std::vector<std::vector<std::pair<std::uint8_t, std::uint32_t>>> m_edges; ///< Trie edges; dropped by build().
+        std::vector<std::uint32_t> m_transitions;   ///< states x classes transition table.
+        std::vector<std::uint32_t> m_order;         ///< Breadth-first state order.
+        std::array<std::uint16_t, 256> m_byte_class{}; ///< Byte -> class (0 = not in any pattern).
+        std::size_t m_alphabet_size = 1;
+        bool m_fold_ascii_case = false;
+
+        char fold(char ch) const noexcept {
+            return (m_fold_ascii_case && ch >= 'A' && ch <= 'Z') ? static_cast<char>(ch - 'A' + 'a') : ch;
+        }
+    };
+
+} // namespace optionx::utils
+
+#endif // OPTIONX_HEADER_UTILS_AHO_CORASICK_HPP_INCLUDED
@@ -0,0 +1,792 @@
+#pragma once
+#ifndef OPTIONX_HEADER_UTILS_ASYNC_LOG_HPP_INCLUDED
+#define OPTIONX_HEADER_UTILS_ASYNC_LOG_HPP_INCLUDED
+
+/// \file async_log.hpp
+/// \brief Asynchronous logging adapter with deferred printf-style formatting.
+/// \details Hot paths capture the format pointer and arguments in binary form
+///          into a per-thread single-producer ring buffer. A background thread
+///          drains the rings, formats the records and forwards the lines to a
+///          handler (LOGIT by default). Levels below
+///          `OPTIONX_ASYNC_LOG_MIN_LEVEL` (DEBUG unless overridden) are removed
+///          at compile time by the `OPTIONX_ASYNC_LOG_*` macros, including
+///          argument evaluation.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <logit_cpp/logit.hpp>
+
+/// \brief Minimum level compiled into `OPTIONX_ASYNC_LOG_*` macros.
+/// \details 0 = TRACE, 1 = DEBUG, 2 = INFO, 3 = WARN, 4 = ERROR, 5 = FATAL.
+#ifndef OPTIONX_ASYNC_LOG_MIN_LEVEL
+#define OPTIONX_ASYNC_LOG_MIN_LEVEL 1
+#endif
+
+namespace optionx::utils {
+
+    /// \enum AsyncLogLevel
+    /// \brief Severity of an asynchronous log record.
+    enum class AsyncLogLevel : std::uint8_t {
+        TRACE = 0,
+        DEBUG = 1,
+        INFO  = 2,
+        WARN  = 3,
+        ERR   = 4,                  ///< Named ERR to avoid the Windows ERROR macro.
+        FATAL = 5
+    };
+
+    /// \struct AsyncLogConfig
+    /// \brief Parameters applied by AsyncLogger::start().
+    struct AsyncLogConfig {
+        std::size_t ring_capacity = 4096;                   ///< Records per producer thread (rounded up to a power of two).
+        std::chrono::milliseconds idle_wait{1};             ///< Worker sleep when all rings are empty.
+        AsyncLogLevel min_level = AsyncLogLevel::DEBUG;     ///< Runtime level threshold.
+    };
+
+    namespace async_log_detail {
+
+        enum class ArgType : std::uint8_t {
+            INT64,
+            UINT64,
+            DOUBLE,
+            POINTER,
+            STRING
+        };
+
+        constexpr std::size_t kRecordSize = 256;
+        constexpr std::uint8_t kTruncatedFlag = 0x01;
+
+        /// \brief Fixed-size binary log record stored in a ring slot.
+        struct Record {
+            const char* format = nullptr;       ///< Format string; must have static storage duration.
+            const char* file = nullptr;         ///< Source file of the call site, or nullptr.
+            std::int64_t timestamp_ms = 0;      ///< Capture time in milliseconds since epoch.
+            std::uint32_t line = 0;             ///< Source line of the call site.
+            AsyncLogLevel level = AsyncLogLevel::TRACE;
+            std::uint8_t flags = 0;
+            std::uint16_t size = 0;             ///< Used payload bytes.
+            static constexpr std::size_t kPayloadSize =
+                kRecordSize - 2 * sizeof(const char*) - sizeof(std::int64_t) - 8;
+            unsigned char payload[kPayloadSize];
+        };
+
+        static_assert(sizeof(Record) == kRecordSize, "Async log record must fill one ring slot.");
+
+        /// \brief Appends binary-encoded arguments to a record payload.
+        class ArgWriter {
+        public:
+            explicit ArgWriter(Record& record) : m_record(record) {
+                m_record.size = 0;
+                m_record.flags = 0;
+            }
+
+            template<class T>
+            void write(const T& value) {
+                using U = std::decay_t<T>;
+                if constexpr (std::is_array_v<T>) {
+                    static_assert(std::is_same_v<std::remove_cv_t<std::remove_extent_t<T>>, char>,
+                                  "Unsupported async log argument type.");
+                    put_string(std::string_view(
+                        value, static_cast<std::size_t>(std::find(value, value + std::extent_v<T>, '\0') - value)));
+                } else if constexpr (std::is_same_v<U, bool>) {
+                    put_scalar(ArgType::INT64, static_cast<std::int64_t>(value));
+                } else if constexpr (std::is_enum_v<U>) {
+                    write(static_cast<std::underlying_type_t<U>>(value));
+                } else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>) {
+                    put_scalar(ArgType::INT64, static_cast<std::int64_t>(value));
+                } else if constexpr (std::is_integral_v<U>) {
+                    put_scalar(ArgType::UINT64, static_cast<std::uint64_t>(value));
+                } else if constexpr (std::is_floating_point_v<U>) {
+                    put_scalar(ArgType::DOUBLE, static_cast<double>(value));
+                } else if constexpr (std::is_same_v<U, const char*> || std::is_same_v<U, char*>) {
+                    put_string(value ? std::string_view(value) : std::string_view("(null)"));
+                } else if constexpr (std::is_convertible_v<const U&, std::string_view>) {
+                    put_string(std::string_view(value));
+                } else if constexpr (std::is_pointer_v<U>) {
+                    put_scalar(ArgType::POINTER, static_cast<const void*>(value));
+                } else {
+                    static_assert(std::is_pointer_v<U>, "Unsupported async log argument type.");
+                }
+            }
+
+        private:
+            Record& m_record;
+
+            template<class V>
+            void put_scalar(ArgType type, V value) {
+                if (!reserve(1 + sizeof(V))) return;
+                m_record.payload[m_record.size++] = static_cast<unsigned char>(type);
+                std::memcpy(m_record.payload + m_record.size, &value, sizeof(V));
+                m_record.size = static_cast<std::uint16_t>(m_record.size + sizeof(V));
+            }
+
+            void put_string(std::string_view value) {
+                constexpr std::size_t header = 1 + sizeof(std::uint16_t);
+                if (!reserve(header)) return;
+                const std::size_t available = Record::kPayloadSize - m_record.size - header;
+                if (value.size() > available) {
+                    value = value.substr(0, available);
+                    m_record.flags |= kTruncatedFlag;
+                }
+                const auto length = static_cast<std::uint16_t>(value.size());
+                m_record.payload[m_record.size++] = static_cast<unsigned char>(ArgType::STRING);
+                std::memcpy(m_record.payload + m_record.size, &length, sizeof(length));
+                m_record.size = static_cast<std::uint16_t>(m_record.size + sizeof(length));
+                if (length > 0) {
+                    std::memcpy(m_record.payload + m_record.size, value.data(), length);
+                }
+                m_record.size = static_cast<std::uint16_t>(m_record.size + length);
+            }
+
+            bool reserve(std::size_t bytes) {
+                if ((m_record.flags & kTruncatedFlag) != 0 ||
+                    m_record.size + bytes > Record::kPayloadSize) {
+                    m_record.flags |= kTruncatedFlag;
+                    return false;
+                }
+                return true;
+            }
+        };
+
+        /// \brief Decoded view of one captured argument.
+        struct Arg {
+            ArgType type = ArgType::INT64;
+            std::int64_t i = 0;
+            std::uint64_t u = 0;
+            double d = 0.0;
+            const void* p = nullptr;
+            std::string_view s;
+
+            long long as_signed() const {
+                switch (type) {
+                    case ArgType::UINT64:  return static_cast<long long>(u);
+                    case ArgType::DOUBLE:  return static_cast<long long>(d);
+                    case ArgType::POINTER: return static_cast<long long>(reinterpret_cast<std::uintptr_t>(p));
+                    default:               return static_cast<long long>(i);
+                }
+            }
+
+            unsigned long long as_unsigned() const {
+                switch (type) {
+                    case ArgType::UINT64:  return static_cast<unsigned long long>(u);
+                    case ArgType::DOUBLE:  return static_cast<unsigned long long>(d);
+                    case ArgType::POINTER: return static_cast<unsigned long long>(reinterpret_cast<std::uintptr_t>(p));
+                    default:               return static_cast<unsigned long long>(i);
+                }
+            }
+
+            double as_double() const {
+                switch (type) {
+                    case ArgType::UINT64: return static_cast<double>(u);
+                    case ArgType::DOUBLE: return d;
+                    case ArgType::INT64:  return static_cast<double>(i);
+                    default:              return 0.0;
+                }
+            }
+        };
+
+        /// \brief Sequential reader over a record payload.
+        class ArgReader {
+        public:
+            explicit ArgReader(const Record& record) : m_record(record) {}
+
+            bool next(Arg& arg) {
+                if (m_offset >= m_record.size) return false;
+                arg.type = static_cast<ArgType>(m_record.payload[m_offset++]);
+                switch (arg.type) {
+                    case ArgType::INT64:   read(arg.i); break;
+                    case ArgType::UINT64:  read(arg.u); break;
+                    case ArgType::DOUBLE:  read(arg.d); break;
+                    case ArgType::POINTER: read(arg.p); break;
+                    case ArgType::STRING: {
+                        std::uint16_t length = 0;
+                        read(length);
+                        arg.s = std::string_view(
+                            reinterpret_cast<const char*>(m_record.payload + m_offset), length);
+                        m_offset += length;
+                        break;
+                    }
+                }
+                return true;
+            }
+
+        private:
+            const Record& m_record;
+            std::size_t m_offset = 0;
+
+            template<class V>
+            void read(V& value) {
+                std::memcpy(&value, m_record.payload + m_offset, sizeof(V));
+                m_offset += sizeof(V);
+            }
+        };
+
+        /// \brief Appends printf-formatted text to \p out without a heap round trip for short values.
+        inline void append_printf(std::string& out, const char* fmt, ...) {
+            char buffer[128];
+            va_list args;
+            va_start(args, fmt);
+            va_list args_copy;
+            va_copy(args_copy, args);
+            const int res = vsnprintf(buffer, sizeof(buffer), fmt, args_copy);
+            va_end(args_copy);
+            if (res >= 0 && static_cast<std::size_t>(res) < sizeof(buffer)) {
+                out.append(buffer, static_cast<std::size_t>(res));
+            } else if (res > 0) {
+                const std::size_t offset = out.size();
+                out.resize(offset + static_cast<std::size_t>(res) + 1);
+                vsnprintf(&out[offset], static_cast<std::size_t>(res) + 1, fmt, args);
+                out.resize(offset + static_cast<std::size_t>(res));
+            }
+            va_end(args);
+        }
+
+        /// \brief Renders a captured argument in its natural form (used for `%s` of non-strings).
+        inline void append_natural(std::string& out, const Arg& arg) {
+            switch (arg.type) {
+                case ArgType::INT64:   append_printf(out, "%lld", static_cast<long long>(arg.i)); break;
+                case ArgType::UINT64:  append_printf(out, "%llu", static_cast<unsigned long long>(arg.u)); break;
+                case ArgType::DOUBLE:  append_printf(out, "%g", arg.d); break;
+                case ArgType::POINTER: append_printf(out, "%p", arg.p); break;
+                case ArgType::STRING:  out.append(arg.s.data(), arg.s.size()); break;
+            }
+        }
+
+        /// \brief Formats a record into \p out (cleared first).
+        /// \details Walks the printf format string and renders each conversion
+        ///          with the matching captured argument. Length modifiers in the
+        ///          format are ignored because the captured width is known;
+        ///          mismatched conversions are coerced, `%n` is ignored.
+        inline void format_record(const Record& record, std::string& out) {
+            out.clear();
+            ArgReader reader(record);
+            const char* p = record.format ? record.format : "";
+            std::string spec;
+            std::string scratch;
+            Arg arg;
+            while (*p != '\0') {
+                const char* percent = std::strchr(p, '%');
+                if (!percent) {
+                    out.append(p);
+                    break;
+                }
+                out.append(p, static_cast<std::size_t>(percent - p));
+                p = percent + 1;
+                if (*p == '%') {
+                    out.push_back('%');
+                    ++p;
+                    continue;
+                }
+
+                spec.assign(1, '%');
+                while (*p != '\0' && std::strchr("-+ #0", *p)) spec.push_back(*p++);
+                bool args_left = true;
+                auto take_star = [&]() {
+                    if (reader.next(arg)) {
+                        spec += std::to_string(arg.as_signed());
+                    } else {
+                        args_left = false;
+                    }
+                    ++p;
+                };
+                if (*p == '*') take_star();
+                while (*p >= '0' && *p <= '9') spec.push_back(*p++);
+                if (*p == '.') {
+                    spec.push_back(*p++);
+                    if (*p == '*') take_star();
+                    while (*p >= '0' && *p <= '9') spec.push_back(*p++);
+                }
+                while (*p != '\0' && std::strchr("hlLqjzt", *p)) ++p;
+                if (*p == '\0') {
+                    out += spec;
+                    break;
+                }
+
+                const char conversion = *p++;
+                if (!args_left || !reader.next(arg)) {
+                    out += spec;
+                    out.push_back(conversion);
+                    continue;
+                }
+                switch (conversion) {
+                    case 'd':
+                    case 'i':
+                        spec += "lld";
+                        append_printf(out, spec.c_str(), arg.as_signed());
+                        break;
+                    case 'o':
+                    case 'u':
+                    case 'x':
+                    case 'X':
+                        spec += "ll";
+                        spec.push_back(conversion);
+                        append_printf(out, spec.c_str(), arg.as_unsigned());
+                        break;
+                    case 'c':
+                        spec.push_back('c');
+                        append_printf(out, spec.c_str(), static_cast<int>(arg.as_signed()));
+                        break;
+                    case 'e': case 'E':
+                    case 'f': case 'F':
+                    case 'g': case 'G':
+                    case 'a': case 'A':
+                        spec.push_back(conversion);
+                        append_printf(out, spec.c_str(), arg.as_double());
+                        break;
+                    case 'p':
+                        spec.push_back('p');
+                        append_printf(out, spec.c_str(), arg.type == ArgType::POINTER
+                            ? arg.p
+                            : reinterpret_cast<const void*>(static_cast<std::uintptr_t>(arg.as_unsigned())));
+                        break;
+                    case 's':
+                        scratch.clear();
+                        append_natural(scratch, arg);
+                        if (spec.size() == 1) {
+                            out += scratch;
+                        } else {
+                            spec.push_back('s');
+                            append_printf(out, spec.c_str(), scratch.c_str());
+                        }
+                        break;
+                    case 'n':
+                        break;
+                    default:
+                        out += spec;
+                        out.push_back(conversion);
+                        break;
+                }
+            }
+            if ((record.flags & kTruncatedFlag) != 0) {
+                out += " [truncated]";
+            }
+        }
+
+        /// \brief Bounded single-producer/single-consumer queue of records.
+        class Ring {
+        public:
+            explicit Ring(std::size_t capacity)
+                : m_slots(round_up(capacity)), m_mask(m_slots.size() - 1) {}
+
+            /// \brief Returns the next free slot or nullptr when full (producer side).
+            Record* try_claim() noexcept {
+                const std::size_t head = m_head.load(std::memory_order_relaxed);
+                if (head - m_tail_cache >= m_slots.size()) {
+                    m_tail_cache = m_tail.load(std::memory_order_acquire);
+                    if (head - m_tail_cache >= m_slots.size()) return nullptr;
+                }
+                return &m_slots[head & m_mask];
+            }
+
+            /// \brief Makes the slot returned by try_claim() visible to the consumer.
+            void publish() noexcept {
+                m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+
+            /// \brief Returns the oldest record or nullptr when empty (consumer side).
+            const Record* front() noexcept {
+                const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+                if (tail == m_head_cache) {
+                    m_head_cache = m_head.load(std::memory_order_acquire);
+                    if (tail == m_head_cache) return nullptr;
+                }
+                return &m_slots[tail & m_mask];
+            }
+
+            /// \brief Releases the record returned by front().
+            void pop() noexcept {
+                m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+
+            bool empty() const noexcept {
+                return m_tail.load(std::memory_order_acquire) == m_head.load(std::memory_order_acquire);
+            }
+
+            void detach() noexcept { m_detached.store(true, std::memory_order_release); }
+            bool detached() const noexcept { return m_detached.load(std::memory_order_acquire); }
+
+        private:
+            static std::size_t round_up(std::size_t capacity) {
+                std::size_t size = 2;
+                while (size < capacity) size <<= 1;
+                return size;
+            }
+
+            std::vector<Record> m_slots;
+            const std::size_t m_mask;
+            alignas(64) std::atomic<std::size_t> m_head{0};
+            std::size_t m_tail_cache = 0;                   ///< Producer-local copy of m_tail.
+            alignas(64) std::atomic<std::size_t> m_tail{0};
+            std::size_t m_head_cache = 0;                   ///< Consumer-local copy of m_head.
+            std::atomic<bool> m_detached{false};
+        };
+
+    } // namespace async_log_detail
+
+    /// \class AsyncLogger
+    /// \brief Process-wide asynchronous log sink with per-thread rings.
+    /// \details Until start() is called (and after stop()) records are
+    ///          formatted synchronously on the calling thread, so messages are
+    ///          never lost when the worker is not running; that path skips the
+    ///          producer accounting used by stop(). While running, a full ring
+    ///          drops the record and increments dropped() instead of blocking
+    ///          the producer.
+    class AsyncLogger {
+    public:
+        /// \brief Receives formatted lines on the worker thread.
+        using Handler = std::function<void(AsyncLogLevel level, std::int64_t timestamp_ms, const std::string& message)>;
+
+        /// \brief Returns the process-wide logger.
+        static AsyncLogger& instance() {
+            static AsyncLogger logger;
+            return logger;
+        }
+
+        AsyncLogger(const AsyncLogger&) = delete;
+        AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+        ~AsyncLogger() {
+            stop();
+        }
+
+        /// \brief Starts the background formatting thread.
+        /// \param config Ring capacity, idle wait and runtime level. While the
+        ///        worker is already running only the capacity of new rings and
+        ///        the level are updated.
+        void start(const AsyncLogConfig& config = AsyncLogConfig()) {
+            std::lock_guard<std::mutex> lock(m_control_mutex);
+            m_ring_capacity.store(std::max<std::size_t>(2, config.ring_capacity), std::memory_order_relaxed);
+            set_level(config.min_level);
+            if (m_running.load(std::memory_order_acquire)) return;
+            // The worker reads m_idle_wait, so it is only written while no worker exists.
+            m_idle_wait = config.idle_wait;
+            m_stop_requested.store(false, std::memory_order_relaxed);
+            m_worker = std::thread([this]() { run(); });
+            m_running.store(true, std::memory_order_release);
+        }
+
+        /// \brief Stops the worker and drains all pending records.
+        /// \details Producers that saw the worker running are waited for
+        ///          before the final drain, so their records are not lost.
+        void stop() {
+            std::lock_guard<std::mutex> lock(m_control_mutex);
+            if (!m_running.load(std::memory_order_acquire)) return;
+            m_running.store(false, std::memory_order_seq_cst);
+            while (m_active_producers.load(std::memory_order_seq_cst) != 0) {
+                std::this_thread::yield();
+            }
+            {
+                std::lock_guard<std::mutex> wait_lock(m_wait_mutex);
+                m_stop_requested.store(true, std::memory_order_relaxed);
+            }
+            m_wait_cv.notify_all();
+            if (m_worker.joinable()) m_worker.join();
+            drain();
+        }
+
+        /// \brief Checks whether the background worker is running.
+        bool running() const noexcept {
+            return m_running.load(std::memory_order_acquire);
+        }
+
+        /// \brief Formats and delivers every record queued so far on the calling thread.
+        void flush() {
+            drain();
+        }
+
+        /// \brief Replaces the line handler; pass nullptr to restore LOGIT forwarding.
+        /// \details LOGIT forwarding prefixes each line with the captured call site.
+        void set_handler(Handler handler) {
+            std::lock_guard<std::mutex> lock(m_drain_mutex);
+            m_handler = std::move(handler);
+        }
+
+        /// \brief Sets the runtime level threshold.
+        void set_level(AsyncLogLevel level) noexcept {
+            m_level.store(static_cast<std::uint8_t>(level), std::memory_order_relaxed);
+        }
+
+        /// \brief Checks whether \p level passes the runtime threshold.
+        bool is_enabled(AsyncLogLevel level) const noexcept {
+            return static_cast<std::uint8_t>(level) >= m_level.load(std::memory_order_relaxed);
+        }
+
+        /// \brief Number of records dropped because a ring was full.
+        std::uint64_t dropped() const noexcept {
+            return m_dropped.load(std::memory_order_relaxed);
+        }
+
+        /// \brief Captures a record; formatting is deferred to the worker thread.
+        /// \param level Record severity.
+        /// \param format printf-style format string with static storage duration.
+        /// \param args Arithmetic values, enums, pointers or string-like values.
+        template<class... Args>
+        void log(AsyncLogLevel level, const char* format, const Args&... args) {
+            log_at(level, nullptr, 0, format, args...);
+        }
+
+        /// \brief Captures a record together with its call site.
+        /// \param level Record severity.
+        /// \param file Source file with static storage duration, or nullptr.
+        /// \param line Source line.
+        /// \param format printf-style format string with static storage duration.
+        /// \param args Arithmetic values, enums, pointers or string-like values.
+        template<class... Args>
+        void log_at(AsyncLogLevel level, const char* file, std::uint32_t line,
+                    const char* format, const Args&... args) {
+            if (!is_enabled(level)) return;
+            if (!m_running.load(std::memory_order_acquire)) {
+                log_sync(level, file, line, format, args...);
+                return;
+            }
+            // Pairs with stop(): either this producer sees the flag cleared,
+            // or stop() sees it in flight and waits before the final drain.
+            m_active_producers.fetch_add(1, std::memory_order_seq_cst);
+            if (!m_running.load(std::memory_order_seq_cst)) {
+                m_active_producers.fetch_sub(1, std::memory_order_release);
+                log_sync(level, file, line, format, args...);
+                return;
+            }
+            auto& ring = thread_ring();
+            auto* record = ring.try_claim();
+            if (!record) {
+                m_active_producers.fetch_sub(1, std::memory_order_release);
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            fill(*record, level, file, line, format, args...);
+            ring.publish();
+            m_active_producers.fetch_sub(1, std::memory_order_release);
+        }
+
+    private:
+        using Ring = async_log_detail::Ring;
+        using Record = async_log_detail::Record;
+
+        /// \brief Detaches the ring from the registry when its thread exits.
+        struct ThreadRing {
+            std::shared_ptr<Ring> ring;
+            ~ThreadRing() {
+                if (ring) ring->detach();
+            }
+        };
+
+        std::mutex m_control_mutex;
+        std::mutex m_drain_mutex;                           ///< Serializes draining and handler calls.
+        std::mutex m_rings_mutex;
+        std::mutex m_wait_mutex;
+        std::condition_variable m_wait_cv;
+        std::thread m_worker;
+        std::vector<std::shared_ptr<Ring>> m_rings;
+        std::vector<std::shared_ptr<Ring>> m_drain_rings;   ///< Worker-side snapshot of m_rings.
+        std::uint64_t m_rings_version = 0;
+        std::uint64_t m_drain_version = ~std::uint64_t(0);
+        std::string m_line;
+        Handler m_handler;                                  ///< Custom line handler; empty forwards to LOGIT.
+        std::chrono::milliseconds m_idle_wait{1};
+        std::atomic<std::size_t> m_ring_capacity{4096};
+        std::atomic<std::uint8_t> m_level{static_cast<std::uint8_t>(AsyncLogLevel::DEBUG)};
+        std::atomic<std::uint64_t> m_dropped{0};
+        std::atomic<std::uint32_t> m_active_producers{0};   ///< log() calls between the running check and publish.
+        std::atomic<bool> m_running{false};
+        std::atomic<bool> m_stop_requested{false};
+
+        AsyncLogger() = default;
+
+        /// \brief Forwards a formatted line to LOGIT, keeping the captured call site.
+        /// \details LOGIT macros take their location from the expansion point,
+        ///          so the original `file:line` is carried in the message.
+        static void forward_to_logit(const Record& record, const std::string& line) {
+            thread_local std::string message;
+            message.clear();
+            if (record.file) {
+                const char* file = record.file;
+                for (const char* p = record.file; *p != '\0'; ++p) {
+                    if (*p == '/' || *p == '\\') file = p + 1;
+                }
+                message.append(file);
+                message.push_back(':');
+                message.append(std::to_string(record.line));
+                message.append(": ");
+            }
+            message.append(line);
+            switch (record.level) {
+                case AsyncLogLevel::TRACE: LOGIT_PRINT_TRACE(message); break;
+                case AsyncLogLevel::DEBUG: LOGIT_PRINT_DEBUG(message); break;
+                case AsyncLogLevel::INFO:  LOGIT_PRINT_INFO(message); break;
+                case AsyncLogLevel::WARN:  LOGIT_PRINT_WARN(message); break;
+                case AsyncLogLevel::ERR: LOGIT_PRINT_ERROR(message); break;
+                case AsyncLogLevel::FATAL: LOGIT_PRINT_FATAL(message); break;
+            }
+        }
+
+        static std::int64_t now_ms() noexcept {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+        }
+
+        template<class... Args>
+        static void fill(Record& record, AsyncLogLevel level, const char* file, std::uint32_t line,
+                         const char* format, const Args&... args) {
+            record.format = format;
+            record.file = file;
+            record.line = line;
+            record.level = level;
+            record.timestamp_ms = now_ms();
+            async_log_detail::ArgWriter writer(record);
+            (writer.write(args), ...);
+        }
+
+        template<class... Args>
+        void log_sync(AsyncLogLevel level, const char* file, std::uint32_t line,
+                      const char* format, const Args&... args) {
+            Record record;
+            fill(record, level, file, line, format, args...);
+            thread_local std::string text;
+            async_log_detail::format_record(record, text);
+            std::lock_guard<std::mutex> lock(m_drain_mutex);
+            deliver(record, text);
+        }
+
+        /// \brief Passes a formatted record to the handler; requires m_drain_mutex.
+        void deliver(const Record& record, const std::string& text) {
+            if (m_handler) {
+                m_handler(record.level, record.timestamp_ms, text);
+            } else {
+                forward_to_logit(record, text);
+            }
+        }
+
+        Ring& thread_ring() {
+            thread_local ThreadRing holder;
+            if (!holder.ring) {
+                holder.ring = std::make_shared<Ring>(m_ring_capacity.load(std::memory_order_relaxed));
+                std::lock_guard<std::mutex> lock(m_rings_mutex);
+                m_rings.push_back(holder.ring);
+                ++m_rings_version;
+            }
+            return *holder.ring;
+        }
+
+        void run() {
+            while (!m_stop_requested.load(std::memory_order_relaxed)) {
+                if (drain() > 0) continue;
+                std::unique_lock<std::mutex> lock(m_wait_mutex);
+                m_wait_cv.wait_for(lock, m_idle_wait, [this]() {
+                    return m_stop_requested.load(std::memory_order_relaxed);
+                });
+            }
+        }
+
+        /// \brief Copies the fields a handler needs so the slot can be released first.
+        static Record header_of(const Record& record) noexcept {
+            Record header;
+            header.format = record.format;
+            header.file = record.file;
+            header.line = record.line;
+            header.level = record.level;
+            header.timestamp_ms = record.timestamp_ms;
+            return header;
+        }
+
+        /// \brief Drains every ring once and prunes rings of exited threads.
+        std::size_t drain() {
+            std::lock_guard<std::mutex> lock(m_drain_mutex);
+            bool prune = false;
+            {
+                std::lock_guard<std::mutex> rings_lock(m_rings_mutex);
+                if (m_drain_version != m_rings_version) {
+                    m_drain_rings = m_rings;
+                    m_drain_version = m_rings_version;
+                }
+            }
+
+            std::size_t processed = 0;
+            for (const auto& ring : m_drain_rings) {
+                const bool detached = ring->detached();
+                while (const Record* record = ring->front()) {
+                    async_log_detail::format_record(*record, m_line);
+                    const Record header = header_of(*record);
+                    ring->pop();
+                    deliver(header, m_line);
+                    ++processed;
+                }
+                prune = prune || detached;
+            }
+
+            if (prune) {
+                std::lock_guard<std::mutex> rings_lock(m_rings_mutex);
+                m_rings.erase(std::remove_if(m_rings.begin(), m_rings.end(),
+                    [](const std::shared_ptr<Ring>& ring) {
+                        return ring->detached() && ring->empty();
+                    }), m_rings.end());
+                m_drain_rings = m_rings;
+                m_drain_version = ++m_rings_version;
+            }
+            return processed;
+        }
+    };
+
+    /// \brief Captures a record into the process-wide asynchronous logger.
+    template<class... Args>
+    inline void async_log(AsyncLogLevel level, const char* format, const Args&... args) {
+        AsyncLogger::instance().log(level, format, args...);
+    }
+
+    /// \brief Captures a record with its call site; used by the `OPTIONX_ASYNC_LOG_*` macros.
+    template<class... Args>
+    inline void async_log_at(AsyncLogLevel level, const char* file, std::uint32_t line,
+                             const char* format, const Args&... args) {
+        AsyncLogger::instance().log_at(level, file, line, format, args...);
+    }
+
+} // namespace optionx::utils
+
+#if OPTIONX_ASYNC_LOG_MIN_LEVEL <= 0
+#define OPTIONX_ASYNC_LOG_TRACE(...) ::optionx::utils::async_log_at(::optionx::utils::AsyncLogLevel::TRACE, __FILE__, __LINE__, __VA_ARGS__)
+#else
+#define OPTIONX_ASYNC_LOG_TRACE(...) ((void)0)
+#endif
+
+#if OPTIONX_ASYNC_LOG_MIN_LEVEL <= 1
+#define OPTIONX_ASYNC_LOG_DEBUG(...) ::optionx::utils::async_log_at(::optionx::utils::AsyncLogLevel::DEBUG, __FILE__, __LINE__, __VA_ARGS__)
+#else
+#define OPTIONX_ASYNC_LOG_DEBUG(...) ((void)0)
+#endif
+
+#if OPTIONX_ASYNC_LOG_MIN_LEVEL <= 2
+#define OPTIONX_ASYNC_LOG_INFO(...) ::optionx::utils::async_log_at(::optionx::utils::AsyncLogLevel::INFO, __FILE__, __LINE__, __VA_ARGS__)
+#else
+#define OPTIONX_ASYNC_LOG_INFO(...) ((void)0)
+#endif
+
+#if OPTIONX_ASYNC_LOG_MIN_LEVEL <= 3
+#define OPTIONX_ASYNC_LOG_WARN(...) ::optionx::utils::async_log_at(::optionx::utils::AsyncLogLevel::WARN, __FILE__, __LINE__, __VA_ARGS__)
+#else
+#define OPTIONX_ASYNC_LOG_WARN(...) ((void)0)
+#endif
+
+#if OPTIONX_ASYNC_LOG_MIN_LEVEL <= 4
+#define OPTIONX_ASYNC_LOG_ERROR(...) ::optionx::utils::async_log_at(::optionx::utils::AsyncLogLevel::ERR, __FILE__, __LINE__, __VA_ARGS__)
+#else
+#define OPTIONX_ASYNC_LOG_ERROR(...) ((void)0)
+#endif
+
+#define OPTIONX_ASYNC_LOG_FATAL(...) ::optionx::utils::async_log_at(::optionx::utils::AsyncLogLevel::FATAL, __FILE__, __LINE__, __VA_ARGS__)
+
+#endif // OPTIONX_HEADER_UTILS_ASYNC_LOG_HPP_INCLUDED
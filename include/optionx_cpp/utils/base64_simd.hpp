@@ -0,0 +1,321 @@
+#pragma once
+#ifndef OPTIONX_HEADER_UTILS_BASE64_SIMD_HPP_INCLUDED
+#define OPTIONX_HEADER_UTILS_BASE64_SIMD_HPP_INCLUDED
+
+/// \file base64_simd.hpp
+/// \brief Scalar and x86 SIMD kernels behind utils::Base64.
+/// \details Define OPTIONX_BASE64_NO_SIMD to build only the scalar kernels.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#if !defined(OPTIONX_BASE64_NO_SIMD) && \
+    (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#   define OPTIONX_BASE64_X86_SIMD 1
+#   define OPTIONX_BASE64_TARGET(arch) __attribute__((target(arch)))
+#   include <immintrin.h>
+#elif !defined(OPTIONX_BASE64_NO_SIMD) && defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#   define OPTIONX_BASE64_X86_SIMD 1
+#   define OPTIONX_BASE64_TARGET(arch)
+#   include <immintrin.h>
+#   include <intrin.h>
+#endif
+
+namespace optionx::utils::base64_detail {
+
+    /// \enum SimdLevel
+    /// \brief Instruction set used by the Base64 kernels.
+    enum class SimdLevel {
+        SCALAR, ///< Portable byte loop.
+        SSSE3,  ///< 16 characters per step.
+        AVX2    ///< 32 characters per step.
+    };
+
+    /// \brief Detects the best kernel supported by the running CPU.
+    inline SimdLevel detect_simd_level() noexcept {
+#if defined(OPTIONX_BASE64_X86_SIMD) && defined(_MSC_VER) && !defined(__clang__)
+        int info[4] = {0, 0, 0, 0};
+        __cpuid(info, 0);
+        const int max_leaf = info[0];
+        __cpuid(info, 1);
+        const bool ssse3 = (info[2] & (1 << 9)) != 0;
+        const bool os_avx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 &&
+            (_xgetbv(0) & 0x6) == 0x6;
+        bool avx2 = false;
+        if (os_avx && max_leaf >= 7) {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0;
+        }
+        if (avx2) return SimdLevel::AVX2;
+        if (ssse3) return SimdLevel::SSSE3;
+#elif defined(OPTIONX_BASE64_X86_SIMD)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+        if (__builtin_cpu_supports("ssse3")) return SimdLevel::SSSE3;
+#endif
+        return SimdLevel::SCALAR;
+    }
+
+    /// \brief Returns the cached kernel level for this process.
+    inline SimdLevel simd_level() noexcept {
+        static const SimdLevel level = detect_simd_level();
+        return level;
+    }
+
+    inline constexpr char kAlphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    /// \brief Maps a Base64 character to its 6-bit value, or -1.
+    inline int decode_char(unsigned char c) noexcept {
+        if (c >= 'A' && c <= 'Z') return c - 'A';
+        if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+        if (c >= '0' && c <= '9') return c - '0' + 52;
+        if (c == '+') return 62;
+        if (c == '/') return 63;
+        return -1;
+    }
+
+    /// \brief Encodes all input bytes, including '=' padding.
+    inline void encode_scalar(const std::uint8_t* src, std::size_t size, char* dst) noexcept {
+        std::size_t i = 0;
+        for (; i + 3 <= size; i += 3) {
+            const std::uint32_t v = (std::uint32_t(src[i]) << 16) |
+                (std::uint32_t(src[i + 1]) << 8) | src[i + 2];
+            *dst++ = kAlphabet[(v >> 18) & 0x3F];
+            *dst++ = kAlphabet[(v >> 12) & 0x3F];
+            *dst++ = kAlphabet[(v >> 6) & 0x3F];
+            *dst++ = kAlphabet[v & 0x3F];
+        }
+        const std::size_t remaining = size - i;
+        if (remaining == 0) return;
+        std::uint32_t v = std::uint32_t(src[i]) << 16;
+        if (remaining == 2) v |= std::uint32_t(src[i + 1]) << 8;
+        *dst++ = kAlphabet[(v >> 18) & 0x3F];
+        *dst++ = kAlphabet[(v >> 12) & 0x3F];
+        *dst++ = remaining == 2 ? kAlphabet[(v >> 6) & 0x3F] : '=';
+        *dst = '=';
+    }
+
+    /// \brief Decodes characters without '=' padding.
+    /// \details Trailing partial groups keep only whole bytes.
+    /// \throws std::invalid_argument On a non-alphabet character.
+    inline void decode_scalar(const char* src, std::size_t size, std::uint8_t* dst) {
+        std::uint32_t buffer = 0;
+        std::size_t bits = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            const int value = decode_char(static_cast<unsigned char>(src[i]));
+            if (value < 0) {
+                throw std::invalid_argument("Invalid Base64 input.");
+            }
+            buffer = (buffer << 6) | static_cast<std::uint32_t>(value);
+            bits += 6;
+            if (bits >= 8) {
+                bits -= 8;
+                *dst++ = static_cast<std::uint8_t>((buffer >> bits) & 0xFF);
+            }
+        }
+    }
+
+#if defined(OPTIONX_BASE64_X86_SIMD)
+
+    // Kernels follow W. Mula and D. Lemire, "Faster Base64 Encoding and
+    // Decoding Using AVX2 Instructions" (2018): split 12 bytes into 16
+    // sextets with a shuffle plus multiplies, then translate with a
+    // 16-entry offset table. Decoding validates by character ranges and
+    // leaves any block containing other bytes to the scalar path.
+
+    OPTIONX_BASE64_TARGET("ssse3")
+    inline __m128i encode_translate_ssse3(__m128i in) {
+        in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+        const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+        const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+        const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+        const __m128i indices = _mm_or_si128(t1, t3);
+
+        __m128i offsets = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        offsets = _mm_or_si128(offsets, _mm_and_si128(less, _mm_set1_epi8(13)));
+        const __m128i shift_lut = _mm_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+            '/' - 63, 'A', 0, 0);
+        return _mm_add_epi8(_mm_shuffle_epi8(shift_lut, offsets), indices);
+    }
+
+    /// \brief Encodes whole 12-byte blocks while 16 input bytes are readable.
+    /// \return Number of input bytes consumed (multiple of 12).
+    OPTIONX_BASE64_TARGET("ssse3")
+    inline std::size_t encode_ssse3(const std::uint8_t* src, std::size_t size, char* dst) {
+        std::size_t i = 0;
+        for (; size - i >= 16; i += 12, dst += 16) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), encode_translate_ssse3(in));
+        }
+        return i;
+    }
+
+    OPTIONX_BASE64_TARGET("ssse3")
+    inline __m128i in_range_ssse3(__m128i in, char lo, char hi) {
+        return _mm_and_si128(
+            _mm_cmpgt_epi8(in, _mm_set1_epi8(static_cast<char>(lo - 1))),
+            _mm_cmplt_epi8(in, _mm_set1_epi8(static_cast<char>(hi + 1))));
+    }
+
+    /// \brief Decodes whole 16-character blocks until one holds a non-alphabet byte.
+    /// \return Number of characters consumed (multiple of 16).
+    OPTIONX_BASE64_TARGET("ssse3")
+    inline std::size_t decode_ssse3(const char* src, std::size_t size, std::uint8_t* dst) {
+        std::size_t i = 0;
+        for (; size - i >= 16; i += 16, dst += 12) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            const __m128i upper = in_range_ssse3(in, 'A', 'Z');
+            const __m128i lower = in_range_ssse3(in, 'a', 'z');
+            const __m128i digit = in_range_ssse3(in, '0', '9');
+            const __m128i plus = _mm_cmpeq_epi8(in, _mm_set1_epi8('+'));
+            const __m128i slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+            const __m128i valid = _mm_or_si128(
+                _mm_or_si128(upper, lower), _mm_or_si128(digit, _mm_or_si128(plus, slash)));
+            if (_mm_movemask_epi8(valid) != 0xFFFF) break;
+
+            const __m128i shift = _mm_or_si128(
+                _mm_or_si128(
+                    _mm_and_si128(upper, _mm_set1_epi8(-'A')),
+                    _mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))),
+                _mm_or_si128(
+                    _mm_and_si128(digit, _mm_set1_epi8(52 - '0')),
+                    _mm_or_si128(
+                        _mm_and_si128(plus, _mm_set1_epi8(62 - '+')),
+                        _mm_and_si128(slash, _mm_set1_epi8(63 - '/')))));
+            const __m128i values = _mm_add_epi8(in, shift);
+
+            const __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+            const __m128i words = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+            const __m128i packed = _mm_shuffle_epi8(
+                words, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), packed);
+            const std::uint32_t tail = static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(packed, 8)));
+            std::memcpy(dst + 8, &tail, sizeof(tail));
+        }
+        return i;
+    }
+
+    /// \brief Encodes whole 24-byte blocks while 32 input bytes are readable.
+    /// \return Number of input bytes consumed (multiple of 24).
+    OPTIONX_BASE64_TARGET("avx2")
+    inline std::size_t encode_avx2(const std::uint8_t* src, std::size_t size, char* dst) {
+        const __m256i lane_split = _mm256_setr_epi32(0, 1, 2, 0, 3, 4, 5, 0);
+        const __m256i shuffle = _mm256_set_epi8(
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+        const __m256i shift_lut = _mm256_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+            '/' - 63, 'A', 0, 0,
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+            '/' - 63, 'A', 0, 0);
+        std::size_t i = 0;
+        for (; size - i >= 32; i += 24, dst += 32) {
+            __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            in = _mm256_permutevar8x32_epi32(in, lane_split);
+            in = _mm256_shuffle_epi8(in, shuffle);
+            const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+            const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+            const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+            const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+            const __m256i indices = _mm256_or_si256(t1, t3);
+
+            __m256i offsets = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+            const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+            offsets = _mm256_or_si256(offsets, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+            const __m256i chars = _mm256_add_epi8(_mm256_shuffle_epi8(shift_lut, offsets), indices);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), chars);
+        }
+        return i + encode_ssse3(src + i, size - i, dst);
+    }
+
+    OPTIONX_BASE64_TARGET("avx2")
+    inline __m256i in_range_avx2(__m256i in, char lo, char hi) {
+        return _mm256_and_si256(
+            _mm256_cmpgt_epi8(in, _mm256_set1_epi8(static_cast<char>(lo - 1))),
+            _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(hi + 1)), in));
+    }
+
+    /// \brief Decodes whole 32-character blocks until one holds a non-alphabet byte.
+    /// \return Number of characters consumed (multiple of 16).
+    OPTIONX_BASE64_TARGET("avx2")
+    inline std::size_t decode_avx2(const char* src, std::size_t size, std::uint8_t* dst) {
+        std::size_t i = 0;
+        for (; size - i >= 32; i += 32, dst += 24) {
+            const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            const __m256i upper = in_range_avx2(in, 'A', 'Z');
+            const __m256i lower = in_range_avx2(in, 'a', 'z');
+            const __m256i digit = in_range_avx2(in, '0', '9');
+            const __m256i plus = _mm256_cmpeq_epi8(in, _mm256_set1_epi8('+'));
+            const __m256i slash = _mm256_cmpeq_epi8(in, _mm256_set1_epi8('/'));
+            const __m256i valid = _mm256_or_si256(
+                _mm256_or_si256(upper, lower), _mm256_or_si256(digit, _mm256_or_si256(plus, slash)));
+            if (_mm256_movemask_epi8(valid) != -1) break;
+
+            const __m256i shift = _mm256_or_si256(
+                _mm256_or_si256(
+                    _mm256_and_si256(upper, _mm256_set1_epi8(-'A')),
+                    _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a'))),
+                _mm256_or_si256(
+                    _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')),
+                    _mm256_or_si256(
+                        _mm256_and_si256(plus, _mm256_set1_epi8(62 - '+')),
+                        _mm256_and_si256(slash, _mm256_set1_epi8(63 - '/')))));
+            const __m256i values = _mm256_add_epi8(in, shift);
+
+            const __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+            const __m256i words = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+            __m256i packed = _mm256_shuffle_epi8(words, _mm256_setr_epi8(
+                2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+            packed = _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(packed));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 16), _mm256_extracti128_si256(packed, 1));
+        }
+        return i + decode_ssse3(src + i, size - i, dst);
+    }
+
+#endif // OPTIONX_BASE64_X86_SIMD
+
+    /// \brief Encodes \p size bytes into exactly 4 * ceil(size / 3) characters.
+    inline void encode(const std::uint8_t* src, std::size_t size, char* dst, SimdLevel level) {
+        std::size_t done = 0;
+#if defined(OPTIONX_BASE64_X86_SIMD)
+        if (level == SimdLevel::AVX2) {
+            done = encode_avx2(src, size, dst);
+        } else if (level == SimdLevel::SSSE3) {
+            done = encode_ssse3(src, size, dst);
+        }
+#else
+        (void)level;
+#endif
+        encode_scalar(src + done, size - done, dst + done / 3 * 4);
+    }
+
+    /// \brief Decodes \p size unpadded characters into size * 6 / 8 bytes.
+    /// \throws std::invalid_argument On a non-alphabet character.
+    inline void decode(const char* src, std::size_t size, std::uint8_t* dst, SimdLevel level) {
+        std::size_t done = 0;
+#if defined(OPTIONX_BASE64_X86_SIMD)
+        if (level == SimdLevel::AVX2) {
+            done = decode_avx2(src, size, dst);
+        } else if (level == SimdLevel::SSSE3) {
+            done = decode_ssse3(src, size, dst);
+        }
+#else
+        (void)level;
+#endif
+        decode_scalar(src + done, size - done, dst + done / 4 * 3);
+    }
+
+} // namespace optionx::utils::base64_detail
+
+#endif // OPTIONX_HEADER_UTILS_BASE64_SIMD_HPP_INCLUDED
@@ -51,29 +51,48 @@ namespace crypto {
         /// \return The encrypted string with the IV prepended.
         /// \throws std::runtime_error If encryption fails.
         std::string encrypt(const std::string& plain_text) const {
+            std::string encrypted_text;
+            encrypt_into(plain_text, encrypted_text);
+            return encrypted_text;
+        }
+
+        /// \brief Decrypts a string.
+        /// \param encrypted_text The encrypted text with IV prepended.
+        /// \return The decrypted string.
+        /// \throws std::runtime_error If decryption fails.
+        std::string decrypt(const std::string& encrypted_text) const {
+            std::string plain_text;
+            decrypt_into(encrypted_text, plain_text);
+            return plain_text;
+        }
+
+        /// \brief Encrypts into a caller-provided buffer, reusing its capacity.
+        /// \param plain_text The text to encrypt.
+        /// \param encrypted_text [out] Receives the IV followed by the ciphertext.
+        /// \throws std::runtime_error If encryption fails.
+        void encrypt_into(const std::string& plain_text, std::string& encrypted_text) const {
             std::lock_guard<std::mutex> lock(m_mutex);
             std::array<uint8_t, 32> key = m_secure.get_key();
             try {
-                std::string encrypted_text = optionx::crypto::encrypt(plain_text, key, m_aes_mode);
+                optionx::crypto::encrypt_into(plain_text, key, m_aes_mode, encrypted_text);
                 secure_clear(key);
-                return encrypted_text;
             } catch (...) {
                 secure_clear(key);
                 throw;
             }
         }
 
-        /// \brief Decrypts a string.
+        /// \brief Decrypts into a caller-provided buffer, reusing its capacity.
         /// \param encrypted_text The encrypted text with IV prepended.
-        /// \return The decrypted string.
+        /// \param plain_text [out] Receives the decrypted text.
         /// \throws std::runtime_error If decryption fails.
-        std::string decrypt(const std::string& encrypted_text) const {
+        void decrypt_into(const std::string& encrypted_text, std::string& plain_text) const {
             std::lock_guard<std::mutex> lock(m_mutex);
             std::array<uint8_t, 32> key = m_secure.get_key();
             try {
-                std::string plain_text = optionx::crypto::decrypt(encrypted_text, key, m_aes_mode);
+                optionx::crypto::decrypt_into(
+                    encrypted_text.data(), encrypted_text.size(), key, m_aes_mode, plain_text);
                 secure_clear(key);
-                return plain_text;
             } catch (...) {
                 secure_clear(key);
                 throw;
@@ -20,6 +20,13 @@
 #define optionx_secure_clear_impl SecureZeroMemory
 #else
 #include <cstring>
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/random.h>)
+#include <cerrno>
+#include <sys/random.h>
+#define OPTIONX_HAS_GETRANDOM 1
+#endif
+#endif
 inline void optionx_secure_clear_impl(void* ptr, size_t size) {
     std::memset(ptr, 0, size);
     __asm__ __volatile__("" : : "r"(ptr) : "memory");
@@ -110,7 +117,8 @@ namespace crypto {
     /// \brief Fills a memory region with operating-system random bytes.
     /// \details Intentionally avoids std::random_device: older MinGW/libstdc++
     /// builds could return deterministic random_device output. Windows uses
-    /// BCryptGenRandom directly; Unix-like systems read /dev/urandom.
+    /// BCryptGenRandom directly; Linux uses getrandom() without opening a file
+    /// per call; other Unix-like systems read /dev/urandom.
     /// \throws std::runtime_error If the system random source fails.
     inline void fill_secure_random(void* ptr, size_t size) {
         if (size == 0) {
@@ -133,6 +141,20 @@ namespace crypto {
             size -= chunk;
         }
 #else
+#ifdef OPTIONX_HAS_GETRANDOM
+        while (size > 0) {
+            const ssize_t got = ::getrandom(bytes, size, 0);
+            if (got < 0) {
+                if (errno == EINTR) continue;
+                break; // e.g. ENOSYS on old kernels: fall back to /dev/urandom
+            }
+            bytes += got;
+            size -= static_cast<size_t>(got);
+        }
+        if (size == 0) {
+            return;
+        }
+#endif
         std::ifstream random_source("/dev/urandom", std::ios::in | std::ios::binary);
         if (!random_source) {
             throw std::runtime_error("Failed to open /dev/urandom");
@@ -167,26 +189,22 @@ namespace crypto {
         return iv;
     }
 
-    /// \brief Adds PKCS#7 padding to the input data.
-    /// \param data The input string to pad.
-    /// \return The padded string.
-    inline std::string add_padding(const std::string& data) {
-        size_t padding_size = BLOCK_SIZE - (data.size() % BLOCK_SIZE);
-        std::string padded_data = data;
-        padded_data.append(padding_size, static_cast<char>(padding_size));
-        return padded_data;
+    /// \brief Appends PKCS#7 padding in place.
+    /// \param data Buffer to pad; grows by 1..BLOCK_SIZE bytes.
+    inline void add_padding_in_place(std::string& data) {
+        const size_t padding_size = BLOCK_SIZE - (data.size() % BLOCK_SIZE);
+        data.append(padding_size, static_cast<char>(padding_size));
     }
 
-    /// \brief Removes PKCS#7 padding from the input data.
-    /// \param data The padded string.
-    /// \return The unpadded string.
+    /// \brief Validates and strips PKCS#7 padding in place.
+    /// \param data Padded buffer; shrinks to the unpadded payload.
     /// \throws std::invalid_argument If the padding is invalid.
-    inline std::string remove_padding(const std::string& data) {
+    inline void remove_padding_in_place(std::string& data) {
         if (data.empty()) {
             throw std::invalid_argument("Data is empty, cannot remove padding.");
         }
-        unsigned char padding_size = static_cast<unsigned char>(data.back());
-        if (padding_size > BLOCK_SIZE || padding_size == 0) {
+        const unsigned char padding_size = static_cast<unsigned char>(data.back());
+        if (padding_size > BLOCK_SIZE || padding_size == 0 || padding_size > data.size()) {
             throw std::invalid_argument("Invalid padding size.");
         }
         for (size_t i = data.size() - padding_size; i < data.size(); ++i) {
@@ -194,7 +212,28 @@ namespace crypto {
                 throw std::invalid_argument("Invalid padding detected.");
             }
         }
-        return data.substr(0, data.size() - padding_size);
+        data.resize(data.size() - padding_size);
+    }
+
+    /// \brief Adds PKCS#7 padding to the input data.
+    /// \param data The input string to pad.
+    /// \return The padded string.
+    inline std::string add_padding(const std::string& data) {
+        std::string padded_data;
+        padded_data.reserve(data.size() + BLOCK_SIZE);
+        padded_data = data;
+        add_padding_in_place(padded_data);
+        return padded_data;
+    }
+
+    /// \brief Removes PKCS#7 padding from the input data.
+    /// \param data The padded string.
+    /// \return The unpadded string.
+    /// \throws std::invalid_argument If the padding is invalid.
+    inline std::string remove_padding(const std::string& data) {
+        std::string unpadded = data;
+        remove_padding_in_place(unpadded);
+        return unpadded;
     }
 
     /// \brief Appends the IV to the beginning of the ciphertext.
@@ -222,94 +261,137 @@ namespace crypto {
         return ciphertext_with_iv.substr(BLOCK_SIZE);
     }
 
-    /// \brief Encrypts a string using AES in the specified mode.
+    /// \brief Encrypts into a caller-provided buffer, reusing its capacity.
+    /// \details The buffer receives the IV followed by the ciphertext. The
+    ///          plaintext is padded in place inside \p output, so no
+    ///          intermediate strings are allocated.
     /// \tparam T Type of the encryption key (e.g., std::array<uint8_t, 32>).
     /// \param plain_text The string to encrypt.
     /// \param key The AES encryption key.
     /// \param mode The AES encryption mode.
-    /// \return The encrypted string with the IV prepended.
+    /// \param output Receives IV + ciphertext; previous content is replaced.
     /// \throws std::invalid_argument If the key length is invalid or the AES mode is unsupported.
     template <class T>
-    std::string encrypt(const std::string& plain_text, const T& key, AesMode mode) {
+    void encrypt_into(const std::string& plain_text, const T& key, AesMode mode, std::string& output) {
         validate_key_length(key, mode);
         AES aes(get_aes_key_length(mode));
-        auto iv = generate_iv();
-        std::string padded_text = add_padding(plain_text);
+        const auto iv = generate_iv();
 
-        unsigned char* encrypted = nullptr;
-        switch (mode) {
-            case AesMode::CBC_256:
-            case AesMode::CBC_192:
-            case AesMode::CBC_128:
-                encrypted = aes.EncryptCBC(
-                    reinterpret_cast<const unsigned char*>(padded_text.data()),
-                    padded_text.size(),
-                    key.data(),
-                    iv.data()
-                );
-                break;
-            case AesMode::CFB_256:
-            case AesMode::CFB_192:
-            case AesMode::CFB_128:
-                encrypted = aes.EncryptCFB(
-                    reinterpret_cast<const unsigned char*>(padded_text.data()),
-                    padded_text.size(),
-                    key.data(),
-                    iv.data()
-                );
-                break;
-            default:
-                throw std::invalid_argument("Invalid AES mode.");
-        }
+        output.clear();
+        output.reserve(BLOCK_SIZE + plain_text.size() + BLOCK_SIZE);
+        output.append(reinterpret_cast<const char*>(iv.data()), iv.size());
+        try {
+            output.append(plain_text);
+            add_padding_in_place(output);
+            auto* block = reinterpret_cast<unsigned char*>(&output[BLOCK_SIZE]);
+            const size_t block_size = output.size() - BLOCK_SIZE;
 
-        std::string ciphertext(reinterpret_cast<char*>(encrypted), padded_text.size());
-        delete[] encrypted;
-        return add_iv_to_ciphertext(ciphertext, iv);
+            unsigned char* encrypted = nullptr;
+            switch (mode) {
+                case AesMode::CBC_256:
+                case AesMode::CBC_192:
+                case AesMode::CBC_128:
+                    encrypted = aes.EncryptCBC(block, block_size, key.data(), iv.data());
+                    break;
+                case AesMode::CFB_256:
+                case AesMode::CFB_192:
+                case AesMode::CFB_128:
+                    encrypted = aes.EncryptCFB(block, block_size, key.data(), iv.data());
+                    break;
+                default:
+                    throw std::invalid_argument("Invalid AES mode.");
+            }
+
+            std::copy(encrypted, encrypted + block_size, block);
+            delete[] encrypted;
+        } catch (...) {
+            // The buffer still holds the padded plaintext.
+            secure_clear(output);
+            output.clear();
+            throw;
+        }
     }
 
-    /// \brief Decrypts a string using AES in the specified mode.
+    /// \brief Decrypts into a caller-provided buffer, reusing its capacity.
     /// \tparam T Type of the encryption key (e.g., std::array<uint8_t, 32>).
-    /// \param encrypted_text The string to decrypt, which contains the IV prepended.
+    /// \param data IV followed by the ciphertext.
+    /// \param size Number of bytes in \p data.
     /// \param key The AES decryption key.
     /// \param mode The AES decryption mode.
-    /// \return The decrypted string.
-    /// \throws std::invalid_argument If the key length is invalid or the AES mode is unsupported.
+    /// \param output Receives the plaintext; previous content is replaced.
+    /// \throws std::invalid_argument If the input, key, mode or padding is invalid.
     template <class T>
-    std::string decrypt(const std::string& encrypted_text, const T& key, AesMode mode) {
+    void decrypt_into(const char* data, size_t size, const T& key, AesMode mode, std::string& output) {
         validate_key_length(key, mode);
-        std::array<uint8_t, 16> iv;
-        std::string ciphertext = extract_iv_from_ciphertext(encrypted_text, iv);
+        if (size < BLOCK_SIZE) {
+            throw std::invalid_argument("Ciphertext is too short to contain a valid IV.");
+        }
+        std::array<uint8_t, BLOCK_SIZE> iv;
+        std::copy(data, data + BLOCK_SIZE, iv.begin());
+        const auto* block = reinterpret_cast<const unsigned char*>(data + BLOCK_SIZE);
+        const size_t block_size = size - BLOCK_SIZE;
         AES aes(get_aes_key_length(mode));
 
         unsigned char* decrypted = nullptr;
-        switch (mode) {
-            case AesMode::CBC_256:
-            case AesMode::CBC_192:
-            case AesMode::CBC_128:
-                decrypted = aes.DecryptCBC(
-                    reinterpret_cast<const unsigned char*>(ciphertext.data()),
-                    ciphertext.size(),
-                    key.data(),
-                    iv.data()
-                );
-                break;
-            case AesMode::CFB_256:
-            case AesMode::CFB_192:
-            case AesMode::CFB_128:
-                decrypted = aes.DecryptCFB(
-                    reinterpret_cast<const unsigned char*>(ciphertext.data()),
-                    ciphertext.size(),
-                    key.data(),
-                    iv.data()
-                );
-                break;
-            default:
-                throw std::invalid_argument("Invalid AES mode.");
+        try {
+            switch (mode) {
+                case AesMode::CBC_256:
+                case AesMode::CBC_192:
+                case AesMode::CBC_128:
+                    decrypted = aes.DecryptCBC(block, block_size, key.data(), iv.data());
+                    break;
+                case AesMode::CFB_256:
+                case AesMode::CFB_192:
+                case AesMode::CFB_128:
+                    decrypted = aes.DecryptCFB(block, block_size, key.data(), iv.data());
+                    break;
+                default:
+                    throw std::invalid_argument("Invalid AES mode.");
+            }
+
+            output.assign(reinterpret_cast<const char*>(decrypted), block_size);
+            secure_clear(decrypted, block_size);
+            delete[] decrypted;
+            decrypted = nullptr;
+            remove_padding_in_place(output);
+        } catch (...) {
+            // Neither a stale nor a partial plaintext may stay in the caller's buffer.
+            if (decrypted) {
+                secure_clear(decrypted, block_size);
+                delete[] decrypted;
+            }
+            secure_clear(output);
+            output.clear();
+            throw;
         }
+    }
 
-        std::string plain_text(reinterpret_cast<char*>(decrypted), ciphertext.size());
-        delete[] decrypted;
-        return remove_padding(plain_text);
+    /// \brief Encrypts a string using AES in the specified mode.
+    /// \tparam T Type of the encryption key (e.g., std::array<uint8_t, 32>).
+    /// \param plain_text The string to encrypt.
+    /// \param key The AES encryption key.
+    /// \param mode The AES encryption mode.
+    /// \return The encrypted string with the IV prepended.
+    /// \throws std::invalid_argument If the key length is invalid or the AES mode is unsupported.
+    template <class T>
+    std::string encrypt(const std::string& plain_text, const T& key, AesMode mode) {
+        std::string encrypted_text;
+        encrypt_into(plain_text, key, mode, encrypted_text);
+        return encrypted_text;
+    }
+
+    /// \brief Decrypts a string using AES in the specified mode.
+    /// \tparam T Type of the encryption key (e.g., std::array<uint8_t, 32>).
+    /// \param encrypted_text The string to decrypt, which contains the IV prepended.
+    /// \param key The AES decryption key.
+    /// \param mode The AES decryption mode.
+    /// \return The decrypted string.
+    /// \throws std::invalid_argument If the key length is invalid or the AES mode is unsupported.
+    template <class T>
+    std::string decrypt(const std::string& encrypted_text, const T& key, AesMode mode) {
+        std::string plain_text;
+        decrypt_into(encrypted_text.data(), encrypted_text.size(), key, mode, plain_text);
+        return plain_text;
     }
 
 } // namespace crypto
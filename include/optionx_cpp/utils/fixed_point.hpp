@@ -8,7 +8,12 @@
 #include <cstdint>
 #include <cmath>
 #include <array>
+#include <cstddef>
+#include <functional>
+#include <limits>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 
 namespace optionx::utils {
 
@@ -105,6 +110,24 @@ namespace optionx::utils {
 		return static_cast<double>(value) / static_cast<double>(scale);
 	}
 
+    /// \brief Returns 10^digits as an integer scale.
+    /// \param digits Number of decimal places (0-18)
+    /// \return Integer scaling factor
+    /// \throw std::invalid_argument If digits exceed maximum supported precision
+    inline constexpr std::int64_t decimal_scale(std::size_t digits) {
+        constexpr std::array<std::int64_t, 19> scale = {
+            1LL, 10LL, 100LL, 1000LL, 10000LL, 100000LL, 1000000LL, 10000000LL,
+            100000000LL, 1000000000LL, 10000000000LL, 100000000000LL,
+            1000000000000LL, 10000000000000LL, 100000000000000LL,
+            1000000000000000LL, 10000000000000000LL, 100000000000000000LL,
+            1000000000000000000LL
+        };
+        if (digits > 18) {
+            throw std::invalid_argument("Digits exceed maximum precision (18).");
+        }
+        return scale[digits];
+    }
+
 	/// \brief Compares two floating-point values after decimal rounding.
     /// \details Each value is rounded with normalize_double(value, digits),
     ///          then the rounded values are compared. A one-step price move at
@@ -118,9 +141,409 @@ namespace optionx::utils {
         if (digits > 18) {
             throw std::invalid_argument("Digits exceed maximum precision (18).");
         }
-        return normalize_double(value1, digits) == normalize_double(value2, digits);
+        // Comparing the rounded scaled values is equivalent to comparing
+        // normalize_double() results and skips both divisions.
+        const auto scale = static_cast<double>(decimal_scale(digits));
+        return std::round(value1 * scale) == std::round(value2 * scale);
     }
 
+    namespace fixed_point_detail {
+
+        /// \brief Multiplies with overflow detection.
+        inline std::int64_t checked_mul(std::int64_t value, std::int64_t factor) {
+            if (factor != 0 && value != 0 &&
+                (value > std::numeric_limits<std::int64_t>::max() / factor ||
+                 value < std::numeric_limits<std::int64_t>::min() / factor)) {
+                throw std::overflow_error("Fixed-point value overflow.");
+            }
+            return value * factor;
+        }
+
+        /// \brief Adds with overflow detection.
+        inline std::int64_t checked_add(std::int64_t a, std::int64_t b) {
+            if ((b > 0 && a > std::numeric_limits<std::int64_t>::max() - b) ||
+                (b < 0 && a < std::numeric_limits<std::int64_t>::min() - b)) {
+                throw std::overflow_error("Fixed-point value overflow.");
+            }
+            return a + b;
+        }
+
+        /// \brief Divides rounding half away from zero.
+        inline std::int64_t div_round(std::int64_t value, std::int64_t divisor) noexcept {
+            const std::int64_t quotient = value / divisor;
+            const std::int64_t remainder = value % divisor;
+            const std::int64_t twice = remainder < 0 ? -remainder * 2 : remainder * 2;
+            if (twice >= divisor) return value < 0 ? quotient - 1 : quotient + 1;
+            return quotient;
+        }
+
+        /// \brief Scales a double to an integer with round-half-away-from-zero.
+        inline std::int64_t round_scaled(double value, std::int64_t scale) {
+            const double scaled = std::round(value * static_cast<double>(scale));
+            if (!(scaled >= -9.2233720368547748e18 && scaled < 9.2233720368547748e18)) {
+                throw std::overflow_error("Fixed-point value overflow.");
+            }
+            return static_cast<std::int64_t>(scaled);
+        }
+
+        /// \brief Appends one decimal digit to a magnitude bounded by INT64_MAX.
+        /// \return False, leaving the magnitude unchanged, if the result would exceed the bound.
+        inline bool push_digit(std::uint64_t& magnitude, std::uint64_t digit) noexcept {
+            constexpr std::uint64_t limit = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+            if (magnitude > (limit - digit) / 10) return false;
+            magnitude = magnitude * 10 + digit;
+            return true;
+        }
+
+        /// \brief Parses decimal text ("-12.345", "+0.5", "7") into a value scaled by 10^digits.
+        /// \details Extra fractional digits are rounded half away from zero.
+        ///          Exponents, spaces and empty integer+fraction parts are rejected.
+        inline bool parse_scaled(std::string_view text, std::size_t digits, std::int64_t& out) noexcept {
+            std::size_t pos = 0;
+            bool negative = false;
+            if (pos < text.size() && (text[pos] == '-' || text[pos] == '+')) {
+                negative = text[pos] == '-';
+                ++pos;
+            }
+            constexpr std::uint64_t limit = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+            std::uint64_t magnitude = 0;
+            std::size_t int_digits = 0;
+            for (; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; ++pos, ++int_digits) {
+                if (!push_digit(magnitude, static_cast<std::uint64_t>(text[pos] - '0'))) return false;
+            }
+            std::size_t frac_digits = 0;
+            bool round_up = false;
+            if (pos < text.size() && text[pos] == '.') {
+                ++pos;
+                for (; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; ++pos, ++frac_digits) {
+                    const auto digit = static_cast<std::uint64_t>(text[pos] - '0');
+                    if (frac_digits < digits) {
+                        if (!push_digit(magnitude, digit)) return false;
+                    } else if (frac_digits == digits) {
+                        round_up = digit >= 5;
+                    }
+                }
+            }
+            if (pos != text.size() || int_digits + frac_digits == 0) return false;
+            for (std::size_t i = frac_digits; i < digits; ++i) {
+                if (!push_digit(magnitude, 0)) return false;
+            }
+            if (round_up && ++magnitude > limit) return false;
+            out = negative ? -static_cast<std::int64_t>(magnitude) : static_cast<std::int64_t>(magnitude);
+            return true;
+        }
+
+        /// \brief Formats a scaled integer as fixed decimal text.
+        inline std::string format_scaled(std::int64_t raw, std::size_t digits) {
+            const bool negative = raw < 0;
+            std::uint64_t magnitude = negative
+                ? static_cast<std::uint64_t>(0) - static_cast<std::uint64_t>(raw)
+                : static_cast<std::uint64_t>(raw);
+            char buffer[48];
+            std::size_t pos = sizeof(buffer);
+            std::size_t written = 0;
+            do {
+                if (digits > 0 && written == digits) buffer[--pos] = '.';
+                buffer[--pos] = static_cast<char>('0' + magnitude % 10);
+                magnitude /= 10;
+                ++written;
+            } while (magnitude != 0 || written <= digits);
+            if (negative) buffer[--pos] = '-';
+            return std::string(buffer + pos, sizeof(buffer) - pos);
+        }
+
+    } // namespace fixed_point_detail
+
+    /// \class Decimal64
+    /// \brief Exact decimal value stored as a 64-bit integer with a runtime scale.
+    /// \details The value equals raw() / 10^digits(). Use it where the number
+    ///          of digits is a per-symbol property (price_digits, volume_digits).
+    ///          Comparison is exact across different scales; addition and
+    ///          subtraction use the larger scale. Arithmetic throws
+    ///          std::overflow_error instead of wrapping.
+    class Decimal64 {
+    public:
+        /// \brief Creates zero with zero decimal places.
+        constexpr Decimal64() noexcept = default;
+
+        /// \brief Creates a value from an already scaled integer.
+        /// \param raw Value multiplied by 10^digits.
+        /// \param digits Number of decimal places (0-18).
+        static Decimal64 from_raw(std::int64_t raw, std::size_t digits) {
+            decimal_scale(digits);
+            return Decimal64(raw, static_cast<std::uint8_t>(digits));
+        }
+
+        /// \brief Converts a double at the boundary, rounding half away from zero.
+        static Decimal64 from_double(double value, std::size_t digits) {
+            return Decimal64(
+                fixed_point_detail::round_scaled(value, decimal_scale(digits)),
+                static_cast<std::uint8_t>(digits));
+        }
+
+        /// \brief Parses decimal text without going through double.
+        /// \param text Text such as "1.08412" or "-15".
+        /// \param digits Target decimal places; extra digits are rounded.
+        /// \param out Parsed value on success.
+        /// \return False for malformed or out-of-range text.
+        static bool try_parse(std::string_view text, std::size_t digits, Decimal64& out) noexcept {
+            std::int64_t raw = 0;
+            if (digits > 18 || !fixed_point_detail::parse_scaled(text, digits, raw)) return false;
+            out = Decimal64(raw, static_cast<std::uint8_t>(digits));
+            return true;
+        }
+
+        /// \brief Parses decimal text.
+        /// \throw std::invalid_argument On malformed or out-of-range text.
+        static Decimal64 parse(std::string_view text, std::size_t digits) {
+            Decimal64 result;
+            if (!try_parse(text, digits, result)) {
+                throw std::invalid_argument("Invalid decimal text.");
+            }
+            return result;
+        }
+
+        /// \brief Returns the scaled integer value.
+        constexpr std::int64_t raw() const noexcept { return m_raw; }
+
+        /// \brief Returns the number of decimal places.
+        constexpr std::size_t digits() const noexcept { return m_digits; }
+
+        /// \brief Converts back to double at the boundary.
+        double to_double() const noexcept {
+            return static_cast<double>(m_raw) / static_cast<double>(decimal_scale(m_digits));
+        }
+
+        /// \brief Formats with exactly digits() decimal places.
+        std::string to_string() const {
+            return fixed_point_detail::format_scaled(m_raw, m_digits);
+        }
+
+        /// \brief Returns the value at another scale, rounding half away from zero when reducing.
+        Decimal64 rescale(std::size_t digits) const {
+            decimal_scale(digits);
+            if (digits == m_digits) return *this;
+            if (digits > m_digits) {
+                return Decimal64(
+                    fixed_point_detail::checked_mul(m_raw, decimal_scale(digits - m_digits)),
+                    static_cast<std::uint8_t>(digits));
+            }
+            return Decimal64(
+                fixed_point_detail::div_round(m_raw, decimal_scale(m_digits - digits)),
+                static_cast<std::uint8_t>(digits));
+        }
+
+        /// \brief Multiplies two decimals and rounds the product to \p digits places.
+        /// \throw std::invalid_argument If |a.digits() + b.digits() - digits| exceeds 18.
+        /// \throw std::overflow_error If the rounded product does not fit into int64.
+        static Decimal64 multiply(const Decimal64& a, const Decimal64& b, std::size_t digits) {
+            const auto shift = static_cast<int>(a.m_digits + b.m_digits) - static_cast<int>(digits);
+            decimal_scale(digits);
+#if defined(__SIZEOF_INT128__)
+            __int128 product = static_cast<__int128>(a.m_raw) * b.m_raw;
+            if (shift > 0) {
+                const __int128 divisor = decimal_scale(static_cast<std::size_t>(shift));
+                const __int128 quotient = product / divisor;
+                const __int128 remainder = product % divisor;
+                const __int128 twice = remainder < 0 ? -remainder * 2 : remainder * 2;
+                product = twice >= divisor ? (product < 0 ? quotient - 1 : quotient + 1) : quotient;
+            } else if (shift < 0) {
+                // Range-check before scaling up; the scaled product may not fit even in __int128.
+                const __int128 factor = decimal_scale(static_cast<std::size_t>(-shift));
+                const __int128 limit = std::numeric_limits<std::int64_t>::max() / factor;
+                if (product > limit || product < -limit) {
+                    throw std::overflow_error("Fixed-point value overflow.");
+                }
+                product *= factor;
+            }
+            if (product > std::numeric_limits<std::int64_t>::max() ||
+                product < std::numeric_limits<std::int64_t>::min()) {
+                throw std::overflow_error("Fixed-point value overflow.");
+            }
+            return Decimal64(static_cast<std::int64_t>(product), static_cast<std::uint8_t>(digits));
+#else
+            const long double product = static_cast<long double>(a.m_raw) * static_cast<long double>(b.m_raw);
+            const long double scaled = shift >= 0
+                ? product / static_cast<long double>(decimal_scale(static_cast<std::size_t>(shift)))
+                : product * static_cast<long double>(decimal_scale(static_cast<std::size_t>(-shift)));
+            const long double rounded = std::round(scaled);
+            if (!(rounded >= -9.2233720368547758e18L && rounded < 9.2233720368547758e18L)) {
+                throw std::overflow_error("Fixed-point value overflow.");
+            }
+            return Decimal64(static_cast<std::int64_t>(rounded), static_cast<std::uint8_t>(digits));
+#endif
+        }
+
+        friend Decimal64 operator+(const Decimal64& a, const Decimal64& b) {
+            const auto digits = a.m_digits > b.m_digits ? a.m_digits : b.m_digits;
+            return Decimal64(
+                fixed_point_detail::checked_add(a.rescale(digits).m_raw, b.rescale(digits).m_raw),
+                digits);
+        }
+
+        friend Decimal64 operator-(const Decimal64& a, const Decimal64& b) {
+            return a + (-b);
+        }
+
+        friend Decimal64 operator-(const Decimal64& value) {
+            if (value.m_raw == std::numeric_limits<std::int64_t>::min()) {
+                throw std::overflow_error("Fixed-point value overflow.");
+            }
+            return Decimal64(-value.m_raw, value.m_digits);
+        }
+
+        friend Decimal64 operator*(const Decimal64& value, std::int64_t factor) {
+            return Decimal64(fixed_point_detail::checked_mul(value.m_raw, factor), value.m_digits);
+        }
+
+        Decimal64& operator+=(const Decimal64& other) { return *this = *this + other; }
+        Decimal64& operator-=(const Decimal64& other) { return *this = *this - other; }
+
+        /// \brief Three-way comparison that is exact across scales.
+        static int compare(const Decimal64& a, const Decimal64& b) noexcept {
+            if (a.m_digits == b.m_digits) {
+                return a.m_raw < b.m_raw ? -1 : (a.m_raw > b.m_raw ? 1 : 0);
+            }
+            const bool a_finer = a.m_digits > b.m_digits;
+            const auto& fine = a_finer ? a : b;
+            const auto& coarse = a_finer ? b : a;
+            const auto factor = decimal_scale(static_cast<std::size_t>(fine.m_digits - coarse.m_digits));
+            // Compare coarse.raw * factor with fine.raw without overflowing.
+            const std::int64_t q = fine.m_raw / factor;
+            const std::int64_t r = fine.m_raw % factor;
+            int result = 0;
+            if (q != coarse.m_raw) {
+                result = q < coarse.m_raw ? -1 : 1;
+            } else if (r != 0) {
+                result = r < 0 ? -1 : 1;
+            }
+            return a_finer ? result : -result;
+        }
+
+        friend bool operator==(const Decimal64& a, const Decimal64& b) noexcept { return compare(a, b) == 0; }
+        friend bool operator!=(const Decimal64& a, const Decimal64& b) noexcept { return compare(a, b) != 0; }
+        friend bool operator<(const Decimal64& a, const Decimal64& b) noexcept { return compare(a, b) < 0; }
+        friend bool operator<=(const Decimal64& a, const Decimal64& b) noexcept { return compare(a, b) <= 0; }
+        friend bool operator>(const Decimal64& a, const Decimal64& b) noexcept { return compare(a, b) > 0; }
+        friend bool operator>=(const Decimal64& a, const Decimal64& b) noexcept { return compare(a, b) >= 0; }
+
+    private:
+        std::int64_t m_raw = 0;
+        std::uint8_t m_digits = 0;
+
+        constexpr Decimal64(std::int64_t raw, std::uint8_t digits) noexcept
+            : m_raw(raw), m_digits(digits) {}
+    };
+
+    /// \class Price
+    /// \brief Exact decimal value with a compile-time number of decimal places.
+    /// \details Occupies exactly one int64, so sequences of prices or amounts
+    ///          can be stored, compared and hashed as plain integers.
+    /// \tparam Digits Number of decimal places (0-18).
+    template<std::size_t Digits>
+    class Price {
+        static_assert(Digits <= 18, "Digits exceed maximum precision (18).");
+    public:
+        static constexpr std::size_t digits = Digits;
+        static constexpr std::int64_t scale = decimal_scale(Digits);
+
+        constexpr Price() noexcept = default;
+
+        /// \brief Creates a value from an already scaled integer.
+        static constexpr Price from_raw(std::int64_t raw) noexcept {
+            Price result;
+            result.m_raw = raw;
+            return result;
+        }
+
+        /// \brief Converts a double at the boundary, rounding half away from zero.
+        static Price from_double(double value) {
+            return from_raw(fixed_point_detail::round_scaled(value, scale));
+        }
+
+        /// \brief Converts a Decimal64, rounding when it has more digits.
+        static Price from_decimal(const Decimal64& value) {
+            return from_raw(value.rescale(Digits).raw());
+        }
+
+        /// \brief Parses decimal text without going through double.
+        static bool try_parse(std::string_view text, Price& out) noexcept {
+            std::int64_t raw = 0;
+            if (!fixed_point_detail::parse_scaled(text, Digits, raw)) return false;
+            out.m_raw = raw;
+            return true;
+        }
+
+        /// \brief Parses decimal text.
+        /// \throw std::invalid_argument On malformed or out-of-range text.
+        static Price parse(std::string_view text) {
+            Price result;
+            if (!try_parse(text, result)) {
+                throw std::invalid_argument("Invalid decimal text.");
+            }
+            return result;
+        }
+
+        constexpr std::int64_t raw() const noexcept { return m_raw; }
+
+        double to_double() const noexcept {
+            return static_cast<double>(m_raw) / static_cast<double>(scale);
+        }
+
+        Decimal64 to_decimal() const {
+            return Decimal64::from_raw(m_raw, Digits);
+        }
+
+        std::string to_string() const {
+            return fixed_point_detail::format_scaled(m_raw, Digits);
+        }
+
+        friend Price operator+(Price a, Price b) { return from_raw(fixed_point_detail::checked_add(a.m_raw, b.m_raw)); }
+        friend Price operator-(Price a, Price b) { return a + (-b); }
+        friend Price operator-(Price value) {
+            if (value.m_raw == std::numeric_limits<std::int64_t>::min()) {
+                throw std::overflow_error("Fixed-point value overflow.");
+            }
+            return from_raw(-value.m_raw);
+        }
+        friend Price operator*(Price value, std::int64_t factor) {
+            return from_raw(fixed_point_detail::checked_mul(value.m_raw, factor));
+        }
+        Price& operator+=(Price other) { return *this = *this + other; }
+        Price& operator-=(Price other) { return *this = *this - other; }
+
+        friend constexpr bool operator==(Price a, Price b) noexcept { return a.m_raw == b.m_raw; }
+        friend constexpr bool operator!=(Price a, Price b) noexcept { return a.m_raw != b.m_raw; }
+        friend constexpr bool operator<(Price a, Price b) noexcept { return a.m_raw < b.m_raw; }
+        friend constexpr bool operator<=(Price a, Price b) noexcept { return a.m_raw <= b.m_raw; }
+        friend constexpr bool operator>(Price a, Price b) noexcept { return a.m_raw > b.m_raw; }
+        friend constexpr bool operator>=(Price a, Price b) noexcept { return a.m_raw >= b.m_raw; }
+
+    private:
+        std::int64_t m_raw = 0;
+    };
+
 } // namespace optionx::utils
 
+namespace std {
+
+    template<>
+    struct hash<optionx::utils::Decimal64> {
+        std::size_t operator()(const optionx::utils::Decimal64& value) const noexcept {
+            // Strip trailing zeros so equal values at different scales hash alike.
+            std::int64_t raw = value.raw();
+            while (raw != 0 && raw % 10 == 0) raw /= 10;
+            return std::hash<std::int64_t>()(raw);
+        }
+    };
+
+    template<std::size_t Digits>
+    struct hash<optionx::utils::Price<Digits>> {
+        std::size_t operator()(const optionx::utils::Price<Digits>& value) const noexcept {
+            return std::hash<std::int64_t>()(value.raw());
+        }
+    };
+
+} // namespace std
+
 #endif // OPTIONX_HEADER_UTILS_FIXED_POINT_HPP_INCLUDED
@@ -5,9 +5,13 @@
 /// \file log_redaction.hpp
 /// \brief Helpers for removing sensitive values from diagnostic logs.
 
-#include <algorithm>
-#include <cctype>
+#include "aho_corasick.hpp"
+
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace optionx::utils {
 
@@ -23,89 +27,181 @@ namespace optionx::utils {
         return redact_secret_value(value);
     }
 
-    /// \brief Redacts common secret fields inside a diagnostic string.
-    /// \param text Text that may contain key/value secrets.
-    /// \return Text with recognized secret values replaced by "***".
-    inline std::string redact_secrets_in_text(std::string text) {
-        static constexpr const char* keys[] = {
-            "auth_token",
-            "authorization",
-            "cookie",
-            "cookies",
-            "password",
-            "passwd",
-            "proxy_auth",
-            "session",
-            "token",
-            "user_hash",
-            "x-api-token"
+    /// \class LogRedactor
+    /// \brief Compiled, case-insensitive redactor for key/value secrets in text.
+    /// \details Key names are compiled once into an AhoCorasickAutomaton over
+    ///          ASCII-folded byte classes. redact_to() walks the input a single
+    ///          time and appends the redacted text to a reusable buffer, so cost
+    ///          stays linear in the input regardless of how many keys are listed.
+    class LogRedactor {
+    public:
+        /// \brief How far a matched value extends.
+        enum class ValueExtent {
+            TOKEN, ///< Up to the next '&', ',', ';', space, tab or line break.
+            LINE   ///< Up to the end of the line (cookie and authorization headers).
         };
 
-        auto to_lower_ascii = [](std::string value) {
-            std::transform(value.begin(), value.end(), value.begin(), [](unsigned char ch) {
-                return static_cast<char>(std::tolower(ch));
-            });
-            return value;
+        /// \brief Sensitive key name and the extent of its value.
+        struct Key {
+            std::string name;                        ///< Key name, matched case-insensitively.
+            ValueExtent extent = ValueExtent::TOKEN; ///< Unquoted value extent.
         };
 
-        auto is_key_boundary = [](char ch) {
-            return !(std::isalnum(static_cast<unsigned char>(ch)) || ch == '_' || ch == '-');
-        };
+        /// \brief Returns the keys redacted by redact_secrets_in_text().
+        static std::vector<Key> default_keys() {
+            return {
+                {"auth_token", ValueExtent::TOKEN},
+                {"authorization", ValueExtent::LINE},
+                {"cookie", ValueExtent::LINE},
+                {"cookies", ValueExtent::LINE},
+                {"password", ValueExtent::TOKEN},
+                {"passwd", ValueExtent::TOKEN},
+                {"proxy_auth", ValueExtent::TOKEN},
+                {"session", ValueExtent::TOKEN},
+                {"token", ValueExtent::TOKEN},
+                {"user_hash", ValueExtent::TOKEN},
+                {"x-api-token", ValueExtent::TOKEN}
+            };
+        }
 
-        auto is_value_delimiter = [](char ch) {
-            return ch == '&' || ch == ',' || ch == ';' ||
-                   ch == '\r' || ch == '\n' || ch == '\t' || ch == ' ';
-        };
+        /// \brief Returns a shared redactor compiled from default_keys().
+        static const LogRedactor& default_instance() {
+            static const LogRedactor instance;
+            return instance;
+        }
 
-        std::string lower = to_lower_ascii(text);
-        for (const std::string key : keys) {
-            std::size_t pos = 0;
-            while ((pos = lower.find(key, pos)) != std::string::npos) {
-                const bool left_ok = (pos == 0) || is_key_boundary(lower[pos - 1]);
-                const std::size_t key_end = pos + key.size();
-                const bool right_ok = key_end >= lower.size() || is_key_boundary(lower[key_end]);
-                if (!left_ok || !right_ok) {
-                    pos = key_end;
-                    continue;
-                }
+        /// \brief Compiles the default keys.
+        LogRedactor() : LogRedactor(default_keys()) {}
 
-                std::size_t sep = key_end;
-                while (sep < lower.size() && lower[sep] == ' ') ++sep;
-                if (sep >= lower.size() || (lower[sep] != '=' && lower[sep] != ':')) {
-                    pos = key_end;
-                    continue;
-                }
+        /// \brief Compiles a custom key set.
+        /// \param keys Sensitive key names; empty names are ignored.
+        explicit LogRedactor(const std::vector<Key>& keys)
+            : m_automaton(true) {
+            build(keys);
+        }
 
-                std::size_t value_begin = sep + 1;
-                while (value_begin < lower.size() && lower[value_begin] == ' ') ++value_begin;
-                if (value_begin >= lower.size()) {
-                    pos = value_begin;
-                    continue;
-                }
+        /// \brief Redacts recognized secret values.
+        /// \param text Text that may contain key/value secrets.
+        /// \return Text with recognized secret values replaced by "***".
+        std::string redact(std::string_view text) const {
+            std::string output;
+            redact_to(text, output);
+            return output;
+        }
 
-                const char quote = (lower[value_begin] == '"' || lower[value_begin] == '\'')
-                    ? lower[value_begin]
-                    : '\0';
-                if (quote != '\0') ++value_begin;
-
-                std::size_t value_end = value_begin;
-                if (quote != '\0') {
-                    while (value_end < lower.size() && lower[value_end] != quote) ++value_end;
-                } else if (key == "cookie" || key == "cookies" || key == "authorization") {
-                    while (value_end < lower.size() && lower[value_end] != '\r' && lower[value_end] != '\n') {
-                        ++value_end;
+        /// \brief Redacts recognized secret values into a caller-provided buffer.
+        /// \details A value is redacted when a key sits between key boundaries
+        ///          and is followed by optional spaces and '=' or ':'. Quoted
+        ///          values end at the closing quote. Scanning resumes after
+        ///          each redacted value.
+        /// \param text Text that may contain key/value secrets.
+        /// \param output Receives the redacted text; previous content is replaced.
+        void redact_to(std::string_view text, std::string& output) const {
+            output.clear();
+            output.reserve(text.size());
+
+            const std::size_t size = text.size();
+            std::size_t copied = 0;
+            std::size_t i = 0;
+            std::uint32_t state = AhoCorasickAutomaton::ROOT;
+            while (i < size) {
+                state = m_automaton.next(state, text[i]);
+                std::size_t value_begin = 0;
+                std::size_t value_end = 0;
+                bool redacted = false;
+                for (std::uint32_t s = m_automaton.is_terminal(state) ? state : m_automaton.output_link(state);
+                     s != AhoCorasickAutomaton::ROOT; s = m_automaton.output_link(s)) {
+                    const Key& key = m_keys[m_state_key[s]];
+                    if (match_value(text, i + 1 - key.name.size(), i + 1, key.extent, value_begin, value_end)) {
+                        redacted = true;
+                        break;
                     }
-                } else {
-                    while (value_end < lower.size() && !is_value_delimiter(lower[value_end])) ++value_end;
                 }
+                if (!redacted) {
+                    ++i;
+                    continue;
+                }
+                output.append(text.data() + copied, value_begin - copied);
+                output += "***";
+                copied = value_end;
+                i = value_end;
+                state = AhoCorasickAutomaton::ROOT;
+            }
+            output.append(text.data() + copied, size - copied);
+        }
+
+    private:
+        std::vector<Key> m_keys;
+        AhoCorasickAutomaton m_automaton;
+        std::vector<std::size_t> m_state_key; ///< Terminal state -> index into m_keys.
+
+        static bool is_key_char(char ch) noexcept {
+            return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') ||
+                   (ch >= '0' && ch <= '9') || ch == '_' || ch == '-';
+        }
+
+        static bool is_value_delimiter(char ch) noexcept {
+            return ch == '&' || ch == ',' || ch == ';' ||
+                   ch == '\r' || ch == '\n' || ch == '\t' || ch == ' ';
+        }
 
-                text.replace(value_begin, value_end - value_begin, "***");
-                lower = to_lower_ascii(text);
-                pos = value_begin + 3;
+        /// \brief Validates a key occurrence at [key_begin, key_end) and locates its value.
+        static bool match_value(
+                std::string_view text,
+                std::size_t key_begin,
+                std::size_t key_end,
+                ValueExtent extent,
+                std::size_t& value_begin,
+                std::size_t& value_end) noexcept {
+            const std::size_t size = text.size();
+            if (key_begin > 0 && is_key_char(text[key_begin - 1])) return false;
+            if (key_end < size && is_key_char(text[key_end])) return false;
+
+            std::size_t sep = key_end;
+            while (sep < size && text[sep] == ' ') ++sep;
+            if (sep >= size || (text[sep] != '=' && text[sep] != ':')) return false;
+
+            value_begin = sep + 1;
+            while (value_begin < size && text[value_begin] == ' ') ++value_begin;
+            if (value_begin >= size) return false;
+
+            const char quote = (text[value_begin] == '"' || text[value_begin] == '\'') ? text[value_begin] : '\0';
+            if (quote != '\0') ++value_begin;
+
+            value_end = value_begin;
+            if (quote != '\0') {
+                while (value_end < size && text[value_end] != quote) ++value_end;
+            } else if (extent == ValueExtent::LINE) {
+                while (value_end < size && text[value_end] != '\r' && text[value_end] != '\n') ++value_end;
+            } else {
+                while (value_end < size && !is_value_delimiter(text[value_end])) ++value_end;
             }
+            return true;
         }
 
-        return text;
+        void build(const std::vector<Key>& keys) {
+            std::vector<std::uint32_t> terminals;
+            for (const auto& key : keys) {
+                if (key.name.empty()) continue;
+                m_keys.push_back(key);
+                terminals.push_back(m_automaton.add_pattern(key.name));
+            }
+            m_automaton.build();
+
+            // Duplicate names (in any letter case) keep the first entry.
+            m_state_key.assign(m_automaton.state_count(), m_keys.size());
+            for (std::size_t k = 0; k < terminals.size(); ++k) {
+                auto& slot = m_state_key[terminals[k]];
+                if (slot == m_keys.size()) slot = k;
+            }
+        }
+    };
+
+    /// \brief Redacts common secret fields inside a diagnostic string.
+    /// \param text Text that may contain key/value secrets.
+    /// \return Text with recognized secret values replaced by "***".
+    inline std::string redact_secrets_in_text(std::string_view text) {
+        return LogRedactor::default_instance().redact(text);
     }
 
 } // namespace optionx::utils
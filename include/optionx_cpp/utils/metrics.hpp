@@ -0,0 +1,15 @@
+#pragma once
+#ifndef OPTIONX_HEADER_UTILS_METRICS_HPP_INCLUDED
+#define OPTIONX_HEADER_UTILS_METRICS_HPP_INCLUDED
+
+/// \file metrics.hpp
+/// \brief In-process metrics: sharded counters, gauges, HDR-style histograms and exporters.
+/// \details Built-in instrumentation reports to `MetricsRegistry::global()`.
+///          Use `utils/metrics_http.hpp` for the optional Prometheus HTTP endpoint.
+
+#include "metrics/Counter.hpp"
+#include "metrics/Histogram.hpp"
+#include "metrics/MetricsRegistry.hpp"
+#include "metrics/MetricsExport.hpp"
+
+#endif // OPTIONX_HEADER_UTILS_METRICS_HPP_INCLUDED
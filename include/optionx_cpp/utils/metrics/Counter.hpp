@@ -0,0 +1,116 @@
+#pragma once
+#ifndef OPTIONX_HEADER_UTILS_METRICS_COUNTER_HPP_INCLUDED
+#define OPTIONX_HEADER_UTILS_METRICS_COUNTER_HPP_INCLUDED
+
+/// \file Counter.hpp
+/// \brief Sharded monotonic counter and integer gauge.
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace optionx::utils::metrics {
+
+    namespace metrics_detail {
+
+        /// \brief Number of shards per counter; a power of two.
+        constexpr std::size_t kCounterShards = 16;
+
+        /// \brief Destructive-interference size used to pad shards.
+        constexpr std::size_t kCacheLineSize = 64;
+
+        /// \brief Counter shard on its own cache line.
+        struct alignas(kCacheLineSize) CounterCell {
+            std::atomic<std::uint64_t> value{0};
+        };
+
+        /// \brief Returns the shard of the calling thread.
+        /// \details Threads get consecutive shard numbers on first use, so up to
+        ///          kCounterShards writer threads never share a cache line.
+        inline std::size_t thread_shard() noexcept {
+            static std::atomic<std::size_t> s_next{0};
+            thread_local const std::size_t s_shard =
+                s_next.fetch_add(1, std::memory_order_relaxed) & (kCounterShards - 1);
+            return s_shard;
+        }
+
+    } // namespace metrics_detail
+
+    /// \class Counter
+    /// \brief Monotonic counter with per-thread shards.
+    ///
+    /// `inc()` is one relaxed atomic add on the calling thread's shard, so
+    /// hot paths on different threads do not contend. `value()` sums the
+    /// shards and is meant for exporters, not for hot paths.
+    class Counter {
+    public:
+        Counter() = default;
+        Counter(const Counter&) = delete;
+        Counter& operator=(const Counter&) = delete;
+
+        /// \brief Adds a value to the counter.
+        /// \param delta Amount to add.
+        void inc(std::uint64_t delta = 1) noexcept {
+            m_cells[metrics_detail::thread_shard()].value.fetch_add(delta, std::memory_order_relaxed);
+        }
+
+        /// \brief Returns the current total.
+        std::uint64_t value() const noexcept {
+            std::uint64_t total = 0;
+            for (const auto& cell : m_cells) {
+                total += cell.value.load(std::memory_order_relaxed);
+            }
+            return total;
+        }
+
+        /// \brief Resets the counter to zero.
+        /// \details Intended for tests; concurrent increments may survive the reset.
+        void reset() noexcept {
+            for (auto& cell : m_cells) {
+                cell.value.store(0, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        std::array<metrics_detail::CounterCell, metrics_detail::kCounterShards> m_cells;
+    }; // Counter
+
+    /// \class Gauge
+    /// \brief Integer value that can go up and down, such as a queue depth.
+    ///
+    /// Several owners may share one gauge; each should report through `add()`
+    /// with the change of its own contribution so the gauge holds the sum.
+    class Gauge {
+    public:
+        Gauge() = default;
+        Gauge(const Gauge&) = delete;
+        Gauge& operator=(const Gauge&) = delete;
+
+        /// \brief Sets the gauge value.
+        void set(std::int64_t value) noexcept {
+            m_value.store(value, std::memory_order_relaxed);
+        }
+
+        /// \brief Adds a signed delta to the gauge.
+        void add(std::int64_t delta) noexcept {
+            m_value.fetch_add(delta, std::memory_order_relaxed);
+        }
+
+        /// \brief Returns the current value.
+        std::int64_t value() const noexcept {
+            return m_value.load(std::memory_order_relaxed);
+        }
+
+        /// \brief Resets the gauge to zero.
+        void reset() noexcept {
+            set(0);
+        }
+
+    private:
+        alignas(metrics_detail::kCacheLineSize) std::atomic<std::int64_t> m_value{0};
+    }; // Gauge
+
+} // namespace optionx::utils::metrics
+
+#endif // OPTIONX_HEADER_UTILS_METRICS_COUNTER_HPP_INCLUDED
@@ -0,0 +1,200 @@
+#pragma once
+#ifndef OPTIONX_HEADER_UTILS_METRICS_HISTOGRAM_HPP_INCLUDED
+#define OPTIONX_HEADER_UTILS_METRICS_HISTOGRAM_HPP_INCLUDED
+
+/// \file Histogram.hpp
+/// \brief HDR-style log-linear histogram for latencies and sizes.
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace optionx::utils::metrics {
+
+    namespace metrics_detail {
+
+        /// \brief Sub-bucket bits; every power-of-two range is split into 2^(bits-1) buckets.
+        constexpr unsigned kSubBucketBits = 6;
+        constexpr std::uint64_t kSubBucketCount = std::uint64_t{1} << kSubBucketBits;
+        constexpr std::uint64_t kSubBucketHalf = kSubBucketCount / 2;
+        constexpr std::size_t kHistogramBuckets =
+            static_cast<std::size_t>(kSubBucketCount + (64 - kSubBucketBits) * kSubBucketHalf);
+
+        /// \brief Returns the index of the highest set bit of a non-zero value.
+        inline unsigned highest_bit(std::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#else
+            unsigned bit = 0;
+            while (value >>= 1) ++bit;
+            return bit;
+#endif
+        }
+
+        /// \brief Maps a value to its bucket.
+        /// \details Values below kSubBucketCount get exact buckets; larger values
+        ///          keep kSubBucketBits significant bits, so the bucket width is
+        ///          at most 1/32 of the value.
+        inline std::size_t bucket_index(std::uint64_t value) noexcept {
+            if (value < kSubBucketCount) return static_cast<std::size_t>(value);
+            const unsigned exponent = highest_bit(value);
+            const unsigned shift = exponent - (kSubBucketBits - 1);
+            const std::uint64_t mantissa = value >> shift;
+            return static_cast<std::size_t>(
+                kSubBucketCount +
+                (exponent - kSubBucketBits) * kSubBucketHalf +
+                (mantissa - kSubBucketHalf));
+        }
+
+        /// \brief Returns the largest value that maps to a bucket.
+        inline std::uint64_t bucket_upper_bound(std::size_t index) noexcept {
+            if (index < kSubBucketCount) return index;
+            const std::uint64_t offset = index - kSubBucketCount;
+            const unsigned exponent = static_cast<unsigned>(offset / kSubBucketHalf) + kSubBucketBits;
+            const unsigned shift = exponent - (kSubBucketBits - 1);
+            const std::uint64_t mantissa = offset % kSubBucketHalf + kSubBucketHalf;
+            if (mantissa + 1 == kSubBucketCount && exponent == 63) {
+                return std::numeric_limits<std::uint64_t>::max();
+            }
+            return ((mantissa + 1) << shift) - 1;
+        }
+
+    } // namespace metrics_detail
+
+    /// \struct HistogramSnapshot
+    /// \brief Point-in-time copy of a Histogram.
+    struct HistogramSnapshot {
+        std::vector<std::pair<std::size_t, std::uint64_t>> buckets; ///< Non-empty buckets as (index, count), ascending.
+        std::uint64_t count = 0; ///< Number of recorded values.
+        std::uint64_t sum = 0;   ///< Sum of recorded values.
+        std::uint64_t min = 0;   ///< Smallest recorded value, 0 when empty.
+        std::uint64_t max = 0;   ///< Largest recorded value, 0 when empty.
+
+        /// \brief Returns the value at a quantile.
+        /// \param quantile Quantile in [0, 1].
+        /// \return Upper bound of the bucket holding the quantile, capped at `max`.
+        std::uint64_t value_at(double quantile) const noexcept {
+            if (count == 0) return 0;
+            if (!(quantile > 0.0)) return min;
+            if (quantile >= 1.0) return max;
+            const auto rank = static_cast<std::uint64_t>(std::ceil(quantile * static_cast<double>(count)));
+            std::uint64_t seen = 0;
+            for (const auto& bucket : buckets) {
+                seen += bucket.second;
+                if (seen >= rank) {
+                    const std::uint64_t bound = metrics_detail::bucket_upper_bound(bucket.first);
+                    return bound < max ? (bound > min ? bound : min) : max;
+                }
+            }
+            return max;
+        }
+
+        /// \brief Returns the arithmetic mean, or 0 when empty.
+        double mean() const noexcept {
+            return count == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+        }
+    };
+
+    /// \class Histogram
+    /// \brief Lock-free log-linear histogram of non-negative integer values.
+    ///
+    /// Buckets follow the HdrHistogram layout with six significant bits, so
+    /// any recorded value is reported within about 3% over the full 64-bit
+    /// range, with fixed memory (about 15 KiB per histogram). The unit is
+    /// chosen by the caller and belongs in the metric name (`_us`, `_ms`,
+    /// `_bytes`). `record()` is a few relaxed atomic operations.
+    class Histogram {
+    public:
+        Histogram() = default;
+        Histogram(const Histogram&) = delete;
+        Histogram& operator=(const Histogram&) = delete;
+
+        /// \brief Records a value.
+        void record(std::uint64_t value) noexcept {
+            m_buckets[metrics_detail::bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+            m_sum.fetch_add(value, std::memory_order_relaxed);
+            update_min(value);
+            update_max(value);
+        }
+
+        /// \brief Records a duration in microseconds.
+        template<class Rep, class Period>
+        void record_us(std::chrono::duration<Rep, Period> duration) noexcept {
+            const auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+            record(us > 0 ? static_cast<std::uint64_t>(us) : 0);
+        }
+
+        /// \brief Returns a copy of the current state.
+        HistogramSnapshot snapshot() const {
+            HistogramSnapshot snapshot;
+            for (std::size_t i = 0; i < m_buckets.size(); ++i) {
+                const std::uint64_t count = m_buckets[i].load(std::memory_order_relaxed);
+                if (count == 0) continue;
+                snapshot.buckets.emplace_back(i, count);
+                snapshot.count += count;
+            }
+            snapshot.sum = m_sum.load(std::memory_order_relaxed);
+            if (snapshot.count > 0) {
+                snapshot.min = m_min.load(std::memory_order_relaxed);
+                snapshot.max = m_max.load(std::memory_order_relaxed);
+            }
+            return snapshot;
+        }
+
+        /// \brief Clears all buckets.
+        /// \details Intended for tests; concurrent records may survive the reset.
+        void reset() noexcept {
+            for (auto& bucket : m_buckets) bucket.store(0, std::memory_order_relaxed);
+            m_sum.store(0, std::memory_order_relaxed);
+            m_min.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+            m_max.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<std::atomic<std::uint64_t>, metrics_detail::kHistogramBuckets> m_buckets{};
+        std::atomic<std::uint64_t> m_sum{0};
+        std::atomic<std::uint64_t> m_min{std::numeric_limits<std::uint64_t>::max()};
+        std::atomic<std::uint64_t> m_max{0};
+
+        void update_min(std::uint64_t value) noexcept {
+            std::uint64_t current = m_min.load(std::memory_order_relaxed);
+            while (value < current &&
+                   !m_min.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+        }
+
+        void update_max(std::uint64_t value) noexcept {
+            std::uint64_t current = m_max.load(std::memory_order_relaxed);
+            while (value > current &&
+                   !m_max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+        }
+    }; // Histogram
+
+    /// \class ScopedTimer
+    /// \brief Records the lifetime of a scope into a histogram, in microseconds.
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(Histogram& histogram) noexcept
+            : m_histogram(histogram),
+              m_start(std::chrono::steady_clock::now()) {}
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        ~ScopedTimer() {
+            m_histogram.record_us(std::chrono::steady_clock::now() - m_start);
+        }
+
+    private:
+        Histogram& m_histogram;
+        std::chrono::steady_clock::time_point m_start;
+    }; // ScopedTimer
+
+} // namespace optionx::utils::metrics
+
+#endif // OPTIONX_HEADER_UTILS_METRICS_HISTOGRAM_HPP_INCLUDED
@@ -0,0 +1,167 @@
+#pragma once
+#ifndef OPTIONX_HEADER_UTILS_METRICS_METRICS_EXPORT_HPP_INCLUDED
+#define OPTIONX_HEADER_UTILS_METRICS_METRICS_EXPORT_HPP_INCLUDED
+
+/// \file MetricsExport.hpp
+/// \brief Prometheus text and JSON exporters for MetricsRegistry snapshots.
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace optionx::utils::metrics {
+
+    namespace metrics_detail {
+
+        /// \brief Quantiles exported for histograms, with their label values.
+        inline const std::array<std::pair<double, const char*>, 5>& export_quantiles() {
+            static const std::array<std::pair<double, const char*>, 5> s_quantiles = {{
+                {0.5, "0.5"}, {0.9, "0.9"}, {0.99, "0.99"}, {0.999, "0.999"}, {1.0, "1"}
+            }};
+            return s_quantiles;
+        }
+
+        inline void append_escaped(std::string& out, const std::string& text, bool escape_quote) {
+            for (const char ch : text) {
+                if (ch == '\\') {
+                    out += "\\\\";
+                } else
+                if (ch == '\n') {
+                    out += "\\n";
+                } else
+                if (ch == '"' && escape_quote) {
+                    out += "\\\"";
+                } else {
+                    out.push_back(ch);
+                }
+            }
+        }
+
+        inline void append_labels(
+                std::string& out,
+                const MetricLabels& labels,
+                const char* quantile = nullptr) {
+            if (labels.empty() && !quantile) return;
+            out.push_back('{');
+            bool first = true;
+            for (const auto& label : labels) {
+                if (!first) out.push_back(',');
+                first = false;
+                out += label.first;
+                out += "=\"";
+                append_escaped(out, label.second, true);
+                out.push_back('"');
+            }
+            if (quantile) {
+                if (!first) out.push_back(',');
+                out += "quantile=\"";
+                out += quantile;
+                out.push_back('"');
+            }
+            out.push_back('}');
+        }
+
+        inline void append_line(
+                std::string& out,
+                const std::string& name,
+                const char* suffix,
+                const MetricLabels& labels,
+                const char* quantile,
+                const std::string& value) {
+            out += name;
+            out += suffix;
+            append_labels(out, labels, quantile);
+            out.push_back(' ');
+            out += value;
+            out.push_back('\n');
+        }
+
+    } // namespace metrics_detail
+
+    /// \brief Formats metric families in the Prometheus text exposition format (0.0.4).
+    /// \details Histograms are exported as summaries with the 0.5, 0.9, 0.99,
+    ///          0.999 and 1 quantiles plus `_sum` and `_count`.
+    inline std::string to_prometheus_text(const std::vector<MetricFamilySnapshot>& families) {
+        std::string out;
+        for (const auto& family : families) {
+            out += "# HELP ";
+            out += family.name;
+            out.push_back(' ');
+            metrics_detail::append_escaped(out, family.help, false);
+            out += "\n# TYPE ";
+            out += family.name;
+            out.push_back(' ');
+            out += to_str(family.type);
+            out.push_back('\n');
+            for (const auto& sample : family.samples) {
+                if (family.type != MetricType::HISTOGRAM) {
+                    metrics_detail::append_line(out, family.name, "", sample.labels, nullptr, std::to_string(sample.value));
+                    continue;
+                }
+                const auto& histogram = sample.histogram;
+                for (const auto& quantile : metrics_detail::export_quantiles()) {
+                    metrics_detail::append_line(
+                        out, family.name, "", sample.labels, quantile.second,
+                        std::to_string(histogram.value_at(quantile.first)));
+                }
+                metrics_detail::append_line(out, family.name, "_sum", sample.labels, nullptr, std::to_string(histogram.sum));
+                metrics_detail::append_line(out, family.name, "_count", sample.labels, nullptr, std::to_string(histogram.count));
+            }
+        }
+        return out;
+    }
+
+    /// \brief Formats the current state of a registry in the Prometheus text format.
+    inline std::string to_prometheus_text(const MetricsRegistry& registry) {
+        return to_prometheus_text(registry.snapshot());
+    }
+
+    /// \brief Converts metric families to JSON.
+    /// \details Layout: `{"metrics":[{"name","type","help","samples":[...]}]}`.
+    ///          Counter and gauge samples carry `value`; histogram samples carry
+    ///          `count`, `sum`, `min`, `max`, `mean` and `quantiles`.
+    inline nlohmann::json to_json(const std::vector<MetricFamilySnapshot>& families) {
+        nlohmann::json metrics = nlohmann::json::array();
+        for (const auto& family : families) {
+            nlohmann::json samples = nlohmann::json::array();
+            for (const auto& sample : family.samples) {
+                nlohmann::json labels = nlohmann::json::object();
+                for (const auto& label : sample.labels) labels[label.first] = label.second;
+                nlohmann::json item{{"labels", std::move(labels)}};
+                if (family.type != MetricType::HISTOGRAM) {
+                    item["value"] = sample.value;
+                } else {
+                    const auto& histogram = sample.histogram;
+                    nlohmann::json quantiles = nlohmann::json::object();
+                    for (const auto& quantile : metrics_detail::export_quantiles()) {
+                        quantiles[quantile.second] = histogram.value_at(quantile.first);
+                    }
+                    item["count"] = histogram.count;
+                    item["sum"] = histogram.sum;
+                    item["min"] = histogram.min;
+                    item["max"] = histogram.max;
+                    item["mean"] = histogram.mean();
+                    item["quantiles"] = std::move(quantiles);
+                }
+                samples.push_back(std::move(item));
+            }
+            metrics.push_back(nlohmann::json{
+                {"name", family.name},
+                {"type", to_str(family.type)},
+                {"help", family.help},
+                {"samples", std::move(samples)}
+            });
+        }
+        return nlohmann::json{{"metrics", std::move(metrics)}};
+    }
+
+    /// \brief Converts the current state of a registry to JSON.
+    inline nlohmann::json to_json(const MetricsRegistry& registry) {
+        return to_json(registry.snapshot());
+    }
+
+} // namespace optionx::utils::metrics
+
+#endif // OPTIONX_HEADER_UTILS_METRICS_METRICS_EXPORT_HPP_INCLUDED
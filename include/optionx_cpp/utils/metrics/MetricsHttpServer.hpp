@@ -0,0 +1,162 @@
+#pragma once
+#ifndef OPTIONX_HEADER_UTILS_METRICS_METRICS_HTTP_SERVER_HPP_INCLUDED
+#define OPTIONX_HEADER_UTILS_METRICS_METRICS_HTTP_SERVER_HPP_INCLUDED
+
+/// \file MetricsHttpServer.hpp
+/// \brief Optional local HTTP endpoint that serves a MetricsRegistry.
+/// \note Include through `utils/metrics_http.hpp`; it pulls in Simple-Web-Server.
+
+namespace optionx::utils::metrics {
+
+    /// \struct MetricsHttpServerConfig
+    /// \brief Listening address and routes of MetricsHttpServer.
+    struct MetricsHttpServerConfig {
+        std::string address = "127.0.0.1";        ///< Bind address; keep it local unless the port is firewalled.
+        unsigned short port = 9464;               ///< Bind port; 0 picks a free port.
+        std::string path = "/metrics";            ///< Prometheus text route.
+        std::string json_path = "/metrics.json";  ///< JSON route; empty disables it.
+        std::chrono::milliseconds start_timeout{5000}; ///< Maximum wait for the listener in start().
+    };
+
+    /// \class MetricsHttpServer
+    /// \brief Serves a metrics registry over HTTP for Prometheus scrapes.
+    ///
+    /// Runs one Simple-Web-Server listener on its own thread. Every scrape
+    /// takes a registry snapshot, so scraping never blocks instrumented code
+    /// beyond the registry's registration mutex.
+    class MetricsHttpServer {
+    public:
+        /// \brief Creates a server for a registry.
+        /// \param registry Registry to export; must outlive the server.
+        explicit MetricsHttpServer(MetricsRegistry& registry = MetricsRegistry::global())
+            : m_registry(registry) {}
+
+        MetricsHttpServer(const MetricsHttpServer&) = delete;
+        MetricsHttpServer& operator=(const MetricsHttpServer&) = delete;
+
+        /// \brief Stops the listener.
+        ~MetricsHttpServer() {
+            stop();
+        }
+
+        /// \brief Starts listening and waits until the port is bound.
+        /// \param config Listener settings.
+        /// \return True if the listener is running; false if it is already
+        ///         running or the port could not be bound in time.
+        bool start(MetricsHttpServerConfig config = {}) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_server) return false;
+
+            auto server = std::make_shared<HttpServer>();
+            server->config.address = config.address;
+            server->config.port = config.port;
+            server->config.thread_pool_size = 1;
+            configure_routes(*server, config);
+
+            auto started = std::make_shared<std::promise<bool>>();
+            auto result = started->get_future();
+            m_server = server;
+            m_thread = std::thread([server, started]() {
+                try {
+                    server->start([started](unsigned short) {
+                        started->set_value(true);
+                    });
+                } catch (const std::exception& ex) {
+                    LOGIT_ERROR("MetricsHttpServer: failed to start: ", ex.what());
+                    try { started->set_value(false); } catch (const std::future_error&) {}
+                }
+            });
+
+            if (result.wait_for(config.start_timeout) != std::future_status::ready || !result.get()) {
+                stop_locked();
+                return false;
+            }
+            LOGIT_INFO("MetricsHttpServer: listening on ", config.address, ":", server->bound_port());
+            return true;
+        }
+
+        /// \brief Stops the listener and joins its thread.
+        void stop() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            stop_locked();
+        }
+
+        /// \brief Returns the bound port, or 0 when not running.
+        unsigned short port() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_server ? m_server->bound_port() : 0;
+        }
+
+        /// \brief Checks whether the listener is running.
+        bool running() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return static_cast<bool>(m_server);
+        }
+
+    private:
+        class HttpServer final : public SimpleWeb::Server<SimpleWeb::HTTP> {
+        public:
+            unsigned short bound_port() const noexcept {
+                return m_bound_port.load();
+            }
+
+        protected:
+            void after_bind() override {
+                m_bound_port.store(acceptor->local_endpoint().port());
+            }
+
+        private:
+            std::atomic<unsigned short> m_bound_port{0};
+        };
+
+        MetricsRegistry& m_registry;
+        mutable std::mutex m_mutex;
+        std::shared_ptr<HttpServer> m_server;
+        std::thread m_thread;
+
+        void stop_locked() {
+            if (m_server) m_server->stop();
+            if (m_thread.joinable()) m_thread.join();
+            m_server.reset();
+        }
+
+        void configure_routes(HttpServer& server, const MetricsHttpServerConfig& config) {
+            auto* registry = &m_registry;
+            server.resource[route_pattern(config.path)]["GET"] =
+                [registry](
+                    std::shared_ptr<HttpServer::Response> response,
+                    std::shared_ptr<HttpServer::Request>) {
+                    SimpleWeb::CaseInsensitiveMultimap headers;
+                    headers.emplace("Content-Type", "text/plain; version=0.0.4; charset=utf-8");
+                    response->write(SimpleWeb::StatusCode::success_ok, to_prometheus_text(*registry), headers);
+                };
+            if (config.json_path.empty()) return;
+            server.resource[route_pattern(config.json_path)]["GET"] =
+                [registry](
+                    std::shared_ptr<HttpServer::Response> response,
+                    std::shared_ptr<HttpServer::Request>) {
+                    SimpleWeb::CaseInsensitiveMultimap headers;
+                    headers.emplace("Content-Type", "application/json");
+                    response->write(SimpleWeb::StatusCode::success_ok, to_json(*registry).dump(), headers);
+                };
+        }
+
+        /// \brief Builds an exact-match route regex for a literal path.
+        static std::string route_pattern(const std::string& path) {
+            std::string pattern("^");
+            for (const char ch : path) {
+                if (std::isalnum(static_cast<unsigned char>(ch)) || ch == '/' || ch == '_' || ch == '-') {
+                    pattern.push_back(ch);
+                } else {
+                    pattern.push_back('\\');
+                    pattern.push_back(ch);
+                }
+            }
+            pattern.push_back('$');
+            return pattern;
+        }
+    }; // MetricsHttpServer
+
+} // namespace optionx::utils::metrics
+
+#endif // OPTIONX_HEADER_UTILS_METRICS_METRICS_HTTP_SERVER_HPP_INCLUDED
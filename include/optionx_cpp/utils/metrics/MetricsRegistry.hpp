@@ -0,0 +1,241 @@
+#pragma once
+#ifndef OPTIONX_HEADER_UTILS_METRICS_METRICS_REGISTRY_HPP_INCLUDED
+#define OPTIONX_HEADER_UTILS_METRICS_METRICS_REGISTRY_HPP_INCLUDED
+
+/// \file MetricsRegistry.hpp
+/// \brief Named metric families with labels and point-in-time snapshots.
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace optionx::utils::metrics {
+
+    /// \brief Label set of a metric series as (name, value) pairs.
+    using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+    /// \enum MetricType
+    /// \brief Kind of a metric family.
+    enum class MetricType {
+        COUNTER,   ///< Monotonic Counter.
+        GAUGE,     ///< Gauge that can go up and down.
+        HISTOGRAM  ///< Histogram of values; exported as a summary.
+    };
+
+    /// \brief Returns the Prometheus type name of a metric type.
+    inline const char* to_str(MetricType type) noexcept {
+        switch (type) {
+            case MetricType::COUNTER:   return "counter";
+            case MetricType::GAUGE:     return "gauge";
+            case MetricType::HISTOGRAM: return "summary";
+        }
+        return "untyped";
+    }
+
+    /// \struct MetricSample
+    /// \brief Snapshot of one labeled series.
+    struct MetricSample {
+        MetricLabels labels;          ///< Sorted label set.
+        std::int64_t value = 0;       ///< Counter or gauge value.
+        HistogramSnapshot histogram;  ///< Histogram state, for HISTOGRAM families.
+    };
+
+    /// \struct MetricFamilySnapshot
+    /// \brief Snapshot of all series of one metric name.
+    struct MetricFamilySnapshot {
+        std::string name;                 ///< Metric name.
+        std::string help;                 ///< Help text.
+        MetricType type = MetricType::COUNTER; ///< Metric kind.
+        std::vector<MetricSample> samples; ///< Series ordered by label set.
+    };
+
+    /// \class MetricsRegistry
+    /// \brief Owns named metric families and hands out stable references to their series.
+    ///
+    /// Look up a series once (for example in a constructor or a function-local
+    /// static) and keep the returned reference: registration takes a mutex,
+    /// updates do not. Series are never removed, so references stay valid for
+    /// the registry lifetime. Names follow Prometheus rules; reusing a name
+    /// with a different type throws `std::invalid_argument`.
+    class MetricsRegistry {
+    public:
+        MetricsRegistry() = default;
+        MetricsRegistry(const MetricsRegistry&) = delete;
+        MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+        /// \brief Returns the process-wide registry used by built-in instrumentation.
+        /// \details Never destroyed, so components torn down during static
+        ///          destruction can still touch their metrics.
+        static MetricsRegistry& global() {
+            static MetricsRegistry* s_registry = new MetricsRegistry();
+            return *s_registry;
+        }
+
+        /// \brief Returns a counter series, creating it on first use.
+        /// \param name Metric name; counters conventionally end with `_total`.
+        /// \param help Help text, used when the family is created.
+        /// \param labels Label set of the series.
+        Counter& counter(const std::string& name, const std::string& help, MetricLabels labels = {}) {
+            return get<Counter>(MetricType::COUNTER, name, help, std::move(labels));
+        }
+
+        /// \brief Returns a gauge series, creating it on first use.
+        Gauge& gauge(const std::string& name, const std::string& help, MetricLabels labels = {}) {
+            return get<Gauge>(MetricType::GAUGE, name, help, std::move(labels));
+        }
+
+        /// \brief Returns a histogram series, creating it on first use.
+        /// \param name Metric name; include the unit, e.g. `_us`.
+        Histogram& histogram(const std::string& name, const std::string& help, MetricLabels labels = {}) {
+            return get<Histogram>(MetricType::HISTOGRAM, name, help, std::move(labels));
+        }
+
+        /// \brief Returns a snapshot of all families, ordered by name.
+        std::vector<MetricFamilySnapshot> snapshot() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::vector<MetricFamilySnapshot> families;
+            families.reserve(m_families.size());
+            for (const auto& item : m_families) {
+                const auto& family = item.second;
+                MetricFamilySnapshot out;
+                out.name = item.first;
+                out.help = family.help;
+                out.type = family.type;
+                out.samples.reserve(family.series.size());
+                for (const auto& series : family.series) {
+                    MetricSample sample;
+                    sample.labels = series.second.labels;
+                    if (series.second.counter) {
+                        sample.value = static_cast<std::int64_t>(series.second.counter->value());
+                    } else
+                    if (series.second.gauge) {
+                        sample.value = series.second.gauge->value();
+                    } else
+                    if (series.second.histogram) {
+                        sample.histogram = series.second.histogram->snapshot();
+                    }
+                    out.samples.push_back(std::move(sample));
+                }
+                families.push_back(std::move(out));
+            }
+            return families;
+        }
+
+        /// \brief Resets every series to zero; references stay valid.
+        void reset() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto& family : m_families) {
+                for (auto& series : family.second.series) {
+                    if (series.second.counter) series.second.counter->reset();
+                    if (series.second.gauge) series.second.gauge->reset();
+                    if (series.second.histogram) series.second.histogram->reset();
+                }
+            }
+        }
+
+    private:
+        struct Series {
+            MetricLabels labels;
+            std::unique_ptr<Counter> counter;
+            std::unique_ptr<Gauge> gauge;
+            std::unique_ptr<Histogram> histogram;
+        };
+
+        struct Family {
+            MetricType type = MetricType::COUNTER;
+            std::string help;
+            std::map<std::string, Series> series; ///< Series by canonical label key.
+        };
+
+        mutable std::mutex m_mutex;
+        std::map<std::string, Family> m_families;
+
+        template<class T>
+        T& get(MetricType type, const std::string& name, const std::string& help, MetricLabels labels) {
+            if (!is_valid_metric_name(name)) {
+                throw std::invalid_argument("Invalid metric name: " + name);
+            }
+            for (const auto& label : labels) {
+                if (!is_valid_label_name(label.first)) {
+                    throw std::invalid_argument("Invalid label name for metric " + name + ": " + label.first);
+                }
+            }
+            std::sort(labels.begin(), labels.end());
+            const std::string key = label_key(labels);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto family_it = m_families.find(name);
+            if (family_it == m_families.end()) {
+                Family family;
+                family.type = type;
+                family.help = help;
+                family_it = m_families.emplace(name, std::move(family)).first;
+            } else
+            if (family_it->second.type != type) {
+                throw std::invalid_argument("Metric " + name + " is already registered as " + to_str(family_it->second.type));
+            }
+
+            auto& series = family_it->second.series[key];
+            if (series.labels.empty()) series.labels = std::move(labels);
+            return ensure<T>(series);
+        }
+
+        template<class T>
+        static T& ensure(Series& series) {
+            if constexpr (std::is_same_v<T, Counter>) {
+                if (!series.counter) series.counter = std::make_unique<Counter>();
+                return *series.counter;
+            } else
+            if constexpr (std::is_same_v<T, Gauge>) {
+                if (!series.gauge) series.gauge = std::make_unique<Gauge>();
+                return *series.gauge;
+            } else {
+                if (!series.histogram) series.histogram = std::make_unique<Histogram>();
+                return *series.histogram;
+            }
+        }
+
+        static std::string label_key(const MetricLabels& labels) {
+            std::string key;
+            for (const auto& label : labels) {
+                key += label.first;
+                key.push_back('\x1f');
+                key += label.second;
+                key.push_back('\x1e');
+            }
+            return key;
+        }
+
+        static bool is_name_char(char ch, bool first, bool allow_colon) noexcept {
+            if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch == '_') return true;
+            if (allow_colon && ch == ':') return true;
+            return !first && ch >= '0' && ch <= '9';
+        }
+
+        static bool is_valid_metric_name(const std::string& name) noexcept {
+            if (name.empty()) return false;
+            for (std::size_t i = 0; i < name.size(); ++i) {
+                if (!is_name_char(name[i], i == 0, true)) return false;
+            }
+            return true;
+        }
+
+        static bool is_valid_label_name(const std::string& name) noexcept {
+            if (name.empty() || name == "quantile") return false;
+            for (std::size_t i = 0; i < name.size(); ++i) {
+                if (!is_name_char(name[i], i == 0, false)) return false;
+            }
+            return true;
+        }
+    }; // MetricsRegistry
+
+} // namespace optionx::utils::metrics
+
+#endif // OPTIONX_HEADER_UTILS_METRICS_METRICS_REGISTRY_HPP_INCLUDED
@@ -0,0 +1,24 @@
+#pragma once
+#ifndef OPTIONX_HEADER_UTILS_METRICS_HTTP_HPP_INCLUDED
+#define OPTIONX_HEADER_UTILS_METRICS_HTTP_HPP_INCLUDED
+
+/// \file metrics_http.hpp
+/// \brief Local HTTP endpoint exporting metrics in Prometheus text format.
+/// \note Not included by utils.hpp, so builds without Simple-Web-Server are unaffected.
+
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <server_http.hpp>
+#include <logit_cpp/logit.hpp>
+
+#include "metrics.hpp"
+#include "metrics/MetricsHttpServer.hpp"
+
+#endif // OPTIONX_HEADER_UTILS_METRICS_HTTP_HPP_INCLUDED
@@ -10,6 +10,7 @@
 /// It provides a convenient way to include the entire system with a single import.
 
 
+#include "metrics.hpp"
 #include "pubsub/Event.hpp"
 #include "pubsub/EventListener.hpp"
 #include "pubsub/EventBus.hpp"
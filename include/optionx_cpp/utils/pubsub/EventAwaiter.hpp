@@ -90,11 +90,13 @@ namespace optionx::utils {
             // Capture weak_ptr to control lifetime until the first match.
              if (m_single_shot) m_retain_self = this->shared_from_this();
             auto weak_self = this->weak_from_this();
-            m_bus.subscribe<EventType>(this, [weak_self](const EventType& ev){
+            // Typed callback_t keeps overload resolution away from the
+            // `const Event*` overload for events with a `bool` constructor.
+            m_bus.subscribe<EventType>(this, callback_t([weak_self](const EventType& ev){
                 if (auto self = weak_self.lock()) {
                     self->handle_event(ev);
                 }
-            });
+            }));
         }
 
         void handle_event(const EventType& ev) {
@@ -37,6 +37,11 @@ namespace optionx::utils {
         using callback_list_t = std::vector<CallbackRecord>;
         using listener_list_t = std::vector<class EventListener*>;
 
+        EventBus() = default;
+
+        /// \brief Removes events that were never processed from the backlog metric.
+        ~EventBus();
+
         /// \brief Subscribes to an event type with a custom callback function taking a concrete event reference.
         /// \tparam EventType Type of the event to subscribe to.
         /// \param owner Object that owns the subscription, used for later unsubscription.
@@ -98,6 +103,15 @@ namespace optionx::utils {
         mutable std::mutex m_queue_mutex; ///< Mutex for thread-safe queue operations
         mutable std::mutex m_subscriptions_mutex;
         std::queue<std::unique_ptr<Event>> m_event_queue; ///< Queue for asynchronous event processing
+
+        /// \brief Process-wide event bus metrics.
+        struct Metrics {
+            metrics::Gauge&     backlog;  ///< Events queued by notify_async() and not yet dispatched.
+            metrics::Counter&   queued;   ///< Events queued by notify_async().
+            metrics::Histogram& batch_us; ///< Time to dispatch one queued batch.
+
+            static Metrics& instance();
+        };
     };
 
 }; // namespace optionx::utils
@@ -114,14 +114,34 @@ namespace optionx::utils {
         notify(&event);
     }
 
+    inline EventBus::~EventBus() {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        if (!m_event_queue.empty()) {
+            Metrics::instance().backlog.add(-static_cast<std::int64_t>(m_event_queue.size()));
+        }
+    }
+
+    inline EventBus::Metrics& EventBus::Metrics::instance() {
+        auto& registry = metrics::MetricsRegistry::global();
+        static Metrics s_metrics{
+            registry.gauge("optionx_event_bus_backlog", "Events queued by EventBus::notify_async and not yet dispatched."),
+            registry.counter("optionx_event_bus_queued_events_total", "Events queued by EventBus::notify_async."),
+            registry.histogram("optionx_event_bus_batch_us", "Time to dispatch one batch of queued events, in microseconds.")
+        };
+        return s_metrics;
+    }
+
     inline void EventBus::notify_async(std::unique_ptr<Event> event) {
         if (!event) {
             LOGIT_WARN("EventBus::notify_async ignored null event.");
             return;
         }
 
+        auto& metrics = Metrics::instance();
+        metrics.queued.inc();
         std::lock_guard<std::mutex> lock(m_queue_mutex);
         m_event_queue.push(std::move(event));
+        metrics.backlog.add(1);
     }
 
     inline void EventBus::process() {
@@ -132,6 +152,9 @@ namespace optionx::utils {
         std::swap(local_queue, m_event_queue);
         lock.unlock();
 
+        auto& metrics = Metrics::instance();
+        metrics.backlog.add(-static_cast<std::int64_t>(local_queue.size()));
+        metrics::ScopedTimer timer(metrics.batch_us);
         while (!local_queue.empty()) {
             notify(local_queue.front().get());
             local_queue.pop();
@@ -147,6 +170,7 @@ namespace optionx::utils {
             if (m_event_queue.empty()) break;
             std::swap(local, m_event_queue);
             lock.unlock();
+            Metrics::instance().backlog.add(-static_cast<std::int64_t>(local.size()));
 
             while (!local.empty()) {
                 notify(local.front().get());
@@ -12,35 +12,45 @@
 #include <limits>
 #include <optional>
 #include <string>
+#include <string_view>
 
 namespace optionx::utils {
 
+    /// \brief Returns a view without leading or trailing whitespace.
+    /// \param value Source text.
+    /// \return Trimmed view into the source text.
+    inline std::string_view trim_view(std::string_view value) noexcept {
+        std::size_t first = 0;
+        while (first < value.size() &&
+               std::isspace(static_cast<unsigned char>(value[first])) != 0) {
+            ++first;
+        }
+        std::size_t last = value.size();
+        while (last > first &&
+               std::isspace(static_cast<unsigned char>(value[last - 1])) != 0) {
+            --last;
+        }
+        return value.substr(first, last - first);
+    }
+
     /// \brief Returns a copy without leading or trailing whitespace.
     /// \param value Source string.
     /// \return Trimmed copy of the source string.
-    inline std::string trim_copy(const std::string& value) {
-        auto first = std::find_if_not(value.begin(), value.end(), [](unsigned char ch) {
-            return std::isspace(ch) != 0;
-        });
-        if (first == value.end()) return {};
-
-        auto last = std::find_if_not(value.rbegin(), value.rend(), [](unsigned char ch) {
-            return std::isspace(ch) != 0;
-        }).base();
-        return std::string(first, last);
+    inline std::string trim_copy(std::string_view value) {
+        return std::string(trim_view(value));
     }
 
-    /// \brief Extracts a quoted HTML/XML attribute value.
+    /// \brief Extracts a quoted HTML/XML attribute value without copying it.
     /// \param html Source markup fragment.
     /// \param attr_name Attribute name. Matching is case-sensitive.
-    /// \return Attribute value or std::nullopt when the attribute is missing.
-    inline std::optional<std::string> extract_html_attr(
-            const std::string& html,
-            const std::string& attr_name) {
+    /// \return View into `html` or std::nullopt when the attribute is missing.
+    inline std::optional<std::string_view> extract_html_attr_view(
+            std::string_view html,
+            std::string_view attr_name) {
         if (attr_name.empty()) return std::nullopt;
 
         std::size_t pos = 0;
-        while ((pos = html.find(attr_name, pos)) != std::string::npos) {
+        while ((pos = html.find(attr_name, pos)) != std::string_view::npos) {
             if (pos > 0) {
                 const unsigned char prev = static_cast<unsigned char>(html[pos - 1]);
                 if (std::isspace(prev) == 0 && html[pos - 1] != '<' && html[pos - 1] != '/') {
@@ -73,34 +83,45 @@ namespace optionx::utils {
 
             const std::size_t value_start = cursor + 1;
             const std::size_t value_end = html.find(quote, value_start);
-            if (value_end == std::string::npos) return std::nullopt;
+            if (value_end == std::string_view::npos) return std::nullopt;
             return html.substr(value_start, value_end - value_start);
         }
 
         return std::nullopt;
     }
 
+    /// \brief Extracts a quoted HTML/XML attribute value.
+    /// \param html Source markup fragment.
+    /// \param attr_name Attribute name. Matching is case-sensitive.
+    /// \return Attribute value or std::nullopt when the attribute is missing.
+    inline std::optional<std::string> extract_html_attr(
+            std::string_view html,
+            std::string_view attr_name) {
+        auto value = extract_html_attr_view(html, attr_name);
+        if (!value) return std::nullopt;
+        return std::string(*value);
+    }
+
     /// \brief Parses a non-negative decimal int64_t value and rejects partial parses.
     /// \param value Raw numeric string.
     /// \return Parsed value or std::nullopt when the whole string is not digits.
-    inline std::optional<int64_t> parse_i64_strict(const std::string& value) {
+    inline std::optional<int64_t> parse_i64_strict(std::string_view value) {
         if (value.empty()) return std::nullopt;
-        if (!std::all_of(value.begin(), value.end(), [](unsigned char ch) {
-                return std::isdigit(ch) != 0;
-            })) {
-            return std::nullopt;
-        }
-        try {
-            return std::stoll(value);
-        } catch (...) {
-            return std::nullopt;
+        constexpr int64_t max_value = (std::numeric_limits<int64_t>::max)();
+        int64_t result = 0;
+        for (const char ch : value) {
+            if (ch < '0' || ch > '9') return std::nullopt;
+            const int digit = ch - '0';
+            if (result > (max_value - digit) / 10) return std::nullopt;
+            result = result * 10 + digit;
         }
+        return result;
     }
 
     /// \brief Parses a non-negative decimal int value and rejects partial parses.
     /// \param value Raw numeric string.
     /// \return Parsed value or std::nullopt when the value is invalid or too large.
-    inline std::optional<int> parse_int_strict(const std::string& value) {
+    inline std::optional<int> parse_int_strict(std::string_view value) {
         const auto parsed = parse_i64_strict(value);
         if (!parsed ||
             *parsed > static_cast<int64_t>(std::numeric_limits<int>::max())) {
@@ -112,7 +133,7 @@ namespace optionx::utils {
     /// \brief Parses a finite double value and rejects partial parses.
     /// \param value Raw numeric string.
     /// \return Parsed value or std::nullopt when the full string is not a number.
-    inline std::optional<double> parse_double_strict(const std::string& value) {
+    inline std::optional<double> parse_double_strict(std::string_view value) {
         if (value.empty()) return std::nullopt;
         if (std::any_of(value.begin(), value.end(), [](unsigned char ch) {
                 return std::isspace(ch) != 0;
@@ -120,9 +141,10 @@ namespace optionx::utils {
             return std::nullopt;
         }
         try {
+            const std::string text(value);
             std::size_t parsed = 0;
-            const double result = std::stod(value, &parsed);
-            if (parsed != value.size() || !std::isfinite(result)) {
+            const double result = std::stod(text, &parsed);
+            if (parsed != text.size() || !std::isfinite(result)) {
                 return std::nullopt;
             }
             return result;
@@ -136,9 +158,9 @@ namespace optionx::utils {
     /// \param attr_name Attribute name.
     /// \return Parsed value or std::nullopt when the attribute is missing or invalid.
     inline std::optional<int64_t> parse_i64_attr(
-            const std::string& html,
-            const std::string& attr_name) {
-        auto value = extract_html_attr(html, attr_name);
+            std::string_view html,
+            std::string_view attr_name) {
+        auto value = extract_html_attr_view(html, attr_name);
         if (!value) return std::nullopt;
         return parse_i64_strict(*value);
     }
@@ -148,9 +170,9 @@ namespace optionx::utils {
     /// \param attr_name Attribute name.
     /// \return Parsed value or std::nullopt when the attribute is missing or invalid.
     inline std::optional<int> parse_int_attr(
-            const std::string& html,
-            const std::string& attr_name) {
-        auto value = extract_html_attr(html, attr_name);
+            std::string_view html,
+            std::string_view attr_name) {
+        auto value = extract_html_attr_view(html, attr_name);
         if (!value) return std::nullopt;
         return parse_int_strict(*value);
     }
@@ -160,9 +182,9 @@ namespace optionx::utils {
     /// \param attr_name Attribute name.
     /// \return Parsed value or std::nullopt when the attribute is missing or invalid.
     inline std::optional<double> parse_double_attr(
-            const std::string& html,
-            const std::string& attr_name) {
-        auto value = extract_html_attr(html, attr_name);
+            std::string_view html,
+            std::string_view attr_name) {
+        auto value = extract_html_attr_view(html, attr_name);
         if (!value) return std::nullopt;
         return parse_double_strict(*value);
     }
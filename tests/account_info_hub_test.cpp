@@ -3,7 +3,9 @@
 #include <optionx_cpp/components.hpp>
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace {
@@ -176,6 +178,96 @@ TEST(AccountInfoHub, DuplicateAddDoesNotReplayLastUpdateAgain) {
     EXPECT_EQ(late->messages[0], "ready");
 }
 
+TEST(AccountInfoHub, AccountSubscribersReceiveOnlyTheirAccounts) {
+    optionx::components::AccountInfoHub hub;
+
+    hub.publish(optionx::AccountInfoUpdate(
+        nullptr, optionx::AccountUpdateStatus::CONNECTED, 7, "seven"));
+    hub.publish(optionx::AccountInfoUpdate(
+        nullptr, optionx::AccountUpdateStatus::CONNECTED, 8, "eight"));
+    const auto version = hub.account_version(7);
+    EXPECT_NE(version, 0u);
+    EXPECT_EQ(hub.account_version(9), 0u);
+
+    const auto subscriber = std::make_shared<RecordingAccountSubscriber>();
+    hub.add_account_subscriber(subscriber, {7, 9});
+
+    ASSERT_EQ(subscriber->messages.size(), 1u);
+    EXPECT_EQ(subscriber->messages[0], "seven");
+    EXPECT_EQ(hub.account_subscriber_count(7), 1u);
+
+    hub.publish(optionx::AccountInfoUpdate(
+        nullptr, optionx::AccountUpdateStatus::BALANCE_UPDATED, 8, "eight"));
+    EXPECT_EQ(subscriber->messages.size(), 1u);
+
+    hub.publish(optionx::AccountInfoUpdate(
+        nullptr, optionx::AccountUpdateStatus::BALANCE_UPDATED, 7, "balance"));
+    hub.publish(optionx::AccountInfoUpdate(
+        nullptr, optionx::AccountUpdateStatus::CONNECTING, 9, "nine"));
+    ASSERT_EQ(subscriber->messages.size(), 3u);
+    EXPECT_EQ(subscriber->messages[1], "balance");
+    EXPECT_EQ(subscriber->messages[2], "nine");
+    EXPECT_GT(hub.account_version(7), version);
+
+    const auto last = hub.last_update(8);
+    ASSERT_TRUE(last.has_value());
+    EXPECT_EQ(last->status, optionx::AccountUpdateStatus::BALANCE_UPDATED);
+    EXPECT_EQ(hub.last_update()->account_id, 9);
+
+    hub.remove_subscriber(subscriber.get());
+    hub.publish(optionx::AccountInfoUpdate(
+        nullptr, optionx::AccountUpdateStatus::DISCONNECTED, 7, "stop"));
+    EXPECT_EQ(subscriber->messages.size(), 3u);
+    EXPECT_EQ(hub.account_subscriber_count(7), 0u);
+}
+
+TEST(AccountInfoHub, ConcurrentPublishersDeliverAccountUpdatesInOrder) {
+    optionx::components::AccountInfoHub hub;
+    hub.publish(optionx::AccountInfoUpdate(
+        nullptr, optionx::AccountUpdateStatus::CONNECTED, 7, "start"));
+
+    class OrderedSubscriber final : public optionx::components::IAccountInfoSubscriber {
+    public:
+        void on_account_info(const optionx::AccountInfoUpdate& update) override {
+            std::lock_guard<std::mutex> lock(mutex);
+            messages.push_back(update.message);
+        }
+
+        std::mutex mutex;
+        std::vector<std::string> messages;
+    };
+
+    const auto subscriber = std::make_shared<OrderedSubscriber>();
+    hub.add_account_subscriber(subscriber, {7});
+
+    constexpr int kThreads = 4;
+    constexpr int kUpdates = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&hub, t]() {
+            for (int i = 0; i < kUpdates; ++i) {
+                hub.publish(optionx::AccountInfoUpdate(
+                    nullptr,
+                    optionx::AccountUpdateStatus::BALANCE_UPDATED,
+                    7,
+                    std::to_string(t * kUpdates + i)));
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    std::lock_guard<std::mutex> lock(subscriber->mutex);
+    ASSERT_EQ(subscriber->messages.size(), static_cast<std::size_t>(kThreads * kUpdates + 1));
+    EXPECT_EQ(subscriber->messages.front(), "start");
+    EXPECT_EQ(subscriber->messages.back(), hub.last_update(7)->message);
+    std::vector<int> last_seen(kThreads, -1);
+    for (std::size_t i = 1; i < subscriber->messages.size(); ++i) {
+        const int value = std::stoi(subscriber->messages[i]);
+        EXPECT_GT(value % kUpdates, last_seen[value / kUpdates]);
+        last_seen[value / kUpdates] = value % kUpdates;
+    }
+}
+
 TEST(AccountInfoHub, BindsToAccountInfoCallback) {
     optionx::components::AccountInfoHub hub;
     optionx::account_info_callback_t callback;
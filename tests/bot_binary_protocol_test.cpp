@@ -2,6 +2,8 @@
 
 #include <optionx_cpp/bridges.hpp>
 
+#include <filesystem>
+#include <fstream>
 #include <stdexcept>
 #include <string>
 
@@ -367,6 +369,102 @@ TEST(BotBinaryProtocol, RejectsInvalidCommands) {
         std::invalid_argument);
 }
 
+TEST(BridgeDedupeStore, RejectsDuplicatesWithinTtlWindow) {
+    optionx::bridges::detail::BridgeDedupeStore store;
+    std::string error;
+    ASSERT_TRUE(store.open({}, 1000, 16, 0, error)) << error;
+    EXPECT_FALSE(store.persistent());
+
+    EXPECT_TRUE(store.remember("signal-a", 100));
+    EXPECT_FALSE(store.remember("signal-a", 500));
+    EXPECT_TRUE(store.contains("signal-a", 1099));
+    EXPECT_FALSE(store.contains("signal-a", 1100));
+    EXPECT_TRUE(store.remember("signal-a", 1200));
+
+    store.forget("signal-a");
+    EXPECT_FALSE(store.contains("signal-a", 1200));
+    EXPECT_EQ(store.size(), 0u);
+}
+
+TEST(BridgeDedupeStore, EvictsOldestKeysAtHardCap) {
+    optionx::bridges::detail::BridgeDedupeStore store;
+    std::string error;
+    ASSERT_TRUE(store.open({}, 0, 3, 0, error)) << error;
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(store.remember("key-" + std::to_string(i), i));
+    }
+    EXPECT_EQ(store.size(), 3u);
+    EXPECT_FALSE(store.contains("key-96", 100));
+    EXPECT_TRUE(store.contains("key-97", 100));
+    EXPECT_TRUE(store.contains("key-99", 100));
+}
+
+TEST(BridgeDedupeStore, ReplaysJournalAfterReopen) {
+    namespace fs = std::filesystem;
+    const auto path = fs::temp_directory_path() / "optionx_bridge_dedupe_store_test.bin";
+    fs::remove(path);
+
+    {
+        optionx::bridges::detail::BridgeDedupeStore store;
+        std::string error;
+        ASSERT_TRUE(store.open(path, 10000, 64, 0, error)) << error;
+        EXPECT_TRUE(store.persistent());
+        EXPECT_TRUE(store.remember("kept", 0));
+        EXPECT_TRUE(store.remember("forgotten", 0));
+        EXPECT_TRUE(store.remember("short-lived", 0));
+        store.forget("forgotten");
+    }
+
+    {
+        // A torn trailing record must not invalidate the rest of the journal.
+        std::ofstream tail(path, std::ios::binary | std::ios::app);
+        tail.write("\x01\x02\x03", 3);
+    }
+
+    optionx::bridges::detail::BridgeDedupeStore store;
+    std::string error;
+    ASSERT_TRUE(store.open(path, 10000, 64, 5000, error)) << error;
+    EXPECT_FALSE(store.remember("kept", 5000));
+    EXPECT_TRUE(store.contains("short-lived", 5000));
+    EXPECT_TRUE(store.remember("forgotten", 5000));
+    EXPECT_FALSE(store.contains("kept", 10000));
+
+    store.close();
+    fs::remove(path);
+}
+
+TEST(BridgeDedupeStore, FallsBackToMemoryWhenJournalRewriteFails) {
+    namespace fs = std::filesystem;
+    const auto path = fs::temp_directory_path() / "optionx_bridge_dedupe_store_fail_test.bin";
+    auto temp_path = path;
+    temp_path += ".tmp";
+    fs::remove(path);
+    fs::remove_all(temp_path);
+
+    optionx::bridges::detail::BridgeDedupeStore store;
+    std::string error;
+    ASSERT_TRUE(store.open(path, 10000, 64, 0, error)) << error;
+    EXPECT_TRUE(store.take_journal_error().empty());
+
+    // A directory in place of the temporary file makes compaction fail.
+    fs::create_directory(temp_path);
+    for (int i = 0; i < 100 && store.persistent(); ++i) {
+        EXPECT_TRUE(store.remember("churn", 0));
+        store.forget("churn");
+    }
+    EXPECT_FALSE(store.persistent());
+    EXPECT_FALSE(store.take_journal_error().empty());
+    EXPECT_TRUE(store.take_journal_error().empty());
+
+    EXPECT_TRUE(store.remember("after-failure", 0));
+    EXPECT_FALSE(store.remember("after-failure", 1));
+
+    store.close();
+    fs::remove_all(temp_path);
+    fs::remove(path);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,604 @@
+#pragma once
+
+// Local Intrade Bar stand-in for offline platform tests and benchmarks.
+//
+// One loopback port serves recorded HTTP responses and, through HTTP upgrade,
+// the `/bapi` and `/fxconnect` websocket streams, so `AuthData::host` alone
+// points both the HTTP client and the websocket managers at the mock.
+
+#include <server_http.hpp>
+#include <server_ws.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace optionx::tests::intrade_bar_mock {
+
+/// Recorded HTTP response. Bodies may contain `%NOW_MS%`, `%NOW_SEC%` and
+/// `%SEQ%` (1-based request number of the route), expanded when served.
+struct MockHttpResponse {
+    int status = 200;
+    std::string body;
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::int64_t delay_ms = 0; ///< Simulated broker latency.
+};
+
+/// Responses of one method/path pair, served in order. After the last one the
+/// route repeats it, or starts over when `loop` is set.
+struct MockHttpRoute {
+    std::string method = "GET";
+    std::string path;
+    std::vector<MockHttpResponse> responses;
+    bool loop = false;
+};
+
+/// Recorded websocket frame at an offset from the stream start.
+struct MockWsFrame {
+    std::int64_t offset_ms = 0;
+    std::string message; ///< Same placeholders as MockHttpResponse::body.
+};
+
+/// Recorded websocket stream. `/bapi` streams start on connect; streams with
+/// a `subscription` start when the client sends that text (the `/fxconnect`
+/// symbol frame, such as `EUR/USD`).
+struct MockWsStream {
+    std::string path;
+    std::string subscription;
+    std::vector<MockWsFrame> frames;
+};
+
+/// Recorded broker session.
+///
+/// JSON layout:
+/// `{"http":[{"method","path","loop","responses":[{"status","body","headers":{},"delay_ms"}]}],
+///   "ws":[{"path","subscription","frames":[{"t_ms","message"}]}]}`
+struct MockRecording {
+    std::vector<MockHttpRoute> http;
+    std::vector<MockWsStream> ws;
+
+    static MockRecording from_json(const nlohmann::json& j) {
+        MockRecording recording;
+        for (const auto& item : j.value("http", nlohmann::json::array())) {
+            MockHttpRoute route;
+            route.method = item.value("method", "GET");
+            route.path = item.at("path").get<std::string>();
+            route.loop = item.value("loop", false);
+            for (const auto& r : item.value("responses", nlohmann::json::array())) {
+                MockHttpResponse response;
+                response.status = r.value("status", 200);
+                response.body = r.value("body", "");
+                response.delay_ms = r.value("delay_ms", std::int64_t{0});
+                // items() only references its object, so the headers must outlive the loop.
+                const auto headers = r.value("headers", nlohmann::json::object());
+                for (const auto& header : headers.items()) {
+                    response.headers.emplace_back(header.key(), header.value().get<std::string>());
+                }
+                route.responses.push_back(std::move(response));
+            }
+            recording.http.push_back(std::move(route));
+        }
+        for (const auto& item : j.value("ws", nlohmann::json::array())) {
+            MockWsStream stream;
+            stream.path = item.at("path").get<std::string>();
+            stream.subscription = item.value("subscription", "");
+            for (const auto& f : item.value("frames", nlohmann::json::array())) {
+                stream.frames.push_back({f.value("t_ms", std::int64_t{0}), f.at("message").get<std::string>()});
+            }
+            std::stable_sort(stream.frames.begin(), stream.frames.end(),
+                [](const MockWsFrame& a, const MockWsFrame& b) { return a.offset_ms < b.offset_ms; });
+            recording.ws.push_back(std::move(stream));
+        }
+        return recording;
+    }
+
+    static MockRecording load_file(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) throw std::runtime_error("Cannot open mock recording: " + path);
+        return from_json(nlohmann::json::parse(file));
+    }
+};
+
+/// Replay settings for websocket streams.
+struct MockReplayConfig {
+    double speed = 1.0;             ///< Speed multiple of recorded time; <= 0 sends frames back to back.
+    std::size_t repeat = 1;         ///< Passes over each stream; 0 repeats until the connection closes.
+    std::int64_t repeat_gap_ms = 0; ///< Recorded-time gap between passes.
+};
+
+struct MockBrokerConfig {
+    std::string address = "127.0.0.1";
+    unsigned short port = 0; ///< 0 picks a free port.
+    std::size_t thread_pool_size = 1;
+    MockReplayConfig replay;
+    std::size_t max_logged_requests = 1024;
+};
+
+struct MockHttpRequestLog {
+    std::string method;
+    std::string path;
+    std::string query;
+    std::string body;
+};
+
+struct MockBrokerStats {
+    std::uint64_t http_requests = 0;
+    std::uint64_t http_unmatched = 0;
+    std::uint64_t ws_connections = 0;
+    std::uint64_t ws_subscriptions = 0;
+    std::uint64_t ws_frames_sent = 0;
+};
+
+/// Minimal recorded session for a USER_TOKEN login on a demo USD account:
+/// profile, balance, price polling, active trades, trade open/check and both
+/// websocket price streams with `frames_per_stream` frames every `interval_ms`.
+inline MockRecording make_default_recording(
+        std::size_t frames_per_stream = 10,
+        std::int64_t interval_ms = 100) {
+    MockRecording recording;
+    auto add = [&recording](std::string method, std::string path, std::string body) {
+        MockHttpRoute route;
+        route.method = std::move(method);
+        route.path = std::move(path);
+        MockHttpResponse response;
+        response.body = std::move(body);
+        route.responses.push_back(std::move(response));
+        recording.http.push_back(std::move(route));
+    };
+
+    add("GET", "/profile",
+        "<div class=\"radio\"><label><input type=\"radio\" name=\"user_real_trade\" value=\"0\" checked=\"checked\">Demo</label></div>"
+        "<div class=\"radio\"><label><input type=\"radio\" name=\"user_real_trade\" value=\"1\">Real</label></div>"
+        "<div class=\"radio\"><label><input type=\"radio\" name=\"user_currency_edit\" value=\"0\" checked=\"checked\">USD</label></div>"
+        "<div class=\"radio\"><label><input type=\"radio\" name=\"user_currency_edit\" value=\"1\">RUB</label></div>");
+    add("POST", "/balance.php", "10000.00 $");
+    add("GET", "/price_now",
+        R"({"EUR/USD":{"ask":1.10002,"bid":1.10001,"Updates":%NOW_SEC%}})");
+    add("GET", "/",
+        "<table><tbody class=\"table_tbody\" id=\"trade_active\"></tbody></table>"
+        "<div id=\"trade_close_block\" class=\"hide\"><table class=\"\">"
+        "<tbody class=\"table_tbody\" id=\"trade_close\"></tbody></table>"
+        "<div class=\"text-center\"><a id=\"trade_btn_load_more\" data-last=\"\"></a></div></div>");
+    add("POST", "/ajax5_new.php",
+        "<tr data-id=\"%SEQ%\" data-timeopen=\"%NOW_SEC%\" data-rate=\"1.10001\"></tr>");
+    add("POST", "/trade_check2.php", "1.10010;1.80");
+    add("POST", "/user_real_trade.php", "ok");
+    add("POST", "/user_currency_edit.php", "ok");
+
+    MockWsStream bapi;
+    bapi.path = "/bapi";
+    MockWsStream fx;
+    fx.path = "/fxconnect";
+    fx.subscription = "EUR/USD";
+    for (std::size_t i = 0; i < frames_per_stream; ++i) {
+        const auto offset = static_cast<std::int64_t>(i) * interval_ms;
+        char price[32];
+        std::snprintf(price, sizeof(price), "%.2f", 61500.0 + static_cast<double>(i));
+        char ask[32];
+        char bid[32];
+        std::snprintf(ask, sizeof(ask), "%.5f", 1.10002 + 0.00001 * static_cast<double>(i));
+        std::snprintf(bid, sizeof(bid), "%.5f", 1.10001 + 0.00001 * static_cast<double>(i));
+        bapi.frames.push_back({offset,
+            std::string(R"({"stream":"btcusdt@aggTrade","data":{"e":"aggTrade","E":%NOW_MS%,"s":"BTCUSDT","p":")") +
+            price + R"(","q":"0.00017000","T":%NOW_MS%,"m":false,"M":true}})"});
+        fx.frames.push_back({offset,
+            std::string(R"({"Updates":%NOW_SEC%,"ask":)") + ask +
+            R"(,"bid":)" + bid + R"(,"symbol":"EUR\/USD"})"});
+    }
+    recording.ws.push_back(std::move(bapi));
+    recording.ws.push_back(std::move(fx));
+    return recording;
+}
+
+/// Loopback Intrade Bar broker that serves a MockRecording.
+///
+/// HTTP routes answer from the recording; HEAD requests to any recorded GET
+/// path return its status without a body, which covers the host availability
+/// check. Websocket upgrades on the same port are handed to an embedded
+/// Simple-WebSocket-Server, and one scheduler thread replays the recorded
+/// frames and delayed HTTP responses at the configured speed.
+class IntradeBarMockBroker {
+public:
+    using HttpServer = SimpleWeb::Server<SimpleWeb::HTTP>;
+    using WsServer = SimpleWeb::SocketServer<SimpleWeb::WS>;
+    using clock_t = std::chrono::steady_clock;
+
+    explicit IntradeBarMockBroker(MockRecording recording, MockBrokerConfig config = {})
+        : m_recording(std::move(recording)),
+          m_config(std::move(config)) {}
+
+    IntradeBarMockBroker(const IntradeBarMockBroker&) = delete;
+    IntradeBarMockBroker& operator=(const IntradeBarMockBroker&) = delete;
+
+    ~IntradeBarMockBroker() {
+        stop();
+    }
+
+    /// Starts the listener and the replay thread; returns false if the port could not be bound.
+    bool start(std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+        if (m_server_thread.joinable()) return false;
+        m_http.config.address = m_config.address;
+        m_http.config.port = m_config.port;
+        m_http.config.thread_pool_size = m_config.thread_pool_size;
+        configure_http_routes();
+        configure_ws_endpoints();
+
+        {
+            std::lock_guard<std::mutex> lock(m_task_mutex);
+            m_stop_tasks = false;
+        }
+        m_task_thread = std::thread([this]() { run_tasks(); });
+
+        auto port_promise = std::make_shared<std::promise<unsigned short>>();
+        auto port_future = port_promise->get_future();
+        m_server_thread = std::thread([this, port_promise]() {
+            try {
+                m_http.start([port_promise](unsigned short port) {
+                    try { port_promise->set_value(port); } catch (...) {}
+                });
+            } catch (...) {
+                try { port_promise->set_value(0); } catch (...) {}
+            }
+        });
+
+        if (port_future.wait_for(timeout) != std::future_status::ready ||
+            (m_port = port_future.get()) == 0) {
+            stop();
+            return false;
+        }
+        return true;
+    }
+
+    /// Stops replay, closes websocket clients and joins the server threads.
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(m_task_mutex);
+            m_stop_tasks = true;
+            m_tasks = {};
+        }
+        m_task_cv.notify_all();
+        if (m_task_thread.joinable()) m_task_thread.join();
+
+        {
+            std::lock_guard<std::mutex> lock(m_session_mutex);
+            for (auto& item : m_sessions) item.second->active = false;
+            m_sessions.clear();
+        }
+        for (const auto& connection : m_ws.get_connections()) {
+            connection->send_close(1001);
+        }
+        m_http.stop();
+        if (m_server_thread.joinable()) m_server_thread.join();
+        m_port = 0;
+    }
+
+    unsigned short port() const noexcept {
+        return m_port;
+    }
+
+    /// Returns the value for `AuthData::host`.
+    std::string host() const {
+        return "http://" + m_config.address + ":" + std::to_string(m_port);
+    }
+
+    MockBrokerStats stats() const {
+        MockBrokerStats stats;
+        stats.http_requests = m_http_requests.load();
+        stats.http_unmatched = m_http_unmatched.load();
+        stats.ws_connections = m_ws_connections.load();
+        stats.ws_subscriptions = m_ws_subscriptions.load();
+        stats.ws_frames_sent = m_ws_frames_sent.load();
+        return stats;
+    }
+
+    /// Returns how many requests a recorded route has served.
+    std::uint64_t route_hits(const std::string& method, const std::string& path) const {
+        std::lock_guard<std::mutex> lock(m_log_mutex);
+        auto it = m_route_hits.find(method + ' ' + path);
+        return it == m_route_hits.end() ? 0 : it->second;
+    }
+
+    /// Returns the logged requests, oldest first, up to `max_logged_requests`.
+    std::vector<MockHttpRequestLog> requests() const {
+        std::lock_guard<std::mutex> lock(m_log_mutex);
+        return m_requests;
+    }
+
+private:
+    struct ReplaySession {
+        std::weak_ptr<WsServer::Connection> connection;
+        const MockWsStream* stream = nullptr;
+        std::size_t index = 0;
+        std::size_t pass = 0;
+        clock_t::time_point started;
+        std::atomic<bool> active{true};
+    };
+
+    struct Task {
+        clock_t::time_point due;
+        std::uint64_t sequence = 0;
+        std::function<void()> run;
+
+        bool operator>(const Task& other) const noexcept {
+            return due != other.due ? due > other.due : sequence > other.sequence;
+        }
+    };
+
+    MockRecording m_recording;
+    MockBrokerConfig m_config;
+    HttpServer m_http;
+    WsServer m_ws;
+    std::thread m_server_thread;
+    unsigned short m_port = 0;
+
+    std::mutex m_task_mutex;
+    std::condition_variable m_task_cv;
+    std::priority_queue<Task, std::vector<Task>, std::greater<Task>> m_tasks;
+    std::uint64_t m_task_sequence = 0;
+    bool m_stop_tasks = false;
+    std::thread m_task_thread;
+
+    std::mutex m_session_mutex;
+    std::unordered_map<const WsServer::Connection*, std::shared_ptr<ReplaySession>> m_sessions;
+
+    mutable std::mutex m_log_mutex;
+    std::unordered_map<std::string, std::uint64_t> m_route_hits;
+    std::vector<MockHttpRequestLog> m_requests;
+
+    std::atomic<std::uint64_t> m_http_requests{0};
+    std::atomic<std::uint64_t> m_http_unmatched{0};
+    std::atomic<std::uint64_t> m_ws_connections{0};
+    std::atomic<std::uint64_t> m_ws_subscriptions{0};
+    std::atomic<std::uint64_t> m_ws_frames_sent{0};
+
+    static std::string route_pattern(const std::string& path) {
+        std::string pattern("^");
+        for (const char ch : path) {
+            if (std::isalnum(static_cast<unsigned char>(ch)) || ch == '/' || ch == '_' || ch == '-') {
+                pattern.push_back(ch);
+            } else {
+                pattern.push_back('\\');
+                pattern.push_back(ch);
+            }
+        }
+        pattern += "/?$";
+        return pattern;
+    }
+
+    static void replace_all(std::string& text, const std::string& token, const std::string& value) {
+        for (std::size_t pos = text.find(token); pos != std::string::npos; pos = text.find(token, pos + value.size())) {
+            text.replace(pos, token.size(), value);
+        }
+    }
+
+    static std::string expand(std::string text, std::uint64_t sequence) {
+        if (text.find('%') == std::string::npos) return text;
+        const auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        replace_all(text, "%NOW_MS%", std::to_string(now_ms));
+        replace_all(text, "%NOW_SEC%", std::to_string(now_ms / 1000));
+        replace_all(text, "%SEQ%", std::to_string(sequence));
+        return text;
+    }
+
+    void schedule(clock_t::time_point due, std::function<void()> run) {
+        {
+            std::lock_guard<std::mutex> lock(m_task_mutex);
+            if (m_stop_tasks) return;
+            m_tasks.push(Task{due, ++m_task_sequence, std::move(run)});
+        }
+        m_task_cv.notify_one();
+    }
+
+    void run_tasks() {
+        std::unique_lock<std::mutex> lock(m_task_mutex);
+        while (!m_stop_tasks) {
+            if (m_tasks.empty()) {
+                m_task_cv.wait(lock);
+                continue;
+            }
+            // Copied: schedule() may reallocate the queue while the wait releases the lock.
+            const auto due = m_tasks.top().due;
+            if (due > clock_t::now()) {
+                m_task_cv.wait_until(lock, due);
+                continue;
+            }
+            auto run = std::move(const_cast<Task&>(m_tasks.top()).run);
+            m_tasks.pop();
+            lock.unlock();
+            run();
+            lock.lock();
+        }
+    }
+
+    std::uint64_t log_request(
+            const std::string& method,
+            const std::string& path,
+            const std::shared_ptr<HttpServer::Request>& request) {
+        ++m_http_requests;
+        std::lock_guard<std::mutex> lock(m_log_mutex);
+        if (m_requests.size() < m_config.max_logged_requests) {
+            m_requests.push_back({method, path, request->query_string, request->content.string()});
+        }
+        return ++m_route_hits[method + ' ' + path];
+    }
+
+    void configure_http_routes() {
+        for (const auto& route : m_recording.http) {
+            const MockHttpRoute* route_ptr = &route;
+            auto& methods = m_http.resource[route_pattern(route.path)];
+            methods[route.method] = [this, route_ptr](
+                    std::shared_ptr<HttpServer::Response> response,
+                    std::shared_ptr<HttpServer::Request> request) {
+                const auto sequence = log_request(route_ptr->method, route_ptr->path, request);
+                if (route_ptr->responses.empty()) {
+                    response->write(SimpleWeb::StatusCode::server_error_not_implemented);
+                    return;
+                }
+                const auto count = route_ptr->responses.size();
+                const auto index = route_ptr->loop
+                    ? static_cast<std::size_t>((sequence - 1) % count)
+                    : static_cast<std::size_t>(std::min<std::uint64_t>(sequence - 1, count - 1));
+                const MockHttpResponse& recorded = route_ptr->responses[index];
+                auto write = [response, &recorded, sequence]() {
+                    SimpleWeb::CaseInsensitiveMultimap headers;
+                    for (const auto& header : recorded.headers) headers.emplace(header.first, header.second);
+                    response->write(
+                        static_cast<SimpleWeb::StatusCode>(recorded.status),
+                        expand(recorded.body, sequence),
+                        headers);
+                };
+                if (recorded.delay_ms > 0) {
+                    schedule(clock_t::now() + std::chrono::milliseconds(recorded.delay_ms), std::move(write));
+                } else {
+                    write();
+                }
+            };
+            if (route.method == "GET" && methods.find("HEAD") == methods.end()) {
+                methods["HEAD"] = [this, route_ptr](
+                        std::shared_ptr<HttpServer::Response> response,
+                        std::shared_ptr<HttpServer::Request> request) {
+                    log_request("HEAD", route_ptr->path, request);
+                    const int status = route_ptr->responses.empty() ? 200 : route_ptr->responses.front().status;
+                    response->write(static_cast<SimpleWeb::StatusCode>(status));
+                };
+            }
+        }
+
+        m_http.default_resource["GET"] = m_http.default_resource["POST"] = m_http.default_resource["HEAD"] = [this](
+                std::shared_ptr<HttpServer::Response> response,
+                std::shared_ptr<HttpServer::Request> request) {
+            ++m_http_requests;
+            ++m_http_unmatched;
+            response->write(SimpleWeb::StatusCode::client_error_not_found, "Not recorded: " + request->path);
+        };
+
+        // Hand-off documented on SocketServer::upgrade(): the connection keeps
+        // the HTTP server's socket and io_service, so m_ws is never started.
+        m_http.on_upgrade = [this](
+                std::unique_ptr<SimpleWeb::HTTP>& socket,
+                std::shared_ptr<HttpServer::Request> request) {
+            auto connection = std::make_shared<WsServer::Connection>(std::move(socket));
+            connection->method = std::move(request->method);
+            connection->path = std::move(request->path);
+            connection->query_string = std::move(request->query_string);
+            connection->http_version = std::move(request->http_version);
+            connection->header = std::move(request->header);
+            m_ws.upgrade(connection);
+        };
+    }
+
+    void configure_ws_endpoints() {
+        std::vector<std::string> paths;
+        for (const auto& stream : m_recording.ws) {
+            if (std::find(paths.begin(), paths.end(), stream.path) == paths.end()) {
+                paths.push_back(stream.path);
+            }
+        }
+        for (const auto& path : paths) {
+            auto& endpoint = m_ws.endpoint[route_pattern(path)];
+            endpoint.on_open = [this, path](std::shared_ptr<WsServer::Connection> connection) {
+                ++m_ws_connections;
+                if (const auto* stream = find_stream(path, std::string())) {
+                    start_replay(connection, *stream);
+                }
+            };
+            endpoint.on_message = [this, path](
+                    std::shared_ptr<WsServer::Connection> connection,
+                    std::shared_ptr<WsServer::InMessage> message) {
+                if (const auto* stream = find_stream(path, message->string())) {
+                    start_replay(connection, *stream);
+                }
+            };
+            endpoint.on_close = [this](std::shared_ptr<WsServer::Connection> connection, int, const std::string&) {
+                end_replay(connection.get());
+            };
+            endpoint.on_error = [this](std::shared_ptr<WsServer::Connection> connection, const SimpleWeb::error_code&) {
+                end_replay(connection.get());
+            };
+        }
+    }
+
+    const MockWsStream* find_stream(const std::string& path, const std::string& subscription) const {
+        for (const auto& stream : m_recording.ws) {
+            if (stream.path == path && stream.subscription == subscription) return &stream;
+        }
+        return nullptr;
+    }
+
+    void start_replay(const std::shared_ptr<WsServer::Connection>& connection, const MockWsStream& stream) {
+        auto session = std::make_shared<ReplaySession>();
+        session->connection = connection;
+        session->stream = &stream;
+        session->started = clock_t::now();
+        {
+            std::lock_guard<std::mutex> lock(m_session_mutex);
+            auto& slot = m_sessions[connection.get()];
+            if (slot) slot->active = false;
+            slot = session;
+        }
+        ++m_ws_subscriptions;
+        schedule_next_frame(session);
+    }
+
+    void end_replay(const WsServer::Connection* connection) {
+        std::lock_guard<std::mutex> lock(m_session_mutex);
+        auto it = m_sessions.find(connection);
+        if (it == m_sessions.end()) return;
+        it->second->active = false;
+        m_sessions.erase(it);
+    }
+
+    void schedule_next_frame(const std::shared_ptr<ReplaySession>& session) {
+        const auto& frames = session->stream->frames;
+        if (frames.empty()) return;
+        if (session->index == frames.size()) {
+            session->index = 0;
+            ++session->pass;
+        }
+        const auto repeat = m_config.replay.repeat;
+        if (repeat != 0 && session->pass >= repeat) return;
+
+        auto due = clock_t::now();
+        if (m_config.replay.speed > 0.0) {
+            const auto pass_ms = frames.back().offset_ms + m_config.replay.repeat_gap_ms;
+            const auto offset_ms = static_cast<double>(
+                static_cast<std::int64_t>(session->pass) * pass_ms + frames[session->index].offset_ms);
+            due = session->started + std::chrono::microseconds(
+                static_cast<std::int64_t>(offset_ms * 1000.0 / m_config.replay.speed));
+        }
+        schedule(due, [this, session]() { send_frame(session); });
+    }
+
+    void send_frame(const std::shared_ptr<ReplaySession>& session) {
+        if (!session->active) return;
+        auto connection = session->connection.lock();
+        if (!connection) return;
+        const auto& frame = session->stream->frames[session->index];
+        connection->send(expand(frame.message, session->index + 1), [this](const SimpleWeb::error_code& ec) {
+            if (!ec) ++m_ws_frames_sent;
+        });
+        ++session->index;
+        schedule_next_frame(session);
+    }
+};
+
+} // namespace optionx::tests::intrade_bar_mock
@@ -2277,24 +2277,170 @@ TEST(IntradeBarTradeExecution, RejectsClassicAbsoluteExpiryWithUint32DurationOve
     EXPECT_FALSE(detail::normalize_classic_expiry(*request, timestamp));
 }
 
+TEST(IntradeBarDomainHealth, OrdersMirrorsByHealthAndLatency) {
+    DomainHealthTable table;
+    const std::vector<int> configured = {0, 1, 2, 3, 4, 5};
+    EXPECT_EQ(table.order(configured), configured);
+
+    table.record_success(3, 120, 1000);
+    table.record_success(5, 40, 1000);
+    table.record_failure(0);
+    table.record_failure(0);
+    table.record_failure(2);
+
+    EXPECT_EQ(table.order(configured), (std::vector<int>{5, 3, 1, 4, 2, 0}));
+
+    // A failure demotes a fast mirror; a later success restores it.
+    table.record_failure(5);
+    EXPECT_EQ(table.order(configured), (std::vector<int>{3, 1, 4, 2, 5, 0}));
+    table.record_success(5, 60, 2000);
+    ASSERT_NE(table.find(5), nullptr);
+    EXPECT_EQ(table.find(5)->failures, 0u);
+    EXPECT_EQ(table.find(5)->last_success_ms, 2000);
+    EXPECT_NEAR(table.find(5)->latency_ms, 46.0, 1e-9);
+    EXPECT_EQ(table.order(configured).front(), 5);
+
+    table.clear();
+    EXPECT_EQ(table.find(5), nullptr);
+    EXPECT_EQ(table.order(configured), configured);
+}
+
+TEST(IntradeBarAdaptivePollScheduler, BacksOffWhenIdleAndResetsOnActivity) {
+    AdaptivePollScheduler schedule(1000, 2000, 10000);
+
+    EXPECT_EQ(schedule.next_delay_ms(false), 2000);
+    EXPECT_EQ(schedule.next_delay_ms(false), 4000);
+    EXPECT_EQ(schedule.next_delay_ms(false), 8000);
+    EXPECT_EQ(schedule.next_delay_ms(false), 10000);
+    EXPECT_EQ(schedule.next_delay_ms(false), 10000);
+
+    // Activity polls at the active period and restarts the idle backoff.
+    EXPECT_EQ(schedule.next_delay_ms(true), 1000);
+    EXPECT_EQ(schedule.idle_delay_ms(), 2000);
+    EXPECT_EQ(schedule.next_delay_ms(false), 2000);
+
+    // A known close time pulls the next poll in.
+    EXPECT_EQ(schedule.next_delay_ms(true, 250), 250);
+    EXPECT_EQ(schedule.next_delay_ms(false, 60000), 2000);
+    EXPECT_EQ(schedule.next_delay_ms(true, -5), 1000);
+
+    schedule.next_delay_ms(false);
+    schedule.reset_backoff();
+    EXPECT_EQ(schedule.idle_delay_ms(), 2000);
+
+    // The cap never drops below the first idle delay.
+    schedule.configure(0, 5000, 1000);
+    EXPECT_EQ(schedule.next_delay_ms(true), 1);
+    EXPECT_EQ(schedule.next_delay_ms(false), 5000);
+    EXPECT_EQ(schedule.next_delay_ms(false), 5000);
+}
+
+TEST(IntradeBarActiveTradesSnapshotTracker, DropsUnchangedSnapshotsUnlessRefreshRequested) {
+    ActiveTradesSnapshotTracker tracker;
+    ActiveTradesSnapshot snapshot;
+    ActiveTradeInfo first;
+    first.id = 11;
+    first.close_time_ms = 5000;
+    ActiveTradeInfo second;
+    second.id = 7;
+    second.close_time_ms = 3000;
+    snapshot.trades = { first, second };
+
+    // The first snapshot of an account context is always published.
+    auto decision = tracker.reconcile(snapshot, 1000);
+    EXPECT_TRUE(decision.changed);
+    EXPECT_TRUE(decision.publish);
+    EXPECT_EQ(tracker.next_close_ms(), 3000);
+
+    // Same trades in another order are not republished.
+    std::swap(snapshot.trades[0], snapshot.trades[1]);
+    decision = tracker.reconcile(snapshot, 3500);
+    EXPECT_FALSE(decision.changed);
+    EXPECT_FALSE(decision.publish);
+    EXPECT_EQ(tracker.next_close_ms(), 5000);
+
+    // A pending queue refresh is answered once, even without changes.
+    tracker.request_refresh();
+    decision = tracker.reconcile(snapshot, 3500);
+    EXPECT_FALSE(decision.changed);
+    EXPECT_TRUE(decision.publish);
+    EXPECT_FALSE(tracker.refresh_requested());
+    EXPECT_FALSE(tracker.reconcile(snapshot, 3500).publish);
+
+    // A moved close time is a change.
+    snapshot.trades[0].close_time_ms = 4000;
+    decision = tracker.reconcile(snapshot, 3500);
+    EXPECT_TRUE(decision.changed);
+    EXPECT_TRUE(decision.publish);
+    EXPECT_EQ(tracker.next_close_ms(), 4000);
+
+    decision = tracker.reconcile(ActiveTradesSnapshot{}, 6000);
+    EXPECT_TRUE(decision.changed);
+    EXPECT_EQ(tracker.next_close_ms(), 0);
+
+    // A new account context publishes its first snapshot again.
+    tracker.reset();
+    EXPECT_TRUE(tracker.reconcile(ActiveTradesSnapshot{}, 6000).publish);
+}
+
+TEST(IntradeBarActiveTradesSnapshotTracker, ReconcilesOpenTradesEventCount) {
+    ActiveTradesSnapshotTracker tracker;
+    EXPECT_FALSE(tracker.has_open_trades());
+    EXPECT_FALSE(tracker.update_open_trades(0));
+    EXPECT_FALSE(tracker.update_open_trades(-3));
+
+    EXPECT_TRUE(tracker.update_open_trades(2));
+    EXPECT_TRUE(tracker.has_open_trades());
+    EXPECT_FALSE(tracker.update_open_trades(2));
+    EXPECT_TRUE(tracker.update_open_trades(1));
+    EXPECT_EQ(tracker.open_trades(), 1);
+
+    // The count belongs to the trade queue and survives a context reset.
+    tracker.request_refresh();
+    tracker.reset();
+    EXPECT_FALSE(tracker.refresh_requested());
+    EXPECT_EQ(tracker.open_trades(), 1);
+
+    EXPECT_TRUE(tracker.update_open_trades(-1));
+    EXPECT_EQ(tracker.open_trades(), 0);
+    EXPECT_FALSE(tracker.has_open_trades());
+
+    // Open trades keep refreshes at the sync period; idle refreshes back off.
+    AdaptivePollScheduler schedule(1000, 1000, 8000);
+    EXPECT_EQ(schedule.next_delay_ms(tracker.has_open_trades()), 1000);
+    EXPECT_EQ(schedule.next_delay_ms(tracker.has_open_trades()), 2000);
+    tracker.update_open_trades(1);
+    EXPECT_EQ(schedule.next_delay_ms(tracker.has_open_trades()), 1000);
+    EXPECT_EQ(schedule.next_delay_ms(tracker.has_open_trades()), 1000);
+}
+
 TEST(IntradeBarAuthData, KeepsDisconnectedDomainRetryPeriodInConfig) {
     AuthData auth_data;
     auth_data.set_email_password("user@example.test", "secret");
     auth_data.account_type = AccountType::DEMO;
     auth_data.currency = CurrencyType::USD;
     auth_data.disconnected_domain_retry_period_ms = 12345;
+    auth_data.balance_active_period_ms = 5000;
+    auth_data.balance_idle_max_period_ms = 7200000;
+    auth_data.active_trades_sync_max_period_ms = 60000;
     auth_data.order_interval_ms = 250;
     auth_data.trade_history_source = TradeHistorySource::HTML_CSV;
 
     nlohmann::json json;
     auth_data.to_json(json);
     ASSERT_EQ(json.at("disconnected_domain_retry_period_ms").get<int64_t>(), 12345);
+    ASSERT_EQ(json.at("balance_active_period_ms").get<int64_t>(), 5000);
+    ASSERT_EQ(json.at("balance_idle_max_period_ms").get<int64_t>(), 7200000);
+    ASSERT_EQ(json.at("active_trades_sync_max_period_ms").get<int64_t>(), 60000);
     ASSERT_EQ(json.at("order_interval_ms").get<int64_t>(), 250);
     ASSERT_EQ(json.at("trade_history_source").get<std::string>(), "HTML_CSV");
 
     AuthData restored;
     restored.from_json(json);
     EXPECT_EQ(restored.disconnected_domain_retry_period_ms, 12345);
+    EXPECT_EQ(restored.balance_active_period_ms, 5000);
+    EXPECT_EQ(restored.balance_idle_max_period_ms, 7200000);
+    EXPECT_EQ(restored.active_trades_sync_max_period_ms, 60000);
     EXPECT_EQ(restored.order_interval_ms, 250);
     EXPECT_EQ(restored.trade_history_source, TradeHistorySource::HTML_CSV);
 
@@ -2536,6 +2682,77 @@ TEST(IntradeBarApiResponses, ParsesBinanceKlinesAsLastPriceBars) {
     EXPECT_EQ(sequence.bars[0].price_type(), MarketPriceType::LAST);
 }
 
+TEST(IntradeBarApiResponses, StreamsBarHistoryBodiesFedInSmallChunks) {
+    BarHistoryRequest fx_request("NZDUSD", 60, 1782980700, 1782980760);
+    fx_request.price_source = BarPriceSource::BID;
+    std::string fx_body = fxhis_response(1782980700);
+    fx_body.insert(fx_body.rfind("]]"), "],[1782980760,\"0.5\",\"0.5\",\"0.6\",\"0.4\",1,1,1,1,7");
+
+    const std::string kline_body =
+        R"([[1783016040000,"61521.34","61530.00","61500.00","61510.00","0.25",1783016099999],)"
+        R"( [1783016100000,"61510.00","61540.00","61490.00","61535.50","1.5",1783016159999]])";
+    BarHistoryRequest kline_request("BTCUSDT", 60, 1783016040, 1783016100);
+    kline_request.price_source = BarPriceSource::LAST;
+
+    for (const std::size_t chunk_size : {std::size_t{1}, std::size_t{3}, std::size_t{64}}) {
+        BarSequence fx_sequence;
+        BarHistoryStreamParser fx_parser(
+            BarHistoryStreamParser::Format::FX_HISTORY, fx_request, fx_sequence);
+        for (std::size_t pos = 0; pos < fx_body.size(); pos += chunk_size) {
+            fx_parser.feed(std::string_view(fx_body).substr(pos, chunk_size));
+        }
+        fx_parser.finish();
+        ASSERT_EQ(fx_sequence.bars.size(), 2u);
+        EXPECT_EQ(fx_parser.bars_parsed(), 2u);
+        EXPECT_DOUBLE_EQ(fx_sequence.bars[0].open, 0.56880);
+        EXPECT_EQ(fx_sequence.bars[1].time_ms, 1782980760000ull);
+        EXPECT_DOUBLE_EQ(fx_sequence.bars[1].high, 0.6);
+        EXPECT_DOUBLE_EQ(fx_sequence.bars[1].volume, 7.0);
+        EXPECT_EQ(fx_sequence.bars[1].price_type(), MarketPriceType::BID);
+
+        BarSequence kline_sequence;
+        BarHistoryStreamParser kline_parser(
+            BarHistoryStreamParser::Format::BINANCE_KLINES, kline_request, kline_sequence);
+        for (std::size_t pos = 0; pos < kline_body.size(); pos += chunk_size) {
+            kline_parser.feed(std::string_view(kline_body).substr(pos, chunk_size));
+        }
+        kline_parser.finish();
+        ASSERT_EQ(kline_sequence.bars.size(), 2u);
+        EXPECT_EQ(kline_sequence.bars[1].time_ms, 1783016100000ull);
+        EXPECT_DOUBLE_EQ(kline_sequence.bars[1].close, 61535.50);
+        EXPECT_DOUBLE_EQ(kline_sequence.bars[1].volume, 1.5);
+    }
+}
+
+TEST(IntradeBarApiResponses, RejectsMalformedOrRejectedBarHistoryBodies) {
+    BarHistoryRequest fx_request("NZDUSD", 60, 1782980700, 1782980700);
+    fx_request.price_source = BarPriceSource::MID;
+    BarHistoryRequest kline_request("BTCUSDT", 60, 1783016040, 1783016040);
+    kline_request.price_source = BarPriceSource::LAST;
+
+    const std::string fx_body = fxhis_response(1782980700);
+    EXPECT_THROW(
+        parse_fxhis_bar_history(fx_body.substr(0, fx_body.size() - 3), fx_request),
+        std::runtime_error);
+    EXPECT_THROW(
+        parse_fxhis_bar_history(
+            R"({"candles":[],"response":{"error":"limit","executed":false}})",
+            fx_request),
+        std::runtime_error);
+    EXPECT_THROW(
+        parse_fxhis_bar_history(R"({"response":{"error":"","executed":true}})", fx_request),
+        std::runtime_error);
+    EXPECT_THROW(
+        parse_binance_klines_bar_history(R"({"code":-1121,"msg":"Invalid symbol."})", kline_request),
+        std::runtime_error);
+    EXPECT_THROW(
+        parse_binance_klines_bar_history(R"([[1783016040000,"61521.34","oops","1","1","1"]])", kline_request),
+        std::runtime_error);
+    EXPECT_THROW(
+        parse_binance_klines_bar_history(R"([[1783016040000,"1","1"]])", kline_request),
+        std::runtime_error);
+}
+
 TEST(IntradeBarApiResponses, UsesKnownBarHistoryStartLimits) {
     EXPECT_EQ(minimum_bar_history_from_ts("EUR/USD"), 1007337600);
     EXPECT_EQ(minimum_bar_history_from_ts("NZDUSD"), 1007424000);
@@ -0,0 +1,260 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <client_http.hpp>
+#include <client_ws.hpp>
+
+#include "IntradeBarMockBroker.hpp"
+
+#include <optionx_cpp/platforms.hpp>
+
+using namespace optionx;
+using namespace optionx::platforms;
+using namespace optionx::platforms::intrade_bar;
+using namespace optionx::tests::intrade_bar_mock;
+
+namespace {
+
+using HttpClient = SimpleWeb::Client<SimpleWeb::HTTP>;
+using WsClient = SimpleWeb::SocketClient<SimpleWeb::WS>;
+
+/// Collects websocket messages from one mock stream.
+class StreamReader {
+public:
+    StreamReader(const IntradeBarMockBroker& broker, const std::string& path, std::string subscription = {})
+        : m_client("127.0.0.1:" + std::to_string(broker.port()) + path),
+          m_subscription(std::move(subscription)) {
+        m_client.on_open = [this](std::shared_ptr<WsClient::Connection> connection) {
+            if (!m_subscription.empty()) connection->send(m_subscription);
+        };
+        m_client.on_message = [this](
+                std::shared_ptr<WsClient::Connection>,
+                std::shared_ptr<WsClient::InMessage> message) {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_messages.push_back(message->string());
+            }
+            m_cv.notify_all();
+        };
+        m_thread = std::thread([this]() { m_client.start(); });
+    }
+
+    ~StreamReader() {
+        m_client.stop();
+        if (m_thread.joinable()) m_thread.join();
+    }
+
+    std::vector<std::string> wait_for(std::size_t count, std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait_for(lock, timeout, [this, count]() { return m_messages.size() >= count; });
+        return m_messages;
+    }
+
+private:
+    WsClient m_client;
+    std::string m_subscription;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::vector<std::string> m_messages;
+    std::thread m_thread;
+};
+
+MockWsStream make_counter_stream(const std::string& path, const std::string& subscription, std::size_t frames) {
+    MockWsStream stream;
+    stream.path = path;
+    stream.subscription = subscription;
+    for (std::size_t i = 0; i < frames; ++i) {
+        stream.frames.push_back({static_cast<std::int64_t>(i) * 20, "frame-" + std::to_string(i) + "-%SEQ%"});
+    }
+    return stream;
+}
+
+template <class Predicate>
+bool wait_for_platform(
+        IntradeBarPlatform& platform,
+        Predicate&& predicate,
+        std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!predicate() && std::chrono::steady_clock::now() < deadline) {
+        platform.process();
+        platform.event_bus().drain();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    platform.event_bus().drain();
+    platform.process();
+    return predicate();
+}
+
+} // namespace
+
+TEST(IntradeBarMockBroker, ParsesRecordingJsonAndSortsFrames) {
+    const auto recording = MockRecording::from_json(nlohmann::json::parse(R"({
+        "http": [{"method": "POST", "path": "/balance.php", "loop": true, "responses": [
+            {"body": "1.00 $", "delay_ms": 15, "headers": {"Content-Type": "text/html"}},
+            {"status": 503}
+        ]}],
+        "ws": [{"path": "/fxconnect", "subscription": "EUR/USD", "frames": [
+            {"t_ms": 40, "message": "b"},
+            {"t_ms": 10, "message": "a"}
+        ]}]
+    })"));
+
+    ASSERT_EQ(recording.http.size(), 1u);
+    EXPECT_EQ(recording.http[0].method, "POST");
+    EXPECT_TRUE(recording.http[0].loop);
+    ASSERT_EQ(recording.http[0].responses.size(), 2u);
+    EXPECT_EQ(recording.http[0].responses[0].delay_ms, 15);
+    EXPECT_EQ(recording.http[0].responses[0].headers.size(), 1u);
+    EXPECT_EQ(recording.http[0].responses[1].status, 503);
+
+    ASSERT_EQ(recording.ws.size(), 1u);
+    EXPECT_EQ(recording.ws[0].subscription, "EUR/USD");
+    ASSERT_EQ(recording.ws[0].frames.size(), 2u);
+    EXPECT_EQ(recording.ws[0].frames[0].message, "a");
+    EXPECT_EQ(recording.ws[0].frames[1].offset_ms, 40);
+}
+
+TEST(IntradeBarMockBroker, ServesRecordedResponsesInOrder) {
+    MockRecording recording;
+    MockHttpRoute sequence;
+    sequence.path = "/profile";
+    sequence.responses = {{200, "first", {}, 0}, {200, "second-%SEQ%", {}, 0}};
+    MockHttpRoute looped;
+    looped.method = "POST";
+    looped.path = "/trade_check2.php";
+    looped.loop = true;
+    looped.responses = {{200, "even", {}, 0}, {500, "odd", {}, 20}};
+    recording.http = {sequence, looped};
+
+    IntradeBarMockBroker broker(recording);
+    ASSERT_TRUE(broker.start());
+
+    HttpClient client("127.0.0.1:" + std::to_string(broker.port()));
+    EXPECT_EQ(client.request("GET", "/profile")->content.string(), "first");
+    EXPECT_EQ(client.request("GET", "/profile?x=1")->content.string(), "second-2");
+    EXPECT_EQ(client.request("GET", "/profile")->content.string(), "second-3");
+
+    EXPECT_EQ(client.request("POST", "/trade_check2.php", "a")->content.string(), "even");
+    const auto delayed = client.request("POST", "/trade_check2.php", "b");
+    EXPECT_EQ(delayed->status_code.substr(0, 3), "500");
+    EXPECT_EQ(delayed->content.string(), "odd");
+    EXPECT_EQ(client.request("POST", "/trade_check2.php", "c")->content.string(), "even");
+
+    EXPECT_EQ(client.request("HEAD", "/profile")->status_code.substr(0, 3), "200");
+    EXPECT_EQ(client.request("GET", "/missing")->status_code.substr(0, 3), "404");
+
+    const auto stats = broker.stats();
+    EXPECT_EQ(stats.http_requests, 8u);
+    EXPECT_EQ(stats.http_unmatched, 1u);
+    EXPECT_EQ(broker.route_hits("GET", "/profile"), 3u);
+    EXPECT_EQ(broker.route_hits("POST", "/trade_check2.php"), 3u);
+
+    const auto requests = broker.requests();
+    ASSERT_GE(requests.size(), 4u);
+    EXPECT_EQ(requests[1].query, "x=1");
+    EXPECT_EQ(requests[3].body, "a");
+}
+
+TEST(IntradeBarMockBroker, ReplaysStreamRepeatedlyAsFastAsPossible) {
+    MockRecording recording;
+    recording.ws.push_back(make_counter_stream("/bapi", "", 3));
+    MockBrokerConfig config;
+    config.replay.speed = 0.0;
+    config.replay.repeat = 2;
+
+    IntradeBarMockBroker broker(recording, config);
+    ASSERT_TRUE(broker.start());
+
+    StreamReader reader(broker, "/bapi");
+    const auto messages = reader.wait_for(6);
+    ASSERT_EQ(messages.size(), 6u);
+    EXPECT_EQ(messages[0], "frame-0-1");
+    EXPECT_EQ(messages[2], "frame-2-3");
+    EXPECT_EQ(messages[3], "frame-0-1");
+    EXPECT_EQ(messages[5], "frame-2-3");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(reader.wait_for(7, std::chrono::milliseconds(0)).size(), 6u);
+    EXPECT_EQ(broker.stats().ws_connections, 1u);
+    EXPECT_EQ(broker.stats().ws_subscriptions, 1u);
+}
+
+TEST(IntradeBarMockBroker, FxStreamStartsOnSubscriptionAtRecordedPace) {
+    MockRecording recording;
+    recording.ws.push_back(make_counter_stream("/fxconnect", "EUR/USD", 4));
+    MockBrokerConfig config;
+    config.replay.speed = 0.5;
+
+    IntradeBarMockBroker broker(recording, config);
+    ASSERT_TRUE(broker.start());
+
+    StreamReader idle(broker, "/fxconnect");
+    EXPECT_TRUE(idle.wait_for(1, std::chrono::milliseconds(100)).empty());
+
+    const auto started = std::chrono::steady_clock::now();
+    StreamReader reader(broker, "/fxconnect", "EUR/USD");
+    ASSERT_EQ(reader.wait_for(4).size(), 4u);
+    // Three 20 ms gaps at half speed take at least 120 ms.
+    EXPECT_GE(std::chrono::steady_clock::now() - started, std::chrono::milliseconds(120));
+}
+
+TEST(IntradeBarMockBroker, PlatformReceivesBtcAndFxTicksFromDefaultRecording) {
+    MockBrokerConfig config;
+    config.replay.speed = 10.0;
+    IntradeBarMockBroker broker(make_default_recording(), config);
+    ASSERT_TRUE(broker.start());
+
+    IntradeBarPlatform platform;
+    platform.run(false);
+    std::mutex callback_mutex;
+    std::size_t btc_items = 0;
+    std::size_t fx_items = 0;
+    platform.on_tick_data() =
+        [&](std::unique_ptr<market_data::TickDataBatch> batch) {
+            if (!batch) return;
+            std::lock_guard<std::mutex> lock(callback_mutex);
+            if (batch->symbol == "BTCUSDT") btc_items += batch->items.size();
+            if (batch->symbol == "EURUSD") fx_items += batch->items.size();
+        };
+
+    auto auth = std::make_unique<AuthData>();
+    auth->set_user_token("1", "mock-token");
+    auth->host = broker.host();
+    ASSERT_TRUE(platform.configure_auth(std::move(auth)));
+    platform.event_bus().drain();
+
+    for (const char* symbol : {"BTCUSDT", "EUR/USD"}) {
+        market_data::MarketDataSubscriptionResult result;
+        ASSERT_TRUE(platform.subscribe_ticks(
+            market_data::TickSubscriptionRequest(
+                symbol,
+                market_data::MarketDataTransport::WEBSOCKET),
+            [&result](market_data::MarketDataSubscriptionResult value) {
+                result = std::move(value);
+            }));
+        ASSERT_TRUE(result);
+    }
+
+    ASSERT_TRUE(wait_for_platform(
+        platform,
+        [&]() {
+            std::lock_guard<std::mutex> lock(callback_mutex);
+            return btc_items > 0 && fx_items > 0;
+        }));
+
+    EXPECT_GE(broker.stats().ws_subscriptions, 2u);
+    EXPECT_GT(broker.stats().ws_frames_sent, 0u);
+    platform.shutdown();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
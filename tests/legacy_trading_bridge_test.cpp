@@ -97,6 +97,8 @@ TEST(LegacyTradingBridge, ConfigRoundTripsJson) {
     config.buffer_size = 4096;
     config.pipe_timeout_ms = 100;
     config.ping_period_ms = 3000;
+    config.framed_mode = true;
+    config.frame_flush_period_ms = 40;
 
     nlohmann::json json;
     config.to_json(json);
@@ -110,6 +112,8 @@ TEST(LegacyTradingBridge, ConfigRoundTripsJson) {
     EXPECT_EQ(restored.buffer_size, 4096u);
     EXPECT_EQ(restored.pipe_timeout_ms, 100u);
     EXPECT_EQ(restored.ping_period_ms, 3000);
+    EXPECT_TRUE(restored.framed_mode);
+    EXPECT_EQ(restored.frame_flush_period_ms, 40);
     EXPECT_EQ(restored.bridge_type(), optionx::BridgeType::LEGACY_TRADING_NAMED_PIPE);
     EXPECT_TRUE(restored.validate().first);
 
@@ -192,6 +196,36 @@ TEST(LegacyTradingBridge, RejectsInvalidContractFields) {
         std::invalid_argument);
 }
 
+TEST(LegacyTradingBridge, ResolvesSymbolsThroughRegistry) {
+    using Registry = legacy_protocol::LegacySymbolRegistry;
+
+    for (const auto symbol : Registry::symbols()) {
+        EXPECT_EQ(Registry::find(symbol), symbol);
+    }
+    EXPECT_EQ(Registry::find("eur/usd"), "EURUSD");
+    EXPECT_EQ(Registry::find("btc-usd"), "BTCUSDT");
+    EXPECT_EQ(Registry::find(" gbp_jpy "), "GBPJPY");
+    EXPECT_TRUE(Registry::find("USDRUB").empty());
+    EXPECT_TRUE(Registry::find("").empty());
+    EXPECT_TRUE(Registry::find("EURUSDEURUSDEURUSD").empty());
+
+    EXPECT_THROW(
+        legacy_protocol::parse_contract(
+            nlohmann::json{{"s", 7}, {"a", 1.0}, {"dir", "BUY"}, {"dur", 60}},
+            0.0),
+        std::invalid_argument);
+    EXPECT_THROW(
+        legacy_protocol::parse_contract(
+            nlohmann::json{{"s", "EURUSD"}, {"a", "1"}, {"dir", "BUY"}, {"dur", 60}},
+            0.0),
+        std::invalid_argument);
+    EXPECT_EQ(
+        legacy_protocol::parse_contract(
+            nlohmann::json{{"s", "EURUSD"}, {"a", 1.0}, {"dir", "put"}, {"dur", 60}},
+            0.0)->order_type,
+        optionx::OrderType::BUY);
+}
+
 TEST(LegacyTradingBridge, FormatsTradeResultUpdate) {
     optionx::TradeRequest request;
     request.symbol = "EURUSD";
@@ -257,6 +291,87 @@ TEST(LegacyTradingBridge, FormatsAccountSnapshots) {
     EXPECT_EQ(connection.at("aid").get<std::int64_t>(), 42);
 }
 
+TEST(LegacyTradingBridge, ParsesBatchFrames) {
+    const std::string first = R"({"contract":{"s":"EURUSD","a":1,"dir":"buy","dur":60}})";
+    const std::string second = R"({"ping":1})";
+
+    std::string frame;
+    legacy_protocol::append_frame_record(frame, first);
+    legacy_protocol::append_frame_record(frame, second);
+
+    ASSERT_TRUE(legacy_protocol::is_framed_message(frame));
+    EXPECT_FALSE(legacy_protocol::is_framed_message(first));
+    EXPECT_EQ(frame, "#" + std::to_string(first.size()) + ":" + first + "10:" + second);
+
+    const auto records = legacy_protocol::parse_frame(frame);
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0], first);
+    EXPECT_EQ(records[1], second);
+    EXPECT_TRUE(legacy_protocol::parse_frame("#").empty());
+
+    EXPECT_THROW(legacy_protocol::parse_frame("#5:{}"), std::invalid_argument);
+    EXPECT_THROW(legacy_protocol::parse_frame("#:{}"), std::invalid_argument);
+    EXPECT_THROW(legacy_protocol::parse_frame("#2{}"), std::invalid_argument);
+    EXPECT_THROW(legacy_protocol::parse_frame("#9999999999:{}"), std::invalid_argument);
+}
+
+TEST(LegacyTradingBridge, CoalescesOutboundBatchIntoFrames) {
+    legacy_protocol::LegacyOutboundBatch batch;
+    EXPECT_TRUE(batch.empty());
+    EXPECT_TRUE(batch.take_frames(1024).empty());
+
+    batch.set_balance(R"({"b":1})");
+    batch.push(R"({"update_bet":1})");
+    batch.set_connection(R"({"conn":1})");
+    batch.set_balance(R"({"b":2})");
+    batch.push(R"({"ping":1})");
+
+    auto frames = batch.take_frames(1024);
+    EXPECT_TRUE(batch.empty());
+    ASSERT_EQ(frames.size(), 1u);
+    auto records = legacy_protocol::parse_frame(frames[0]);
+    ASSERT_EQ(records.size(), 4u);
+    // Snapshots keep their latest position relative to ordered messages.
+    EXPECT_EQ(records[0], R"({"update_bet":1})");
+    EXPECT_EQ(records[1], R"({"conn":1})");
+    EXPECT_EQ(records[2], R"({"b":2})");
+    EXPECT_EQ(records[3], R"({"ping":1})");
+
+    batch.push(R"({"update_bet":2})");
+    batch.set_balance(R"({"b":3})");
+    batch.push(R"({"update_bet":3})");
+    frames = batch.take_frames(1024);
+    ASSERT_EQ(frames.size(), 1u);
+    records = legacy_protocol::parse_frame(frames[0]);
+    ASSERT_EQ(records.size(), 3u);
+    EXPECT_EQ(records[0], R"({"update_bet":2})");
+    EXPECT_EQ(records[1], R"({"b":3})");
+    EXPECT_EQ(records[2], R"({"update_bet":3})");
+
+    // Two 22-byte payloads are 25-byte records: with the marker one frame
+    // needs 51 bytes, so a 50-byte budget splits them and 51 does not.
+    batch.push(std::string(22, 'y'));
+    batch.push(std::string(22, 'y'));
+    EXPECT_EQ(batch.take_frames(50).size(), 2u);
+    batch.push(std::string(22, 'y'));
+    batch.push(std::string(22, 'y'));
+    frames = batch.take_frames(51);
+    ASSERT_EQ(frames.size(), 1u);
+    EXPECT_EQ(frames[0].size(), 51u);
+
+    for (int i = 0; i < 10; ++i) {
+        batch.push(std::string(20, 'x'));
+    }
+    frames = batch.take_frames(50);
+    ASSERT_EQ(frames.size(), 5u);
+    std::size_t total = 0;
+    for (const auto& frame : frames) {
+        EXPECT_LE(frame.size(), 50u);
+        total += legacy_protocol::parse_frame(frame).size();
+    }
+    EXPECT_EQ(total, 10u);
+}
+
 TEST(LegacyTradingBridge, RunFailsWithoutSignalIdAllocator) {
     LegacyTradingBridge bridge;
 
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <typeindex>
+#include <vector>
+
+#include <optionx_cpp/utils.hpp>
+
+namespace {
+
+using optionx::utils::metrics::Histogram;
+using optionx::utils::metrics::MetricsRegistry;
+using optionx::utils::metrics::MetricType;
+
+class MetricsTestEvent final : public optionx::utils::Event {
+public:
+    std::type_index type() const override {
+        return typeid(MetricsTestEvent);
+    }
+
+    const char* name() const override {
+        return "MetricsTestEvent";
+    }
+};
+
+} // namespace
+
+TEST(MetricsRegistryTest, ShardedCounterSumsAllThreads) {
+    MetricsRegistry registry;
+    auto& counter = registry.counter("optionx_test_events_total", "Test counter.");
+
+    constexpr int kThreads = 8;
+    constexpr int kIncrements = 50000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&counter]() {
+            for (int i = 0; i < kIncrements; ++i) counter.inc();
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_EQ(counter.value(), static_cast<std::uint64_t>(kThreads) * kIncrements);
+    EXPECT_EQ(&counter, &registry.counter("optionx_test_events_total", "Test counter."));
+}
+
+TEST(MetricsRegistryTest, HistogramQuantilesStayWithinBucketError) {
+    Histogram histogram;
+    for (std::uint64_t value = 1; value <= 100000; ++value) {
+        histogram.record(value);
+    }
+
+    const auto snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.count, 100000u);
+    EXPECT_EQ(snapshot.min, 1u);
+    EXPECT_EQ(snapshot.max, 100000u);
+    EXPECT_EQ(snapshot.sum, 100000ull * 100001ull / 2);
+    for (const double quantile : {0.5, 0.9, 0.99, 0.999}) {
+        const double expected = quantile * 100000.0;
+        const double actual = static_cast<double>(snapshot.value_at(quantile));
+        EXPECT_GE(actual, expected);
+        EXPECT_LE(actual, expected * 1.04) << "quantile " << quantile;
+    }
+    EXPECT_EQ(snapshot.value_at(1.0), 100000u);
+}
+
+TEST(MetricsRegistryTest, SmallValuesUseExactBuckets) {
+    Histogram histogram;
+    for (std::uint64_t value = 0; value < 64; ++value) {
+        histogram.record(value);
+    }
+    const auto snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.buckets.size(), 64u);
+    EXPECT_EQ(snapshot.value_at(0.5), 31u);
+}
+
+TEST(MetricsRegistryTest, TypeMismatchThrows) {
+    MetricsRegistry registry;
+    registry.counter("optionx_test_total", "Test counter.");
+    EXPECT_THROW(registry.gauge("optionx_test_total", "Test gauge."), std::invalid_argument);
+    EXPECT_THROW(registry.counter("1bad", "Bad name."), std::invalid_argument);
+    EXPECT_THROW(registry.counter("optionx_test_total", "Test counter.", {{"quantile", "1"}}), std::invalid_argument);
+}
+
+TEST(MetricsRegistryTest, PrometheusTextSortsAndEscapesLabels) {
+    MetricsRegistry registry;
+    registry.counter("optionx_test_total", "Test \\ counter.", {{"z", "a\"b"}, {"a", "line\nbreak"}}).inc(3);
+    registry.gauge("optionx_test_depth", "Test gauge.").set(-2);
+    registry.histogram("optionx_test_us", "Test histogram.").record(10);
+
+    const auto text = optionx::utils::metrics::to_prometheus_text(registry);
+    EXPECT_NE(text.find("# HELP optionx_test_total Test \\\\ counter.\n"), std::string::npos);
+    EXPECT_NE(text.find("# TYPE optionx_test_total counter\n"), std::string::npos);
+    EXPECT_NE(text.find("optionx_test_total{a=\"line\\nbreak\",z=\"a\\\"b\"} 3\n"), std::string::npos);
+    EXPECT_NE(text.find("optionx_test_depth -2\n"), std::string::npos);
+    EXPECT_NE(text.find("# TYPE optionx_test_us summary\n"), std::string::npos);
+    EXPECT_NE(text.find("optionx_test_us{quantile=\"0.99\"} 10\n"), std::string::npos);
+    EXPECT_NE(text.find("optionx_test_us_sum 10\n"), std::string::npos);
+    EXPECT_NE(text.find("optionx_test_us_count 1\n"), std::string::npos);
+    EXPECT_LT(text.find("optionx_test_depth"), text.find("optionx_test_total"));
+}
+
+TEST(MetricsRegistryTest, JsonExportHasFamiliesAndSamples) {
+    MetricsRegistry registry;
+    registry.counter("optionx_test_total", "Test counter.", {{"result", "ok"}}).inc(2);
+    auto& histogram = registry.histogram("optionx_test_ms", "Test histogram.");
+    histogram.record(4);
+    histogram.record(8);
+
+    const auto json = optionx::utils::metrics::to_json(registry);
+    ASSERT_TRUE(json.contains("metrics"));
+    ASSERT_EQ(json["metrics"].size(), 2u);
+
+    const auto& histogram_family = json["metrics"][0];
+    EXPECT_EQ(histogram_family["name"], "optionx_test_ms");
+    EXPECT_EQ(histogram_family["type"], "summary");
+    EXPECT_EQ(histogram_family["samples"][0]["count"], 2);
+    EXPECT_EQ(histogram_family["samples"][0]["max"], 8);
+    EXPECT_DOUBLE_EQ(histogram_family["samples"][0]["mean"].get<double>(), 6.0);
+    EXPECT_EQ(histogram_family["samples"][0]["quantiles"]["1"], 8);
+
+    const auto& counter_family = json["metrics"][1];
+    EXPECT_EQ(counter_family["type"], "counter");
+    EXPECT_EQ(counter_family["samples"][0]["labels"]["result"], "ok");
+    EXPECT_EQ(counter_family["samples"][0]["value"], 2);
+}
+
+TEST(MetricsRegistryTest, EventBusReportsBacklog) {
+    auto& registry = MetricsRegistry::global();
+    auto& backlog = registry.gauge("optionx_event_bus_backlog", "");
+    auto& queued = registry.counter("optionx_event_bus_queued_events_total", "");
+
+    const auto backlog_before = backlog.value();
+    const auto queued_before = queued.value();
+    {
+        optionx::utils::EventBus bus;
+        bus.notify_async(std::make_unique<MetricsTestEvent>());
+        bus.notify_async(std::make_unique<MetricsTestEvent>());
+        EXPECT_EQ(backlog.value(), backlog_before + 2);
+        EXPECT_EQ(queued.value(), queued_before + 2);
+
+        bus.process();
+        EXPECT_EQ(backlog.value(), backlog_before);
+
+        bus.notify_async(std::make_unique<MetricsTestEvent>());
+        EXPECT_EQ(backlog.value(), backlog_before + 1);
+    }
+    EXPECT_EQ(backlog.value(), backlog_before);
+}
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <optionx_cpp/data.hpp>
+
+namespace {
+
+using optionx::MmSeriesConfig;
+using optionx::MmSeriesEndAction;
+using optionx::MmSeriesEngine;
+using optionx::MmSeriesScope;
+using optionx::MmStepTable;
+using optionx::MmSystemType;
+using optionx::TradeState;
+
+MmSeriesConfig martingale(MmSystemType type, std::uint32_t steps) {
+    MmSeriesConfig config;
+    config.type = type;
+    config.amount = 1.0;
+    config.multiplier = 2.0;
+    config.steps = steps;
+    return config;
+}
+
+} // namespace
+
+TEST(MmSeriesEngineTest, MartingaleAdvancesOnLossAndResetsOnWin) {
+    MmSeriesEngine engine;
+    const auto table = engine.add_table(martingale(MmSystemType::MARTINGALE_SIGNAL, 3));
+    const std::uint64_t key = 42;
+
+    auto decision = engine.decide(table, key);
+    ASSERT_TRUE(decision);
+    EXPECT_EQ(decision.step, 0u);
+    EXPECT_DOUBLE_EQ(decision.amount, 1.0);
+
+    EXPECT_EQ(engine.on_result(table, key, decision.step, TradeState::LOSS), 1u);
+    EXPECT_DOUBLE_EQ(engine.decide(table, key).amount, 2.0);
+    EXPECT_EQ(engine.on_result(table, key, 1, TradeState::STANDOFF), 1u);
+    EXPECT_EQ(engine.on_result(table, key, 1, TradeState::LOSS), 2u);
+    EXPECT_DOUBLE_EQ(engine.decide(table, key).amount, 4.0);
+    EXPECT_EQ(engine.active_series(), 1u);
+
+    // Losing the last step starts over.
+    EXPECT_EQ(engine.on_result(table, key, 2, TradeState::LOSS), 0u);
+    EXPECT_EQ(engine.active_series(), 0u);
+
+    engine.on_result(table, key, 0, TradeState::LOSS);
+    EXPECT_EQ(engine.on_result(table, key, 1, TradeState::WIN), 0u);
+    EXPECT_DOUBLE_EQ(engine.decide(table, key).amount, 1.0);
+}
+
+TEST(MmSeriesEngineTest, AntiMartingaleHoldsLastStep) {
+    auto config = martingale(MmSystemType::ANTI_MARTINGALE_SYMBOL, 2);
+    config.end_action = MmSeriesEndAction::HOLD;
+    MmSeriesEngine engine;
+    const auto table = engine.add_table(config);
+    EXPECT_EQ(engine.table(table)->scope(), MmSeriesScope::SYMBOL);
+
+    EXPECT_EQ(engine.on_result(table, 7, 0, TradeState::LOSS), 0u);
+    EXPECT_EQ(engine.on_result(table, 7, 0, TradeState::WIN), 1u);
+    EXPECT_EQ(engine.on_result(table, 7, 1, TradeState::WIN), 1u);
+    EXPECT_EQ(engine.on_result(table, 7, 1, TradeState::LOSS), 0u);
+}
+
+TEST(MmSeriesEngineTest, BalanceRelativeTablesAndLimits) {
+    MmSeriesConfig percent;
+    percent.type = MmSystemType::PERCENT;
+    percent.percent = 2.0;
+    percent.min_amount = 1.0;
+    percent.max_amount = 50.0;
+
+    MmSeriesConfig kelly;
+    kelly.type = MmSystemType::KELLY_CRITERION;
+    kelly.kelly_win_rate = 0.6;
+    kelly.kelly_payout = 1.0;
+    kelly.kelly_scale = 0.5;
+
+    MmSeriesEngine engine;
+    const auto percent_table = engine.add_table(percent);
+    const auto kelly_table = engine.add_table(kelly);
+
+    EXPECT_DOUBLE_EQ(engine.decide(percent_table, 1, 1000.0).amount, 20.0);
+    EXPECT_DOUBLE_EQ(engine.decide(percent_table, 1, 10.0).amount, 1.0);
+    EXPECT_DOUBLE_EQ(engine.decide(percent_table, 1, 10000.0).amount, 50.0);
+    // Full Kelly at p = 0.6, b = 1 is 0.2; half of it is 10%.
+    EXPECT_NEAR(engine.decide(kelly_table, 1, 1000.0).amount, 100.0, 1e-9);
+}
+
+TEST(MmSeriesEngineTest, ExplicitStakesAndInvalidConfigs) {
+    auto config = martingale(MmSystemType::MARTINGALE_BAR, 10);
+    config.amounts = {1.0, 2.2, 4.84};
+    const auto table = MmStepTable::compile(config);
+    ASSERT_EQ(table.size(), 3u);
+    EXPECT_DOUBLE_EQ(table.amount(2, 0.0), 4.84);
+    EXPECT_DOUBLE_EQ(table.amount(100, 0.0), 4.84);
+
+    config.type = MmSystemType::LABOUCHERE_SIGNAL;
+    EXPECT_THROW(MmStepTable::compile(config), std::invalid_argument);
+    config.type = MmSystemType::MARTINGALE_SIGNAL;
+    config.amounts = {1.0, -1.0};
+    EXPECT_THROW(MmStepTable::compile(config), std::invalid_argument);
+
+    MmSeriesEngine engine;
+    EXPECT_FALSE(engine.decide(MmSeriesEngine::INVALID_TABLE, 1));
+
+    const MmStepTable empty;
+    EXPECT_EQ(empty.size(), 0u);
+    EXPECT_DOUBLE_EQ(empty.amount(0, 1000.0), 0.0);
+    EXPECT_EQ(empty.next_step(3, TradeState::LOSS), 0u);
+}
+
+TEST(MmSeriesEngineTest, SeriesKeysFollowScope) {
+    optionx::TradeSignal a;
+    a.signal_name = "trend";
+    a.symbol = "EURUSD";
+    optionx::TradeSignal b;
+    b.signal_name = a.signal_name;
+    b.symbol = "GBPUSD";
+
+    EXPECT_EQ(MmSeriesEngine::series_key(a, MmSeriesScope::SIGNAL), MmSeriesEngine::series_key(b, MmSeriesScope::SIGNAL));
+    EXPECT_NE(MmSeriesEngine::series_key(a, MmSeriesScope::SYMBOL), MmSeriesEngine::series_key(b, MmSeriesScope::SYMBOL));
+    EXPECT_NE(MmSeriesEngine::series_key(a, MmSeriesScope::BAR, 60), MmSeriesEngine::series_key(a, MmSeriesScope::BAR, 120));
+
+    b.symbol = a.symbol;
+    b.mm_group_hash = "group";
+    EXPECT_NE(MmSeriesEngine::series_key(a, MmSeriesScope::SIGNAL), MmSeriesEngine::series_key(b, MmSeriesScope::SIGNAL));
+
+    a.set_money_management(std::make_unique<optionx::MmSeriesParams>(martingale(MmSystemType::MARTINGALE_SIGNAL, 4)));
+    EXPECT_EQ(a.mm_type, MmSystemType::MARTINGALE_SIGNAL);
+    const auto json = a.mm_params->to_json();
+    EXPECT_EQ(optionx::MmSeriesParams::from_json(json).config.steps, 4u);
+
+    MmSeriesEngine engine;
+    const auto table = engine.add_table(a);
+    ASSERT_NE(table, MmSeriesEngine::INVALID_TABLE);
+    EXPECT_EQ(engine.table(table)->size(), 4u);
+}
+
+TEST(MmSeriesEngineTest, StateMapMatchesReferenceUnderChurn) {
+    MmSeriesEngine engine;
+    const auto table = engine.add_table(martingale(MmSystemType::MARTINGALE_SIGNAL, 6));
+    std::unordered_map<std::uint64_t, std::uint32_t> reference;
+    std::mt19937_64 rng(12345);
+
+    for (int i = 0; i < 200000; ++i) {
+        const std::uint64_t key = rng() % 2000;
+        const auto state = (rng() % 3 == 0) ? TradeState::WIN : TradeState::LOSS;
+        const auto current = engine.step(table, key);
+        ASSERT_EQ(current, reference.count(key) ? reference[key] : 0u);
+        const auto next = engine.on_result(table, key, current, state);
+        if (next == 0) {
+            reference.erase(key);
+        } else {
+            reference[key] = next;
+        }
+    }
+    EXPECT_EQ(engine.active_series(), reference.size());
+    for (const auto& item : reference) {
+        EXPECT_EQ(engine.step(table, item.first), item.second);
+    }
+}
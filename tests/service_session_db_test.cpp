@@ -4,7 +4,10 @@
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <optionx_cpp/storages.hpp>
 #include <optionx_cpp/utils.hpp>
@@ -41,6 +44,29 @@ TEST(CryptoRandomTest, GeneratesKeysWithExpectedModeLengths) {
     EXPECT_EQ(aes_128.generate_key().size(), 16u);
 }
 
+TEST(CryptoAesTest, EncryptsAndDecryptsIntoReusedBuffers) {
+    optionx::crypto::AESCrypt aes(optionx::crypto::AesMode::CBC_256);
+    ASSERT_TRUE(aes.set_key(aes.generate_key()));
+
+    std::string encrypted;
+    std::string decrypted;
+    for (std::size_t size : {0u, 1u, 15u, 16u, 17u, 300u}) {
+        const std::string plain(size, 'p');
+        aes.encrypt_into(plain, encrypted);
+        EXPECT_EQ(encrypted.size(), optionx::crypto::BLOCK_SIZE * (2 + size / optionx::crypto::BLOCK_SIZE));
+        aes.decrypt_into(encrypted, decrypted);
+        EXPECT_EQ(decrypted, plain);
+        EXPECT_EQ(aes.decrypt(encrypted), plain);
+    }
+
+    std::string padded = "abc";
+    optionx::crypto::add_padding_in_place(padded);
+    ASSERT_EQ(padded.size(), optionx::crypto::BLOCK_SIZE);
+    optionx::crypto::remove_padding_in_place(padded);
+    EXPECT_EQ(padded, "abc");
+    EXPECT_THROW(aes.decrypt_into(std::string(8, 'x'), decrypted), std::invalid_argument);
+}
+
 TEST(ServiceSessionDBTest, StoresReadsRemovesAndClearsEncryptedSessionValues) {
     optionx::storage::ServiceSessionDB session_db(
         make_config("service_session_db_test"));
@@ -74,6 +100,166 @@ TEST(ServiceSessionDBTest, StoresReadsRemovesAndClearsEncryptedSessionValues) {
     EXPECT_FALSE(session_db.get_session_value(platform, email).has_value());
 }
 
+TEST(ServiceSessionDBTest, ReadsAndMigratesLegacyBase64Rows) {
+    const auto config = make_config("service_session_db_legacy_test");
+    const std::array<std::uint8_t, 32> encryption_key = {
+        0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+        0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50,
+        0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+        0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60
+    };
+    const std::string value = "legacy-session-value";
+
+    {
+        optionx::crypto::AESCrypt aes(optionx::crypto::AesMode::CBC_256);
+        ASSERT_TRUE(aes.set_key(encryption_key));
+        mdbxc::KeyValueTable<std::string, std::string> table(config, "sessions");
+        table.insert_or_assign(
+            optionx::utils::Base64::encode("legacy-platform:user@example.test"),
+            optionx::utils::Base64::encode(aes.encrypt(value)));
+        table.disconnect();
+    }
+
+    {
+        optionx::storage::ServiceSessionDB session_db(config);
+        ASSERT_TRUE(session_db.is_open());
+        ASSERT_TRUE(session_db.set_key(encryption_key));
+        const auto stored_value = session_db.get_session_value("legacy-platform", "user@example.test");
+        ASSERT_TRUE(stored_value.has_value());
+        EXPECT_EQ(*stored_value, value);
+    }
+
+    {
+        mdbxc::KeyValueTable<std::string, std::string> table(config, "sessions");
+        const auto row = table.find(optionx::utils::Base64::encode("legacy-platform:user@example.test"));
+        ASSERT_TRUE(row.has_value());
+        // Migrated rows hold binary ciphertext instead of Base64 text.
+        EXPECT_THROW(optionx::utils::Base64::decode(*row), std::invalid_argument);
+        table.disconnect();
+    }
+
+    optionx::storage::ServiceSessionDB session_db(config);
+    ASSERT_TRUE(session_db.set_key(encryption_key));
+    const auto migrated_value = session_db.get_session_value("legacy-platform", "user@example.test");
+    ASSERT_TRUE(migrated_value.has_value());
+    EXPECT_EQ(*migrated_value, value);
+}
+
+TEST(ServiceSessionDBTest, DefaultKeyReadsLegacyRowsWithoutMigrating) {
+    const auto config = make_config("service_session_db_default_key_test");
+    std::array<std::uint8_t, 32> default_key{};
+    for (std::size_t i = 0; i < default_key.size(); ++i) {
+        default_key[i] = static_cast<std::uint8_t>(i);
+    }
+    const std::string db_key = optionx::utils::Base64::encode("legacy-platform:user@example.test");
+    std::string legacy_row;
+
+    {
+        optionx::crypto::AESCrypt aes(optionx::crypto::AesMode::CBC_256);
+        ASSERT_TRUE(aes.set_key(default_key));
+        legacy_row = optionx::utils::Base64::encode(aes.encrypt("default-key-session"));
+        mdbxc::KeyValueTable<std::string, std::string> table(config, "sessions");
+        table.insert_or_assign(db_key, legacy_row);
+        table.disconnect();
+    }
+
+    {
+        optionx::storage::ServiceSessionDB session_db(config);
+        ASSERT_TRUE(session_db.uses_default_key());
+        const auto stored_value = session_db.get_session_value("legacy-platform", "user@example.test");
+        ASSERT_TRUE(stored_value.has_value());
+        EXPECT_EQ(*stored_value, "default-key-session");
+    }
+
+    mdbxc::KeyValueTable<std::string, std::string> table(config, "sessions");
+    const auto row = table.find(db_key);
+    ASSERT_TRUE(row.has_value());
+    EXPECT_EQ(*row, legacy_row);
+    table.disconnect();
+}
+
+TEST(ServiceSessionDBTest, MigratesOnlyLegacyRowsThatDecryptToText) {
+    const auto config = make_config("service_session_db_plaintext_test");
+    const std::array<std::uint8_t, 32> encryption_key = {
+        0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+        0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+        0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+        0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x80
+    };
+    const std::string binary_value("\x00\x01session\xFF\xFE", 11);
+    const std::string text_value = u8"{\"user\": \"\u0418\u0432\u0430\u043D\"}\r\n\ttoken=abc";
+    const std::string binary_key = optionx::utils::Base64::encode("legacy-platform:binary@example.test");
+    const std::string text_key = optionx::utils::Base64::encode("legacy-platform:text@example.test");
+    const std::string broken_key = optionx::utils::Base64::encode("legacy-platform:broken@example.test");
+    const std::string broken_row = optionx::utils::Base64::encode(std::string(40, 'x'));
+    std::string binary_row;
+
+    {
+        optionx::crypto::AESCrypt aes(optionx::crypto::AesMode::CBC_256);
+        ASSERT_TRUE(aes.set_key(encryption_key));
+        binary_row = optionx::utils::Base64::encode(aes.encrypt(binary_value));
+        mdbxc::KeyValueTable<std::string, std::string> table(config, "sessions");
+        table.insert_or_assign(binary_key, binary_row);
+        table.insert_or_assign(text_key, optionx::utils::Base64::encode(aes.encrypt(text_value)));
+        // Not a whole number of AES blocks: decryption fails before the padding check.
+        table.insert_or_assign(broken_key, broken_row);
+        table.disconnect();
+    }
+
+    {
+        optionx::storage::ServiceSessionDB session_db(config);
+        ASSERT_TRUE(session_db.set_key(encryption_key));
+
+        const auto binary = session_db.get_session_value("legacy-platform", "binary@example.test");
+        ASSERT_TRUE(binary.has_value());
+        EXPECT_EQ(*binary, binary_value);
+        const auto text = session_db.get_session_value("legacy-platform", "text@example.test");
+        ASSERT_TRUE(text.has_value());
+        EXPECT_EQ(*text, text_value);
+        EXPECT_FALSE(session_db.get_session_value("legacy-platform", "broken@example.test").has_value());
+    }
+
+    mdbxc::KeyValueTable<std::string, std::string> table(config, "sessions");
+    EXPECT_EQ(table.find(binary_key).value_or(""), binary_row);
+    EXPECT_EQ(table.find(broken_key).value_or(""), broken_row);
+    const auto text_row = table.find(text_key);
+    ASSERT_TRUE(text_row.has_value());
+    EXPECT_THROW(optionx::utils::Base64::decode(*text_row), std::invalid_argument);
+    table.disconnect();
+}
+
+TEST(ServiceSessionDBTest, ConcurrentCacheMissesAgreeWithStoredValues) {
+    optionx::storage::ServiceSessionDB session_db(
+        make_config("service_session_db_concurrent_test"));
+    ASSERT_TRUE(session_db.is_open());
+    std::array<std::uint8_t, 32> encryption_key{};
+    encryption_key.fill(0x5A);
+    ASSERT_TRUE(session_db.set_key(encryption_key));
+    for (int i = 0; i < 16; ++i) {
+        ASSERT_TRUE(session_db.set_session_value("concurrent", std::to_string(i), "value-" + std::to_string(i)));
+    }
+
+    for (int round = 0; round < 20; ++round) {
+        // Setting the key drops the cache, so the readers race on cache misses.
+        ASSERT_TRUE(session_db.set_key(encryption_key));
+        std::atomic<int> mismatches{0};
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&session_db, &mismatches]() {
+                for (int i = 0; i < 16; ++i) {
+                    const auto value = session_db.get_session_value("concurrent", std::to_string(i));
+                    if (!value || *value != "value-" + std::to_string(i)) ++mismatches;
+                }
+            });
+        }
+        if (round % 2 == 1) {
+            ASSERT_TRUE(session_db.set_session_value("concurrent", "0", "value-0"));
+        }
+        for (auto& reader : readers) reader.join();
+        EXPECT_EQ(mismatches.load(), 0);
+    }
+}
+
 TEST(ServiceSessionDBTest, ReportsDefaultAndCustomKeyState) {
     optionx::storage::ServiceSessionDB session_db(
         make_config("service_session_db_key_state_test"));
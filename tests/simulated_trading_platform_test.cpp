@@ -0,0 +1,354 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <optionx_cpp/platforms.hpp>
+
+namespace {
+
+using optionx::platforms::SimulatedTradingPlatform;
+using optionx::platforms::simulator::ExpiryResolution;
+using optionx::platforms::simulator::LatencyDistribution;
+using optionx::platforms::simulator::SimulationConfig;
+
+struct FinalTrade {
+    std::uint32_t trade_id = 0;
+    std::int64_t option_id = 0;
+    optionx::TradeState state = optionx::TradeState::UNKNOWN;
+    optionx::TradeErrorCode error_code = optionx::TradeErrorCode::SUCCESS;
+    std::int64_t delay = 0;
+    double profit = 0.0;
+};
+
+bool is_final(optionx::TradeState state) {
+    return state == optionx::TradeState::WIN ||
+           state == optionx::TradeState::LOSS ||
+           state == optionx::TradeState::STANDOFF ||
+           state == optionx::TradeState::REFUND ||
+           state == optionx::TradeState::OPEN_ERROR ||
+           state == optionx::TradeState::CHECK_ERROR;
+}
+
+std::unique_ptr<SimulationConfig> make_config(std::uint64_t seed) {
+    auto config = std::make_unique<SimulationConfig>();
+    config->seed = seed;
+    config->balance = 1000.0;
+    config->payout = 0.8;
+    config->expiry_resolution = ExpiryResolution::SEEDED;
+    config->open_latency = LatencyDistribution::uniform(5, 40);
+    config->close_latency = LatencyDistribution::fixed(5);
+    config->publish_prices = false;
+    return config;
+}
+
+mdbxc::Config make_db_config(const std::string& name) {
+    static std::atomic<std::uint64_t> counter{0};
+    const auto stamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    mdbxc::Config config;
+    config.pathname = "data/" + name + "_" + std::to_string(stamp) + "_" + std::to_string(counter.fetch_add(1));
+    config.max_dbs = 4;
+    config.no_subdir = false;
+    config.relative_to_exe = true;
+    return config;
+}
+
+std::unique_ptr<optionx::TradeResult> fetch_result(SimulatedTradingPlatform& platform, std::int64_t option_id) {
+    optionx::TradeResultQuery query;
+    query.option_id = option_id;
+    std::unique_ptr<optionx::TradeResult> fetched;
+    EXPECT_TRUE(platform.fetch_trade_result(
+        query,
+        std::make_unique<optionx::TradeResult>(),
+        [&fetched](std::unique_ptr<optionx::TradeResult> result) {
+            fetched = std::move(result);
+        }));
+    return fetched;
+}
+
+bool run_until(SimulatedTradingPlatform& platform, const std::function<bool()>& done) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!done()) {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        platform.process();
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+bool connect(SimulatedTradingPlatform& platform, std::unique_ptr<SimulationConfig> config) {
+    bool connected = false;
+    platform.configure_auth(std::move(config));
+    platform.connect([&connected](optionx::ConnectionResult result) {
+        connected = result.success;
+    });
+    platform.run(false);
+    return run_until(platform, [&connected]() { return connected; });
+}
+
+std::vector<FinalTrade> place_and_wait(
+        SimulatedTradingPlatform& platform,
+        std::size_t count,
+        double amount = 1.0) {
+    std::vector<FinalTrade> trades;
+    for (std::size_t i = 0; i < count; ++i) {
+        auto request = std::make_unique<optionx::TradeRequest>();
+        request->symbol = "EURUSD";
+        request->amount = amount;
+        request->option_type = optionx::OptionType::SPRINT;
+        request->order_type = i % 2 == 0 ? optionx::OrderType::BUY : optionx::OrderType::SELL;
+        request->duration = 1;
+        request->add_callback([&trades](
+                std::unique_ptr<optionx::TradeRequest>,
+                std::unique_ptr<optionx::TradeResult> result) {
+            if (!is_final(result->trade_state)) return;
+            FinalTrade trade;
+            trade.trade_id = result->trade_id;
+            trade.option_id = result->option_id;
+            trade.state = result->trade_state;
+            trade.error_code = result->error_code;
+            trade.delay = result->delay;
+            trade.profit = result->profit;
+            trades.push_back(trade);
+        });
+        EXPECT_TRUE(platform.place_trade(std::move(request)));
+    }
+    EXPECT_TRUE(run_until(platform, [&trades, count]() { return trades.size() >= count; }));
+    std::sort(trades.begin(), trades.end(), [](const FinalTrade& lhs, const FinalTrade& rhs) {
+        return lhs.option_id < rhs.option_id;
+    });
+    return trades;
+}
+
+} // namespace
+
+TEST(SimulatedTradingPlatformTest, SameSeedProducesSameTrades) {
+    std::vector<FinalTrade> runs[2];
+    for (auto& run : runs) {
+        SimulatedTradingPlatform platform;
+        ASSERT_TRUE(connect(platform, make_config(42)));
+        run = place_and_wait(platform, 16);
+    }
+
+    ASSERT_EQ(runs[0].size(), 16u);
+    ASSERT_EQ(runs[1].size(), 16u);
+    for (std::size_t i = 0; i < runs[0].size(); ++i) {
+        EXPECT_EQ(runs[0][i].option_id, static_cast<std::int64_t>(i + 1));
+        EXPECT_EQ(runs[0][i].option_id, runs[1][i].option_id);
+        EXPECT_EQ(runs[0][i].state, runs[1][i].state);
+        EXPECT_EQ(runs[0][i].delay, runs[1][i].delay);
+        EXPECT_DOUBLE_EQ(runs[0][i].profit, runs[1][i].profit);
+    }
+}
+
+TEST(SimulatedTradingPlatformTest, FixedLatencyIsReportedAsDelay) {
+    auto config = make_config(7);
+    config->open_latency = LatencyDistribution::fixed(30);
+
+    SimulatedTradingPlatform platform;
+    ASSERT_TRUE(connect(platform, std::move(config)));
+    const auto trades = place_and_wait(platform, 4);
+
+    ASSERT_EQ(trades.size(), 4u);
+    for (const auto& trade : trades) {
+        EXPECT_EQ(trade.delay, 30);
+    }
+}
+
+TEST(SimulatedTradingPlatformTest, RejectionRateRejectsOrders) {
+    auto config = make_config(3);
+    config->rejection_rate = 1.0;
+
+    SimulatedTradingPlatform platform;
+    ASSERT_TRUE(connect(platform, std::move(config)));
+    const auto trades = place_and_wait(platform, 5);
+
+    ASSERT_EQ(trades.size(), 5u);
+    for (const auto& trade : trades) {
+        EXPECT_EQ(trade.state, optionx::TradeState::OPEN_ERROR);
+        EXPECT_EQ(trade.error_code, optionx::TradeErrorCode::CANCELED_TRADE);
+
+        const auto fetched = fetch_result(platform, trade.option_id);
+        ASSERT_TRUE(fetched);
+        EXPECT_EQ(fetched->trade_state, optionx::TradeState::OPEN_ERROR);
+        EXPECT_EQ(fetched->error_code, optionx::TradeErrorCode::CANCELED_TRADE);
+    }
+    EXPECT_DOUBLE_EQ(platform.get_info<double>(optionx::AccountInfoType::BALANCE), 1000.0);
+
+    optionx::TradeHistoryResult history;
+    ASSERT_TRUE(platform.fetch_trade_history([&history](optionx::TradeHistoryResult result) {
+        history = std::move(result);
+    }));
+    ASSERT_TRUE(history.success);
+    EXPECT_TRUE(history.records.empty());
+}
+
+TEST(SimulatedTradingPlatformTest, AttachedTradeRecordDBStoresFinalResults) {
+    optionx::storage::TradeRecordDB db(make_db_config("simulated_platform_trades"));
+    ASSERT_TRUE(db.is_open());
+
+    auto config = make_config(5);
+    config->rejection_rate = 0.5;
+    config->win_rate = 1.0;
+
+    SimulatedTradingPlatform platform;
+    std::size_t written = 0;
+    platform.on_trade_id() = [&db]() { return db.get_trade_id(); };
+    platform.on_trade_result() = [&db, &written](
+            std::unique_ptr<optionx::TradeRequest> request,
+            std::unique_ptr<optionx::TradeResult> result) {
+        if (!is_final(result->trade_state)) return;
+        if (db.upsert(optionx::TradeRecord::from_trade(*request, *result)).ok()) ++written;
+    };
+    ASSERT_TRUE(connect(platform, std::move(config)));
+    const auto trades = place_and_wait(platform, 16);
+
+    ASSERT_EQ(trades.size(), 16u);
+    ASSERT_TRUE(run_until(platform, [&written]() { return written >= 16; }));
+    EXPECT_EQ(db.count(), 16u);
+
+    std::size_t rejected = 0;
+    for (const auto& trade : trades) {
+        ASSERT_NE(trade.trade_id, 0u);
+        const auto stored = db.find_by_trade_id(trade.trade_id);
+        ASSERT_TRUE(stored.ok()) << stored.message;
+        EXPECT_EQ(stored.record.option_id, trade.option_id);
+        EXPECT_EQ(stored.record.trade_state, trade.state);
+
+        const auto fetched = fetch_result(platform, trade.option_id);
+        ASSERT_TRUE(fetched);
+        EXPECT_EQ(fetched->trade_state, trade.state);
+        if (trade.state == optionx::TradeState::OPEN_ERROR) ++rejected;
+    }
+    EXPECT_GT(rejected, 0u);
+    EXPECT_LT(rejected, trades.size());
+}
+
+TEST(SimulatedTradingPlatformTest, SeededWinsUpdateBalanceAndHistory) {
+    auto config = make_config(11);
+    config->win_rate = 1.0;
+
+    SimulatedTradingPlatform platform;
+    ASSERT_TRUE(connect(platform, std::move(config)));
+    const auto trades = place_and_wait(platform, 3, 10.0);
+
+    ASSERT_EQ(trades.size(), 3u);
+    for (const auto& trade : trades) {
+        EXPECT_EQ(trade.state, optionx::TradeState::WIN);
+        EXPECT_DOUBLE_EQ(trade.profit, 8.0);
+    }
+    EXPECT_DOUBLE_EQ(platform.get_info<double>(optionx::AccountInfoType::BALANCE), 1024.0);
+
+    optionx::TradeHistoryResult history;
+    ASSERT_TRUE(platform.fetch_trade_history([&history](optionx::TradeHistoryResult result) {
+        history = std::move(result);
+    }));
+    ASSERT_TRUE(history.success);
+    ASSERT_EQ(history.records.size(), 3u);
+    for (const auto& record : history.records) {
+        EXPECT_EQ(record.trade_state, optionx::TradeState::WIN);
+    }
+
+    optionx::TradeResultQuery query;
+    query.option_id = 2;
+    std::unique_ptr<optionx::TradeResult> fetched;
+    ASSERT_TRUE(platform.fetch_trade_result(
+        query,
+        std::make_unique<optionx::TradeResult>(),
+        [&fetched](std::unique_ptr<optionx::TradeResult> result) {
+            fetched = std::move(result);
+        }));
+    ASSERT_TRUE(fetched);
+    EXPECT_EQ(fetched->option_id, 2);
+    EXPECT_EQ(fetched->trade_state, optionx::TradeState::WIN);
+
+    query.option_id = 100;
+    ASSERT_TRUE(platform.fetch_trade_result(
+        query,
+        std::make_unique<optionx::TradeResult>(),
+        [&fetched](std::unique_ptr<optionx::TradeResult> result) {
+            fetched = std::move(result);
+        }));
+    EXPECT_EQ(fetched->trade_state, optionx::TradeState::CHECK_ERROR);
+}
+
+TEST(SimulatedTradingPlatformTest, PriceFeedIsDeterministic) {
+    optionx::platforms::simulator::SimulatedPriceFeed first;
+    optionx::platforms::simulator::SimulatedPriceFeed second;
+    SimulationConfig config;
+    first.configure(5, config.effective_symbols());
+    second.configure(5, config.effective_symbols());
+
+    // Query in different orders; steps must not depend on query history.
+    const double late = first.price_at("EURUSD", 60000);
+    const double early = first.price_at("EURUSD", 1000);
+    EXPECT_DOUBLE_EQ(second.price_at("EURUSD", 1000), early);
+    EXPECT_DOUBLE_EQ(second.price_at("EURUSD", 60000), late);
+    EXPECT_DOUBLE_EQ(first.price_at("UNKNOWN", 1000), 0.0);
+    EXPECT_EQ(first.step_at("EURUSD", 1000), 1000 / 250);
+}
+
+TEST(SimulatedTradingPlatformTest, ResultQueriesRaceWithWorkerThread) {
+    auto config = make_config(13);
+    config->rejection_rate = 0.3;
+    config->max_history_records = 8;
+
+    SimulatedTradingPlatform platform;
+    std::atomic<bool> connected{false};
+    platform.configure_auth(std::move(config));
+    platform.connect([&connected](optionx::ConnectionResult result) {
+        connected = result.success;
+    });
+    platform.run(true);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!connected && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(connected);
+
+    const std::size_t count = 32;
+    std::atomic<std::size_t> finished{0};
+    for (std::size_t i = 0; i < count; ++i) {
+        auto request = std::make_unique<optionx::TradeRequest>();
+        request->symbol = "EURUSD";
+        request->amount = 1.0;
+        request->option_type = optionx::OptionType::SPRINT;
+        request->order_type = optionx::OrderType::BUY;
+        request->duration = 1;
+        request->add_callback([&finished](
+                std::unique_ptr<optionx::TradeRequest>,
+                std::unique_ptr<optionx::TradeResult> result) {
+            if (is_final(result->trade_state)) ++finished;
+        });
+        ASSERT_TRUE(platform.place_trade(std::move(request)));
+    }
+
+    // Query from this thread while the worker fills, closes and evicts trades.
+    std::size_t answered = 0;
+    while (finished < count && std::chrono::steady_clock::now() < deadline) {
+        for (std::int64_t option_id = 1; option_id <= static_cast<std::int64_t>(count); ++option_id) {
+            optionx::TradeResultQuery query;
+            query.option_id = option_id;
+            platform.fetch_trade_result(
+                query,
+                std::make_unique<optionx::TradeResult>(),
+                [&answered](std::unique_ptr<optionx::TradeResult> result) {
+                    if (result) ++answered;
+                });
+        }
+        platform.fetch_trade_history([](optionx::TradeHistoryResult result) {
+            EXPECT_LE(result.records.size(), 8u);
+        });
+    }
+    EXPECT_EQ(finished.load(), count);
+    EXPECT_GT(answered, 0u);
+    EXPECT_EQ(platform.sent_orders(), count);
+    platform.shutdown();
+}
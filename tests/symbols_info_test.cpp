@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <optionx_cpp/data.hpp>
+
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using optionx::SymbolInfo;
+using optionx::SymbolRegistry;
+using optionx::SymbolsInfo;
+
+TEST(SymbolsInfoTest, FindsSymbolsByNormalizedNameAndAlias) {
+    SymbolsInfo info(SymbolsInfo::MatchMode::NORMALIZED);
+    info.add_symbol("EURUSD", 5);
+    info.add_symbol("USDJPY", 3);
+    info.add_symbol("BTCUSDT", 2);
+    info.add_alias("BTC/USD", "BTCUSDT");
+    info.add_alias("XAUUSD", "GOLD");
+
+    ASSERT_TRUE(info.find_symbol("EURUSD").has_value());
+    EXPECT_EQ(info.find_symbol("eur/usd")->symbol, "EURUSD");
+    EXPECT_EQ(info.find_symbol(" usd_jpy ")->digits, 3);
+    EXPECT_EQ(info.find_symbol("btcusd")->symbol, "BTCUSDT");
+    EXPECT_FALSE(info.find_symbol("XAUUSD").has_value());
+    EXPECT_FALSE(info.find_symbol("").has_value());
+    EXPECT_FALSE(info.find_symbol(std::string(100, 'A')).has_value());
+
+    const auto registry = info.snapshot();
+    ASSERT_NE(registry, nullptr);
+    EXPECT_EQ(registry->size(), 3u);
+    const auto id = registry->find_id("EURUSD");
+    ASSERT_NE(id, SymbolRegistry::INVALID_ID);
+    EXPECT_EQ(registry->at(id)->digits, 5);
+    EXPECT_EQ(registry->find_id("BTC-USD"), registry->find_id("BTCUSDT"));
+    EXPECT_EQ(registry->at(SymbolRegistry::INVALID_ID), nullptr);
+
+    info.clear();
+    EXPECT_FALSE(info.find_symbol("EURUSD").has_value());
+    EXPECT_EQ(registry->find("EURUSD")->digits, 5);
+}
+
+TEST(SymbolsInfoTest, RefreshKeepsInternedIdsAndOldSnapshots) {
+    SymbolsInfo info(SymbolsInfo::MatchMode::NORMALIZED);
+    info.assign({SymbolInfo("EURUSD", 5), SymbolInfo("GBPUSD", 5), SymbolInfo("USDJPY", 3)});
+    const auto before = info.snapshot();
+    const auto eurusd = before->find_id("EURUSD");
+    const auto usdjpy = before->find_id("USDJPY");
+    const auto gbpusd = before->find_id("GBPUSD");
+
+    info.assign({SymbolInfo("USDJPY", 3), SymbolInfo("AUDUSD", 5), SymbolInfo("EURUSD", 4)});
+    const auto after = info.snapshot();
+    EXPECT_EQ(after->find_id("EURUSD"), eurusd);
+    EXPECT_EQ(after->find_id("USDJPY"), usdjpy);
+    EXPECT_EQ(after->at(gbpusd), nullptr);
+    EXPECT_NE(after->find_id("AUDUSD"), gbpusd);
+    EXPECT_EQ(after->at(eurusd)->digits, 4);
+    EXPECT_EQ(after->size(), 3u);
+
+    EXPECT_EQ(before->at(eurusd)->digits, 5);
+    EXPECT_NE(before->find("GBPUSD"), nullptr);
+
+    SymbolsInfo copy = info;
+    EXPECT_EQ(copy.snapshot(), after);
+    EXPECT_EQ(copy.find_symbol("audusd")->symbol, "AUDUSD");
+}
+
+TEST(SymbolsInfoTest, ReadersSeeCompleteSnapshotsDuringRefresh) {
+    SymbolsInfo info(SymbolsInfo::MatchMode::NORMALIZED);
+    info.assign({SymbolInfo("EURUSD", 5), SymbolInfo("USDJPY", 3)});
+
+    std::thread writer([&info]() {
+        for (int i = 0; i < 200; ++i) {
+            std::vector<SymbolInfo> list = {SymbolInfo("EURUSD", 5), SymbolInfo("USDJPY", 3)};
+            if (i % 2 == 0) list.emplace_back("GBPUSD", 5);
+            info.assign(std::move(list));
+        }
+    });
+
+    for (int i = 0; i < 2000; ++i) {
+        const auto registry = info.snapshot();
+        ASSERT_NE(registry, nullptr);
+        ASSERT_NE(registry->find("EURUSD"), nullptr);
+        EXPECT_EQ(registry->find("usdjpy")->digits, 3);
+    }
+    writer.join();
+}
+
+TEST(SymbolsInfoTest, MatchesExactlyByDefault) {
+    SymbolsInfo info;
+    EXPECT_EQ(info.match_mode(), SymbolsInfo::MatchMode::EXACT);
+    info.add_symbol("EURUSD", 5);
+    info.add_symbol("EUR/USD", 4);
+    info.add_symbol("eurusd", 3);
+    info.add_alias("Gold", "EURUSD");
+
+    EXPECT_EQ(info.snapshot()->size(), 3u);
+    EXPECT_EQ(info.find_symbol("EURUSD")->digits, 5);
+    EXPECT_EQ(info.find_symbol("EUR/USD")->digits, 4);
+    EXPECT_EQ(info.find_symbol("eurusd")->digits, 3);
+    EXPECT_EQ(info.find_symbol("Gold")->symbol, "EURUSD");
+    EXPECT_FALSE(info.find_symbol("EUR_USD").has_value());
+    EXPECT_FALSE(info.find_symbol("GOLD").has_value());
+    EXPECT_FALSE(info.find_symbol(" EURUSD").has_value());
+
+    info.set_match_mode(SymbolsInfo::MatchMode::NORMALIZED);
+    EXPECT_EQ(info.snapshot()->size(), 1u);
+    EXPECT_EQ(info.find_symbol("EUR_USD")->digits, 5);
+    EXPECT_EQ(info.find_symbol("GOLD")->symbol, "EURUSD");
+
+    info.set_match_mode(SymbolsInfo::MatchMode::EXACT);
+    EXPECT_EQ(info.find_symbol("eurusd")->digits, 3);
+    EXPECT_FALSE(info.find_symbol("EUR_USD").has_value());
+}
+
+TEST(SymbolsInfoTest, NormalizationFoldsAsciiOnly) {
+    // Bytes outside ASCII are dropped rather than case-folded through the C locale.
+    EXPECT_EQ(SymbolRegistry::normalize("eur/usd"), "EURUSD");
+    EXPECT_EQ(SymbolRegistry::normalize("x\xC3\xA9y\xFF_1"), "XY1");
+
+    SymbolsInfo info(SymbolsInfo::MatchMode::NORMALIZED);
+    info.add_symbol("DAX40", 2);
+    EXPECT_EQ(info.find_symbol("dax\xE4" "40")->symbol, "DAX40");
+    EXPECT_FALSE(info.find_symbol("\xC4\xC1\xD8").has_value());
+}
+
+TEST(SymbolsInfoTest, NormalizedMatchingIgnoresCaseAndSeparators) {
+    SymbolsInfo info(SymbolsInfo::MatchMode::NORMALIZED);
+    info.begin_update();
+    info.add_symbol("EUR/USD", 5);
+    info.add_symbol("eurusd", 3);
+    info.add_symbol("GBPUSD", 5);
+    EXPECT_EQ(info.snapshot(), nullptr);
+    EXPECT_FALSE(info.find_symbol("GBPUSD").has_value());
+    info.end_update();
+
+    ASSERT_NE(info.snapshot(), nullptr);
+    EXPECT_EQ(info.symbols().size(), 3u);
+    EXPECT_EQ(info.snapshot()->size(), 2u);
+    EXPECT_EQ(info.find_symbol("eurusd")->symbol, "EUR/USD");
+    EXPECT_EQ(info.find_symbol("EURUSD")->digits, 5);
+    EXPECT_EQ(info.find_symbol("gbp-usd")->symbol, "GBPUSD");
+}
+
+TEST(SymbolsInfoTest, BatchedUpdatesPublishOnce) {
+    SymbolsInfo info(SymbolsInfo::MatchMode::NORMALIZED);
+    info.add_symbol("EURUSD", 5);
+    const auto before = info.snapshot();
+
+    info.begin_update();
+    info.begin_update();
+    for (int i = 0; i < 1000; ++i) {
+        info.add_symbol("SYM" + std::to_string(i), 2);
+    }
+    info.add_alias("EUR", "EURUSD");
+    info.end_update();
+    EXPECT_EQ(info.snapshot(), before);
+    EXPECT_FALSE(info.find_symbol("SYM7").has_value());
+    info.end_update();
+    info.end_update();
+
+    const auto after = info.snapshot();
+    ASSERT_NE(after, before);
+    EXPECT_EQ(after->size(), 1001u);
+    EXPECT_EQ(after->find_id("EURUSD"), before->find_id("EURUSD"));
+    EXPECT_EQ(info.find_symbol("sym999")->digits, 2);
+    EXPECT_EQ(info.find_symbol("eur")->symbol, "EURUSD");
+
+    info.clear();
+    EXPECT_FALSE(info.find_symbol("EURUSD").has_value());
+    info.add_symbol("USDJPY", 3);
+    EXPECT_EQ(info.find_symbol("USDJPY")->digits, 3);
+}
+
+TEST(SymbolsInfoTest, MoveTransfersListAndRegistry) {
+    SymbolsInfo info;
+    info.assign({SymbolInfo("EURUSD", 5), SymbolInfo("USDJPY", 3)});
+    const auto registry = info.snapshot();
+
+    SymbolsInfo moved(std::move(info));
+    EXPECT_EQ(moved.snapshot(), registry);
+    EXPECT_EQ(moved.symbols().size(), 2u);
+
+    SymbolsInfo target;
+    target.add_symbol("GBPUSD", 5);
+    target = std::move(moved);
+    EXPECT_EQ(target.snapshot(), registry);
+    EXPECT_EQ(target.find_symbol("USDJPY")->digits, 3);
+    EXPECT_FALSE(target.find_symbol("usdjpy").has_value());
+    EXPECT_FALSE(target.find_symbol("GBPUSD").has_value());
+
+    static_assert(std::is_nothrow_move_constructible<SymbolsInfo>::value,
+                  "SymbolsInfo must be cheap to move");
+}
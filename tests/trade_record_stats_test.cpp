@@ -259,6 +259,44 @@ TEST(TradeTimeZoneTest, RepeatedDstHourHasDistinctUtcBuckets) {
         tz.start_of_local_hour_utc_ms(second));
 }
 
+TEST(TradeTimeZoneTest, TransitionTableMatchesTimeShieldAndBatchConversion) {
+    const auto tz = optionx::TradeTimeZone::named(time_shield::CET);
+    const auto* table = optionx::TradeTimeZoneTransitions::get(time_shield::CET);
+    ASSERT_NE(table, nullptr);
+    ASSERT_GT(table->starts().size(), 100u);
+    EXPECT_EQ(table->starts().front(), optionx::TradeTimeZoneTransitions::TABLE_BEGIN_UTC_MS);
+    EXPECT_TRUE(std::is_sorted(table->starts().begin(), table->starts().end()));
+
+    const std::int64_t deltas[] = {
+        -static_cast<std::int64_t>(time_shield::MS_PER_HOUR), -1, 0, 1,
+        static_cast<std::int64_t>(time_shield::MS_PER_HOUR)
+    };
+    std::vector<std::int64_t> column;
+    for (std::size_t i = 1; i < table->starts().size(); i += 7) {
+        const auto transition = table->starts()[i];
+        for (const auto delta : deltas) {
+            column.push_back(transition + delta);
+        }
+    }
+    column.push_back(time_shield::to_timestamp_ms(1995, 7, 1, 12, 0, 0));
+    column.push_back(time_shield::to_timestamp_ms(2026, 10, 25, 0, 30, 0));
+    column.push_back(time_shield::to_timestamp_ms(2026, 10, 25, 1, 30, 0));
+
+    const auto local = tz.to_local_ms(column);
+    ASSERT_EQ(local.size(), column.size());
+    optionx::TradeTimeZoneCursor cursor(tz);
+    for (std::size_t i = 0; i < column.size(); ++i) {
+        time_shield::tz_t expected = 0;
+        ASSERT_TRUE(time_shield::zone_offset_at_utc_ms(column[i], time_shield::CET, expected));
+        EXPECT_EQ(tz.offset_at_utc_ms(column[i]), expected) << "utc_ms=" << column[i];
+        EXPECT_EQ(local[i], column[i] + expected * time_shield::MS_PER_SEC);
+        EXPECT_EQ(cursor.to_local_ms(column[i]), local[i]);
+    }
+
+    const auto fixed = optionx::TradeTimeZone::fixed_offset(time_shield::SEC_PER_HOUR).to_local_ms(column);
+    EXPECT_EQ(fixed.back(), column.back() + time_shield::MS_PER_HOUR);
+}
+
 TEST(TradeRecordStatusFixerTest, MarksStaleAsCheckError) {
     std::vector<TradeRecord> records;
     // Terminal trade at 1000000
@@ -825,7 +863,7 @@ TEST(TradeStatsCalculatorTest, PortfolioBalanceModeCombinesAccountsInBaseCurrenc
 
     optionx::TradeStatsConfig cfg;
     cfg.equity_mode = optionx::TradeStatsEquityMode::PORTFOLIO_BALANCE;
-    cfg.currency_matrix.base_currency = optionx::CurrencyType::USD;
+    cfg.currency_matrix.set_base_currency(optionx::CurrencyType::USD);
     cfg.currency_matrix.set_rate(optionx::CurrencyType::RUB, optionx::CurrencyType::USD, 0.01);
     cfg.include_non_terminal = false;
     auto stats_ptr = TradeStatsCalculator::calc(records, cfg);
@@ -845,6 +883,72 @@ TEST(TradeStatsCalculatorTest, PortfolioBalanceModeCombinesAccountsInBaseCurrenc
     EXPECT_DOUBLE_EQ(stats.total_profit, 1.0);
 }
 
+TEST(TradeCurrencyConversionMatrixTest, ResolvesInverseCrossAndDailyRates) {
+    using optionx::CurrencyType;
+    constexpr std::int64_t day_ms = optionx::TradeCurrencyConversionMatrix::MS_PER_DAY;
+    constexpr std::int64_t day1 = 19000 * day_ms;
+
+    optionx::TradeCurrencyConversionMatrix matrix;
+    matrix.set_base_currency(CurrencyType::USD);
+    matrix.set_rate(CurrencyType::RUB, CurrencyType::USD, 0.01);
+    matrix.set_rate(CurrencyType::EUR, CurrencyType::USD, 1.1);
+
+    EXPECT_NEAR(matrix.convert(100.0, CurrencyType::USD, CurrencyType::RUB), 10000.0, 1e-9);
+    EXPECT_NEAR(matrix.convert(100.0, CurrencyType::EUR, CurrencyType::RUB), 11000.0, 1e-9);
+    EXPECT_DOUBLE_EQ(matrix.convert(5.0, CurrencyType::GBP, CurrencyType::USD), 5.0);
+    EXPECT_FALSE(matrix.has_daily_rates());
+
+    matrix.set_daily_rate(CurrencyType::RUB, CurrencyType::USD, day1 + 3600000, 0.012);
+    matrix.set_daily_rate(CurrencyType::RUB, CurrencyType::USD, day1 + 2 * day_ms, 0.010);
+    matrix.set_daily_rate(CurrencyType::RUB, CurrencyType::USD, day1 + day_ms, 0.011);
+    EXPECT_TRUE(matrix.has_daily_rates());
+
+    EXPECT_DOUBLE_EQ(matrix.rate(CurrencyType::RUB, CurrencyType::USD, day1 - 1), 0.01);
+    EXPECT_DOUBLE_EQ(matrix.rate(CurrencyType::RUB, CurrencyType::USD, day1), 0.012);
+    EXPECT_DOUBLE_EQ(matrix.rate(CurrencyType::RUB, CurrencyType::USD, day1 + day_ms + 5), 0.011);
+    EXPECT_DOUBLE_EQ(matrix.rate(CurrencyType::RUB, CurrencyType::USD, day1 + 30 * day_ms), 0.010);
+    EXPECT_NEAR(matrix.convert(12.0, CurrencyType::USD, CurrencyType::RUB, day1), 1000.0, 1e-9);
+    EXPECT_NEAR(matrix.convert(1.2, CurrencyType::EUR, CurrencyType::RUB, day1), 110.0, 1e-9);
+    EXPECT_NEAR(matrix.convert(100.0, CurrencyType::EUR, CurrencyType::RUB), 11000.0, 1e-9);
+
+    std::vector<TradeRecord> records;
+    records.push_back(make_win_record(1, day1, 1000.0, 800.0));
+    records.push_back(make_win_record(2, day1 + 2 * day_ms, 1000.0, -1000.0, "EURUSD", optionx::TradeState::LOSS));
+    for (auto& record : records) record.currency = CurrencyType::RUB;
+
+    optionx::TradeStatsConfig cfg;
+    cfg.currency_matrix = matrix;
+    cfg.include_non_terminal = false;
+    auto stats_ptr = TradeStatsCalculator::calc(records, cfg);
+    EXPECT_NEAR(stats_ptr->total_profit, 800.0 * 0.012 - 1000.0 * 0.010, 1e-9);
+    EXPECT_NEAR(stats_ptr->total_volume, 1000.0 * 0.012 + 1000.0 * 0.010, 1e-9);
+}
+
+TEST(TradeCurrencyConversionMatrixTest, SettersKeepResolvedTableCurrent) {
+    using optionx::CurrencyType;
+    optionx::TradeCurrencyConversionMatrix matrix;
+    EXPECT_DOUBLE_EQ(matrix.rate(CurrencyType::EUR, CurrencyType::USD), 0.0);
+    EXPECT_DOUBLE_EQ(matrix.rate(CurrencyType::EUR, CurrencyType::EUR), 1.0);
+
+    matrix.set_rates({
+        {{CurrencyType::EUR, CurrencyType::USD}, 1.1},
+        {{CurrencyType::RUB, CurrencyType::USD}, 0.01},
+        {{CurrencyType::EUR, CurrencyType::GBP}, 0.85}
+    });
+    EXPECT_NEAR(matrix.rate(CurrencyType::USD, CurrencyType::EUR), 1.0 / 1.1, 1e-12);
+
+    // With USD as base the EUR->RUB cross rate pivots through USD.
+    matrix.set_base_currency(CurrencyType::USD);
+    EXPECT_EQ(matrix.base_currency(), CurrencyType::USD);
+    EXPECT_NEAR(matrix.rate(CurrencyType::EUR, CurrencyType::RUB), 110.0, 1e-9);
+    EXPECT_NEAR(matrix.convert_to_base(100.0, CurrencyType::RUB), 1.0, 1e-12);
+
+    matrix.set_rates({{{CurrencyType::GBP, CurrencyType::USD}, 1.25}});
+    EXPECT_EQ(matrix.rates().size(), 1u);
+    EXPECT_DOUBLE_EQ(matrix.rate(CurrencyType::EUR, CurrencyType::USD), 0.0);
+    EXPECT_DOUBLE_EQ(matrix.rate(CurrencyType::GBP, CurrencyType::USD), 1.25);
+}
+
 TEST(TradeStatsCalculatorTest, RecordBalanceModePreservesZeroCloseBalanceSnapshot) {
     std::vector<TradeRecord> records;
     records.push_back(make_win_record(1, 1000, 100.0, -100.0, "EURUSD", optionx::TradeState::LOSS));
@@ -928,6 +1032,57 @@ TEST(TradeMetaStatsCalculatorTest, CollectsUniqueSymbols) {
     EXPECT_EQ(meta.symbol_stats.size(), 2u);
 }
 
+TEST(TradeMetaStatsCalculatorTest, MatchesPerValueCalculation) {
+    const std::int64_t day_ms = 1700006400000; // 2023-11-15 00:00:00 UTC
+    std::vector<TradeRecord> records;
+    records.push_back(make_win_record(1, day_ms + 3 * 3600000, 10.0, 8.2, "EURUSD", optionx::TradeState::WIN));
+    records.push_back(make_win_record(2, day_ms + 3 * 3600000 + 60000, 10.0, -10.0, "GBPUSD", optionx::TradeState::LOSS));
+    records.push_back(make_win_record(3, day_ms + 5 * 3600000, 20.0, 16.4, "EURUSD", optionx::TradeState::WIN));
+    records.push_back(make_win_record(4, day_ms + 9 * 3600000, 10.0, 8.2, "EURUSD", optionx::TradeState::WIN));
+    records.push_back(make_win_record(5, day_ms + 10 * 3600000, 15.0, -15.0, "BTCUSD", optionx::TradeState::LOSS));
+    records[2].signal_name = "other-signal";
+
+    optionx::TradeStatsConfig cfg;
+    cfg.start_balance = 1000.0;
+    cfg.filter.hours.add_include(3);
+    cfg.filter.hours.add_include(5);
+    cfg.filter.hours.add_exclude(10);
+    auto meta = TradeMetaStatsCalculator::calc(records, cfg);
+
+    ASSERT_EQ(meta.symbols, (std::vector<std::string>{"EURUSD", "GBPUSD"}));
+    ASSERT_EQ(meta.signals, (std::vector<std::string>{"other-signal", "test-signal"}));
+    ASSERT_EQ(meta.symbol_stats.size(), 2u);
+    ASSERT_EQ(meta.hour_stats.size(), 24u);
+    ASSERT_EQ(meta.weekday_stats.size(), 7u);
+    EXPECT_TRUE(meta.has_demo);
+    EXPECT_FALSE(meta.has_real);
+
+    const auto expect_same = [](const optionx::TradeStats& actual, const optionx::TradeStats& expected) {
+        EXPECT_EQ(actual.total.trades, expected.total.trades);
+        EXPECT_EQ(actual.total.wins, expected.total.wins);
+        EXPECT_EQ(actual.total.losses, expected.total.losses);
+        EXPECT_DOUBLE_EQ(actual.total_profit, expected.total_profit);
+        EXPECT_DOUBLE_EQ(actual.max_absolute_drawdown, expected.max_absolute_drawdown);
+        EXPECT_EQ(actual.equity_curve.x_time, expected.equity_curve.x_time);
+        EXPECT_EQ(actual.equity_curve.y_value, expected.equity_curve.y_value);
+        EXPECT_EQ(actual.by_hour[3].trades, expected.by_hour[3].trades);
+    };
+
+    for (std::size_t i = 0; i < meta.symbols.size(); ++i) {
+        auto symbol_cfg = cfg;
+        symbol_cfg.filter.symbols.include = {meta.symbols[i]};
+        expect_same(meta.symbol_stats[i], *TradeStatsCalculator::calc(records, symbol_cfg));
+    }
+    for (std::uint32_t h = 0; h < 24; ++h) {
+        auto hour_cfg = cfg;
+        hour_cfg.filter.hours.include = {h};
+        expect_same(meta.hour_stats[h], *TradeStatsCalculator::calc(records, hour_cfg));
+    }
+    // Hour buckets ignore the base hour include list but keep its exclusions.
+    EXPECT_EQ(meta.hour_stats[9].total.trades, 1u);
+    EXPECT_EQ(meta.hour_stats[10].total.trades, 0u);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <optionx_cpp/platforms.hpp>
+
+#include <chrono>
+#include <functional>
+#include <thread>
+
+using namespace optionx;
+using optionx::platforms::TradeUpPlatform;
+
+namespace optionx::platforms {
+
+    /// Feeds captured stream frames into the platform's WebSocketManager.
+    class TradeUpPlatformTestAccess {
+    public:
+        static void replay_stream_frame(
+                TradeUpPlatform& platform,
+                std::string_view frame,
+                AccountType account_type) {
+            platform.m_ws_manager.handle_frame(frame, account_type);
+        }
+    };
+
+} // namespace optionx::platforms
+
+namespace {
+
+    using optionx::platforms::TradeUpPlatformTestAccess;
+
+    /// Drives the platform loop until `done` holds or the deadline passes.
+    bool drive_until(TradeUpPlatform& platform, const std::function<bool()>& done) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!done()) {
+            if (std::chrono::steady_clock::now() > deadline) return false;
+            platform.process();
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+} // namespace
+
+TEST(TradeUpPlatform, StreamBalanceFrameUpdatesAccountOnLoop) {
+    TradeUpPlatform platform;
+    int balance_updates = 0;
+    platform.on_account_info() = [&balance_updates](const AccountInfoUpdate& update) {
+        if (update.status == AccountUpdateStatus::BALANCE_UPDATED) ++balance_updates;
+    };
+    platform.run(false);
+
+    TradeUpPlatformTestAccess::replay_stream_frame(
+        platform,
+        R"({"evt":"balancesResults","data":{"balance":"1250.75","currency":"EUR"}})",
+        AccountType::DEMO);
+    // The socket thread only queues the update; the account changes on the loop.
+    EXPECT_DOUBLE_EQ(platform.get_info<double>(AccountInfoType::BALANCE), 0.0);
+
+    ASSERT_TRUE(drive_until(platform, [&platform]() {
+        return platform.get_info<double>(AccountInfoType::BALANCE) == 1250.75;
+    }));
+    EXPECT_EQ(platform.get_info<CurrencyType>(AccountInfoType::CURRENCY), CurrencyType::EUR);
+    EXPECT_EQ(balance_updates, 1);
+
+    // Unhandled events and nested `evt` keys never reach the account snapshot.
+    TradeUpPlatformTestAccess::replay_stream_frame(
+        platform, R"({"evt":"quotes","balance":1})", AccountType::DEMO);
+    TradeUpPlatformTestAccess::replay_stream_frame(
+        platform, R"({"data":{"evt":"balancesResults","balance":2}})", AccountType::DEMO);
+    for (int i = 0; i < 20; ++i) platform.process();
+    EXPECT_DOUBLE_EQ(platform.get_info<double>(AccountInfoType::BALANCE), 1250.75);
+    EXPECT_EQ(balance_updates, 1);
+
+    platform.shutdown();
+}
+
+TEST(TradeUpPlatform, StreamDealFramesArePublishedOnLoop) {
+    TradeUpPlatform platform;
+    platform.run(false);
+
+    std::shared_ptr<TradeResult> received;
+    auto awaiter = utils::EventAwaiter<events::BrokerTradeUpdateEvent>::create(
+        platform.event_bus(),
+        [](const events::BrokerTradeUpdateEvent& event) {
+            return event.result && event.result->option_hash == "77";
+        },
+        [&received](const events::BrokerTradeUpdateEvent& event) {
+            received = event.result;
+        });
+
+    TradeUpPlatformTestAccess::replay_stream_frame(
+        platform,
+        R"({"evt":"dealClosed","data":{"id":77,"amount":5,"profit":4.1,"closeTime":1700000060}})",
+        AccountType::REAL);
+    EXPECT_EQ(received, nullptr);
+
+    ASSERT_TRUE(drive_until(platform, [&received]() { return received != nullptr; }));
+    EXPECT_EQ(received->option_id, 77);
+    EXPECT_EQ(received->account_type, AccountType::REAL);
+    EXPECT_EQ(received->trade_state, TradeState::WIN);
+    EXPECT_EQ(received->close_date, 1700000060000);
+    EXPECT_DOUBLE_EQ(platform.get_info<double>(AccountInfoType::BALANCE), 0.0);
+
+    platform.shutdown();
+}
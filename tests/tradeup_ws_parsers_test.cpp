@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <optionx_cpp/data.hpp>
+#include <optionx_cpp/platforms/TradeUpPlatform/ws_parsers.hpp>
+
+using namespace optionx;
+namespace tradeup = optionx::platforms::tradeup;
+
+TEST(TradeUpWsParsers, DetectsTopLevelEventName) {
+    EXPECT_EQ(
+        tradeup::detect_ws_event(R"({"evt":"balancesResults","data":{}})"),
+        tradeup::WsEventType::BALANCES);
+    EXPECT_EQ(
+        tradeup::detect_ws_event(R"({"id":1, "evt" : "dealClosed", "data":{}})"),
+        tradeup::WsEventType::DEAL_CLOSED);
+    EXPECT_EQ(
+        tradeup::detect_ws_event(R"({"evt":"dealOpened"})"),
+        tradeup::WsEventType::DEAL_OPENED);
+    EXPECT_EQ(
+        tradeup::detect_ws_event(R"({"evt":"quotes","data":[1,2,3]})"),
+        tradeup::WsEventType::UNKNOWN);
+    EXPECT_EQ(tradeup::detect_ws_event(R"({"operation":"PONG"})"), tradeup::WsEventType::UNKNOWN);
+    EXPECT_EQ(tradeup::detect_ws_event(R"({"evt":)"), tradeup::WsEventType::UNKNOWN);
+    EXPECT_EQ(tradeup::detect_ws_event("not json"), tradeup::WsEventType::UNKNOWN);
+    EXPECT_EQ(tradeup::find_ws_event_name(R"({"evt": "x"})"), "x");
+    EXPECT_EQ(tradeup::find_ws_event_name(R"({"name":"evt","evt":"y"})"), "y");
+    EXPECT_EQ(tradeup::find_ws_event_name(R"({"tag":"\"evt\"","evt":"y"})"), "y");
+
+    // Only the top-level key counts.
+    EXPECT_EQ(
+        tradeup::detect_ws_event(R"({"data":{"evt":"balancesResults"},"evt":"quotes"})"),
+        tradeup::WsEventType::UNKNOWN);
+    EXPECT_EQ(
+        tradeup::detect_ws_event(R"({"data":{"evt":"balancesResults","balance":1}})"),
+        tradeup::WsEventType::UNKNOWN);
+    EXPECT_EQ(
+        tradeup::detect_ws_event(R"([{"evt":"balancesResults"}])"),
+        tradeup::WsEventType::UNKNOWN);
+    EXPECT_EQ(tradeup::find_ws_event_name(R"({"evt":1,"data":{"x":"balancesResults"}})"), "");
+    EXPECT_EQ(tradeup::find_ws_event_name(R"({"data":[{"evt":"a"}],"evt":"b"})"), "b");
+}
+
+TEST(TradeUpWsParsers, ParsesBalanceFrames) {
+    tradeup::WsBalanceUpdate update;
+    ASSERT_TRUE(tradeup::parse_ws_balances(
+        R"({"evt":"balancesResults","data":{"balance":"1250.75","currency":"USD"}})",
+        update));
+    EXPECT_DOUBLE_EQ(update.balance, 1250.75);
+    EXPECT_EQ(update.currency, CurrencyType::USD);
+
+    tradeup::WsBalanceUpdate list_update;
+    ASSERT_TRUE(tradeup::parse_ws_balances(
+        R"({"evt":"balancesResults","data":[{"amount": 99.5 }]})",
+        list_update));
+    EXPECT_DOUBLE_EQ(list_update.balance, 99.5);
+    EXPECT_EQ(list_update.currency, CurrencyType::UNKNOWN);
+
+    // Fields of nested objects are not taken for the balance.
+    tradeup::WsBalanceUpdate nested;
+    EXPECT_FALSE(tradeup::parse_ws_balances(
+        R"({"evt":"balancesResults","data":{"bonus":{"balance":5}}})",
+        nested));
+
+    EXPECT_FALSE(tradeup::parse_ws_balances(R"({"evt":"balancesResults","data":[]})", update));
+    EXPECT_FALSE(tradeup::parse_ws_balances(R"({"evt":"balancesResults","data":{"balance":"n/a"}})", update));
+    EXPECT_FALSE(tradeup::parse_ws_balances("not json", update));
+}
+
+TEST(TradeUpWsParsers, ParsesDealFrames) {
+    TradeResult opened;
+    ASSERT_TRUE(tradeup::parse_ws_deal(
+        R"({"evt":"dealOpened","data":{"id":812,"amount":10,"payout":85,"openRate":"1.0841","openTime":1700000000}})",
+        false,
+        opened));
+    EXPECT_EQ(opened.option_id, 812);
+    EXPECT_EQ(opened.option_hash, "812");
+    EXPECT_DOUBLE_EQ(opened.amount, 10.0);
+    EXPECT_DOUBLE_EQ(opened.payout, 0.85);
+    EXPECT_DOUBLE_EQ(opened.open_price, 1.0841);
+    EXPECT_EQ(opened.open_date, 1700000000000);
+    EXPECT_EQ(opened.trade_state, TradeState::IN_PROGRESS);
+    EXPECT_EQ(opened.platform_type, PlatformType::TRADEUP);
+
+    TradeResult closed;
+    ASSERT_TRUE(tradeup::parse_ws_deal(
+        R"({"evt":"dealClosed","data":{"id":"a-7","profit":-10,"closeRate":1.08,"closeTime":1700000060000}})",
+        true,
+        closed));
+    EXPECT_EQ(closed.option_hash, "a-7");
+    EXPECT_DOUBLE_EQ(closed.close_price, 1.08);
+    EXPECT_EQ(closed.close_date, 1700000060000);
+    EXPECT_EQ(closed.trade_state, TradeState::LOSS);
+
+    TradeResult won;
+    ASSERT_TRUE(tradeup::parse_ws_deal(
+        R"({"evt":"dealClosed","data":{"id":9,"status":"won","profit":0}})",
+        true,
+        won));
+    EXPECT_EQ(won.trade_state, TradeState::WIN);
+
+    TradeResult missing_id;
+    EXPECT_FALSE(tradeup::parse_ws_deal(R"({"evt":"dealClosed","data":{"profit":1}})", true, missing_id));
+    EXPECT_FALSE(tradeup::parse_ws_deal(R"({"evt":"dealClosed","data":{"deal":{"id":1}}})", true, missing_id));
+    EXPECT_FALSE(tradeup::parse_ws_deal("{", true, missing_id));
+}
@@ -2,8 +2,14 @@
 
 #include <optionx_cpp/components.hpp>
 
+#include <chrono>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -19,6 +25,22 @@ public:
     std::vector<optionx::TradingConditionUpdate> updates;
 };
 
+class CallbackTradingConditionSubscriber final
+        : public optionx::components::ITradingConditionSubscriber {
+public:
+    explicit CallbackTradingConditionSubscriber(
+            std::function<void(const optionx::TradingConditionUpdate&)> callback)
+        : m_callback(std::move(callback)) {}
+
+    void on_trading_condition(
+            const optionx::TradingConditionUpdate& update) override {
+        m_callback(update);
+    }
+
+private:
+    std::function<void(const optionx::TradingConditionUpdate&)> m_callback;
+};
+
 optionx::TradingConditionUpdate make_condition(
         std::string symbol,
         double payout) {
@@ -151,6 +173,154 @@ TEST(TradingConditionHub, DuplicateAddDoesNotReplayCachedSnapshotsAgain) {
     EXPECT_EQ(subscriber->updates.size(), 1u);
 }
 
+TEST(TradingConditionUpdate, DiffPatchKeepsOnlyChangedFields) {
+    const auto snapshot = make_condition("EUR/USD", 0.82);
+
+    auto patch = make_scope("EUR/USD");
+    patch.payout = 0.82;
+    patch.market_open = false;
+    patch.timestamp = 1700000000;
+
+    const auto delta = snapshot.diff_patch(patch);
+    EXPECT_TRUE(delta.same_scope(snapshot));
+    EXPECT_EQ(delta.timestamp, 1700000000);
+    EXPECT_FALSE(delta.payout.has_value());
+    ASSERT_TRUE(delta.market_open.has_value());
+    EXPECT_FALSE(*delta.market_open);
+
+    patch.market_open = true;
+    EXPECT_TRUE(snapshot.diff_patch(patch).empty());
+}
+
+TEST(TradingConditionHub, ScopedSubscribersReceiveSnapshotThenDeltas) {
+    optionx::components::TradingConditionHub hub;
+
+    hub.publish(make_condition("EUR/USD", 0.80));
+    hub.publish(make_condition("BTCUSDT", 0.70));
+    const auto first_version = hub.scope_version(make_scope("EUR/USD"));
+    EXPECT_NE(first_version, 0u);
+    EXPECT_EQ(hub.scope_version(make_scope("GBP/USD")), 0u);
+
+    const auto scoped = std::make_shared<RecordingTradingConditionSubscriber>();
+    hub.add_scoped_subscriber(scoped, {make_scope("EUR/USD"), make_scope("GBP/USD")});
+
+    ASSERT_EQ(scoped->updates.size(), 1u);
+    EXPECT_EQ(scoped->updates[0].symbol, "EUR/USD");
+    EXPECT_DOUBLE_EQ(*scoped->updates[0].payout, 0.80);
+    EXPECT_EQ(hub.scoped_subscriber_count(make_scope("EUR/USD")), 1u);
+
+    hub.publish(make_condition("BTCUSDT", 0.72));
+    hub.publish(make_condition("EUR/USD", 0.80));
+    EXPECT_EQ(scoped->updates.size(), 1u);
+    EXPECT_EQ(hub.scope_version(make_scope("EUR/USD")), first_version);
+
+    hub.publish(make_condition("EUR/USD", 0.85));
+    ASSERT_EQ(scoped->updates.size(), 2u);
+    ASSERT_TRUE(scoped->updates[1].payout.has_value());
+    EXPECT_DOUBLE_EQ(*scoped->updates[1].payout, 0.85);
+    EXPECT_FALSE(scoped->updates[1].market_open.has_value());
+    EXPECT_GT(hub.scope_version(make_scope("EUR/USD")), first_version);
+
+    hub.publish(make_condition("GBP/USD", 0.78));
+    ASSERT_EQ(scoped->updates.size(), 3u);
+    EXPECT_EQ(scoped->updates[2].symbol, "GBP/USD");
+    ASSERT_TRUE(scoped->updates[2].market_open.has_value());
+
+    hub.remove_subscriber(scoped.get());
+    hub.publish(make_condition("EUR/USD", 0.90));
+    EXPECT_EQ(scoped->updates.size(), 3u);
+    EXPECT_EQ(hub.scoped_subscriber_count(make_scope("EUR/USD")), 0u);
+    EXPECT_DOUBLE_EQ(*hub.current_condition(make_scope("EUR/USD"))->payout, 0.90);
+}
+
+TEST(TradingConditionHub, PlainSubscribersDoNotSerializePublishers) {
+    optionx::components::TradingConditionHub hub;
+    std::promise<void> other_published;
+    auto other_future = other_published.get_future();
+    bool other_ready = false;
+
+    // A subscriber that waits for another thread's publish used to deadlock
+    // because publish() held a hub-wide lock across callbacks.
+    const auto blocking = std::make_shared<CallbackTradingConditionSubscriber>(
+        [&](const optionx::TradingConditionUpdate& update) {
+            if (update.symbol != "EUR/USD") return;
+            other_ready = other_future.wait_for(std::chrono::seconds(5)) ==
+                std::future_status::ready;
+        });
+    hub.add_subscriber(blocking);
+
+    std::thread other([&hub, &other_published]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        hub.publish(make_condition("BTCUSDT", 0.70));
+        other_published.set_value();
+    });
+    hub.publish(make_condition("EUR/USD", 0.80));
+    other.join();
+    EXPECT_TRUE(other_ready);
+}
+
+TEST(TradingConditionHub, ScopedDeltasPublishedFromCallbackKeepOrder) {
+    optionx::components::TradingConditionHub hub;
+    hub.publish(make_condition("EUR/USD", 0.80));
+
+    std::vector<double> payouts;
+    const auto subscriber = std::make_shared<CallbackTradingConditionSubscriber>(
+        [&](const optionx::TradingConditionUpdate& update) {
+            payouts.push_back(*update.payout);
+            if (payouts.size() == 1) {
+                hub.publish(make_condition("EUR/USD", 0.81));
+                hub.publish(make_condition("EUR/USD", 0.82));
+                // Re-entrant deltas wait until this callback returns.
+                EXPECT_EQ(payouts.size(), 1u);
+            }
+        });
+    hub.add_scoped_subscriber(subscriber, {make_scope("EUR/USD")});
+
+    ASSERT_EQ(payouts.size(), 3u);
+    EXPECT_DOUBLE_EQ(payouts[0], 0.80);
+    EXPECT_DOUBLE_EQ(payouts[1], 0.81);
+    EXPECT_DOUBLE_EQ(payouts[2], 0.82);
+}
+
+TEST(TradingConditionHub, ConcurrentPublishersDeliverScopedDeltasInOrder) {
+    optionx::components::TradingConditionHub hub;
+    hub.publish(make_condition("EUR/USD", 0.0));
+
+    std::mutex mutex;
+    optionx::TradingConditionUpdate merged = make_scope("EUR/USD");
+    std::size_t deliveries = 0;
+    const auto subscriber = std::make_shared<CallbackTradingConditionSubscriber>(
+        [&](const optionx::TradingConditionUpdate& update) {
+            std::lock_guard<std::mutex> lock(mutex);
+            merged.merge_patch(update);
+            ++deliveries;
+        });
+    hub.add_scoped_subscriber(subscriber, {make_scope("EUR/USD")});
+
+    constexpr int kThreads = 4;
+    constexpr int kUpdates = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&hub, t]() {
+            for (int i = 1; i <= kUpdates; ++i) {
+                auto update = make_scope("EUR/USD");
+                update.payout = static_cast<double>(t * kUpdates + i);
+                if (i % 3 == 0) update.market_open = (i % 2) == 0;
+                hub.publish(std::move(update));
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    // Applying the deltas in delivery order must rebuild the cached snapshot.
+    const auto current = hub.current_condition(make_scope("EUR/USD"));
+    ASSERT_TRUE(current.has_value());
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_GT(deliveries, 1u);
+    EXPECT_DOUBLE_EQ(*merged.payout, *current->payout);
+    EXPECT_EQ(*merged.market_open, *current->market_open);
+}
+
 TEST(TradingConditionHub, BindsToTradingConditionCallback) {
     optionx::components::TradingConditionHub hub;
     optionx::trading_condition_callback_t callback;
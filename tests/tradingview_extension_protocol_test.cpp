@@ -5,6 +5,7 @@
 
 #include <client_http.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <limits>
 #include <mutex>
@@ -745,6 +746,88 @@ TEST(TradingViewExtensionProtocol, AppliesConditionRuleForLevelAlert) {
     EXPECT_DOUBLE_EQ(result.parsed_payload.at("price").get<double>(), 1.14072);
 }
 
+TEST(TradingViewLevelRuleIndex, KeepsFirstMatchOrderAcrossBuckets) {
+    auto config = base_config();
+    config.level_alert_rules = {
+        TradingViewLevelAlertRule{{}, {}, "crossing_up", {}, {}, "buy", "wildcard_up"},
+        TradingViewLevelAlertRule{{}, "FX:EURUSD", {}, {}, {}, "sell", "eurusd_any"},
+        TradingViewLevelAlertRule{"42", "EURUSD", {}, {}, {}, "sell", "eurusd_alert_42"},
+        TradingViewLevelAlertRule{{}, "  FX:GBPUSD ", {}, {}, "Crossing", "buy", "gbpusd_text"}
+    };
+    const tv_protocol::protocol::LevelRuleIndex index(config);
+
+    tv_protocol::protocol::NormalizedEvent event;
+    event.original_symbol = "FX:EURUSD";
+    event.symbol = "EURUSD";
+    event.alert_id = "42";
+    event.condition_type = "crossing_down";
+    event.message = "EURUSD Crossing 1.1";
+
+    const auto* rule = index.find(event);
+    ASSERT_NE(rule, nullptr);
+    EXPECT_EQ(rule->signal_name, "eurusd_any");
+
+    event.condition_type = "crossing_up";
+    rule = index.find(event);
+    ASSERT_NE(rule, nullptr);
+    EXPECT_EQ(rule->signal_name, "wildcard_up");
+
+    event.original_symbol = "FX:GBPUSD";
+    event.symbol = "GBPUSD";
+    event.condition_type.clear();
+    rule = index.find(event);
+    ASSERT_NE(rule, nullptr);
+    EXPECT_EQ(rule->signal_name, "gbpusd_text");
+
+    event.original_symbol = "FX:USDJPY";
+    event.symbol = "USDJPY";
+    EXPECT_EQ(index.find(event), nullptr);
+
+    const auto stats = index.stats();
+    EXPECT_EQ(stats.rule_count, 4u);
+    EXPECT_EQ(stats.lookups, 4u);
+    EXPECT_EQ(stats.matches, 3u);
+    EXPECT_GT(stats.candidates_checked, 0u);
+    EXPECT_GE(stats.total_match_ns, stats.max_match_ns);
+}
+
+TEST(TradingViewLevelRuleIndex, AgreesWithLinearRuleScan) {
+    auto config = base_config();
+    const std::vector<std::string> symbols = {"FX:EURUSD", "EURUSD", "FX:GBPUSD", ""};
+    const std::vector<std::string> alert_ids = {"", "1", "2"};
+    const std::vector<std::string> conditions = {"", "crossing_up", "crossing"};
+    for (const auto& symbol : symbols) {
+        for (const auto& alert_id : alert_ids) {
+            for (const auto& condition : conditions) {
+                config.level_alert_rules.push_back(TradingViewLevelAlertRule{
+                    alert_id, symbol, condition, {}, {}, "buy",
+                    symbol + "/" + alert_id + "/" + condition});
+            }
+        }
+    }
+    std::reverse(config.level_alert_rules.begin(), config.level_alert_rules.end());
+    const tv_protocol::protocol::LevelRuleIndex index(config);
+
+    for (const auto& symbol : symbols) {
+        for (const auto& alert_id : alert_ids) {
+            for (const auto& condition : conditions) {
+                tv_protocol::protocol::NormalizedEvent event;
+                event.original_symbol = symbol;
+                event.symbol = symbol == "FX:EURUSD" ? "EURUSD" : symbol;
+                event.fire_id = alert_id;
+                event.condition_type = condition;
+
+                const auto* expected = tv_protocol::protocol::find_level_rule(config, event);
+                const auto* actual = index.find(event);
+                ASSERT_EQ(expected == nullptr, actual == nullptr);
+                if (expected) {
+                    EXPECT_EQ(expected->signal_name, actual->signal_name);
+                }
+            }
+        }
+    }
+}
+
 TEST(TradingViewExtensionProtocol, ParsesForwardedPrivateFeedPayload) {
     auto config = base_config();
     config.level_alert_rules.push_back(
@@ -1033,6 +1116,69 @@ TEST(TradingViewExtensionProtocol, CanDisableDefaultActionKeywords) {
     EXPECT_FALSE(result.signal);
 }
 
+TEST(TradingViewActionKeywordMatcher, RespectsAsciiWordBoundaries) {
+    const tv_protocol::TradingViewActionKeywordMatcher matcher(
+        {"buy", "call"},
+        {"sell", "put"});
+
+    EXPECT_EQ(matcher.classify("EURUSD BUY now"), optionx::OrderType::BUY);
+    EXPECT_EQ(matcher.classify("output_put"), optionx::OrderType::UNKNOWN);
+    EXPECT_EQ(matcher.classify("buyer callback"), optionx::OrderType::UNKNOWN);
+    EXPECT_EQ(matcher.classify("buyer, then SELL"), optionx::OrderType::SELL);
+    EXPECT_EQ(matcher.classify("buy/sell"), optionx::OrderType::UNKNOWN);
+    EXPECT_EQ(matcher.keyword_count(), 4u);
+}
+
+TEST(TradingViewActionKeywordMatcher, MatchesNonAsciiKeywordsAsSubstrings) {
+    auto config = base_config();
+    config.buy_action_keywords = {u8"  \u043F\u043E\u043A\u0443\u043F\u0430  "};
+    const auto matcher = tv_protocol::protocol::make_action_keyword_matcher(config);
+
+    EXPECT_EQ(
+        matcher.classify(u8"\u041F\u041E\u041A\u0423\u041F\u0410\u0422\u042C EURUSD"),
+        optionx::OrderType::BUY);
+    EXPECT_EQ(
+        matcher.classify(u8"\u0428\u043E\u0440\u0442 BTCUSD"),
+        optionx::OrderType::SELL);
+}
+
+TEST(TradingViewActionKeywordMatcher, AgreesWithReferenceKeywordScan) {
+    auto config = base_config();
+    config.buy_action_keywords = {"up", "bull", "go long"};
+    config.sell_action_keywords = {"down", "bear", "go short"};
+    const auto matcher = tv_protocol::protocol::make_action_keyword_matcher(config);
+    const auto buy = tv_protocol::protocol::effective_buy_action_keywords(config);
+    const auto sell = tv_protocol::protocol::effective_sell_action_keywords(config);
+
+    const std::vector<std::string> texts = {
+        "EURUSD crossing up 1.0850",
+        "markup and bullish",
+        "Go Long on BTCUSD",
+        "GO SHORTER",
+        "bear_trap buy",
+        u8"\u041B\u043E\u043D\u0433 and put",
+        "",
+        "   "
+    };
+    for (const auto& text : texts) {
+        std::uint8_t expected = 0;
+        if (tv_protocol::protocol::contains_any_action_keyword(text, buy)) {
+            expected |= tv_protocol::TradingViewActionKeywordMatcher::BUY_MASK;
+        }
+        if (tv_protocol::protocol::contains_any_action_keyword(text, sell)) {
+            expected |= tv_protocol::TradingViewActionKeywordMatcher::SELL_MASK;
+        }
+        EXPECT_EQ(matcher.match_mask(text), expected) << text;
+    }
+}
+
+TEST(TradingViewActionKeywordMatcher, EmptyMatcherNeverClassifies) {
+    const tv_protocol::TradingViewActionKeywordMatcher matcher;
+
+    EXPECT_TRUE(matcher.empty());
+    EXPECT_EQ(matcher.classify("BUY SELL"), optionx::OrderType::UNKNOWN);
+}
+
 TEST(TradingViewExtensionProtocol, IgnoresPriceAlertLifecycleMessages) {
     auto config = base_config();
 
@@ -1,11 +1,16 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <functional>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -121,6 +126,301 @@ TEST(FixedPointUtilsTest, PrecisionToleranceUsesHalfDecimalStep) {
         std::invalid_argument);
 }
 
+TEST(FixedPointUtilsTest, Decimal64ParsesAndComparesExactly) {
+    using optionx::utils::Decimal64;
+
+    const auto price = Decimal64::parse("1.084125", 5);
+    EXPECT_EQ(price.raw(), 108413);
+    EXPECT_EQ(price.to_string(), "1.08413");
+    EXPECT_EQ(Decimal64::parse("-0.000015", 5).raw(), -2);
+    EXPECT_EQ(Decimal64::parse("+12", 2).to_string(), "12.00");
+    EXPECT_EQ(Decimal64::parse(".5", 1).raw(), 5);
+    EXPECT_EQ(Decimal64::from_double(0.1 + 0.2, 2).to_string(), "0.30");
+    EXPECT_EQ(Decimal64::from_raw(-5, 3).to_string(), "-0.005");
+
+    Decimal64 parsed;
+    EXPECT_FALSE(Decimal64::try_parse("", 2, parsed));
+    EXPECT_FALSE(Decimal64::try_parse("1e5", 2, parsed));
+    EXPECT_FALSE(Decimal64::try_parse("1.2.3", 2, parsed));
+    EXPECT_FALSE(Decimal64::try_parse("99999999999999999999", 0, parsed));
+    EXPECT_THROW(Decimal64::parse("abc", 2), std::invalid_argument);
+
+    EXPECT_EQ(Decimal64::parse("1.5", 1), Decimal64::parse("1.50000", 5));
+    EXPECT_LT(Decimal64::parse("-1.00001", 5), Decimal64::parse("-1", 0));
+    EXPECT_GT(Decimal64::parse("2.00001", 5), Decimal64::parse("2", 0));
+    EXPECT_EQ(std::hash<Decimal64>()(Decimal64::parse("1.5", 1)),
+              std::hash<Decimal64>()(Decimal64::parse("1.50", 2)));
+
+    const auto sum = Decimal64::parse("0.1", 1) + Decimal64::parse("0.02", 2);
+    EXPECT_EQ(sum.to_string(), "0.12");
+    EXPECT_EQ((sum - Decimal64::parse("0.12", 2)).raw(), 0);
+    EXPECT_EQ(Decimal64::parse("1.08412", 5).rescale(3).to_string(), "1.084");
+    EXPECT_EQ(Decimal64::parse("-1.0845", 4).rescale(3).to_string(), "-1.085");
+    EXPECT_EQ(Decimal64::multiply(
+        Decimal64::parse("100", 2), Decimal64::parse("0.82", 2), 2).to_string(), "82.00");
+    EXPECT_THROW(Decimal64::from_raw(INT64_MAX, 0) + Decimal64::from_raw(1, 0), std::overflow_error);
+}
+
+TEST(FixedPointUtilsTest, Decimal64ParseRejectsOverflowAtInt64Max) {
+    using optionx::utils::Decimal64;
+
+    Decimal64 parsed;
+    ASSERT_TRUE(Decimal64::try_parse("9223372036854775807", 0, parsed));
+    EXPECT_EQ(parsed.raw(), INT64_MAX);
+    EXPECT_FALSE(Decimal64::try_parse("9223372036854775808", 0, parsed));
+    EXPECT_FALSE(Decimal64::try_parse("20000000000000000000", 0, parsed));
+    EXPECT_FALSE(Decimal64::try_parse("184467440737095516160", 0, parsed));
+
+    // Fraction digits.
+    ASSERT_TRUE(Decimal64::try_parse("922337203685477580.7", 1, parsed));
+    EXPECT_EQ(parsed.raw(), INT64_MAX);
+    EXPECT_FALSE(Decimal64::try_parse("922337203685477580.8", 1, parsed));
+    EXPECT_FALSE(Decimal64::try_parse("1844674407370955162.0", 1, parsed));
+    ASSERT_TRUE(Decimal64::try_parse("-92233720368.54775807", 8, parsed));
+    EXPECT_EQ(parsed.raw(), -INT64_MAX);
+    EXPECT_FALSE(Decimal64::try_parse("92233720368.54775808", 8, parsed));
+
+    // Zero padding of missing fraction digits.
+    EXPECT_FALSE(Decimal64::try_parse("2000000000000000000", 1, parsed));
+    ASSERT_TRUE(Decimal64::try_parse("922337203685477580", 1, parsed));
+    EXPECT_EQ(parsed.raw(), INT64_MAX - 7);
+    EXPECT_FALSE(Decimal64::try_parse("922337203685477581", 1, parsed));
+    EXPECT_FALSE(Decimal64::try_parse("184467440737", 8, parsed));
+    EXPECT_FALSE(Decimal64::try_parse("92233720369", 8, parsed));
+
+    // Rounding of extra fraction digits.
+    EXPECT_FALSE(Decimal64::try_parse("922337203685477580.75", 1, parsed));
+}
+
+TEST(FixedPointUtilsTest, Decimal64MultiplyRejectsOverflowBeforeScalingUp) {
+    using optionx::utils::Decimal64;
+
+    // 10^24 * 10^18 does not fit into __int128; the range check must come first.
+    const auto big = Decimal64::from_raw(1000000000000, 0);
+    EXPECT_THROW(Decimal64::multiply(big, big, 18), std::overflow_error);
+    EXPECT_THROW(Decimal64::multiply(big, Decimal64::from_raw(-1000000000000, 0), 18), std::overflow_error);
+
+    // Largest products that still fit after scaling up.
+    EXPECT_EQ(Decimal64::multiply(
+        Decimal64::from_raw(3, 0), Decimal64::from_raw(3, 0), 18).raw(), 9000000000000000000LL);
+    EXPECT_THROW(Decimal64::multiply(
+        Decimal64::from_raw(10, 0), Decimal64::from_raw(1, 0), 18), std::overflow_error);
+    EXPECT_EQ(Decimal64::multiply(
+        Decimal64::parse("1.5", 1), Decimal64::parse("-2", 0), 4).to_string(), "-3.0000");
+}
+
+TEST(FixedPointUtilsTest, PriceStoresSingleScaledInteger) {
+    using Price5 = optionx::utils::Price<5>;
+    static_assert(sizeof(Price5) == sizeof(std::int64_t), "Price must stay one int64.");
+
+    const auto bid = Price5::parse("1.08412");
+    const auto ask = Price5::from_double(1.08414);
+    EXPECT_EQ(bid.raw(), 108412);
+    EXPECT_EQ((ask - bid).raw(), 2);
+    EXPECT_EQ((ask - bid).to_string(), "0.00002");
+    EXPECT_TRUE(bid < ask);
+    EXPECT_DOUBLE_EQ(ask.to_double(), 1.08414);
+    EXPECT_EQ(Price5::from_decimal(optionx::utils::Decimal64::parse("1.084125", 6)), Price5::parse("1.08413"));
+    EXPECT_EQ(bid.to_decimal(), optionx::utils::Decimal64::parse("1.08412", 5));
+    EXPECT_EQ(std::hash<Price5>()(bid), std::hash<std::int64_t>()(108412));
+}
+
+TEST(Base64Test, EncodesAndDecodesRfc4648Vectors) {
+    using optionx::utils::Base64;
+    const std::pair<std::string, std::string> vectors[] = {
+        {"", ""}, {"f", "Zg=="}, {"fo", "Zm8="}, {"foo", "Zm9v"},
+        {"foob", "Zm9vYg=="}, {"fooba", "Zm9vYmE="}, {"foobar", "Zm9vYmFy"}
+    };
+    for (const auto& vector : vectors) {
+        EXPECT_EQ(Base64::encode(vector.first), vector.second);
+        EXPECT_EQ(Base64::decode(vector.second), vector.first);
+    }
+    EXPECT_EQ(Base64::decode("Zm9v=ignored"), "foo");
+    EXPECT_THROW(Base64::decode("Zm9v YmFy"), std::invalid_argument);
+}
+
+TEST(Base64Test, SimdKernelsMatchScalarKernel) {
+    namespace detail = optionx::utils::base64_detail;
+    std::vector<detail::SimdLevel> levels = {detail::SimdLevel::SCALAR};
+    if (detail::simd_level() != detail::SimdLevel::SCALAR) levels.push_back(detail::SimdLevel::SSSE3);
+    if (detail::simd_level() == detail::SimdLevel::AVX2) levels.push_back(detail::SimdLevel::AVX2);
+
+    for (std::size_t size = 0; size < 200; ++size) {
+        std::string bytes(size, '\0');
+        for (std::size_t i = 0; i < size; ++i) {
+            bytes[i] = static_cast<char>((i * 131 + size * 7) & 0xFF);
+        }
+        const std::string encoded = optionx::utils::Base64::encode(bytes);
+        ASSERT_EQ(encoded.size(), optionx::utils::Base64::encoded_size(size));
+
+        for (const auto level : levels) {
+            std::string text(encoded.size(), '\0');
+            if (size > 0) {
+                detail::encode(reinterpret_cast<const std::uint8_t*>(bytes.data()), size, &text[0], level);
+            }
+            EXPECT_EQ(text, encoded) << "size=" << size << " level=" << static_cast<int>(level);
+
+            const std::size_t chars = encoded.find('=') == std::string::npos ? encoded.size() : encoded.find('=');
+            std::string decoded(size, '\0');
+            if (chars > 0) {
+                detail::decode(encoded.data(), chars, reinterpret_cast<std::uint8_t*>(&decoded[0]), level);
+            }
+            EXPECT_EQ(decoded, bytes) << "size=" << size << " level=" << static_cast<int>(level);
+
+            if (chars > 0) {
+                std::string corrupted = encoded;
+                corrupted[chars / 2] = '\x80';
+                std::string out(size, '\0');
+                EXPECT_THROW(
+                    detail::decode(corrupted.data(), chars, reinterpret_cast<std::uint8_t*>(&out[0]), level),
+                    std::invalid_argument);
+            }
+        }
+    }
+}
+
+TEST(AesUtilsTest, DecryptIntoClearsOutputOnBadPadding) {
+    using optionx::crypto::AesMode;
+    std::array<std::uint8_t, 32> key{};
+    for (std::size_t i = 0; i < key.size(); ++i) key[i] = static_cast<std::uint8_t>(i);
+
+    const std::string plain = "fifteen bytes!!";
+    std::string cipher = optionx::crypto::encrypt(plain, key, AesMode::CFB_256);
+    std::string output = "previous secret";
+    optionx::crypto::decrypt_into(cipher.data(), cipher.size(), key, AesMode::CFB_256, output);
+    EXPECT_EQ(output, plain);
+
+    // CFB flips the same plaintext bit, turning the 0x01 padding byte into 0x41.
+    cipher.back() = static_cast<char>(cipher.back() ^ 0x40);
+    output = "previous secret";
+    EXPECT_THROW(
+        optionx::crypto::decrypt_into(cipher.data(), cipher.size(), key, AesMode::CFB_256, output),
+        std::invalid_argument);
+    EXPECT_TRUE(output.empty());
+}
+
+TEST(AsyncLogTest, DeferredFormattingMatchesPrintf) {
+    using optionx::utils::AsyncLogLevel;
+    auto& logger = optionx::utils::AsyncLogger::instance();
+    std::vector<std::string> lines;
+    logger.set_handler([&lines](AsyncLogLevel, std::int64_t, const std::string& message) {
+        lines.push_back(message);
+    });
+
+    const std::string symbol = "EURUSD";
+    const char* missing = nullptr;
+    OPTIONX_ASYNC_LOG_INFO("tick %s bid=%.5f ask=%8.3f id=%llu", symbol, 1.08412, 1.0843, 42ULL);
+    OPTIONX_ASYNC_LOG_WARN("%-6d|%05ld|%x|%c|%%|%*d|%s", -7, 12L, 255u, 'z', 4, 9, missing);
+    OPTIONX_ASYNC_LOG_ERROR("count=%s ratio=%d extra=%d", 3, 2.9);
+    OPTIONX_ASYNC_LOG_DEBUG("%s", std::string(400, 'x'));
+    logger.set_handler(nullptr);
+
+    ASSERT_EQ(lines.size(), 4u);
+    EXPECT_EQ(lines[0], "tick EURUSD bid=1.08412 ask=   1.084 id=42");
+    EXPECT_EQ(lines[1], "-7    |00012|ff|z|%|   9|(null)");
+    EXPECT_EQ(lines[2], "count=3 ratio=2 extra=%d");
+    EXPECT_EQ(lines[3].substr(lines[3].size() - 12), " [truncated]");
+    EXPECT_LT(lines[3].size(), 300u);
+}
+
+TEST(AsyncLogTest, WorkerDrainsPerThreadRings) {
+    using optionx::utils::AsyncLogLevel;
+    auto& logger = optionx::utils::AsyncLogger::instance();
+    std::mutex mutex;
+    std::vector<std::string> lines;
+    logger.set_handler([&](AsyncLogLevel, std::int64_t, const std::string& message) {
+        std::lock_guard<std::mutex> lock(mutex);
+        lines.push_back(message);
+    });
+
+    optionx::utils::AsyncLogConfig config;
+    config.ring_capacity = 1024;
+    config.min_level = AsyncLogLevel::DEBUG;
+    logger.start(config);
+    EXPECT_TRUE(logger.running());
+    const auto dropped_before = logger.dropped();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < 500; ++i) {
+                OPTIONX_ASYNC_LOG_TRACE("filtered %d", i);
+                OPTIONX_ASYNC_LOG_DEBUG("thread %d record %d", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    logger.stop();
+    EXPECT_FALSE(logger.running());
+    logger.set_level(optionx::utils::AsyncLogConfig().min_level);
+    logger.set_handler(nullptr);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(lines.size() + (logger.dropped() - dropped_before), 2000u);
+    if (logger.dropped() == dropped_before) {
+        EXPECT_EQ(std::count(lines.begin(), lines.end(), "thread 3 record 499"), 1);
+    }
+    for (const auto& line : lines) {
+        EXPECT_EQ(line.rfind("thread ", 0), 0u);
+    }
+}
+
+TEST(AsyncLogTest, StopKeepsRecordsOfConcurrentProducers) {
+    using optionx::utils::AsyncLogLevel;
+    auto& logger = optionx::utils::AsyncLogger::instance();
+    std::atomic<std::size_t> delivered{0};
+    logger.set_handler([&delivered](AsyncLogLevel, std::int64_t, const std::string&) {
+        delivered.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    constexpr int kThreads = 4;
+    constexpr int kRecords = 20000;
+    optionx::utils::AsyncLogConfig config;
+    config.ring_capacity = 1 << 16;
+    logger.start(config);
+    const auto dropped_before = logger.dropped();
+
+    std::atomic<int> started{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&started, t]() {
+            started.fetch_add(1);
+            for (int i = 0; i < kRecords; ++i) {
+                OPTIONX_ASYNC_LOG_INFO("thread %d record %d", t, i);
+            }
+        });
+    }
+    while (started.load() < kThreads) std::this_thread::yield();
+    logger.stop();
+    for (auto& thread : threads) thread.join();
+    logger.flush();
+    logger.set_handler(nullptr);
+
+    EXPECT_EQ(delivered.load() + (logger.dropped() - dropped_before),
+              static_cast<std::size_t>(kThreads * kRecords));
+}
+
+TEST(AsyncLogTest, DefaultsSkipTraceRecords) {
+    using optionx::utils::AsyncLogLevel;
+    auto& logger = optionx::utils::AsyncLogger::instance();
+    EXPECT_FALSE(logger.running());
+    EXPECT_FALSE(logger.is_enabled(AsyncLogLevel::TRACE));
+    EXPECT_TRUE(logger.is_enabled(AsyncLogLevel::DEBUG));
+
+    int evaluated = 0;
+    std::vector<std::string> lines;
+    logger.set_handler([&lines](AsyncLogLevel, std::int64_t, const std::string& message) {
+        lines.push_back(message);
+    });
+    // TRACE is compiled out by default, so its arguments are never evaluated.
+    OPTIONX_ASYNC_LOG_TRACE("trace %d", ++evaluated);
+    OPTIONX_ASYNC_LOG_DEBUG("debug %d", 1);
+    logger.set_handler(nullptr);
+    EXPECT_EQ(evaluated, 0);
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0], "debug 1");
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -1,5 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <optionx_cpp/utils.hpp>
 
 TEST(LogRedactionTest, RedactsNonEmptySecrets) {
@@ -25,6 +31,59 @@ TEST(LogRedactionTest, RedactsSecretFieldsInsideText) {
         "plain diagnostic text");
 }
 
+TEST(LogRedactionTest, CompiledRedactorReusesBufferAndMatchesCaseInsensitively) {
+    const optionx::utils::LogRedactor redactor({
+        {"api_key", optionx::utils::LogRedactor::ValueExtent::TOKEN},
+        {"set-cookie", optionx::utils::LogRedactor::ValueExtent::LINE}
+    });
+
+    std::string output = "stale content";
+    redactor.redact_to("API_KEY = 'abc def' my_api_key=keep", output);
+    EXPECT_EQ(output, "API_KEY = '***' my_api_key=keep");
+
+    redactor.redact_to("Set-Cookie: a=1; b=2\r\nHost: example", output);
+    EXPECT_EQ(output, "Set-Cookie: ***\r\nHost: example");
+
+    EXPECT_EQ(redactor.redact("token=abc"), "token=abc");
+    EXPECT_EQ(
+        optionx::utils::redact_secrets_in_text("X-API-TOKEN: abc&AUTH_TOKEN=def&tokens=ghi"),
+        "X-API-TOKEN: ***&AUTH_TOKEN=***&tokens=ghi");
+}
+
+TEST(AhoCorasickTest, ReportsOverlappingPatternsThroughOutputLinks) {
+    optionx::utils::AhoCorasickAutomaton automaton(true);
+    const std::vector<std::string> patterns = {"he", "She", "his", "hers"};
+    std::vector<std::uint32_t> terminals;
+    for (const auto& pattern : patterns) {
+        terminals.push_back(automaton.add_pattern(pattern));
+    }
+    EXPECT_EQ(automaton.add_pattern("HE"), terminals[0]);
+    EXPECT_EQ(automaton.add_pattern(""), optionx::utils::AhoCorasickAutomaton::ROOT);
+    automaton.build();
+    EXPECT_EQ(automaton.breadth_first_order().size() + 1, automaton.state_count());
+
+    const auto pattern_at = [&](std::uint32_t state) {
+        const auto it = std::find(terminals.begin(), terminals.end(), state);
+        return patterns[static_cast<std::size_t>(it - terminals.begin())];
+    };
+
+    const std::string text = "uSHErs";
+    std::vector<std::pair<std::size_t, std::string>> matches;
+    std::uint32_t state = optionx::utils::AhoCorasickAutomaton::ROOT;
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        state = automaton.next(state, text[i]);
+        for (auto s = automaton.is_terminal(state) ? state : automaton.output_link(state);
+             s != optionx::utils::AhoCorasickAutomaton::ROOT; s = automaton.output_link(s)) {
+            matches.emplace_back(i + 1 - automaton.depth(s), pattern_at(s));
+        }
+    }
+
+    const std::vector<std::pair<std::size_t, std::string>> expected = {
+        {1, "She"}, {2, "he"}, {2, "hers"}
+    };
+    EXPECT_EQ(matches, expected);
+}
+
 TEST(TaskManagerTest, RejectsInvalidPeriodicPeriods) {
     optionx::utils::TaskManager manager;
     auto callback = [](std::shared_ptr<optionx::utils::Task>) {};